@@ -476,6 +476,12 @@ macro(dune_probe_functions)
     "sys/types.h;sys/socket.h;winsock2.h"
     DUNE_SYS_HAS_SOCKET)
 
+  dune_test_function(recvmsg
+    "ssize_t"
+    "int;struct msghdr*;int"
+    "sys/types.h;sys/socket.h"
+    DUNE_SYS_HAS_RECVMSG)
+
   dune_test_function(WSAStartup
     "int"
     "WORD;WSADATA*"
@@ -752,4 +758,22 @@ macro(dune_probe_functions)
     "stdio.h"
     DUNE_SYS_HAS_POPEN)
 
+  dune_test_function(writev
+    "ssize_t"
+    "int;struct iovec*;int"
+    "sys/types.h;sys/uio.h"
+    DUNE_SYS_HAS_WRITEV)
+
+  dune_test_function(fdatasync
+    "int"
+    "int"
+    "unistd.h"
+    DUNE_SYS_HAS_FDATASYNC)
+
+  dune_test_function(fsync
+    "int"
+    "int"
+    "unistd.h"
+    DUNE_SYS_HAS_FSYNC)
+
 endmacro(dune_probe_functions)
@@ -107,8 +107,10 @@ macro(dune_probe_headers)
   dune_test_header(linux/i2c-dev.h)
   dune_test_header(linux/i2c.h)
   dune_test_header(linux/rtc.h)
+  dune_test_header(linux/serial.h)
   dune_test_header(linux/input.h)
   dune_test_header(linux/spi/spidev.h)
+  dune_test_header(linux/futex.h)
   dune_test_header(netdb.h)
   dune_test_header(pthread.h)
   dune_test_header(signal.h)
@@ -123,6 +125,7 @@ macro(dune_probe_headers)
   dune_test_header(sys/time.h)
   dune_test_header(sys/timex.h)
   dune_test_header(sys/types.h)
+  dune_test_header(sys/uio.h)
   dune_test_header(sys/file.h)
   dune_test_header(sys/wait.h)
   dune_test_header(sys/vfs.h)
@@ -0,0 +1,214 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+// Utility to convert scattered bathymetry points into a gridded raster     *
+// usable by Simulators.Environment.                                        *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+#include <DUNE/Simulation/Bathymetry.hpp>
+
+using DUNE_NAMESPACES;
+using DUNE::Simulation::Bathymetry;
+
+// Default cell size (m).
+static const double c_cell = 5.0;
+// Default interpolation radius (m).
+static const double c_radius = 10.0;
+// Cells per tile side.
+static const unsigned c_tile = 64;
+
+//! Scattered depth sounding.
+struct Sounding
+{
+  double north;
+  double east;
+  double depth;
+};
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 3)
+  {
+    std::cerr << "Usage: " << argv[0] << " <bathymetry.ini> <bathymetry.grid> [cell size] [radius]" << std::endl;
+    std::cerr << "Cells are filled by inverse distance weighting of the samples within radius (meters)." << std::endl;
+    return 1;
+  }
+
+  double cell = (argc > 3) ? std::atof(argv[3]) : c_cell;
+  double radius = (argc > 4) ? std::atof(argv[4]) : c_radius;
+  if (cell <= 0 || radius <= 0)
+  {
+    std::cerr << "ERROR: cell size and radius must be positive" << std::endl;
+    return 1;
+  }
+
+  Bathymetry::Layout layout;
+  std::vector<Sounding> samples;
+
+  try
+  {
+    Parsers::Config cfg(argv[1]);
+    std::vector<std::string> lines;
+    cfg.get("Bathymetry", "Data", "", lines);
+    cfg.get("Bathymetry", "Latitude (degrees)", "", layout.lat);
+    cfg.get("Bathymetry", "Longitude (degrees)", "", layout.lon);
+
+    for (unsigned i = 0; i < lines.size(); ++i)
+    {
+      std::vector<double> v;
+      String::split(lines[i], " ", v);
+      if (v.size() < 3)
+        continue;
+
+      Sounding s = {v[0], v[1], v[2]};
+      samples.push_back(s);
+    }
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  if (samples.empty())
+  {
+    std::cerr << "ERROR: no bathymetry data" << std::endl;
+    return 1;
+  }
+
+  double n_min = samples[0].north;
+  double n_max = n_min;
+  double e_min = samples[0].east;
+  double e_max = e_min;
+  for (size_t i = 1; i < samples.size(); ++i)
+  {
+    n_min = std::min(n_min, samples[i].north);
+    n_max = std::max(n_max, samples[i].north);
+    e_min = std::min(e_min, samples[i].east);
+    e_max = std::max(e_max, samples[i].east);
+  }
+
+  layout.lat = Angles::radians(layout.lat);
+  layout.lon = Angles::radians(layout.lon);
+  layout.north = n_min;
+  layout.east = e_min;
+  layout.cell = cell;
+  layout.rows = (unsigned)std::floor((n_max - n_min) / cell) + 1;
+  layout.cols = (unsigned)std::floor((e_max - e_min) / cell) + 1;
+  layout.tile = c_tile;
+
+  // Bucket samples by radius-sized squares.
+  unsigned b_rows = (unsigned)std::floor((n_max - n_min) / radius) + 1;
+  unsigned b_cols = (unsigned)std::floor((e_max - e_min) / radius) + 1;
+  std::vector<std::vector<size_t> > buckets(b_rows * b_cols);
+  for (size_t i = 0; i < samples.size(); ++i)
+  {
+    unsigned br = (unsigned)((samples[i].north - n_min) / radius);
+    unsigned bc = (unsigned)((samples[i].east - e_min) / radius);
+    buckets[br * b_cols + bc].push_back(i);
+  }
+
+  std::vector<float> depths((size_t)layout.rows * layout.cols, std::numeric_limits<float>::quiet_NaN());
+  size_t filled = 0;
+
+  for (unsigned r = 0; r < layout.rows; ++r)
+  {
+    double north = n_min + r * cell;
+    int br = (int)((north - n_min) / radius);
+
+    for (unsigned c = 0; c < layout.cols; ++c)
+    {
+      double east = e_min + c * cell;
+      int bc = (int)((east - e_min) / radius);
+
+      double sum = 0;
+      double total = 0;
+      bool exact = false;
+
+      for (int i = br - 1; i <= br + 1 && !exact; ++i)
+      {
+        for (int j = bc - 1; j <= bc + 1 && !exact; ++j)
+        {
+          if (i < 0 || j < 0 || i >= (int)b_rows || j >= (int)b_cols)
+            continue;
+
+          const std::vector<size_t>& bucket = buckets[i * b_cols + j];
+          for (size_t k = 0; k < bucket.size(); ++k)
+          {
+            const Sounding& s = samples[bucket[k]];
+            double d2 = (s.north - north) * (s.north - north) + (s.east - east) * (s.east - east);
+            if (d2 > radius * radius)
+              continue;
+
+            if (d2 < 1e-6)
+            {
+              sum = s.depth;
+              total = 1;
+              exact = true;
+              break;
+            }
+
+            sum += s.depth / d2;
+            total += 1 / d2;
+          }
+        }
+      }
+
+      if (total > 0)
+      {
+        depths[(size_t)r * layout.cols + c] = sum / total;
+        ++filled;
+      }
+    }
+  }
+
+  try
+  {
+    Bathymetry::write(argv[2], layout, depths);
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << samples.size() << " samples, "
+            << layout.rows << " x " << layout.cols << " cells of " << cell << " m, "
+            << filled << " with data" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,842 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef BENCH_BENCHMARKS_HPP_INCLUDED_
+#define BENCH_BENCHMARKS_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Harness.hpp"
+
+using namespace DUNE;
+
+//! Create a navigation state with plausible values.
+//! @param[in] i sample index.
+//! @return message.
+static IMC::EstimatedState*
+makeEstimatedState(unsigned i)
+{
+  IMC::EstimatedState* msg = new IMC::EstimatedState;
+  msg->setTimeStamp(1.46e9 + i * 0.1);
+  msg->setSource(0x2000);
+  msg->setSourceEntity(30);
+  msg->lat = 0.7188 + i * 1e-8;
+  msg->lon = -0.1516 - i * 1e-8;
+  msg->height = 0.5;
+  msg->x = i * 0.15;
+  msg->y = i * 0.05;
+  msg->z = 2.0 + (i % 10) * 0.01;
+  msg->phi = 0.01;
+  msg->theta = -0.02;
+  msg->psi = 1.2 + (i % 100) * 0.001;
+  msg->u = 1.5;
+  msg->depth = msg->z;
+  msg->alt = 10.0 - (i % 10) * 0.01;
+  return msg;
+}
+
+//! Create a sidescan ping.
+//! @param[in] size number of data bytes.
+//! @return message.
+static IMC::SonarData*
+makeSonarData(unsigned size)
+{
+  IMC::SonarData* msg = new IMC::SonarData;
+  msg->setTimeStamp(1.46e9);
+  msg->type = IMC::SonarData::ST_SIDESCAN;
+  msg->frequency = 770000;
+  msg->max_range = 30;
+  msg->bits_per_point = 8;
+  msg->scale_factor = 1.0f;
+  msg->data.resize(size);
+  for (unsigned i = 0; i < size; ++i)
+    msg->data[i] = (char)((i * 37) ^ (i >> 3));
+  return msg;
+}
+
+//! Create a system announcement.
+//! @return message.
+static IMC::Announce*
+makeAnnounce(void)
+{
+  IMC::Announce* msg = new IMC::Announce;
+  msg->setTimeStamp(1.46e9);
+  msg->sys_name = "lauv-xplore-1";
+  msg->sys_type = IMC::SYSTEMTYPE_UUV;
+  msg->lat = 0.7188;
+  msg->lon = -0.1516;
+  msg->services = "dune://0.0.0.0/uid/1294925553839635/;"
+    "dune://0.0.0.0/version/2016.05.0/;"
+    "imc+udp://10.0.10.80:6002/;"
+    "imc+tcp://10.0.10.80:6002/;"
+    "http://10.0.10.80:8080/dune;";
+  return msg;
+}
+
+//! Serialize a message to a buffer.
+class PacketSerialize: public Benchmark
+{
+public:
+  PacketSerialize(IMC::Message* msg):
+    Benchmark(std::string("imc.serialize.") + msg->getName(), msg->getSerializationSize()),
+    m_msg(msg)
+  { }
+
+  ~PacketSerialize(void)
+  {
+    delete m_msg;
+  }
+
+  void
+  run(unsigned count)
+  {
+    unsigned total = 0;
+    for (unsigned i = 0; i < count; ++i)
+      total += IMC::Packet::serialize(m_msg, m_bfr, sizeof(m_bfr));
+    g_sink += total;
+  }
+
+private:
+  IMC::Message* m_msg;
+  uint8_t m_bfr[DUNE_IMC_CONST_MAX_SIZE];
+};
+
+//! Deserialize a message from a buffer.
+class PacketDeserialize: public Benchmark
+{
+public:
+  PacketDeserialize(IMC::Message* msg):
+    Benchmark(std::string("imc.deserialize.") + msg->getName(), msg->getSerializationSize()),
+    m_msg(msg)
+  { }
+
+  ~PacketDeserialize(void)
+  {
+    delete m_msg;
+  }
+
+  void
+  setup(void)
+  {
+    m_size = IMC::Packet::serialize(m_msg, m_bfr, sizeof(m_bfr));
+  }
+
+  void
+  run(unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      IMC::Message* msg = IMC::Packet::deserialize(m_bfr, m_size);
+      g_sink += msg->getTimeStamp();
+      delete msg;
+    }
+  }
+
+private:
+  IMC::Message* m_msg;
+  uint8_t m_bfr[DUNE_IMC_CONST_MAX_SIZE];
+  uint16_t m_size;
+};
+
+//! Task stub that queues received messages like Tasks::Task.
+class StubTask: public Tasks::AbstractTask
+{
+public:
+  StubTask(Tasks::Context& ctx):
+    m_recipient(this, ctx),
+    m_count(0)
+  {
+    m_recipient.bind(IMC::EstimatedState::getIdStatic(),
+                     new Tasks::Consumer<StubTask, IMC::EstimatedState>(*this, &StubTask::consume));
+  }
+
+  void
+  receive(const IMC::Message* msg)
+  {
+    m_recipient.put(msg);
+  }
+
+  void
+  consume(const IMC::EstimatedState* msg)
+  {
+    m_count += msg->x > 0;
+  }
+
+  void
+  drain(void)
+  {
+    m_recipient.runCallBacks();
+  }
+
+  const char*
+  getName(void) const
+  {
+    return "Bench";
+  }
+
+  void inf(const char*, ...) { }
+  void war(const char*, ...) { }
+  void err(const char*, ...) { }
+  void cri(const char*, ...) { }
+  void debug(const char*, ...) { }
+  void trace(const char*, ...) { }
+  void spew(const char*, ...) { }
+
+private:
+  Tasks::Recipient m_recipient;
+  unsigned m_count;
+
+  void
+  run(void)
+  { }
+};
+
+//! Dispatch messages through the bus to a number of recipients and
+//! run their consumers.
+class BusDispatch: public Benchmark
+{
+public:
+  BusDispatch(unsigned fanout):
+    Benchmark(Utils::String::str("imc.bus.dispatch.%u", fanout)),
+    m_fanout(fanout),
+    m_msg(NULL)
+  { }
+
+  void
+  setup(void)
+  {
+    m_ctx = new Tasks::Context;
+    for (unsigned i = 0; i < m_fanout; ++i)
+      m_tasks.push_back(new StubTask(*m_ctx));
+    m_msg = makeEstimatedState(1);
+  }
+
+  void
+  teardown(void)
+  {
+    for (unsigned i = 0; i < m_tasks.size(); ++i)
+      delete m_tasks[i];
+    m_tasks.clear();
+    delete m_msg;
+    delete m_ctx;
+  }
+
+  void
+  run(unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      m_ctx->mbus.dispatch(m_msg);
+
+      // Keep queues short as running tasks would.
+      if ((i & 63) == 63)
+        drain();
+    }
+
+    drain();
+  }
+
+private:
+  unsigned m_fanout;
+  Tasks::Context* m_ctx;
+  std::vector<StubTask*> m_tasks;
+  IMC::Message* m_msg;
+
+  void
+  drain(void)
+  {
+    for (unsigned i = 0; i < m_tasks.size(); ++i)
+      m_tasks[i]->drain();
+  }
+};
+
+//! Queue and consume messages in a single recipient.
+class RecipientQueue: public Benchmark
+{
+public:
+  RecipientQueue(void):
+    Benchmark("tasks.recipient.queue"),
+    m_msg(NULL)
+  { }
+
+  void
+  setup(void)
+  {
+    m_ctx = new Tasks::Context;
+    m_task = new StubTask(*m_ctx);
+    m_msg = makeEstimatedState(1);
+  }
+
+  void
+  teardown(void)
+  {
+    delete m_task;
+    delete m_msg;
+    delete m_ctx;
+  }
+
+  void
+  run(unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      m_task->receive(m_msg);
+      if ((i & 63) == 63)
+        m_task->drain();
+    }
+
+    m_task->drain();
+  }
+
+private:
+  Tasks::Context* m_ctx;
+  StubTask* m_task;
+  IMC::Message* m_msg;
+};
+
+//! CRC16 of a 1 KiB block.
+class CRC16Block: public Benchmark
+{
+public:
+  CRC16Block(void):
+    Benchmark("algorithms.crc16.1k", sizeof(m_data))
+  {
+    for (unsigned i = 0; i < sizeof(m_data); ++i)
+      m_data[i] = (uint8_t)(i * 7);
+  }
+
+  void
+  run(unsigned count)
+  {
+    uint16_t crc = 0;
+    for (unsigned i = 0; i < count; ++i)
+      crc = Algorithms::CRC16::compute(m_data, sizeof(m_data), crc);
+    g_sink += crc;
+  }
+
+private:
+  uint8_t m_data[1024];
+};
+
+//! Matrix operations.
+class MatrixOperation: public Benchmark
+{
+public:
+  enum Operation
+  {
+    OP_MULTIPLY,
+    OP_INVERSE
+  };
+
+  MatrixOperation(Operation op, unsigned size):
+    Benchmark(Utils::String::str("math.matrix.%s.%u", op == OP_MULTIPLY ? "multiply" : "inverse", size)),
+    m_op(op),
+    m_a(size, size),
+    m_b(size, size)
+  {
+    for (unsigned i = 0; i < size; ++i)
+    {
+      for (unsigned j = 0; j < size; ++j)
+      {
+        m_a(i, j) = (i == j ? size : 0) + 1.0 / (1 + i + j);
+        m_b(i, j) = (double)((i * 3 + j) % 7) - 3.0;
+      }
+    }
+  }
+
+  void
+  run(unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      Math::Matrix r = (m_op == OP_MULTIPLY) ? m_a * m_b : inverse(m_a);
+      g_sink += r(0, 0);
+    }
+  }
+
+private:
+  Operation m_op;
+  Math::Matrix m_a;
+  Math::Matrix m_b;
+};
+
+//! Prediction and correction of a Kalman filter.
+class KalmanStep: public Benchmark
+{
+public:
+  KalmanStep(unsigned states, unsigned outputs,
+             Navigation::KalmanFilter::UpdateMode mode = Navigation::KalmanFilter::UPDATE_BATCH):
+    Benchmark(Utils::String::str("navigation.kalman.step.%ux%u%s", states, outputs,
+                                 mode == Navigation::KalmanFilter::UPDATE_SEQUENTIAL ? ".sequential" : "")),
+    m_states(states),
+    m_outputs(outputs),
+    m_mode(mode)
+  { }
+
+  void
+  setup(void)
+  {
+    m_kal.reset(m_states, m_outputs);
+    m_kal.setUpdateMode(m_mode);
+    m_kal.setProcessNoise(1e-3);
+    m_kal.setMeasurementNoise(0.1);
+    m_kal.setCovariance(1.0);
+
+    Math::Matrix a(m_states, m_states);
+    a.identity();
+    for (unsigned i = 0; i + 1 < m_states; i += 2)
+      a(i, i + 1) = 0.1;
+    m_kal.setStateTransition(a);
+
+    for (unsigned i = 0; i < m_outputs; ++i)
+      m_kal.setObservation(i, (i * 2) % m_states, 1.0);
+  }
+
+  void
+  run(unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      m_kal.predict();
+      for (unsigned j = 0; j < m_outputs; ++j)
+        m_kal.setInnovation(j, 0.01 * (double)((i + j) % 5));
+      m_kal.update(0);
+    }
+
+    g_sink += m_kal.getState(0);
+  }
+
+private:
+  Navigation::KalmanFilter m_kal;
+  unsigned m_states;
+  unsigned m_outputs;
+  Navigation::KalmanFilter::UpdateMode m_mode;
+};
+
+//! Geodetic conversions.
+class GeodeticConversion: public Benchmark
+{
+public:
+  enum Conversion
+  {
+    CONV_DISPLACEMENT,
+    CONV_DISPLACE,
+    CONV_FRAME_EXACT,
+    CONV_FRAME_FAST
+  };
+
+  GeodeticConversion(Conversion conv):
+    Benchmark(std::string("coordinates.") + c_names[conv]),
+    m_conv(conv),
+    m_frame(c_lat, c_lon, 0, conv == CONV_FRAME_FAST ? Coordinates::LocalFrame::MODE_FAST :
+            Coordinates::LocalFrame::MODE_EXACT)
+  { }
+
+  void
+  run(unsigned count)
+  {
+    double sum = 0;
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      double lat = c_lat + (i % 1000) * 1e-6;
+      double lon = c_lon - (i % 997) * 1e-6;
+      double n = 0;
+      double e = 0;
+
+      switch (m_conv)
+      {
+        case CONV_DISPLACEMENT:
+          Coordinates::WGS84::displacement(c_lat, c_lon, 0.0, lat, lon, 0.0, &n, &e);
+          break;
+        case CONV_DISPLACE:
+          {
+            double hae = 0;
+            n = (i % 1000) * 2.0;
+            e = (i % 997) * -2.0;
+            Coordinates::WGS84::displace(n, e, 0.0, &lat, &lon, &hae);
+            n = lat;
+            e = lon;
+          }
+          break;
+        case CONV_FRAME_EXACT:
+        case CONV_FRAME_FAST:
+          m_frame.toNED(lat, lon, 0, n, e);
+          break;
+      }
+
+      sum += n + e;
+    }
+
+    g_sink += sum;
+  }
+
+private:
+  static const double c_lat;
+  static const double c_lon;
+  static const char* c_names[];
+  Conversion m_conv;
+  Coordinates::LocalFrame m_frame;
+};
+
+const double GeodeticConversion::c_lat = 0.7188;
+const double GeodeticConversion::c_lon = -0.1516;
+const char* GeodeticConversion::c_names[] =
+{
+  "wgs84.displacement",
+  "wgs84.displace",
+  "local_frame.exact",
+  "local_frame.fast"
+};
+
+//! Batch conversion of geodetic coordinates with a local frame.
+class GeodeticBatch: public Benchmark
+{
+public:
+  GeodeticBatch(Coordinates::LocalFrame::Mode mode):
+    Benchmark(mode == Coordinates::LocalFrame::MODE_FAST ?
+              "coordinates.local_frame.fast.batch" : "coordinates.local_frame.exact.batch"),
+    m_frame(0.7188, -0.1516, 30.0, mode)
+  { }
+
+  void
+  setup(void)
+  {
+    m_lat.resize(c_points);
+    m_lon.resize(c_points);
+    m_hae.resize(c_points);
+    m_n.resize(c_points);
+    m_e.resize(c_points);
+    m_d.resize(c_points);
+
+    for (unsigned i = 0; i < c_points; ++i)
+    {
+      m_lat[i] = m_frame.getLatitude() + (i % 997) * 1e-6;
+      m_lon[i] = m_frame.getLongitude() - (i % 991) * 1e-6;
+      m_hae[i] = i % 13;
+    }
+  }
+
+  void
+  run(unsigned count)
+  {
+    for (unsigned done = 0; done < count; done += c_points)
+    {
+      unsigned n = std::min(count - done, c_points);
+      m_frame.toNED(n, &m_lat[0], &m_lon[0], &m_hae[0], &m_n[0], &m_e[0], &m_d[0]);
+      g_sink += m_n[0] + m_e[n - 1];
+    }
+  }
+
+private:
+  static const unsigned c_points = 1024;
+  Coordinates::LocalFrame m_frame;
+  std::vector<double> m_lat;
+  std::vector<double> m_lon;
+  std::vector<double> m_hae;
+  std::vector<double> m_n;
+  std::vector<double> m_e;
+  std::vector<double> m_d;
+};
+
+//! Fill a buffer with serialized navigation data.
+//! @param[out] data buffer.
+//! @param[in] size minimum number of bytes.
+static void
+makeLogData(std::vector<char>& data, unsigned size)
+{
+  uint8_t bfr[DUNE_IMC_CONST_MAX_SIZE];
+  data.clear();
+
+  for (unsigned i = 0; data.size() < size; ++i)
+  {
+    IMC::EstimatedState* msg = makeEstimatedState(i);
+    uint16_t n = IMC::Packet::serialize(msg, bfr, sizeof(bfr));
+    data.insert(data.end(), (char*)bfr, (char*)bfr + n);
+    delete msg;
+  }
+
+  data.resize(size);
+}
+
+//! Compression or decompression of a block of log data.
+class CompressionCodec: public Benchmark
+{
+public:
+  //! Constructor.
+  //! @param[in] method compression method.
+  //! @param[in] compress true to compress, false to decompress.
+  //! @param[in] input data to compress, empty to use synthetic
+  //! navigation data.
+  CompressionCodec(Compression::Methods method, bool compress, const std::vector<char>& input):
+    Benchmark(std::string("compression.") + Compression::Factory::method(method)
+              + (compress ? ".compress" : ".decompress"),
+              input.empty() ? c_size : input.size()),
+    m_method(method),
+    m_compress(compress),
+    m_compressor(NULL),
+    m_decompressor(NULL),
+    m_input(input),
+    m_ratio(0)
+  { }
+
+  double
+  getRatio(void) const
+  {
+    return m_ratio;
+  }
+
+  void
+  setup(void)
+  {
+    if (m_input.empty())
+      makeLogData(m_data, c_size);
+    else
+      m_data = m_input;
+
+    m_compressor = Compression::Factory::compressor(m_method);
+    m_decompressor = Compression::Factory::decompressor(m_method);
+    m_compressor->compress(m_packed, &m_data[0], m_data.size());
+    m_ratio = (double)m_data.size() / m_packed.getSize();
+    m_output.resize(2 * m_data.size() + 1024);
+  }
+
+  void
+  teardown(void)
+  {
+    delete m_compressor;
+    delete m_decompressor;
+  }
+
+  void
+  run(unsigned count)
+  {
+    for (unsigned i = 0; i < count; ++i)
+    {
+      if (m_compress)
+      {
+        m_compressor->compress(&m_output[0], m_output.size(), &m_data[0], m_data.size());
+        g_sink += m_compressor->compressed();
+      }
+      else
+      {
+        m_decompressor->decompress(&m_output[0], m_output.size(), m_packed.getBufferSigned(), m_packed.getSize());
+        g_sink += m_decompressor->decompressed();
+      }
+    }
+  }
+
+private:
+  static const unsigned c_size = 64 * 1024;
+  Compression::Methods m_method;
+  bool m_compress;
+  Compression::Compressor* m_compressor;
+  Compression::Decompressor* m_decompressor;
+  const std::vector<char>& m_input;
+  std::vector<char> m_data;
+  std::vector<char> m_output;
+  Utils::ByteBuffer m_packed;
+  double m_ratio;
+};
+
+//! Writing and reading of LSF log files.
+class LogFile: public Benchmark
+{
+public:
+  LogFile(const FileSystem::Path& dir, bool write):
+    Benchmark(write ? "lsf.write" : "lsf.read"),
+    m_path(dir / "dune-bench.lsf"),
+    m_write(write)
+  { }
+
+  void
+  setup(void)
+  {
+    for (unsigned i = 0; i < c_messages; ++i)
+      m_msgs.push_back(makeEstimatedState(i));
+
+    m_bytes = m_msgs[0]->getSerializationSize();
+
+    if (!m_write)
+      writeFile(c_messages);
+  }
+
+  void
+  teardown(void)
+  {
+    for (unsigned i = 0; i < m_msgs.size(); ++i)
+      delete m_msgs[i];
+    m_msgs.clear();
+    m_path.remove();
+  }
+
+  void
+  run(unsigned count)
+  {
+    if (m_write)
+    {
+      writeFile(count);
+      return;
+    }
+
+    unsigned done = 0;
+    Utils::ByteBuffer bfr;
+
+    while (done < count)
+    {
+      std::ifstream ifs(m_path.c_str(), std::ios::binary);
+      IMC::Message* msg = NULL;
+      while (done < count && (msg = IMC::Packet::deserialize(ifs, bfr)) != NULL)
+      {
+        g_sink += msg->getTimeStamp();
+        delete msg;
+        ++done;
+      }
+    }
+  }
+
+private:
+  static const unsigned c_messages = 4096;
+  FileSystem::Path m_path;
+  bool m_write;
+  std::vector<IMC::Message*> m_msgs;
+
+  void
+  writeFile(unsigned count)
+  {
+    std::ofstream ofs(m_path.c_str(), std::ios::binary | std::ios::trunc);
+    for (unsigned i = 0; i < count; ++i)
+      IMC::Packet::serialize(m_msgs[i % m_msgs.size()], ofs);
+  }
+};
+
+//! Writing of compressed LSF log files.
+class CompressedLogFile: public Benchmark
+{
+public:
+  //! Constructor.
+  //! @param[in] dir directory for temporary files.
+  //! @param[in] method compression method.
+  //! @param[in] threads number of compression threads.
+  CompressedLogFile(const FileSystem::Path& dir, Compression::Methods method, unsigned threads):
+    Benchmark(Utils::String::str("lsf.write.%s.t%u", Compression::Factory::method(method).c_str(), threads)),
+    m_path(dir / "dune-bench.lsf"),
+    m_method(method),
+    m_threads(threads),
+    m_msg(NULL)
+  { }
+
+  void
+  setup(void)
+  {
+    m_msg = makeEstimatedState(1);
+    m_bytes = m_msg->getSerializationSize();
+  }
+
+  void
+  teardown(void)
+  {
+    delete m_msg;
+    m_path.remove();
+  }
+
+  void
+  run(unsigned count)
+  {
+    Compression::FileOutput ofs(m_path.c_str(), m_method, m_threads);
+    for (unsigned i = 0; i < count; ++i)
+      IMC::Packet::serialize(m_msg, ofs);
+  }
+
+private:
+  FileSystem::Path m_path;
+  Compression::Methods m_method;
+  unsigned m_threads;
+  IMC::Message* m_msg;
+};
+
+//! Register all benchmarks.
+//! @param[in] harness benchmark harness.
+//! @param[in] dir directory for temporary files.
+//! @param[in] input compression input, empty to use synthetic data.
+static void
+registerBenchmarks(Harness& harness, const FileSystem::Path& dir, const std::vector<char>& input)
+{
+  harness.add(new PacketSerialize(makeEstimatedState(1)));
+  harness.add(new PacketDeserialize(makeEstimatedState(1)));
+  harness.add(new PacketSerialize(makeSonarData(4000)));
+  harness.add(new PacketDeserialize(makeSonarData(4000)));
+  harness.add(new PacketSerialize(makeAnnounce()));
+  harness.add(new PacketDeserialize(makeAnnounce()));
+
+  harness.add(new BusDispatch(1));
+  harness.add(new BusDispatch(8));
+  harness.add(new RecipientQueue);
+
+  harness.add(new CRC16Block);
+
+  harness.add(new MatrixOperation(MatrixOperation::OP_MULTIPLY, 6));
+  harness.add(new MatrixOperation(MatrixOperation::OP_MULTIPLY, 12));
+  harness.add(new MatrixOperation(MatrixOperation::OP_INVERSE, 6));
+
+  harness.add(new KalmanStep(9, 3));
+  harness.add(new KalmanStep(18, 6));
+  harness.add(new KalmanStep(9, 3, Navigation::KalmanFilter::UPDATE_SEQUENTIAL));
+  harness.add(new KalmanStep(18, 6, Navigation::KalmanFilter::UPDATE_SEQUENTIAL));
+
+  harness.add(new GeodeticConversion(GeodeticConversion::CONV_DISPLACEMENT));
+  harness.add(new GeodeticConversion(GeodeticConversion::CONV_DISPLACE));
+  harness.add(new GeodeticConversion(GeodeticConversion::CONV_FRAME_EXACT));
+  harness.add(new GeodeticConversion(GeodeticConversion::CONV_FRAME_FAST));
+  harness.add(new GeodeticBatch(Coordinates::LocalFrame::MODE_EXACT));
+  harness.add(new GeodeticBatch(Coordinates::LocalFrame::MODE_FAST));
+
+  for (int m = 0; m < Compression::METHOD_UNKNOWN; ++m)
+  {
+    harness.add(new CompressionCodec((Compression::Methods)m, true, input));
+    harness.add(new CompressionCodec((Compression::Methods)m, false, input));
+  }
+
+  harness.add(new LogFile(dir, true));
+  harness.add(new LogFile(dir, false));
+
+  harness.add(new CompressedLogFile(dir, Compression::METHOD_GZIP, 0));
+  harness.add(new CompressedLogFile(dir, Compression::METHOD_GZIP, 4));
+  harness.add(new CompressedLogFile(dir, Compression::METHOD_BZIP2, 0));
+  harness.add(new CompressedLogFile(dir, Compression::METHOD_BZIP2, 4));
+}
+
+#endif
@@ -0,0 +1,315 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef BENCH_HARNESS_HPP_INCLUDED_
+#define BENCH_HARNESS_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+//! Sink for computed values, keeps the compiler from discarding
+//! benchmarked code.
+static volatile double g_sink = 0;
+
+//! Single benchmark.
+class Benchmark
+{
+public:
+  //! Constructor.
+  //! @param[in] name benchmark name.
+  //! @param[in] bytes bytes processed by each operation, zero if
+  //! throughput is not meaningful.
+  Benchmark(const std::string& name, unsigned bytes = 0):
+    m_name(name),
+    m_bytes(bytes)
+  { }
+
+  virtual
+  ~Benchmark(void)
+  { }
+
+  //! Get benchmark name.
+  //! @return benchmark name.
+  const std::string&
+  getName(void) const
+  {
+    return m_name;
+  }
+
+  //! Get bytes processed by each operation.
+  //! @return number of bytes.
+  unsigned
+  getBytes(void) const
+  {
+    return m_bytes;
+  }
+
+  //! Get the ratio between input and output sizes of each
+  //! operation, for benchmarks that transform data.
+  //! @return size ratio, zero if not meaningful.
+  virtual double
+  getRatio(void) const
+  {
+    return 0;
+  }
+
+  //! Prepare benchmark data.
+  virtual void
+  setup(void)
+  { }
+
+  //! Release benchmark data.
+  virtual void
+  teardown(void)
+  { }
+
+  //! Execute a number of operations.
+  //! @param[in] count number of operations.
+  virtual void
+  run(unsigned count) = 0;
+
+protected:
+  //! Benchmark name.
+  std::string m_name;
+  //! Bytes processed by each operation.
+  unsigned m_bytes;
+};
+
+//! Timing of one benchmark.
+struct Result
+{
+  //! Benchmark name.
+  std::string name;
+  //! Operations per repetition.
+  unsigned iterations;
+  //! Bytes processed by each operation.
+  unsigned bytes;
+  //! Ratio between input and output sizes.
+  double ratio;
+  //! Time per operation of each repetition (ns).
+  std::vector<double> samples;
+  //! Statistics of time per operation (ns).
+  double mean;
+  double stddev;
+  double min;
+  double median;
+  double p90;
+  double p99;
+  double max;
+};
+
+//! Runs benchmarks: each one is calibrated to run for a minimum
+//! amount of time per repetition, then run for a number of warmup
+//! repetitions whose timings are discarded, and finally timed for a
+//! number of repetitions.
+class Harness
+{
+public:
+  //! Constructor.
+  //! @param[in] warmup number of warmup repetitions.
+  //! @param[in] repetitions number of timed repetitions.
+  //! @param[in] min_time minimum duration of each repetition (s).
+  Harness(unsigned warmup, unsigned repetitions, double min_time):
+    m_warmup(warmup),
+    m_repetitions(std::max(repetitions, 1u)),
+    m_min_time(min_time)
+  { }
+
+  ~Harness(void)
+  {
+    for (unsigned i = 0; i < m_benchmarks.size(); ++i)
+      delete m_benchmarks[i];
+  }
+
+  //! Add a benchmark. The harness takes ownership.
+  //! @param[in] benchmark benchmark.
+  void
+  add(Benchmark* benchmark)
+  {
+    m_benchmarks.push_back(benchmark);
+  }
+
+  //! Get benchmark names.
+  //! @return benchmark names.
+  std::vector<std::string>
+  getNames(void) const
+  {
+    std::vector<std::string> names;
+    for (unsigned i = 0; i < m_benchmarks.size(); ++i)
+      names.push_back(m_benchmarks[i]->getName());
+    return names;
+  }
+
+  //! Run benchmarks whose name contains a given string.
+  //! @param[in] filter name filter, empty to run all.
+  //! @param[in] log progress output.
+  void
+  run(const std::string& filter, std::FILE* log)
+  {
+    for (unsigned i = 0; i < m_benchmarks.size(); ++i)
+    {
+      Benchmark* b = m_benchmarks[i];
+      if (!filter.empty() && b->getName().find(filter) == std::string::npos)
+        continue;
+
+      b->setup();
+      Result r = measure(b);
+      b->teardown();
+
+      std::fprintf(log, "%-40s %12.1f ns %12.1f ns %12.1f ns", r.name.c_str(), r.median, r.p90, r.max);
+      if (r.bytes)
+        std::fprintf(log, " %10.1f MB/s", r.bytes / r.median * 1e3);
+      if (r.ratio > 0)
+        std::fprintf(log, " %8.2f:1", r.ratio);
+      std::fprintf(log, "\n");
+
+      m_results.push_back(r);
+    }
+  }
+
+  //! Write results in JSON format.
+  //! @param[in] os output stream.
+  void
+  writeJSON(std::ostream& os) const
+  {
+    os << "{\n"
+       << "  \"version\": \"" << DUNE::getFullVersion() << "\",\n"
+       << "  \"time\": " << (uint64_t)DUNE::Time::Clock::getSinceEpoch() << ",\n"
+       << "  \"warmup\": " << m_warmup << ",\n"
+       << "  \"repetitions\": " << m_repetitions << ",\n"
+       << "  \"benchmarks\": [";
+
+    for (unsigned i = 0; i < m_results.size(); ++i)
+    {
+      const Result& r = m_results[i];
+      os << (i ? ",\n" : "\n")
+         << "    {\n"
+         << "      \"name\": \"" << r.name << "\",\n"
+         << "      \"iterations\": " << r.iterations << ",\n"
+         << "      \"bytes\": " << r.bytes << ",\n"
+         << DUNE::Utils::String::str("      \"ratio\": %.3f,\n", r.ratio)
+         << DUNE::Utils::String::str("      \"mean_ns\": %.3f,\n", r.mean)
+         << DUNE::Utils::String::str("      \"stddev_ns\": %.3f,\n", r.stddev)
+         << DUNE::Utils::String::str("      \"min_ns\": %.3f,\n", r.min)
+         << DUNE::Utils::String::str("      \"median_ns\": %.3f,\n", r.median)
+         << DUNE::Utils::String::str("      \"p90_ns\": %.3f,\n", r.p90)
+         << DUNE::Utils::String::str("      \"p99_ns\": %.3f,\n", r.p99)
+         << DUNE::Utils::String::str("      \"max_ns\": %.3f\n", r.max)
+         << "    }";
+    }
+
+    os << "\n  ]\n}\n";
+  }
+
+private:
+  //! Benchmarks.
+  std::vector<Benchmark*> m_benchmarks;
+  //! Results.
+  std::vector<Result> m_results;
+  //! Number of warmup repetitions.
+  unsigned m_warmup;
+  //! Number of timed repetitions.
+  unsigned m_repetitions;
+  //! Minimum duration of each repetition.
+  double m_min_time;
+
+  //! Time a number of operations.
+  //! @param[in] b benchmark.
+  //! @param[in] count number of operations.
+  //! @return elapsed time (ns).
+  static double
+  time(Benchmark* b, unsigned count)
+  {
+    uint64_t start = DUNE::Time::Clock::getNsec();
+    b->run(count);
+    return (double)(DUNE::Time::Clock::getNsec() - start);
+  }
+
+  //! Get a percentile of sorted samples.
+  //! @param[in] sorted sorted samples.
+  //! @param[in] p percentile (0 to 100).
+  //! @return sample value.
+  static double
+  percentile(const std::vector<double>& sorted, double p)
+  {
+    double rank = p / 100.0 * (sorted.size() - 1);
+    unsigned lo = (unsigned)std::floor(rank);
+    unsigned hi = (unsigned)std::ceil(rank);
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (rank - lo);
+  }
+
+  Result
+  measure(Benchmark* b)
+  {
+    Result r;
+    r.name = b->getName();
+    r.bytes = b->getBytes();
+    r.ratio = b->getRatio();
+
+    // Calibrate number of operations per repetition.
+    unsigned count = 1;
+    while (count < (1u << 30) && time(b, count) < m_min_time * 1e9)
+      count *= 2;
+    r.iterations = count;
+
+    for (unsigned i = 0; i < m_warmup; ++i)
+      time(b, count);
+
+    for (unsigned i = 0; i < m_repetitions; ++i)
+      r.samples.push_back(time(b, count) / count);
+
+    std::vector<double> sorted(r.samples);
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0;
+    for (unsigned i = 0; i < sorted.size(); ++i)
+      sum += sorted[i];
+    r.mean = sum / sorted.size();
+
+    double var = 0;
+    for (unsigned i = 0; i < sorted.size(); ++i)
+      var += (sorted[i] - r.mean) * (sorted[i] - r.mean);
+    r.stddev = std::sqrt(var / sorted.size());
+
+    r.min = sorted.front();
+    r.max = sorted.back();
+    r.median = percentile(sorted, 50);
+    r.p90 = percentile(sorted, 90);
+    r.p99 = percentile(sorted, 99);
+    return r;
+  }
+};
+
+#endif
@@ -0,0 +1,15 @@
+add_executable(dune-bench EXCLUDE_FROM_ALL programs/bench/bench.cpp)
+set_target_properties(dune-bench PROPERTIES COMPILE_FLAGS "${DUNE_CXX_FLAGS}")
+target_link_libraries(dune-bench dune-core ${DUNE_SYS_LIBS} ${DUNE_VENDOR_LIBS})
+
+# Run benchmarks and compare against a stored baseline.
+set(DUNE_BENCH_BASELINE "" CACHE FILEPATH "Baseline results for dune-bench-check")
+
+if(DUNE_PROGRAM_PYTHON AND DUNE_BENCH_BASELINE)
+  add_custom_target(dune-bench-check
+    COMMAND dune-bench -o ${CMAKE_BINARY_DIR}/dune-bench.json -d ${CMAKE_BINARY_DIR}
+    COMMAND ${DUNE_PROGRAM_PYTHON}
+    ${PROJECT_SOURCE_DIR}/programs/scripts/dune-bench-compare.py
+    ${DUNE_BENCH_BASELINE} ${CMAKE_BINARY_DIR}/dune-bench.json
+    DEPENDS dune-bench)
+endif(DUNE_PROGRAM_PYTHON AND DUNE_BENCH_BASELINE)
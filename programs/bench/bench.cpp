@@ -0,0 +1,159 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Harness.hpp"
+#include "Benchmarks.hpp"
+
+static void
+usage(const char* program)
+{
+  std::fprintf(stderr,
+               "Usage: %s [options]\n"
+               "  -f <name>     run benchmarks whose name contains <name>\n"
+               "  -r <count>    number of timed repetitions (default: 15)\n"
+               "  -w <count>    number of warmup repetitions (default: 3)\n"
+               "  -t <seconds>  minimum duration of each repetition (default: 0.01)\n"
+               "  -o <file>     write results in JSON format to <file>\n"
+               "  -d <folder>   folder for temporary files (default: current)\n"
+               "  -i <file>     use <file> (e.g., an LSF log) as compression input\n"
+               "  -l            list benchmarks\n",
+               program);
+}
+
+int
+main(int argc, char** argv)
+{
+  std::string filter;
+  std::string output;
+  std::string dir(".");
+  std::string input_file;
+  unsigned repetitions = 15;
+  unsigned warmup = 3;
+  double min_time = 0.01;
+  bool list = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string opt(argv[i]);
+
+    if (opt == "-l")
+    {
+      list = true;
+      continue;
+    }
+
+    if (i + 1 >= argc)
+    {
+      usage(argv[0]);
+      return 1;
+    }
+
+    const char* arg = argv[++i];
+
+    if (opt == "-f")
+      filter = arg;
+    else if (opt == "-r")
+      repetitions = std::atoi(arg);
+    else if (opt == "-w")
+      warmup = std::atoi(arg);
+    else if (opt == "-t")
+      min_time = std::atof(arg);
+    else if (opt == "-o")
+      output = arg;
+    else if (opt == "-d")
+      dir = arg;
+    else if (opt == "-i")
+      input_file = arg;
+    else
+    {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  std::vector<char> input;
+  if (!input_file.empty())
+  {
+    std::ifstream ifs(input_file.c_str(), std::ios::binary);
+    input.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    if (input.empty())
+    {
+      std::fprintf(stderr, "ERROR: failed to read '%s'\n", input_file.c_str());
+      return 1;
+    }
+  }
+
+  Harness harness(warmup, repetitions, min_time);
+  registerBenchmarks(harness, DUNE::FileSystem::Path(dir), input);
+
+  if (list)
+  {
+    std::vector<std::string> names = harness.getNames();
+    for (unsigned i = 0; i < names.size(); ++i)
+      std::printf("%s\n", names[i].c_str());
+    return 0;
+  }
+
+  std::fprintf(stdout, "%-40s %15s %15s %15s\n", "Benchmark", "Median", "90th", "Maximum");
+
+  try
+  {
+    harness.run(filter, stdout);
+  }
+  catch (std::exception& e)
+  {
+    std::fprintf(stderr, "ERROR: %s\n", e.what());
+    return 1;
+  }
+
+  if (!output.empty())
+  {
+    std::ofstream ofs(output.c_str());
+    harness.writeJSON(ofs);
+    if (!ofs)
+    {
+      std::fprintf(stderr, "ERROR: failed to write '%s'\n", output.c_str());
+      return 1;
+    }
+  }
+
+  return 0;
+}
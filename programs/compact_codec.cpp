@@ -0,0 +1,263 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+// Utility to measure the compression ratio of the compact IMC encoding     *
+// on LSF log files.                                                        *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Maximum size of the trained dictionary.
+static const unsigned c_dict_size = 16384;
+// Maximum number of samples of each message used to train the
+// dictionary.
+static const unsigned c_dict_samples = 8;
+
+//! Encoding statistics of one message type.
+struct Statistics
+{
+  Statistics(void):
+    count(0),
+    imc(0),
+    compact(0),
+    dictionary(0)
+  { }
+
+  // Number of messages.
+  unsigned count;
+  // Bytes using the IMC serialization.
+  uint64_t imc;
+  // Bytes using the compact encoding.
+  uint64_t compact;
+  // Bytes using the compact encoding with the dictionary.
+  uint64_t dictionary;
+};
+
+//! Open a (possibly compressed) LSF file.
+static std::istream*
+openLog(const char* fname)
+{
+  Compression::Methods method = Compression::Factory::detect(fname);
+  if (method == Compression::METHOD_UNKNOWN)
+    return new std::ifstream(fname, std::ios::binary);
+
+  return new Compression::FileInput(fname, method);
+}
+
+//! Build a dictionary with the fields of the first messages of each
+//! type. Deflate gives more weight to the end of the dictionary,
+//! where the most frequent messages are placed.
+static void
+trainDictionary(const char* fname, std::vector<char>& dict)
+{
+  std::map<uint16_t, unsigned> samples;
+  std::map<unsigned, std::vector<char> > chunks;
+  std::vector<uint8_t> fields;
+  std::istream* is = openLog(fname);
+  IMC::Message* msg = NULL;
+  unsigned total = 0;
+
+  try
+  {
+    while (total < c_dict_size && (msg = IMC::Packet::deserialize(*is)) != 0)
+    {
+      if (samples[msg->getId()]++ < c_dict_samples)
+      {
+        fields.resize(msg->getPayloadSerializationSize() + 1);
+        msg->serializeFields(&fields[0]);
+        chunks[msg->getId()].insert(chunks[msg->getId()].end(), fields.begin(), fields.end() - 1);
+        total += fields.size() - 1;
+      }
+
+      delete msg;
+    }
+  }
+  catch (std::runtime_error& e)
+  {
+    std::cerr << "WARNING: " << e.what() << std::endl;
+  }
+
+  delete is;
+
+  // Order chunks by message frequency, most frequent last.
+  std::multimap<unsigned, uint16_t> order;
+  std::map<uint16_t, unsigned>::iterator itr = samples.begin();
+  for (; itr != samples.end(); ++itr)
+    order.insert(std::make_pair(itr->second, itr->first));
+
+  std::multimap<unsigned, uint16_t>::iterator oitr = order.begin();
+  for (; oitr != order.end(); ++oitr)
+  {
+    std::vector<char>& chunk = chunks[oitr->second];
+    dict.insert(dict.end(), chunk.begin(), chunk.end());
+  }
+
+  if (dict.size() > c_dict_size)
+    dict.erase(dict.begin(), dict.end() - c_dict_size);
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " <Data.lsf[.gz]> ... <Data.lsf[.gz]>" << std::endl;
+    std::cerr << "The dictionary is trained with the first messages of the first log." << std::endl;
+    return 1;
+  }
+
+  std::vector<char> dict;
+  trainDictionary(argv[1], dict);
+
+  IMC::CompactCodec plain;
+  IMC::CompactCodec deflated;
+  deflated.setDictionary(dict);
+
+  std::map<std::string, Statistics> stats;
+  Statistics total;
+  ByteBuffer bfr;
+  double max_time_error = 0;
+  unsigned failures = 0;
+  double elapsed = 0;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::istream* is = openLog(argv[i]);
+    IMC::Message* msg = NULL;
+    bool first = true;
+
+    try
+    {
+      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      {
+        // Use the first message of each log as reference.
+        if (first)
+        {
+          IMC::Header ref;
+          ref.timestamp = msg->getTimeStamp();
+          ref.src = msg->getSource();
+          ref.src_ent = DUNE_IMC_CONST_UNK_EID;
+          ref.dst = DUNE_IMC_CONST_NULL_ID;
+          ref.dst_ent = DUNE_IMC_CONST_UNK_EID;
+          plain.setReference(ref);
+          deflated.setReference(ref);
+          first = false;
+        }
+
+        Statistics& st = stats[msg->getName()];
+        ++st.count;
+        st.imc += msg->getSerializationSize();
+
+        double start = Clock::get();
+        st.compact += plain.encode(msg, bfr);
+        IMC::Message* dec = plain.decode(bfr.getBuffer(), bfr.getSize());
+        elapsed += Clock::get() - start;
+
+        if (dec->getId() != msg->getId() || dec->getSource() != msg->getSource())
+          ++failures;
+
+        max_time_error = std::max(max_time_error, std::fabs(dec->getTimeStamp() - msg->getTimeStamp()));
+        delete dec;
+
+        st.dictionary += deflated.encode(msg, bfr);
+        dec = deflated.decode(bfr.getBuffer(), bfr.getSize());
+        if (dec->getId() != msg->getId())
+          ++failures;
+        delete dec;
+
+        delete msg;
+      }
+    }
+    catch (std::runtime_error& e)
+    {
+      std::cerr << "WARNING: " << argv[i] << ": " << e.what() << std::endl;
+    }
+
+    delete is;
+  }
+
+  std::cout << std::setw(24) << std::left << "Message"
+            << std::setw(10) << std::right << "Count"
+            << std::setw(12) << "IMC"
+            << std::setw(12) << "Compact"
+            << std::setw(8) << "Ratio"
+            << std::setw(12) << "Dictionary"
+            << std::setw(8) << "Ratio" << std::endl;
+
+  std::cout << std::fixed << std::setprecision(2);
+
+  std::map<std::string, Statistics>::iterator itr = stats.begin();
+  for (; itr != stats.end(); ++itr)
+  {
+    const Statistics& st = itr->second;
+    std::cout << std::setw(24) << std::left << itr->first
+              << std::setw(10) << std::right << st.count
+              << std::setw(12) << st.imc
+              << std::setw(12) << st.compact
+              << std::setw(8) << (double)st.imc / st.compact
+              << std::setw(12) << st.dictionary
+              << std::setw(8) << (double)st.imc / st.dictionary << std::endl;
+
+    total.count += st.count;
+    total.imc += st.imc;
+    total.compact += st.compact;
+    total.dictionary += st.dictionary;
+  }
+
+  if (total.count == 0)
+    return 1;
+
+  std::cout << std::setw(24) << std::left << "Total"
+            << std::setw(10) << std::right << total.count
+            << std::setw(12) << total.imc
+            << std::setw(12) << total.compact
+            << std::setw(8) << (double)total.imc / total.compact
+            << std::setw(12) << total.dictionary
+            << std::setw(8) << (double)total.imc / total.dictionary << std::endl;
+
+  std::cout << std::endl
+            << "Dictionary size: " << dict.size() << " bytes" << std::endl
+            << "Maximum time stamp error: " << max_time_error << " s" << std::endl
+            << "Compact encode/decode throughput: "
+            << (total.count / elapsed) << " messages/s" << std::endl
+            << "Decoding failures: " << failures << std::endl;
+
+  return failures == 0 ? 0 : 1;
+}
@@ -54,10 +54,9 @@ main(int32_t argc, char** argv)
   }
 
   ByteBuffer buffer;
+  ByteBuffer packet;
   std::ofstream lsf("FilteredData.lsf", std::ios::binary);
 
-  IMC::Message* msg;
-
   uint32_t accum = 0;
 
   bool done_first = false;
@@ -85,30 +84,27 @@ main(int32_t argc, char** argv)
 
     try
     {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      uint16_t size;
+      while ((size = IMC::Packet::read(*is, packet)) != 0)
       {
+        // Only the header is decoded, selected packets are copied verbatim.
+        IMC::MessageView view(packet.getBuffer(), size);
+
         if (!done_first)
         {
           // place an empty estimatedstate message in the log
           IMC::EstimatedState state;
-          state.setTimeStamp(msg->getTimeStamp());
+          state.setTimeStamp(view.getTimeStamp());
           IMC::Packet::serialize(&state, buffer);
           lsf.write(buffer.getBufferSigned(), buffer.getSize());
           done_first = true;
         }
 
-        std::set<uint32_t>::const_iterator it;
-        it = ids.find(msg->getId());
-
-        if (it != ids.end())
+        if (ids.find(view.getId()) != ids.end())
         {
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
-
+          lsf.write(packet.getBufferSigned(), size);
           ++i;
         }
-
-        delete msg;
       }
     }
     catch (std::runtime_error& e)
@@ -164,7 +164,7 @@ class Function:
     def __str__(self):
         out = ''
 
-        if self._static:
+        if self._static and self._class is None:
             out += 'static '
 
         if self._rett is not None:
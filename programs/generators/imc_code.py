@@ -363,6 +363,174 @@ class Message:
         return len(self._node.findall("field[@type='message']")) + \
                len(self._node.findall("field[@type='message-list']"))
 
+class View:
+    def __init__(self, root, node, hpp, cpp, consts):
+        self._node = node
+        self._consts = consts
+        abbrev = node.get('abbrev')
+        name = abbrev + 'View'
+        messages = [m.get('abbrev') for m in root.findall('message')]
+        fields = node.findall('field')
+
+        public = []
+
+        # getIdStatic()
+        f = Function('getIdStatic', 'uint16_t', static = True, inline = True)
+        f.body('return %(id)s;' % node.attrib)
+        public.append(f)
+
+        # measure()
+        f = Function('measure', 'uint16_t', [Var('bfr__', 'const uint8_t*'), Var('size__', 'unsigned'), Var('reversed__', 'bool')], static = True)
+        if self.has_fields():
+            f.add_body('const uint8_t* ptr__ = bfr__;')
+            f.add_body('const uint8_t* end__ = bfr__ + size__;')
+            for step in self.get_steps(fields):
+                f.add_body(self.get_skip(step, 'reversed__'))
+            if len(self.get_variable_fields()) == 0:
+                f.add_body('(void)reversed__;')
+            f.add_body('return ptr__ - bfr__;')
+        else:
+            f.add_body('(void)bfr__;\n(void)size__;\n(void)reversed__;')
+            f.add_body('return 0;')
+        public.append(f)
+
+        # getSubId()
+        f = Function('getSubId', 'uint16_t', const = True, inline = True)
+        subid = node.find("field/[@abbrev='id']")
+        if subid is not None and subid.get('type') in consts['fixed_types']:
+            f.body('return id();')
+        else:
+            f.body('return 0;')
+        public.append(f)
+
+        # toMessage()
+        f = Function('toMessage', abbrev + '*', const = True, inline = True)
+        f.body('return static_cast<%s*>(MessageView::toMessage());' % abbrev)
+        public.append(f)
+
+        # getFieldsStatic(): fixed size fields at a constant offset.
+        f = Function('getFieldsStatic', 'const MessageView::Field*', static = True)
+        f.add_body('static const Field fields__[] =\n{')
+        for i, field in enumerate(fields):
+            ftype = field.get('type')
+            steps = self.get_steps(fields[0:i])
+            if ftype not in consts['fixed_types'] or len(steps) > 1:
+                continue
+            if len(steps) == 1 and steps[0][0] != 'fixed':
+                continue
+            offset = 0 if len(steps) == 0 else steps[0][1]
+            ft = 'FT_' + ftype.replace('_t', '').upper()
+            f.add_body('{"%s", %s, %d},' % (field.get('abbrev'), ft, offset))
+        f.add_body('{NULL, FT_UINT8, 0}\n};')
+        f.add_body('return fields__;')
+        public.append(f)
+
+        # Field accessors.
+        for i, field in enumerate(fields):
+            ftype = field.get('type')
+            msg_type = field.get('message-type')
+            typed = False
+            if ftype == 'plaintext' or ftype == 'rawdata':
+                rett = 'DataView'
+                value = 'readData(%s)'
+            elif ftype == 'message' and msg_type in messages:
+                rett = msg_type + 'View'
+                value = rett + '(readInline(%s))'
+                typed = True
+            elif ftype == 'message':
+                rett = 'MessageView'
+                value = 'readInline(%s)'
+            elif ftype == 'message-list':
+                rett = 'MessageListView'
+                value = 'readList(%s)'
+            else:
+                rett = ftype
+                value = 'read<' + ftype + '>(%s)'
+
+            # Fields at a constant offset are accessed directly, the
+            # others after skipping the preceding variable size fields.
+            steps = self.get_steps(fields[0:i])
+            if len(steps) == 0:
+                f = Function(get_name(field), rett, const = True, inline = not typed)
+                f.body('return ' + value % 'getPayload()' + ';')
+            elif len(steps) == 1 and steps[0][0] == 'fixed':
+                f = Function(get_name(field), rett, const = True, inline = not typed)
+                f.body('return ' + value % ('getPayload() + %d' % steps[0][1]) + ';')
+            else:
+                f = Function(get_name(field), rett, const = True)
+                f.add_body('const uint8_t* ptr__ = getPayload();')
+                f.add_body('const uint8_t* end__ = getPayloadEnd();')
+                for step in steps:
+                    if step[0] == 'fixed':
+                        f.add_body('ptr__ += %d;' % step[1])
+                    else:
+                        f.add_body(self.get_skip(step, 'isReversed()'))
+                f.add_body('return ' + value % 'ptr__' + ';')
+            public.append((field.get('name'), f))
+
+        # HPP.
+        hpp.append(comment('Read-only view of %s' % node.get('name'), nl = ''))
+        hpp.append('class %s: public MessageView' % name)
+        hpp.append('{')
+        hpp.append('public:')
+        hpp.append(comment('Create a null view', nl = ''))
+        hpp.append('%s(void)\n{ }\n' % name)
+        hpp.append(comment('Wrap a serialized packet', nl = ''))
+        hpp.append('%s(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)' % name)
+        hpp.append('{\ncheckId(getIdStatic());\n}\n')
+        hpp.append(comment('Narrow a generic view', nl = ''))
+        hpp.append('explicit\n%s(const MessageView& view__): MessageView(view__)' % name)
+        hpp.append('{\ncheckId(getIdStatic());\n}\n')
+
+        for item in public:
+            if type(item) is tuple:
+                hpp.append(comment(item[0], nl = ''))
+                item = item[1]
+            if item.is_inline():
+                hpp.append(item)
+            else:
+                hpp.append(item.decl())
+
+        hpp.append('};\n')
+
+        # CPP.
+        for item in public:
+            if type(item) is tuple:
+                item = item[1]
+            if not item.is_inline():
+                item.set_class(name)
+                cpp.append(item)
+
+    # Group consecutive fixed size fields into a single step.
+    def get_steps(self, fields):
+        steps = []
+        for field in fields:
+            ftype = field.get('type')
+            if ftype in self._consts['variable_types']:
+                steps.append((ftype, 0))
+            elif len(steps) > 0 and steps[-1][0] == 'fixed':
+                steps[-1] = ('fixed', steps[-1][1] + self._consts['sizes'][ftype])
+            else:
+                steps.append(('fixed', self._consts['sizes'][ftype]))
+        return steps
+
+    def get_skip(self, step, reversed):
+        if step[0] == 'fixed':
+            return 'ptr__ = skip(ptr__, end__, %d);' % step[1]
+        elif step[0] == 'message':
+            return 'ptr__ = skipInline(ptr__, end__, %s);' % reversed
+        elif step[0] == 'message-list':
+            return 'ptr__ = skipList(ptr__, end__, %s);' % reversed
+        else:
+            return 'ptr__ = skipData(ptr__, end__, %s);' % reversed
+
+    def get_variable_fields(self):
+        return [field for field in self._node.findall('field')
+                if field.get('type') in self._consts['variable_types']]
+
+    def has_fields(self):
+        return len(self._node.findall('field')) > 0
+
 # Parse command line arguments.
 import argparse
 parser = argparse.ArgumentParser(
@@ -555,3 +723,21 @@ for abbrev in abbrevs:
     Message(root, msg, hpp, cpp, consts)
 hpp.write()
 cpp.write()
+
+################################################################################
+# Views.hpp                                                                    #
+################################################################################
+hpp = File('Views.hpp', dest_folder, md5 = xml_md5)
+hpp.add_dune_headers('Config.hpp', 'IMC/MessageView.hpp', 'IMC/Definitions.hpp')
+
+################################################################################
+# Views.cpp                                                                    #
+################################################################################
+cpp = File('Views.cpp', dest_folder, md5 = xml_md5)
+cpp.add_dune_headers('IMC/Views.hpp')
+
+for abbrev in abbrevs:
+    msg = root.find("message[@abbrev='%s']" % abbrev)
+    View(root, msg, hpp, cpp, consts)
+hpp.write()
+cpp.write()
@@ -0,0 +1,88 @@
+# -*- coding: utf-8 -*-
+############################################################################
+# Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      #
+# Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  #
+############################################################################
+# This file is part of DUNE: Unified Navigation Environment.               #
+#                                                                          #
+# Commercial Licence Usage                                                 #
+# Licencees holding valid commercial DUNE licences may use this file in    #
+# accordance with the commercial licence agreement provided with the       #
+# Software or, alternatively, in accordance with the terms contained in a  #
+# written agreement between you and Universidade do Porto. For licensing   #
+# terms, conditions, and further information contact lsts@fe.up.pt.        #
+#                                                                          #
+# European Union Public Licence - EUPL v.1.1 Usage                         #
+# Alternatively, this file may be used under the terms of the EUPL,        #
+# Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       #
+# included in the packaging of this file. You may not use this work        #
+# except in compliance with the Licence. Unless required by applicable     #
+# law or agreed to in writing, software distributed under the Licence is   #
+# distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     #
+# ANY KIND, either express or implied. See the Licence for the specific    #
+# language governing permissions and limitations at                        #
+# http://ec.europa.eu/idabc/eupl.html.                                     #
+############################################################################
+# Author: agent                                                            #
+############################################################################
+# Compare dune-bench results against a baseline and flag regressions.      #
+############################################################################
+
+from __future__ import print_function
+
+import argparse
+import json
+import sys
+
+def load(path):
+    '''Load benchmark results indexed by name.'''
+    with open(path) as fd:
+        data = json.load(fd)
+    return dict((b['name'], b) for b in data['benchmarks'])
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare dune-bench results.')
+    parser.add_argument('baseline', help='baseline results (JSON)')
+    parser.add_argument('current', help='current results (JSON)')
+    parser.add_argument('-t', '--threshold', type=float, default=10.0,
+                        help='regression threshold in percent (default: 10)')
+    parser.add_argument('-m', '--metric', default='median_ns',
+                        help='statistic to compare (default: median_ns)')
+    args = parser.parse_args()
+
+    base = load(args.baseline)
+    curr = load(args.current)
+    regressions = []
+
+    print('%-40s %12s %12s %8s' % ('Benchmark', 'Baseline', 'Current', 'Change'))
+    for name in sorted(set(base) | set(curr)):
+        if name not in curr:
+            print('%-40s %12.1f %12s %8s' % (name, base[name][args.metric], '-', 'missing'))
+            continue
+        if name not in base:
+            print('%-40s %12s %12.1f %8s' % (name, '-', curr[name][args.metric], 'new'))
+            continue
+
+        old = base[name][args.metric]
+        new = curr[name][args.metric]
+        change = (new - old) / old * 100.0 if old > 0 else 0.0
+
+        # A change is only a regression if it exceeds the threshold and
+        # the noise measured in both runs.
+        noise = max(base[name].get('stddev_ns', 0), curr[name].get('stddev_ns', 0))
+        regressed = change > args.threshold and (new - old) > 2 * noise
+        mark = ' REGRESSION' if regressed else ''
+        print('%-40s %12.1f %12.1f %+7.1f%%%s' % (name, old, new, change, mark))
+
+        if regressed:
+            regressions.append(name)
+
+    if regressions:
+        print('\n%d benchmark(s) regressed more than %.1f%%: %s' %
+              (len(regressions), args.threshold, ', '.join(regressions)))
+        return 1
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
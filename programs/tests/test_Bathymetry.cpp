@@ -0,0 +1,137 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+#include <DUNE/Simulation/Bathymetry.hpp>
+
+using DUNE_NAMESPACES;
+using DUNE::Simulation::Bathymetry;
+
+// Local headers.
+#include "Test.hpp"
+
+int
+main(void)
+{
+  Test test("Simulation::Bathymetry");
+
+  Path path("test_Bathymetry.grid");
+
+  // Sloping bottom: 10 m deep at the first row, 1 m deeper per row.
+  Bathymetry::Layout layout;
+  layout.lat = 0.71;
+  layout.lon = -0.15;
+  layout.north = -100;
+  layout.east = 50;
+  layout.cell = 2;
+  layout.rows = 70;
+  layout.cols = 45;
+  layout.tile = 16;
+
+  std::vector<float> depths(layout.rows * layout.cols);
+  for (unsigned r = 0; r < layout.rows; ++r)
+    for (unsigned c = 0; c < layout.cols; ++c)
+      depths[r * layout.cols + c] = 10.0f + r;
+
+  depths[3 * layout.cols + 3] = std::numeric_limits<float>::quiet_NaN();
+  Bathymetry::write(path, layout, depths);
+
+  {
+    Bathymetry grid(path);
+    const Bathymetry::Layout& l = grid.getLayout();
+    test.boolean("layout is preserved",
+                 l.lat == layout.lat && l.lon == layout.lon && l.north == layout.north
+                 && l.east == layout.east && l.cell == layout.cell && l.rows == layout.rows
+                 && l.cols == layout.cols && l.tile == layout.tile);
+
+    bool match = true;
+    for (unsigned r = 0; r < layout.rows; ++r)
+    {
+      for (unsigned c = 0; c < layout.cols; ++c)
+      {
+        float v = grid.getCell(r, c);
+        float e = depths[r * layout.cols + c];
+        match = match && (v == e || (v != v && e != e));
+      }
+    }
+    test.boolean("cells are preserved across tiles", match);
+
+    double depth = 0;
+    test.boolean("depth at cell", grid.getDepth(-100 + 2 * 20, 60, depth) && depth == 30);
+    test.boolean("bilinear interpolation", grid.getDepth(-100 + 2 * 20.25, 61, depth)
+                 && std::fabs(depth - 30.25) < 1e-6);
+    test.boolean("unknown cells are ignored", grid.getDepth(-100 + 2 * 3.5, 57, depth)
+                 && std::fabs(depth - 13.6666667) < 1e-6);
+    test.boolean("outside grid", !grid.getDepth(-101, 60, depth) && !grid.getDepth(0, 50 + 2 * 45, depth));
+
+    double range = 0;
+    double origin[3] = {-100 + 2 * 20, 60, 5};
+    double down[3] = {0, 0, 1};
+    test.boolean("vertical ray", grid.castRay(origin, down, 100, range) && std::fabs(range - 25) < 0.01);
+    test.boolean("ray beyond range", !grid.castRay(origin, down, 20, range));
+
+    // Heading north with the slope of the bottom: z = 5 + s / 2,
+    // bottom = 30 + s / 2, never hits.
+    double slope[3] = {1, 0, 0.5};
+    test.boolean("parallel ray misses", !grid.castRay(origin, slope, 50, range));
+
+    // Heading south, 45 degrees down: z = 5 + s, bottom = 30 - s / 2,
+    // hit at s = 50 / 3, range = s * sqrt(2).
+    double south[3] = {-1, 0, 1};
+    test.boolean("slanted ray", grid.castRay(origin, south, 50, range)
+                 && std::fabs(range - 50.0 / 3.0 * std::sqrt(2.0)) < 0.01);
+
+    double buried[3] = {-100 + 2 * 20, 60, 40};
+    test.boolean("origin below bottom", grid.castRay(buried, down, 10, range) && range == 0);
+  }
+
+  {
+    std::ofstream ofs(path.c_str(), std::ios::binary | std::ios::trunc);
+    ofs << "DBGR";
+  }
+
+  try
+  {
+    Bathymetry grid(path);
+    test.failed("truncated file is rejected");
+  }
+  catch (Bathymetry::Error& e)
+  {
+    test.passed("truncated file is rejected");
+  }
+
+  path.remove();
+
+  return test.getReturnValue();
+}
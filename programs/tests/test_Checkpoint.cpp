@@ -0,0 +1,149 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <fstream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+int
+main(void)
+{
+  Test test("Tasks::Checkpoint");
+
+  Path path("test_Checkpoint.ckp");
+  std::remove(path.c_str());
+
+  IMC::GpsFix fix;
+  fix.lat = 0.7188;
+  fix.lon = -0.1530;
+  fix.height = 12.5;
+
+  Math::Matrix cov(3, 3);
+  cov.identity();
+  cov(0, 1) = 0.25;
+
+  {
+    Checkpoint ckp(path);
+    double time = 0;
+    test.boolean("new file has no checkpoint", !ckp.load(time));
+
+    ckp.put(fix);
+    ckp.put(cov);
+    ckp.put(std::string("state"));
+    ckp.put((uint32_t)7);
+    ckp.commit(100.0);
+
+    ckp.clear();
+    ckp.put((uint32_t)8);
+    ckp.commit(101.0);
+  }
+
+  {
+    Checkpoint ckp(path);
+    double time = 0;
+    uint32_t value = 0;
+    test.boolean("latest checkpoint is loaded", ckp.load(time) && time == 101.0);
+    ckp.get(value);
+    test.boolean("values are restored", value == 8);
+
+    try
+    {
+      ckp.get(value);
+      test.failed("reading past the end fails");
+    }
+    catch (std::exception&)
+    {
+      test.passed("reading past the end fails");
+    }
+
+    // Corrupt the most recent snapshot.
+    std::fstream fs(path.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    fs.seekp(0, std::ios::end);
+    std::streamoff size = fs.tellp();
+    fs.seekp(16 + (size - 16) / 2 + 24);
+    fs.put(0x55);
+    fs.close();
+  }
+
+  {
+    Checkpoint ckp(path);
+    double time = 0;
+    test.boolean("corrupted snapshot is skipped", ckp.load(time) && time == 100.0);
+
+    IMC::GpsFix rfix;
+    Math::Matrix rcov;
+    std::string str;
+    uint32_t value = 0;
+    ckp.get(rfix);
+    ckp.get(rcov);
+    ckp.get(str);
+    ckp.get(value);
+    test.boolean("previous snapshot is restored", rfix == fix && rcov == cov
+                 && str == "state" && value == 7);
+
+    // Snapshots larger than the file grow it.
+    ckp.clear();
+    for (unsigned i = 0; i < 10000; ++i)
+      ckp.put((double)i);
+    ckp.commit(102.0);
+  }
+
+  {
+    Checkpoint ckp(path);
+    double time = 0;
+    double value = 0;
+    test.boolean("large snapshot is loaded", ckp.load(time) && time == 102.0 && ckp.getSize() == 80000);
+    for (unsigned i = 0; i < 9999; ++i)
+      ckp.get(value);
+    test.boolean("large snapshot is restored", value == 9998);
+
+    // Corrupt the large snapshot: the one taken before the file
+    // grew must still be available.
+    std::fstream fs(path.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    fs.seekp(0, std::ios::end);
+    std::streamoff size = fs.tellp();
+    fs.seekp(16 + (size - 16) / 2 + 24);
+    fs.put(0x55);
+    fs.close();
+    test.boolean("snapshot survives file growth", ckp.load(time) && time == 100.0);
+
+    ckp.invalidate();
+    test.boolean("invalidated file has no checkpoint", !ckp.load(time));
+  }
+
+  std::remove(path.c_str());
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,151 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+// Task headers.
+#include <Transports/UDP/Node.hpp>
+
+using namespace DUNE::Concurrency;
+using namespace DUNE::Network;
+using DUNE::IO::Poll;
+using DUNE::Time::Clock;
+using DUNE::Time::Delay;
+using DUNE::Utils::String;
+
+//! Latency budget of coalesced packets (s).
+static const double c_latency = 0.1;
+
+class Producer: public Thread
+{
+public:
+  Producer(TSQueue<int>& queue, double delay):
+    m_queue(queue),
+    m_delay(delay)
+  { }
+
+  void
+  run(void)
+  {
+    Delay::wait(m_delay);
+    m_queue.push(1);
+  }
+
+private:
+  TSQueue<int>& m_queue;
+  double m_delay;
+};
+
+int
+main(void)
+{
+  Test test("Transports::UDP::Node (coalescing)");
+
+  UDPSocket rx;
+  UDPSocket tx;
+  unsigned port = 0;
+
+  for (unsigned i = 0; i < 100 && port == 0; ++i)
+  {
+    try
+    {
+      rx.bind(6900 + i, Address::Loopback, false);
+      port = 6900 + i;
+    }
+    catch (...)
+    { }
+  }
+
+  test.boolean("bind()", port != 0);
+  Transports::UDP::Node node("node", String::str("imc+udp://127.0.0.1:%u/;imc+udp+coalesce://127.0.0.1:%u/", port, port));
+  node.setCoalescing(1024, c_latency);
+  node.activate(Address::Loopback);
+
+  test.boolean("canCoalesce()", node.canCoalesce());
+  test.boolean("getDeadline() (idle)", node.getDeadline() < 0);
+
+  {
+    uint8_t data[100] = {0};
+    double start = Clock::get();
+    node.send(tx, data, sizeof(data));
+    node.send(tx, data, sizeof(data));
+    double deadline = node.getDeadline();
+
+    test.boolean("getDeadline() (pending)", deadline >= start && deadline <= start + c_latency + 0.01);
+
+    node.flush(tx, Clock::get());
+    test.boolean("flush() before deadline", !Poll::poll(rx, 0.02));
+
+    Delay::wait(deadline - Clock::get() + 0.001);
+    node.flush(tx, Clock::get());
+    test.boolean("flush() after deadline", Poll::poll(rx, 1.0));
+
+    uint8_t bfr[1024];
+    test.boolean("single datagram", rx.read(bfr, sizeof(bfr)) == 2 * sizeof(data));
+    test.boolean("getDeadline() (flushed)", node.getDeadline() < 0);
+  }
+
+  {
+    uint8_t data[1024] = {0};
+    node.send(tx, data, 600);
+    node.send(tx, data, 600);
+    test.boolean("flush() when full", Poll::poll(rx, 0.05));
+    rx.read(data, sizeof(data));
+    node.flush(tx);
+    rx.read(data, sizeof(data));
+  }
+
+  {
+    TSQueue<int> queue;
+    Producer producer(queue, 0.05);
+    double start = Clock::get();
+    producer.start();
+    bool rv = queue.waitForItems(5.0);
+    double elapsed = Clock::get() - start;
+    producer.stopAndJoin();
+
+    test.boolean("waitForItems() wakes on arrival", rv && elapsed < 1.0);
+  }
+
+  {
+    TSQueue<int> queue;
+    double start = Clock::get();
+    bool rv = queue.waitForItems(c_latency);
+    double elapsed = Clock::get() - start;
+
+    test.boolean("waitForItems() honours deadline", !rv && elapsed >= c_latency - 0.01 && elapsed < c_latency + 0.1);
+  }
+
+  return 0;
+}
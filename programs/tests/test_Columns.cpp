@@ -0,0 +1,147 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! Number of messages of each source entity.
+static const unsigned c_count = 1000;
+
+//! Write a log with two entities to a column folder.
+static void
+write(const Path& dir, Compression::Methods method)
+{
+  IMC::ColumnWriter writer(dir, method, 128);
+  ByteBuffer bfr;
+
+  for (unsigned i = 0; i < c_count; ++i)
+  {
+    IMC::EstimatedState state;
+    state.setTimeStamp(1000.0 + i * 0.1);
+    state.setSourceEntity(5);
+    state.x = i * 0.5f;
+    state.lat = 0.7 + i * 1e-9;
+    uint16_t size = IMC::Packet::serialize(&state, bfr);
+    writer.write(IMC::MessageView(bfr.getBuffer(), size));
+
+    IMC::Rpm rpm;
+    rpm.setTimeStamp(1000.0 + i * 0.1);
+    rpm.setSourceEntity(7);
+    rpm.value = (int16_t)(500 - (int)i);
+    size = IMC::Packet::serialize(&rpm, bfr);
+    writer.write(IMC::MessageView(bfr.getBuffer(), size));
+  }
+}
+
+//! Check the columns written by write().
+static void
+check(Test& test, const Path& dir, const std::string& label)
+{
+  IMC::ColumnReader reader(dir);
+
+  test.boolean((label + ": columns exist").c_str(),
+               reader.hasColumn("EstimatedState", 5, "x")
+               && reader.hasColumn("Rpm", 7, "value")
+               && !reader.hasColumn("Rpm", 5, "value"));
+
+  IMC::ColumnReader::Column& col = reader.getColumn("EstimatedState", 5, "x");
+  test.boolean((label + ": rows and blocks").c_str(),
+               col.getRows() == c_count && col.getBlockCount() == (c_count + 127) / 128);
+  test.boolean((label + ": block range").c_str(),
+               col.getBlock(1).min == 64.0 && col.getBlock(1).max == 127.5);
+
+  std::vector<fp64_t> times;
+  std::vector<fp64_t> values;
+  unsigned count = reader.query("EstimatedState", 5, "lat", 0, 1e9, times, values);
+  bool match = count == c_count && values.size() == c_count;
+  for (unsigned i = 0; match && i < c_count; ++i)
+    match = values[i] == 0.7 + i * 1e-9 && times[i] == 1000.0 + i * 0.1;
+  test.boolean((label + ": doubles are preserved").c_str(), match);
+
+  times.clear();
+  values.clear();
+  count = reader.query("Rpm", 7, "value", 1049.95, 1060.05, times, values);
+  match = count == 101 && values.size() == 101;
+  for (unsigned i = 0; match && i < count; ++i)
+    match = values[i] == -(int)i && times[i] > 1049.95 && times[i] < 1060.05;
+  test.boolean((label + ": time range query").c_str(), match);
+}
+
+int
+main(void)
+{
+  Test test("IMC::Columns");
+
+  {
+    const IMC::MessageView::Field* field = IMC::MessageView::getFields(IMC::EstimatedState::getIdStatic());
+    while (field->name != NULL && std::strcmp(field->name, "x") != 0)
+      ++field;
+    test.boolean("fields have constant offsets",
+                 field->name != NULL && field->offset == 20 && field->type == IMC::MessageView::FT_FP32);
+    test.boolean("unknown messages have no fields", IMC::MessageView::getFields(65000) == NULL);
+  }
+
+  Path lz4("test_Columns.lz4");
+  write(lz4, Compression::METHOD_LZ4);
+  check(test, lz4, "lz4");
+  lz4.remove(Path::MODE_RECURSIVE);
+
+  Path raw("test_Columns.raw");
+  write(raw, Compression::METHOD_UNKNOWN);
+  check(test, raw, "uncompressed");
+
+  {
+    std::ofstream ofs((raw / IMC::getColumnName("Rpm", 7, "value")).c_str(),
+                      std::ios::binary | std::ios::app);
+    ofs << "garbage";
+  }
+
+  try
+  {
+    IMC::ColumnReader reader(raw);
+    reader.getColumn("Rpm", 7, "value");
+    test.failed("corrupted files are rejected");
+  }
+  catch (IMC::ColumnError&)
+  {
+    test.passed("corrupted files are rejected");
+  }
+
+  raw.remove(Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,155 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+int
+main(void)
+{
+  Test test("IMC::CompactCodec");
+
+  {
+    ByteBuffer bfr;
+    CompactWriter writer(bfr);
+    writer.writeUnsigned(0);
+    writer.writeUnsigned(127);
+    writer.writeUnsigned(128);
+    writer.writeUnsigned(0xffffffffffffffffULL);
+    writer.writeSigned(-1);
+    writer.writeSigned(-4000000000LL);
+
+    CompactReader reader(bfr.getBuffer(), bfr.getSize());
+    test.boolean("varint 0", reader.readUnsigned() == 0);
+    test.boolean("varint 127", reader.readUnsigned() == 127);
+    test.boolean("varint 128", reader.readUnsigned() == 128);
+    test.boolean("varint 2^64 - 1", reader.readUnsigned() == 0xffffffffffffffffULL);
+    test.boolean("zigzag -1", reader.readSigned() == -1);
+    test.boolean("zigzag -4e9", reader.readSigned() == -4000000000LL);
+    test.boolean("all bytes consumed", reader.getRemaining() == 0);
+  }
+
+  IMC::Header ref;
+  ref.timestamp = 1.46e9;
+  ref.src = 0x2000;
+  ref.src_ent = DUNE_IMC_CONST_UNK_EID;
+  ref.dst = DUNE_IMC_CONST_NULL_ID;
+  ref.dst_ent = DUNE_IMC_CONST_UNK_EID;
+
+  IMC::CompactCodec codec;
+  codec.setReference(ref);
+
+  {
+    IMC::EstimatedState es;
+    es.setTimeStamp(ref.timestamp + 12.3456);
+    es.setSource(0x2000);
+    es.setSourceEntity(12);
+    es.lat = 0.71881;
+    es.lon = -0.15281;
+    es.x = 123.456;
+    es.psi = -2.5;
+    es.u = 1.25;
+
+    ByteBuffer bfr;
+    unsigned size = codec.encode(&es, bfr);
+    IMC::EstimatedState* dec = static_cast<IMC::EstimatedState*>(codec.decode(bfr.getBuffer(), size));
+
+    test.boolean("EstimatedState is smaller", size < es.getSerializationSize() / 2);
+    test.boolean("EstimatedState header", dec->getSource() == 0x2000 && dec->getSourceEntity() == 12
+                 && dec->getDestination() == DUNE_IMC_CONST_NULL_ID);
+    test.boolean("EstimatedState time stamp", std::fabs(dec->getTimeStamp() - es.getTimeStamp()) <= 0.0005);
+    test.boolean("EstimatedState latitude", std::fabs(dec->lat - es.lat) <= 1e-9);
+    test.boolean("EstimatedState position", std::fabs(dec->x - es.x) <= 0.005);
+    test.boolean("EstimatedState heading", std::fabs(dec->psi - es.psi) <= 1e-4);
+    delete dec;
+  }
+
+  {
+    IMC::EntityState msg;
+    msg.setTimeStamp(ref.timestamp - 1.0);
+    msg.setSource(0x1234);
+    msg.setDestination(0x2000);
+    msg.state = IMC::EntityState::ESTA_ERROR;
+    msg.description = "error description";
+
+    ByteBuffer bfr;
+    unsigned size = codec.encode(&msg, bfr);
+    IMC::Message* dec = codec.decode(bfr.getBuffer(), size);
+
+    test.boolean("EntityState without profile is lossless", *dec == msg);
+    delete dec;
+  }
+
+  {
+    std::vector<char> dict;
+    IMC::LogBookEntry entry;
+    entry.text = "vehicle is now in service mode and waiting for plans";
+    entry.context = "Plan Supervisor";
+    std::vector<uint8_t> fields(entry.getPayloadSerializationSize());
+    entry.serializeFields(&fields[0]);
+    dict.assign(fields.begin(), fields.end());
+    codec.setDictionary(dict);
+
+    entry.setTimeStamp(ref.timestamp);
+    ByteBuffer bfr;
+    unsigned size = codec.encode(&entry, bfr);
+    IMC::Message* dec = codec.decode(bfr.getBuffer(), size);
+
+    test.boolean("dictionary deflates fields", size < entry.getPayloadSerializationSize() / 2);
+    test.boolean("dictionary is lossless", *dec == entry);
+    delete dec;
+  }
+
+  {
+    ByteBuffer bfr;
+    IMC::Voltage msg;
+    msg.value = 24.5;
+    unsigned size = codec.encode(&msg, bfr);
+
+    try
+    {
+      IMC::Message* dec = codec.decode(bfr.getBuffer(), size - 1);
+      delete dec;
+      test.failed("truncated message is rejected");
+    }
+    catch (std::runtime_error& e)
+    {
+      test.passed("truncated message is rejected");
+    }
+  }
+
+  return test.getReturnValue();
+}
@@ -27,6 +27,7 @@
 
 // ISO C++ 98 headers.
 #include <iostream>
+#include <cmath>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -49,5 +50,18 @@ main(void)
     test.boolean("wait()", ((end - start) - 1.0) < 0.1);
   }
 
+  {
+    Clock::setScale(10.0);
+    double start = Clock::get();
+    uint64_t sys_start = Clock::getSystemNsec();
+    Delay::wait(1.0);
+    double end = Clock::get();
+    double sys_elapsed = (Clock::getSystemNsec() - sys_start) / c_nsec_per_sec_fp;
+    Clock::setScale(1.0);
+
+    test.boolean("scaled wait()", std::fabs((end - start) - 1.0) < 0.1);
+    test.boolean("scaled wait() system time", sys_elapsed < 0.5);
+  }
+
   return 0;
 }
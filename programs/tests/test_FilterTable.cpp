@@ -0,0 +1,109 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+static std::set<uint32_t>
+ids(uint32_t a)
+{
+  std::set<uint32_t> s;
+  s.insert(a);
+  return s;
+}
+
+static std::set<uint32_t>
+ids(uint32_t a, uint32_t b)
+{
+  std::set<uint32_t> s;
+  s.insert(a);
+  s.insert(b);
+  return s;
+}
+
+int
+main(void)
+{
+  Test test("Tasks::FilterTable");
+
+  std::set<uint32_t> any = ids(FilterTable::c_any);
+
+  {
+    FilterTable table;
+    test.boolean("empty table admits all", table.empty() && table.match(IMC::EstimatedState::getIdStatic(), 1, 2));
+
+    table.add(ids(IMC::EstimatedState::getIdStatic()), ids(0x2000), ids(10, 20));
+    test.boolean("rule applies to message", table.applies(IMC::EstimatedState::getIdStatic()));
+    test.boolean("rule does not apply to other messages", !table.applies(IMC::Temperature::getIdStatic()));
+    test.boolean("listed source is admitted", table.match(IMC::EstimatedState::getIdStatic(), 0x2000, 20));
+    test.boolean("unlisted entity is rejected", !table.match(IMC::EstimatedState::getIdStatic(), 0x2000, 30));
+    test.boolean("unlisted system is rejected", !table.match(IMC::EstimatedState::getIdStatic(), 0x2001, 10));
+    test.boolean("other messages are admitted", table.match(IMC::Temperature::getIdStatic(), 0x2001, 30));
+
+    table.add(ids(IMC::EstimatedState::getIdStatic()), ids(0x2001), any);
+    test.boolean("rules are combined", table.match(IMC::EstimatedState::getIdStatic(), 0x2001, 30)
+                 && table.match(IMC::EstimatedState::getIdStatic(), 0x2000, 10));
+
+    table.add(any, ids(0x3000), any);
+    test.boolean("wildcard rule applies to all messages", table.applies(IMC::Temperature::getIdStatic())
+                 && table.applies(65000));
+    test.boolean("wildcard rule admits", table.match(IMC::Temperature::getIdStatic(), 0x3000, 1)
+                 && table.match(IMC::EstimatedState::getIdStatic(), 0x3000, 1));
+    test.boolean("wildcard rule rejects", !table.match(IMC::Temperature::getIdStatic(), 0x2000, 1));
+
+    table.clear();
+    test.boolean("cleared table admits all", table.empty() && table.match(IMC::Temperature::getIdStatic(), 0x2000, 1));
+  }
+
+  {
+    IMC::Temperature msg;
+    msg.setSource(0x2000);
+    msg.setSourceEntity(5);
+
+    FilterTable table;
+    table.add(ids(msg.getId()), any, std::set<uint32_t>());
+    test.boolean("empty set rejects", !table.match(&msg));
+  }
+
+  {
+    Time::TokenBucket bucket(2.0, 3);
+    unsigned taken = 0;
+    for (unsigned i = 0; i < 10; ++i)
+      taken += bucket.take(100.0) ? 1 : 0;
+    test.boolean("burst is limited", taken == 3);
+    test.boolean("tokens are refilled", bucket.take(100.5) && !bucket.take(100.5));
+    test.boolean("refill is limited by burst", bucket.take(200.0) && bucket.take(200.0)
+                 && bucket.take(200.0) && !bucket.take(200.0));
+  }
+
+  return test.getReturnValue();
+}
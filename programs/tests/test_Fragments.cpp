@@ -0,0 +1,149 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <set>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+#include <DUNE/Network/Fragments.hpp>
+#include <DUNE/Network/FragmentedMessage.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! Reassemble a message skipping some fragments.
+static IMC::Message*
+reassemble(Network::Fragments& frags, const std::set<int>& lost)
+{
+  Network::FragmentedMessage incoming;
+
+  for (int i = 0; i < frags.getNumberOfFragments(); ++i)
+  {
+    if (lost.find(i) != lost.end())
+      continue;
+
+    IMC::Message* msg = incoming.setFragment(frags.getFragment(i));
+    if (msg != NULL)
+      return msg;
+  }
+
+  return NULL;
+}
+
+int
+main(void)
+{
+  Test test("Network::Fragments");
+
+  IMC::DevDataText text;
+  for (unsigned i = 0; i < 1000; ++i)
+    text.value.push_back((char)('a' + (i * 7) % 26));
+
+  {
+    Network::Fragments frags(&text, 100);
+    test.boolean("no parity fragments by default",
+                 frags.getNumberOfFragments() == frags.getNumberOfDataFragments());
+
+    test.boolean("fragments fit the MTU", frags.getFragment(0)->getSerializationSize() <= 100);
+
+    unsigned size = 0;
+    const uint8_t* data = frags.getFragmentData(1, size);
+    test.boolean("fragment data matches fragment",
+                 size == frags.getFragment(1)->data.size()
+                 && std::memcmp(data, &frags.getFragment(1)->data[0], size) == 0);
+
+    IMC::Message* msg = reassemble(frags, std::set<int>());
+    test.boolean("message is reassembled", msg != NULL && *msg == text);
+    delete msg;
+  }
+
+  {
+    Network::Fragments frags(&text, 100, 0.5f);
+    int k = frags.getNumberOfDataFragments();
+    test.boolean("parity fragments are added", frags.getNumberOfFragments() == k + (k + 1) / 2);
+
+    std::set<int> lost;
+    lost.insert(0);
+    lost.insert(3);
+    lost.insert(k - 1);
+    IMC::Message* msg = reassemble(frags, lost);
+    test.boolean("message is recovered from parity", msg != NULL && *msg == text);
+    delete msg;
+
+    lost.clear();
+    for (int i = 0; i < k; ++i)
+    {
+      if (i < (k + 1) / 2)
+        lost.insert(i);
+    }
+    msg = reassemble(frags, lost);
+    test.boolean("message is recovered from any k fragments", msg != NULL && *msg == text);
+    delete msg;
+
+    lost.insert(k);
+    msg = reassemble(frags, lost);
+    test.boolean("too many losses are not recovered", msg == NULL);
+    delete msg;
+  }
+
+  {
+    std::vector<uint8_t> blocks[5];
+    const uint8_t* data[3];
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      blocks[i].resize(16);
+      for (unsigned j = 0; j < 16; ++j)
+        blocks[i][j] = (uint8_t)(i * 31 + j * 17);
+      data[i] = &blocks[i][0];
+    }
+
+    ReedSolomon rs(3, 2);
+    for (unsigned i = 0; i < 2; ++i)
+    {
+      blocks[3 + i].resize(16);
+      rs.encode(data, i, &blocks[3 + i][0], 16);
+    }
+
+    std::vector<uint8_t> out[3];
+    uint8_t* outputs[3];
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      out[i].resize(16);
+      outputs[i] = &out[i][0];
+    }
+
+    const uint8_t* avail[5] = {NULL, &blocks[1][0], NULL, &blocks[3][0], &blocks[4][0]};
+    bool ok = rs.decode(avail, outputs, 16);
+    test.boolean("data blocks are decoded", ok && out[0] == blocks[0] && out[2] == blocks[2]);
+  }
+
+  return test.getReturnValue();
+}
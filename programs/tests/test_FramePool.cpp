@@ -0,0 +1,137 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+int
+main(void)
+{
+  Test test("Media::FramePool");
+
+  FramePool* pool = new FramePool(2, 2000);
+
+  {
+    Frame* f0 = pool->acquire();
+    Frame* f1 = pool->acquire();
+    test.boolean("frames are acquired", f0 != NULL && f1 != NULL);
+    test.boolean("exhausted pool fails", pool->acquire() == NULL);
+    test.boolean("failed acquisition is counted", pool->getDrops() == 1);
+
+    f0->release();
+    test.boolean("released frame is reused", pool->acquire() == f0);
+    f0->release();
+    f1->release();
+    test.boolean("all frames returned", pool->getUsed() == 0);
+    test.boolean("peak usage", pool->getPeakUsed() == 2);
+  }
+
+  IMC::SonarData ping;
+  ping.type = IMC::SonarData::ST_SIDESCAN;
+  ping.frequency = 770000;
+  ping.max_range = 30;
+  ping.bits_per_point = 8;
+  ping.scale_factor = 1.0f;
+  IMC::BeamConfig bc;
+  bc.beam_width = 0.1;
+  ping.beam_config.push_back(bc);
+
+  {
+    Frame* frame = pool->acquire();
+    frame->setSize(2000);
+    for (unsigned i = 0; i < frame->getSize(); ++i)
+      frame->getData()[i] = (uint8_t)(i * 7);
+
+    FrameDescriptor desc(ping, frame);
+    frame->release();
+    desc.setTimeStamp(1.46e9);
+    desc.setSource(0x2000);
+    desc.setSourceEntity(30);
+
+    IMC::Message* copy = desc.clone();
+    test.boolean("copies share frame", static_cast<FrameDescriptor*>(copy)->getFrame() == frame);
+    test.boolean("copies hold references", pool->getUsed() == 1);
+
+    // Reference packet produced without frames.
+    IMC::SonarData full(ping);
+    full.data.assign((char*)frame->getData(), (char*)frame->getData() + frame->getSize());
+    full.setTimeStamp(1.46e9);
+    full.setSource(0x2000);
+    full.setSourceEntity(30);
+    ByteBuffer ref;
+    IMC::Packet::serialize(&full, ref);
+
+    ByteBuffer bfr;
+    uint16_t size = desc.serializeCarrier(bfr);
+    test.boolean("carrier packet matches message",
+                 size == ref.getSize() && std::memcmp(bfr.getBuffer(), ref.getBuffer(), size) == 0);
+
+    IMC::Message* msg = desc.expand();
+    test.boolean("expanded message matches", *msg == full);
+    delete msg;
+
+    delete copy;
+    test.boolean("frame held by descriptor", pool->getUsed() == 1);
+  }
+
+  test.boolean("frame returned after last descriptor", pool->getUsed() == 0);
+
+  {
+    Frame* frame = pool->acquire();
+    frame->setSize(10);
+
+    IMC::SonarData full(ping);
+    full.data.assign(4, (char)0x55);
+    FrameDescriptor desc(full, frame);
+    frame->release();
+
+    ByteBuffer bfr;
+    try
+    {
+      desc.serializeCarrier(bfr);
+      test.failed("non-empty carrier is rejected");
+    }
+    catch (std::exception&)
+    {
+      test.passed("non-empty carrier is rejected");
+    }
+
+    // Pool outlives close() while frames are referenced.
+    pool->close();
+    test.boolean("frame is valid after close", desc.getFrame()->getSize() == 10);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,183 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+static const unsigned c_states = 8;
+static const unsigned c_outputs = 4;
+
+//! Maximum absolute difference between two matrices.
+static double
+difference(const Math::Matrix& a, const Math::Matrix& b)
+{
+  double diff = 0.0;
+  for (int i = 0; i < a.rows(); ++i)
+  {
+    for (int j = 0; j < a.columns(); ++j)
+      diff = std::max(diff, std::fabs(a.element(i, j) - b.element(i, j)));
+  }
+
+  return diff;
+}
+
+//! Build a filter with a sparse transition matrix and a few outputs.
+static void
+setup(Navigation::KalmanFilter& kal)
+{
+  kal.reset(c_states, c_outputs);
+
+  // Constant velocity model for four axes.
+  Math::Matrix a(c_states);
+  for (unsigned i = 0; i < c_states; i += 2)
+    a(i, i + 1) = 0.1;
+  kal.setTransitions(a);
+
+  for (unsigned i = 0; i < c_states; ++i)
+  {
+    kal.setState(i, 0.1 * i);
+    kal.setCovariance(i, 1.0 + i);
+    kal.setProcessNoise(i, 0.01);
+  }
+
+  kal.setCovariance(0, 1, 0.3);
+  kal.setCovariance(1, 0, 0.3);
+
+  // Positions are observed, the last output has no observation.
+  for (unsigned i = 0; i < c_outputs - 1; ++i)
+  {
+    kal.setObservation(i, 2 * i, 1.0);
+    kal.setMeasurementNoise(i, 0.5);
+    kal.setInnovation(i, 0.2 * (i + 1));
+  }
+
+  kal.setObservation(0, 1, 0.5);
+  kal.setMeasurementNoise(c_outputs - 1, 0.5);
+}
+
+int
+main(void)
+{
+  Test test("Navigation::KalmanFilter");
+
+  {
+    Navigation::KalmanFilter kal;
+    setup(kal);
+
+    Math::Matrix a = kal.getCovarianceTransition();
+    Math::Matrix p = a * kal.getCovariance() * transpose(a);
+    for (unsigned i = 0; i < c_states; ++i)
+      p(i, i) += 0.01;
+
+    kal.predict();
+    test.boolean("sparse prediction matches dense prediction",
+                 difference(p, kal.getCovariance()) < 1e-12);
+  }
+
+  {
+    Navigation::KalmanFilter batch;
+    Navigation::KalmanFilter sequential;
+    setup(batch);
+    setup(sequential);
+    sequential.setUpdateMode(Navigation::KalmanFilter::UPDATE_SEQUENTIAL);
+
+    test.boolean("batch update", batch.update(0) == 0);
+    test.boolean("sequential update", sequential.update(0) == 0);
+    test.boolean("states match",
+                 difference(batch.getState(), sequential.getState()) < 1e-9);
+    test.boolean("covariances match",
+                 difference(batch.getCovariance(), sequential.getCovariance()) < 1e-9);
+
+    Math::Matrix p = sequential.getCovariance();
+    test.boolean("covariance is symmetric", difference(p, transpose(p)) == 0.0);
+  }
+
+  {
+    Navigation::KalmanFilter batch;
+    Navigation::KalmanFilter sequential;
+    setup(batch);
+    setup(sequential);
+    sequential.setUpdateMode(Navigation::KalmanFilter::UPDATE_SEQUENTIAL);
+
+    for (unsigned i = 0; i < c_outputs - 1; ++i)
+    {
+      batch.setInnovation(i, 10.0);
+      sequential.setInnovation(i, 10.0);
+    }
+
+    Math::Matrix x = sequential.getState();
+    Math::Matrix p = sequential.getCovariance();
+
+    test.boolean("batch rejects large innovations", batch.update(20) == -1);
+    test.boolean("sequential rejects large innovations", sequential.update(20) == -1);
+    test.boolean("rejected update keeps estimate",
+                 difference(x, sequential.getState()) == 0.0
+                 && difference(p, sequential.getCovariance()) == 0.0);
+  }
+
+  {
+    Navigation::KalmanFilter batch;
+    Navigation::KalmanFilter sequential;
+    setup(batch);
+    setup(sequential);
+    sequential.setUpdateMode(Navigation::KalmanFilter::UPDATE_SEQUENTIAL);
+
+    batch.setInnovation(c_outputs - 1, 10.0);
+    sequential.setInnovation(c_outputs - 1, 10.0);
+
+    test.boolean("unobserved outputs count towards rejection",
+                 batch.update(20) == -1 && sequential.update(20) == -1);
+  }
+
+  {
+    Navigation::KalmanFilter batch;
+    Navigation::KalmanFilter sequential;
+    setup(batch);
+    setup(sequential);
+    sequential.setUpdateMode(Navigation::KalmanFilter::UPDATE_SEQUENTIAL);
+
+    batch.setMeasurementNoise(0, 1, 0.1);
+    batch.setMeasurementNoise(1, 0, 0.1);
+    sequential.setMeasurementNoise(0, 1, 0.1);
+    sequential.setMeasurementNoise(1, 0, 0.1);
+
+    batch.update(0);
+    sequential.update(0);
+    test.boolean("correlated noise falls back to batch update",
+                 difference(batch.getCovariance(), sequential.getCovariance()) == 0.0);
+  }
+
+  return test.getReturnValue();
+}
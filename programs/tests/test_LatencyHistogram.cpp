@@ -0,0 +1,91 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+int
+main(void)
+{
+  Test test("Time::LatencyHistogram");
+
+  {
+    LatencyHistogram h;
+    test.boolean("empty histogram", h.getCount() == 0 && h.getPercentile(99) == 0.0);
+
+    for (unsigned i = 0; i < 90; ++i)
+      h.add(0.0008);
+    for (unsigned i = 0; i < 9; ++i)
+      h.add(0.015);
+    h.add(30.0);
+
+    test.boolean("samples are counted", h.getCount() == 100);
+    test.boolean("samples are bucketed",
+                 h.getBucketCount(3) == 90 && h.getBucketCount(7) == 9
+                 && h.getBucketCount(LatencyHistogram::c_buckets - 1) == 1);
+    test.boolean("median", h.getPercentile(50) == 1e-3);
+    test.boolean("99th percentile", h.getPercentile(99) == 20e-3);
+    test.boolean("maximum", h.getMaximum() == 30.0 && h.getPercentile(100) == 30.0);
+    test.boolean("mean", std::fabs(h.getMean() - (90 * 0.0008 + 9 * 0.015 + 30.0) / 100) < 1e-12);
+
+    h.reset();
+    test.boolean("reset", h.getCount() == 0 && h.getBucketCount(3) == 0);
+  }
+
+  {
+    IMC::EulerAngles sample;
+    sample.setTimeStamp(1000.0);
+    test.boolean("messages start without trace", !sample.hasTrace());
+
+    sample.setTrace(sample.getTimeStamp(), 0);
+    IMC::EstimatedState state;
+    state.setTrace(sample);
+    IMC::DesiredHeading heading;
+    heading.setTrace(state);
+
+    IMC::Message* copy = heading.clone();
+    test.boolean("trace is propagated",
+                 copy->getTraceOrigin() == 1000.0 && copy->getTraceHops() == 2);
+    delete copy;
+
+    ByteBuffer bfr;
+    IMC::Packet::serialize(&heading, bfr);
+    IMC::Message* msg = IMC::Packet::deserialize(bfr.getBuffer(), bfr.getSize());
+    test.boolean("trace is not serialized", !msg->hasTrace());
+    delete msg;
+  }
+
+  return test.getReturnValue();
+}
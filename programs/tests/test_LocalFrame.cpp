@@ -0,0 +1,163 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! Maximum horizontal and vertical error of fast mode within a
+//! given distance from the reference.
+static void
+fastError(const LocalFrame& exact, const LocalFrame& fast, double dist,
+          double& horizontal, double& vertical)
+{
+  horizontal = 0;
+  vertical = 0;
+
+  for (unsigned i = 0; i < 72; ++i)
+  {
+    double n = dist * std::cos(i * Math::c_two_pi / 72);
+    double e = dist * std::sin(i * Math::c_two_pi / 72);
+    double lat, lon, hae;
+    exact.fromNED(n, e, -50.0, lat, lon, hae);
+
+    double fn, fe, fd;
+    fast.toNED(lat, lon, hae, fn, fe, fd);
+    horizontal = std::max(horizontal, std::sqrt((fn - n) * (fn - n) + (fe - e) * (fe - e)));
+    vertical = std::max(vertical, std::fabs(fd + 50.0));
+  }
+}
+
+int
+main(void)
+{
+  Test test("Coordinates::LocalFrame");
+
+  double rlat = Angles::radians(41.18);
+  double rlon = Angles::radians(-8.70);
+  double rhae = 30.0;
+
+  LocalFrame exact(rlat, rlon, rhae);
+  LocalFrame fast(rlat, rlon, rhae, LocalFrame::MODE_FAST);
+
+  {
+    double lat = Angles::radians(41.21);
+    double lon = Angles::radians(-8.64);
+    double n, e, d;
+    double wn, we, wd;
+    exact.toNED(lat, lon, 5.0, n, e, d);
+    WGS84::displacement(rlat, rlon, rhae, lat, lon, 5.0, &wn, &we, &wd);
+    test.boolean("exact mode matches displacement",
+                 std::fabs(n - wn) < 1e-6 && std::fabs(e - we) < 1e-6 && std::fabs(d - wd) < 1e-6);
+
+    double b, r, wb, wr;
+    LocalFrame flat(rlat, rlon);
+    flat.getBearingAndRange(lat, lon, b, r);
+    WGS84::getNEBearingAndRange(rlat, rlon, lat, lon, &wb, &wr);
+    test.boolean("bearing and range match", std::fabs(b - wb) < 1e-9 && std::fabs(r - wr) < 1e-6);
+  }
+
+  {
+    double lat, lon, hae;
+    double n, e, d;
+    exact.fromNED(25000.0, -40000.0, 120.0, lat, lon, hae);
+    exact.toNED(lat, lon, hae, n, e, d);
+    test.boolean("exact round trip",
+                 std::fabs(n - 25000.0) < 1e-6 && std::fabs(e + 40000.0) < 1e-6 && std::fabs(d - 120.0) < 1e-6);
+
+    fast.fromNED(1500.0, 800.0, -20.0, lat, lon, hae);
+    fast.toNED(lat, lon, hae, n, e, d);
+    test.boolean("fast round trip",
+                 std::fabs(n - 1500.0) < 1e-6 && std::fabs(e - 800.0) < 1e-6 && std::fabs(d + 20.0) < 1e-6);
+  }
+
+  {
+    const double lats[] = {0.0, 41.18, -60.0, 70.0};
+    double h2 = 0, v2 = 0, h20 = 0, v20 = 0;
+
+    for (unsigned i = 0; i < sizeof(lats) / sizeof(lats[0]); ++i)
+    {
+      exact.setReference(Angles::radians(lats[i]), rlon, rhae);
+      fast.setReference(Angles::radians(lats[i]), rlon, rhae);
+
+      double h, v;
+      fastError(exact, fast, 2000.0, h, v);
+      h2 = std::max(h2, h);
+      v2 = std::max(v2, v);
+      fastError(exact, fast, 20000.0, h, v);
+      h20 = std::max(h20, h);
+      v20 = std::max(v20, v);
+    }
+
+    test.boolean("fast mode error at 2 km", h2 < 1e-3 && v2 < 1e-3);
+    test.boolean("fast mode error at 20 km", h20 < 0.4 && v20 < 0.4);
+
+    exact.setReference(rlat, rlon, rhae);
+    fast.setReference(rlat, rlon, rhae);
+  }
+
+  {
+    const size_t count = 20000;
+    std::vector<double> lat(count), lon(count), hae(count);
+    std::vector<double> n(count), e(count), d(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      lat[i] = rlat + (double)(i % 997) * 1e-6;
+      lon[i] = rlon - (double)(i % 991) * 1e-6;
+      hae[i] = (double)(i % 13);
+    }
+
+    exact.toNED(count, &lat[0], &lon[0], &hae[0], &n[0], &e[0], &d[0]);
+
+    bool match = true;
+    for (size_t i = 0; i < count; i += 101)
+    {
+      double sn, se, sd;
+      exact.toNED(lat[i], lon[i], hae[i], sn, se, sd);
+      match = match && sn == n[i] && se == e[i] && sd == d[i];
+    }
+    test.boolean("batch matches single conversions", match);
+
+    std::vector<double> olat(count), olon(count);
+    exact.fromNED(count, &n[0], &e[0], &d[0], &olat[0], &olon[0], NULL);
+    bool round = true;
+    for (size_t i = 0; i < count; i += 101)
+      round = round && std::fabs(olat[i] - lat[i]) < 1e-12 && std::fabs(olon[i] - lon[i]) < 1e-12;
+    test.boolean("batch round trip", round);
+  }
+
+  return test.getReturnValue();
+}
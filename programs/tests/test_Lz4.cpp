@@ -0,0 +1,153 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! Decompress data fed in small chunks into a small output buffer.
+static std::vector<char>
+decompressChunked(Decompressor& dec, std::vector<char>& src, unsigned chunk)
+{
+  std::vector<char> rv;
+  char out[1000];
+  unsigned offset = 0;
+
+  while (offset < src.size() || dec.pending())
+  {
+    unsigned len = std::min(chunk, (unsigned)(src.size() - offset));
+    dec.decompress(out, sizeof(out), len ? &src[offset] : out, len);
+    offset += dec.processed();
+    rv.insert(rv.end(), out, out + dec.decompressed());
+  }
+
+  return rv;
+}
+
+int
+main(void)
+{
+  Test test("Compression::Lz4");
+
+  // Mix of repetitive and pseudo-random bytes.
+  std::vector<char> data;
+  uint32_t seed = 1;
+  for (unsigned i = 0; i < 200000; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    data.push_back((char)((i % 97) < 60 ? 'a' + i % 13 : seed >> 24));
+  }
+
+  std::vector<char> packed;
+  {
+    Lz4Compressor comp;
+    Utils::ByteBuffer bfr;
+    comp.compress(bfr, &data[0], data.size());
+    packed.assign(bfr.getBufferSigned(), bfr.getBufferSigned() + bfr.getSize());
+    test.boolean("data is compressed", packed.size() < data.size());
+  }
+
+  {
+    Lz4Decompressor dec;
+    std::vector<char> out(data.size() + 16);
+    dec.decompress(&out[0], out.size(), &packed[0], packed.size());
+    out.resize(dec.decompressed());
+    test.boolean("single call round trip", out == data);
+  }
+
+  {
+    Lz4Decompressor dec;
+    test.boolean("chunked round trip", decompressChunked(dec, packed, 7) == data);
+  }
+
+  {
+    std::vector<char> two(packed);
+    two.insert(two.end(), packed.begin(), packed.end());
+    std::vector<char> expected(data);
+    expected.insert(expected.end(), data.begin(), data.end());
+
+    Lz4Decompressor dec;
+    test.boolean("concatenated frames", decompressChunked(dec, two, 4096) == expected);
+  }
+
+  {
+    std::vector<char> bad(packed);
+    bad[bad.size() - 2] ^= 0x01;
+    Lz4Decompressor dec;
+    try
+    {
+      decompressChunked(dec, bad, 4096);
+      test.failed("content checksum is verified");
+    }
+    catch (std::exception&)
+    {
+      test.passed("content checksum is verified");
+    }
+  }
+
+  {
+    const char* fname = "test_Lz4.lsf.lz4";
+    IMC::EstimatedState state;
+    {
+      FileOutput ofs(fname, METHOD_LZ4);
+      for (unsigned i = 0; i < 1000; ++i)
+      {
+        state.x = i;
+        state.setTimeStamp(i);
+        IMC::Packet::serialize(&state, ofs);
+      }
+    }
+
+    test.boolean("method is detected", Compression::Factory::detect(fname) == METHOD_LZ4);
+
+    unsigned count = 0;
+    {
+      FileInput ifs(fname, METHOD_LZ4);
+      IMC::Message* msg = NULL;
+      while ((msg = IMC::Packet::deserialize(ifs)) != NULL)
+      {
+        if (static_cast<IMC::EstimatedState*>(msg)->x == count)
+          ++count;
+        delete msg;
+      }
+    }
+
+    test.boolean("log file round trip", count == 1000);
+    std::remove(fname);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,97 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <sstream>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! Compute the manifest of a string.
+static Manifest
+make(const std::string& data, uint32_t block_size)
+{
+  std::istringstream is(data);
+  Manifest manifest(block_size);
+  manifest.compute(is);
+  return manifest;
+}
+
+int
+main(void)
+{
+  Test test("FileSystem::Manifest");
+
+  std::string data;
+  for (unsigned i = 0; i < 10000; ++i)
+    data.push_back((char)(i * 31 + i / 7));
+
+  Manifest remote = make(data, 1000);
+  test.boolean("block count", remote.getBlockCount() == 10 && remote.getSize() == 10000);
+  test.boolean("identical copies", remote.diff(make(data, 1000)).empty());
+
+  std::vector<Manifest::Range> ranges = remote.diff(Manifest(1000));
+  test.boolean("missing copy is one range",
+               ranges.size() == 1 && ranges[0].first == 0 && ranges[0].second == 10000);
+
+  ranges = remote.diff(Manifest(1000), 4000);
+  test.boolean("ranges are split",
+               ranges.size() == 3 && ranges[2].first == 8000 && ranges[2].second == 2000);
+
+  // Truncated copy with a partial last block.
+  ranges = remote.diff(make(data.substr(0, 4500), 1000));
+  test.boolean("truncated copy resumes at partial block",
+               ranges.size() == 1 && ranges[0].first == 4000 && ranges[0].second == 6000);
+
+  // Changed bytes in two separate blocks.
+  std::string changed(data);
+  changed[1500] ^= 1;
+  changed[7000] ^= 1;
+  ranges = remote.diff(make(changed, 1000));
+  test.boolean("changed blocks",
+               ranges.size() == 2 && ranges[0].first == 1000 && ranges[0].second == 1000
+               && ranges[1].first == 7000 && ranges[1].second == 1000);
+
+  // Copy with the same prefix but a different last block length.
+  std::string grown(data + "abc");
+  ranges = make(grown, 1000).diff(remote);
+  test.boolean("grown file",
+               ranges.size() == 1 && ranges[0].first == 10000 && ranges[0].second == 3);
+
+  Manifest parsed;
+  test.boolean("text round trip",
+               parsed.parse(remote.str()) && parsed.str() == remote.str() && parsed.diff(remote).empty());
+  test.boolean("invalid text is rejected", !parsed.parse("DMAN 1 10000 1000\n0000\n"));
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,233 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <sstream>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+#include <DUNE/IMC/Views.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+static void
+swap(ByteBuffer& bfr, unsigned offset, unsigned size)
+{
+  uint8_t* ptr = bfr.getBuffer() + offset;
+  for (unsigned i = 0; i < size / 2; ++i)
+    std::swap(ptr[i], ptr[size - 1 - i]);
+}
+
+int
+main(void)
+{
+  Test test("IMC::MessageView");
+
+  {
+    IMC::EstimatedState msg;
+    msg.setTimeStamp(1.5e9);
+    msg.setSource(0x2000);
+    msg.setSourceEntity(12);
+    msg.setDestination(0x4001);
+    msg.setDestinationEntity(3);
+    msg.lat = 0.71;
+    msg.depth = 12.5f;
+    msg.alt = -1.0f;
+
+    ByteBuffer bfr;
+    uint16_t size = IMC::Packet::serialize(&msg, bfr);
+
+    IMC::MessageView view(bfr.getBuffer(), size);
+    test.boolean("header fields", view.getId() == DUNE_IMC_ESTIMATEDSTATE
+                 && view.getTimeStamp() == 1.5e9 && view.getSource() == 0x2000
+                 && view.getSourceEntity() == 12 && view.getDestination() == 0x4001
+                 && view.getDestinationEntity() == 3 && view.getName() == "EstimatedState");
+
+    IMC::EstimatedStateView state(view);
+    test.boolean("fixed fields", state.lat() == 0.71 && state.depth() == 12.5f && state.alt() == -1.0f);
+
+    IMC::Message* copy = view.toMessage();
+    test.boolean("converts to message", *copy == msg);
+    delete copy;
+
+    try
+    {
+      IMC::EntityInfoView info(view);
+      test.failed("narrowing to another type is rejected");
+    }
+    catch (IMC::InvalidMessageId&)
+    {
+      test.passed("narrowing to another type is rejected");
+    }
+
+    bfr.getBuffer()[30] ^= 0x01;
+    try
+    {
+      IMC::MessageView bad(bfr.getBuffer(), size);
+      test.failed("invalid CRC is rejected");
+    }
+    catch (IMC::InvalidCrc&)
+    {
+      test.passed("invalid CRC is rejected");
+    }
+  }
+
+  {
+    IMC::PlanSpecification spec;
+    spec.plan_id = "survey";
+    spec.description = "lawn mower";
+    for (unsigned i = 0; i < 3; ++i)
+    {
+      IMC::PlanManeuver man;
+      man.maneuver_id = String::str("goto%u", i);
+      IMC::Goto go;
+      go.lat = i * 0.1;
+      man.data.set(go);
+      spec.maneuvers.push_back(man);
+    }
+    spec.start_man_id = "goto0";
+
+    IMC::PlanControl pc;
+    pc.setSource(0x0001);
+    pc.type = IMC::PlanControl::PC_REQUEST;
+    pc.op = IMC::PlanControl::PC_START;
+    pc.request_id = 7;
+    pc.plan_id = "survey";
+    pc.flags = IMC::PlanControl::FLG_IGNORE_ERRORS;
+    pc.arg.set(spec);
+    pc.info = "from view test";
+
+    ByteBuffer bfr;
+    uint16_t size = IMC::Packet::serialize(&pc, bfr);
+    IMC::PlanControlView view(bfr.getBuffer(), size);
+
+    test.boolean("variable size fields", view.plan_id() == "survey" && view.info() == "from view test"
+                 && view.flags() == IMC::PlanControl::FLG_IGNORE_ERRORS && view.request_id() == 7);
+
+    IMC::PlanSpecificationView arg(view.arg());
+    test.boolean("inline message", arg.getId() == DUNE_IMC_PLANSPECIFICATION && arg.getSource() == 0x0001
+                 && arg.plan_id() == "survey" && arg.start_man_id() == "goto0");
+
+    IMC::MessageListView list = arg.maneuvers();
+    bool ok = list.size() == 3;
+    for (unsigned i = 0; ok && i < list.size(); ++i)
+    {
+      IMC::PlanManeuverView man(list.get(i));
+      IMC::GotoView go(man.data());
+      ok = man.maneuver_id() == String::str("goto%u", i) && go.lat() == i * 0.1;
+    }
+    test.boolean("message list", ok && list.get(1).getId() == DUNE_IMC_PLANMANEUVER);
+    test.boolean("empty message list", arg.transitions().empty());
+
+    // Nested messages inherit the header of the enclosing packet.
+    IMC::PlanSpecification* nested = IMC::PlanSpecificationView(view.arg()).toMessage();
+    IMC::Message* full = IMC::Packet::deserialize(bfr.getBuffer(), size);
+    test.boolean("inline message converts to message",
+                 *nested == *static_cast<IMC::PlanControl*>(full)->arg.get());
+    delete nested;
+    delete full;
+
+    IMC::PlanControl* copy = view.toMessage();
+    test.boolean("typed conversion", *copy == pc);
+    delete copy;
+
+    pc.arg.clear();
+    size = IMC::Packet::serialize(&pc, bfr);
+    IMC::PlanControlView empty(bfr.getBuffer(), size);
+    test.boolean("null inline message", empty.arg().isNull() && empty.info() == "from view test");
+
+    // Corrupt the length of 'plan_id' and fix the CRC.
+    uint16_t len = 0xfff0;
+    std::memcpy(bfr.getBuffer() + DUNE_IMC_CONST_HEADER_SIZE + 4, &len, 2);
+    uint16_t crc = CRC16::compute(bfr.getBuffer(), size - 2);
+    std::memcpy(bfr.getBuffer() + size - 2, &crc, 2);
+    try
+    {
+      IMC::MessageView bad(bfr.getBuffer(), size);
+      test.failed("inconsistent field layout is rejected");
+    }
+    catch (IMC::BufferTooShort&)
+    {
+      test.passed("inconsistent field layout is rejected");
+    }
+  }
+
+  {
+    IMC::EntityInfo msg;
+    msg.id = 42;
+    msg.label = "Navigation";
+    msg.setTimeStamp(10.0);
+
+    // Build a packet with the opposite byte order.
+    ByteBuffer bfr;
+    uint16_t size = IMC::Packet::serialize(&msg, bfr);
+    swap(bfr, 0, 2);
+    swap(bfr, 2, 2);
+    swap(bfr, 4, 2);
+    swap(bfr, 6, 8);
+    swap(bfr, 14, 2);
+    swap(bfr, 17, 2);
+    swap(bfr, DUNE_IMC_CONST_HEADER_SIZE + 1, 2);
+    uint16_t crc = CRC16::compute(bfr.getBuffer(), size - 2);
+    std::memcpy(bfr.getBuffer() + size - 2, &crc, 2);
+    swap(bfr, size - 2, 2);
+
+    IMC::MessageView view(bfr.getBuffer(), size);
+    test.boolean("reversed byte order", view.isReversed() && view.getSubId() == 42
+                 && view.getTimeStamp() == 10.0 && IMC::EntityInfoView(view).label() == "Navigation");
+
+    IMC::Message* copy = view.toMessage();
+    test.boolean("reversed packet converts to message", *copy == msg);
+    delete copy;
+  }
+
+  {
+    std::stringstream ss;
+    IMC::Heartbeat hb;
+    IMC::Temperature temp;
+    temp.value = 21.5f;
+    IMC::Packet::serialize(&hb, ss);
+    IMC::Packet::serialize(&temp, ss);
+
+    ByteBuffer bfr;
+    unsigned count = 0;
+    uint16_t size;
+    bool ok = true;
+    while ((size = IMC::Packet::read(ss, bfr)) != 0)
+    {
+      IMC::MessageView view(bfr.getBuffer(), size);
+      if (count++ == 1)
+        ok = IMC::TemperatureView(view).value() == 21.5f;
+    }
+    test.boolean("packets are read from streams", ok && count == 2);
+  }
+
+  return test.getReturnValue();
+}
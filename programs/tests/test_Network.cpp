@@ -30,11 +30,16 @@
 
 // DUNE headers.
 #include <DUNE/Network.hpp>
+#include <DUNE/IO/Poll.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/Delay.hpp>
 
 // Local headers.
 #include "Test.hpp"
 
 using namespace DUNE::Network;
+using DUNE::IO::Poll;
+using DUNE::Time::Clock;
 
 int
 main(void)
@@ -84,5 +89,41 @@ main(void)
     test.boolean("IP address resolution", a.resolve());
   }
 
+  {
+    const uint16_t port = 6099;
+    UDPSocket rx;
+    rx.bind(port, Address::Loopback);
+    rx.enableTimestamps(true);
+
+    UDPSocket tx;
+    const uint8_t data[] = {'D', 'U', 'N', 'E'};
+    double before = Clock::getSinceEpoch();
+    tx.write(data, sizeof(data), Address::Loopback, port);
+
+    uint8_t bfr[16] = {0};
+    double tstamp = 0;
+    size_t rv = 0;
+    if (Poll::poll(rx, 1.0))
+      rv = rx.read(bfr, sizeof(bfr), tstamp);
+    double after = Clock::getSinceEpoch();
+
+    test.boolean("UDP receive timestamp (data)", rv == sizeof(data) && bfr[0] == 'D');
+    test.boolean("UDP receive timestamp (time)", tstamp >= before - 0.001 && tstamp <= after);
+
+    // Kernel timestamps follow the time scale.
+    Clock::setScale(10.0);
+    DUNE::Time::Delay::wait(1.0);
+    before = Clock::getSinceEpoch();
+    tx.write(data, sizeof(data), Address::Loopback, port);
+
+    rv = 0;
+    if (Poll::poll(rx, 1.0))
+      rv = rx.read(bfr, sizeof(bfr), tstamp);
+    after = Clock::getSinceEpoch();
+    Clock::setScale(1.0);
+
+    test.boolean("UDP receive timestamp (scaled)", rv == sizeof(data) && tstamp >= before - 0.01 && tstamp <= after);
+  }
+
   return 0;
 }
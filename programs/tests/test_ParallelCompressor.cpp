@@ -0,0 +1,104 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! Write a log file.
+static void
+writeLog(const char* fname, Methods method, unsigned threads)
+{
+  FileOutput ofs(fname, method, threads);
+  IMC::EstimatedState state;
+
+  for (unsigned i = 0; i < 20000; ++i)
+  {
+    state.x = i;
+    state.setTimeStamp(i);
+    IMC::Packet::serialize(&state, ofs);
+  }
+}
+
+//! Read a file.
+static std::vector<char>
+readFile(const char* fname)
+{
+  std::ifstream ifs(fname, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+int
+main(void)
+{
+  Test test("Compression::ParallelCompressor");
+
+  const Methods methods[] = {METHOD_GZIP, METHOD_BZIP2};
+  const char* serial = "test_ParallelCompressor.0";
+  const char* parallel = "test_ParallelCompressor.1";
+
+  for (unsigned m = 0; m < sizeof(methods) / sizeof(methods[0]); ++m)
+  {
+    std::string name = Compression::Factory::method(methods[m]);
+
+    writeLog(serial, methods[m], 0);
+    writeLog(parallel, methods[m], 3);
+
+    std::vector<char> a = readFile(serial);
+    std::vector<char> b = readFile(parallel);
+    test.boolean((name + ": output matches serial compression").c_str(), !a.empty() && a == b);
+
+    unsigned count = 0;
+    {
+      FileInput ifs(parallel, methods[m]);
+      IMC::Message* msg = NULL;
+      while ((msg = IMC::Packet::deserialize(ifs)) != NULL)
+      {
+        if (static_cast<IMC::EstimatedState*>(msg)->x == count)
+          ++count;
+        delete msg;
+      }
+    }
+
+    test.boolean((name + ": messages are read in order").c_str(), count == 20000);
+  }
+
+  std::remove(serial);
+  std::remove(parallel);
+
+  return test.getReturnValue();
+}
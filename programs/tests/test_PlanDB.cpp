@@ -0,0 +1,206 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_WAIT_H)
+#  include <sys/wait.h>
+#endif
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+#include <Plan/DB/Index.hpp>
+#include <Plan/DB/SQLiteStorage.hpp>
+
+static IMC::PlanDBInformation
+makePlan(const std::string& plan_id, std::vector<char>& data)
+{
+  data.assign(plan_id.size() * 10, plan_id[0]);
+
+  IMC::PlanDBInformation info;
+  info.plan_id = plan_id;
+  info.plan_size = data.size();
+  info.change_time = 100.0;
+  info.change_sid = 0x1234;
+  info.change_sname = "test";
+  info.md5.resize(16);
+  MD5::compute((uint8_t*)&data[0], data.size(), (uint8_t*)&info.md5[0]);
+  return info;
+}
+
+static void
+load(Plan::DB::Storage& storage, Plan::DB::Index& index)
+{
+  std::vector<IMC::PlanDBInformation> plans;
+  storage.load(plans);
+
+  IMC::PlanDBState last_change;
+  storage.loadLastChange(last_change);
+
+  index.clear();
+  for (size_t i = 0; i < plans.size(); ++i)
+    index.set(plans[i]);
+
+  index.setLastChange(last_change.change_time, last_change.change_sid,
+                      last_change.change_sname);
+  index.commit();
+}
+
+static void
+removeDatabase(const Path& path)
+{
+  std::remove(path.c_str());
+  std::remove((path.str() + "-wal").c_str());
+  std::remove((path.str() + "-shm").c_str());
+}
+
+int
+main(void)
+{
+  Test test("Plan::DB");
+
+  Path path("test_PlanDB.db");
+  removeDatabase(path);
+
+  std::vector<char> data;
+  IMC::PlanDBState state;
+
+  {
+    Plan::DB::SQLiteStorage storage(path.str(), 0x1234, "test");
+    Plan::DB::Index index;
+    load(storage, index);
+    index.fill(state);
+    test.boolean("new database is empty", state.plan_count == 0);
+
+    storage.begin();
+    IMC::PlanDBInformation info = makePlan("alpha", data);
+    storage.store(info, data);
+    storage.setLastChange(100.0, 0x1234, "test");
+    index.set(info);
+    index.setLastChange(100.0, 0x1234, "test");
+    storage.commit();
+    index.commit();
+
+    index.fill(state);
+    test.boolean("committed plan is reported", state.plan_count == 1
+                 && state.plans_info.size() == 1 && state.change_time == 100.0);
+
+    std::vector<char> committed_md5 = state.md5;
+
+    // Changes of an open transaction are not reported.
+    storage.begin();
+    info = makePlan("bravo", data);
+    storage.store(info, data);
+    storage.setLastChange(200.0, 0x1234, "test");
+    index.set(info);
+    index.setLastChange(200.0, 0x1234, "test");
+
+    index.fill(state);
+    test.boolean("state during batch is committed state",
+                 state.plan_count == 1 && state.plan_size == 50
+                 && state.md5 == committed_md5 && state.change_time == 100.0);
+    test.boolean("plan is indexed during batch", index.find("bravo") != NULL);
+
+    storage.rollback();
+    index.rollback();
+    index.fill(state);
+    test.boolean("rollback restores index", index.find("bravo") == NULL
+                 && index.find("alpha") != NULL && index.getSize() == 50
+                 && state.plan_count == 1);
+
+    storage.begin();
+    storage.store(info, data);
+    index.set(info);
+    storage.commit();
+    index.commit();
+    index.fill(state);
+    test.boolean("batch is reported once committed", state.plan_count == 2
+                 && state.md5 != committed_md5);
+  }
+
+#if defined(DUNE_SYS_HAS_FORK)
+  // Commit a plan and die in the middle of the next transaction
+  // without closing the database.
+  pid_t pid = fork();
+  if (pid == 0)
+  {
+    Plan::DB::SQLiteStorage storage(path.str(), 0x1234, "test");
+    storage.begin();
+    IMC::PlanDBInformation info = makePlan("charlie", data);
+    storage.store(info, data);
+    storage.setLastChange(300.0, 0x1234, "test");
+    storage.commit();
+
+    storage.begin();
+    info = makePlan("delta", data);
+    storage.store(info, data);
+    storage.setLastChange(400.0, 0x1234, "test");
+    _exit(0);
+  }
+
+  int status = -1;
+  waitpid(pid, &status, 0);
+
+  std::ifstream wal((path.str() + "-wal").c_str());
+  test.boolean("write-ahead log is left behind", wal.is_open());
+  wal.close();
+
+  {
+    Plan::DB::SQLiteStorage storage(path.str(), 0x1234, "test");
+    Plan::DB::Index index;
+    load(storage, index);
+    index.fill(state);
+    test.boolean("committed plan is recovered from log",
+                 index.find("charlie") != NULL && state.change_time == 300.0);
+    test.boolean("uncommitted plan is not recovered",
+                 index.find("delta") == NULL && state.plan_count == 3);
+
+    std::vector<char> stored;
+    makePlan("charlie", data);
+    test.boolean("recovered plan data is intact", storage.get("charlie", stored)
+                 && stored == data);
+  }
+#endif
+
+  removeDatabase(path);
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,164 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+static bool
+readFile(const Path& path, std::vector<char>& data)
+{
+  std::ifstream ifs(path.c_str(), std::ios::binary);
+  if (!ifs.is_open())
+    return false;
+
+  data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("Hardware::Recorder");
+
+  Path dir = Path("test_Recorder.tmp");
+  Path file_a = dir / "a" / "Data.bin";
+  Path file_b = dir / "b" / "Data.bin";
+  if (dir.exists())
+    dir.remove(Path::MODE_RECURSIVE);
+
+  std::vector<char> data;
+
+  {
+    Recorder rec(4, 64);
+
+    rec.open(file_a);
+    test.boolean("file is open", rec.isOpen() && rec.getPath() == file_a);
+
+    uint8_t record[40];
+    bool ok = true;
+    for (unsigned i = 0; i < 100; ++i)
+    {
+      std::memset(record, (int)i, sizeof(record));
+      ok = ok && rec.write(record, sizeof(record));
+      if ((i % 5) == 4)
+        rec.sync();
+    }
+
+    test.boolean("records are queued", ok);
+
+    rec.sync();
+    Recorder::Statistics stats = rec.getStatistics();
+    test.boolean("records are written", stats.written == 4000 && stats.backlog == 0);
+
+    uint8_t large[1024] = {0};
+    test.boolean("oversized record is dropped", !rec.write(large, sizeof(large)));
+    test.boolean("dropped bytes are counted", rec.getStatistics().dropped == sizeof(large));
+
+    rec.open(file_b);
+    const void* blocks[] = {"rot", "ated"};
+    size_t sizes[] = {3, 4};
+    test.boolean("blocks are queued as one record", rec.write(blocks, sizes, 2));
+    rec.close();
+    rec.sync();
+    test.boolean("recorder is closed", !rec.isOpen());
+
+    bool match = readFile(file_a, data) && data.size() == 4000;
+    for (size_t i = 0; match && i < data.size(); ++i)
+      match = (data[i] == (char)(i / sizeof(record)));
+    test.boolean("records are written in order", match);
+
+    test.boolean("rotation writes to new file",
+                 readFile(file_b, data) && std::string(data.begin(), data.end()) == "rotated");
+
+    rec.open(file_b);
+    rec.write("!", 1);
+    rec.close();
+    rec.sync();
+    test.boolean("existing file is appended",
+                 readFile(file_b, data) && std::string(data.begin(), data.end()) == "rotated!");
+
+    Path file_e = dir / "e" / "Data.bin";
+    rec.open(file_e);
+    rec.close(true);
+    rec.sync();
+    test.boolean("empty file is removed", !file_e.exists());
+
+    rec.open(file_b);
+    rec.close(true);
+    rec.sync();
+    test.boolean("non-empty file is kept", file_b.size() == 8);
+  }
+
+  if (Path("/dev/full").exists())
+  {
+    Recorder rec(4, 64);
+    rec.open("/dev/full");
+    rec.write("full", 4);
+    rec.sync();
+    test.boolean("storage failure is reported", rec.hasFailed() && rec.getStatistics().error == ENOSPC);
+    test.boolean("failed data is dropped", !rec.write("full", 4) && rec.getStatistics().dropped == 8);
+
+    rec.open(file_a);
+    test.boolean("recording resumes on open", !rec.hasFailed() && rec.write("x", 1));
+  }
+
+  {
+    Recorder rec(8, 4096);
+    rec.open(dir / "c" / "Data.bin");
+
+    std::vector<uint8_t> record(1000, 0xaa);
+    Counter<double> timer(0.2);
+    unsigned queued = 0;
+    while (!timer.overflow())
+    {
+      if (rec.write(&record[0], record.size()))
+        ++queued;
+    }
+
+    rec.close();
+    rec.sync();
+
+    Recorder::Statistics stats = rec.getStatistics();
+    test.boolean("no data lost under load",
+                 stats.written == queued * record.size()
+                 && (dir / "c" / "Data.bin").size() == (int64_t)stats.written);
+  }
+
+  dir.remove(Path::MODE_RECURSIVE);
+
+  return test.getReturnValue();
+}
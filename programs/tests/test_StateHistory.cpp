@@ -0,0 +1,159 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! Build a state whose fields are linear functions of time.
+static IMC::EstimatedState
+makeState(double t)
+{
+  IMC::EstimatedState state;
+  state.setTimeStamp(t);
+  state.lat = 0.7 + t * 1e-7;
+  state.lon = -0.15 - t * 1e-7;
+  state.height = 10.0;
+  state.depth = t * 0.1;
+  state.alt = 20.0 - t * 0.1;
+  state.u = t;
+  state.psi = Angles::normalizeRadian(t * 0.05);
+  return state;
+}
+
+//! Writer that keeps adding states while a reader checks them.
+class Writer: public Concurrency::Thread
+{
+public:
+  Writer(Navigation::StateHistory& history):
+    m_history(history)
+  { }
+
+private:
+  Navigation::StateHistory& m_history;
+
+  void
+  run(void)
+  {
+    double t = 1000;
+    while (!isStopping())
+    {
+      m_history.push(makeState(t));
+      t += 0.01;
+    }
+  }
+};
+
+int
+main(void)
+{
+  Test test("Navigation::StateHistory");
+
+  Navigation::StateHistory history(64);
+  IMC::EstimatedState state;
+  double delta = 0;
+
+  test.boolean("empty history", !history.get(0, state));
+
+  for (unsigned i = 0; i < 100; ++i)
+    history.push(makeState(i));
+
+  test.boolean("capacity is bounded", history.size() == 64);
+  test.boolean("older states are ignored", !history.push(makeState(50)));
+
+  test.boolean("exact sample", history.get(70, state, &delta) && delta == 0 && state.u == 70);
+  test.boolean("linear interpolation",
+               history.get(70.25, state) && std::fabs(state.u - 70.25) < 1e-4
+               && std::fabs(state.depth - 7.025) < 1e-4);
+  test.boolean("absolute position",
+               state.x == 0 && std::fabs(state.lat - (0.7 + 70.25e-7)) < 1e-12);
+
+  test.boolean("overwritten states use oldest", history.get(10, state, &delta)
+               && state.u == 36 && delta == 26);
+
+  history.setTolerance(1.0);
+  test.boolean("tolerance rejects old states", !history.get(10, state));
+  test.boolean("tolerance accepts recent states", history.get(99.5, state));
+
+  history.setInterpolation(Navigation::StateHistory::INTERP_NEAREST);
+  test.boolean("nearest sample", history.get(80.6, state) && state.u == 81);
+
+  {
+    Navigation::StateHistory wrap(8, Navigation::StateHistory::INTERP_SLERP);
+    IMC::EstimatedState a;
+    a.setTimeStamp(1);
+    a.psi = Angles::radians(170);
+    IMC::EstimatedState b;
+    b.setTimeStamp(2);
+    b.psi = Angles::radians(-170);
+    wrap.push(a);
+    wrap.push(b);
+
+    wrap.get(1.5, state);
+    test.boolean("slerp crosses +/-180", std::fabs(std::fabs(Angles::degrees(state.psi)) - 180) < 1e-3);
+
+    wrap.setInterpolation(Navigation::StateHistory::INTERP_LINEAR);
+    wrap.get(1.75, state);
+    test.boolean("linear crosses +/-180", std::fabs(Angles::degrees(state.psi) + 175) < 1e-3);
+
+    wrap.clear();
+    test.boolean("cleared history", wrap.size() == 0 && !wrap.get(1.5, state));
+  }
+
+  {
+    Navigation::StateHistory shared(32);
+    shared.push(makeState(999));
+
+    Writer writer(shared);
+    writer.start();
+
+    unsigned bad = 0;
+    for (unsigned i = 0; i < 200000; ++i)
+    {
+      // Newest state.
+      shared.get(1e9, state);
+
+      // Query around the oldest states, which are being overwritten.
+      double t = state.u - std::fmod(i * 0.0137, 0.4);
+      double delta = 0;
+      if (shared.get(t, state, &delta) && std::fabs(state.u - t) > delta + 1e-3)
+        ++bad;
+    }
+
+    writer.stopAndJoin();
+    test.boolean("concurrent reads are consistent", bad == 0);
+  }
+
+  return test.getReturnValue();
+}
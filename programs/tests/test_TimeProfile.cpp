@@ -0,0 +1,152 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://www.lsts.pt/dune/licence.                                        *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+static IMC::PlanManeuver*
+createGoto(const std::string& id, double lat, double lon)
+{
+  IMC::Goto man;
+  man.lat = Angles::radians(lat);
+  man.lon = Angles::radians(lon);
+  man.z = 2.0;
+  man.z_units = IMC::Z_DEPTH;
+  man.speed = 1.5;
+  man.speed_units = IMC::SUNITS_METERS_PS;
+
+  IMC::PlanManeuver* pman = new IMC::PlanManeuver;
+  pman->maneuver_id = id;
+  pman->data.set(man);
+  return pman;
+}
+
+static IMC::EstimatedState
+createState(double lat, double lon)
+{
+  IMC::EstimatedState state;
+  state.lat = Angles::radians(lat);
+  state.lon = Angles::radians(lon);
+  return state;
+}
+
+static bool
+sameProfiles(const Plans::TimeProfile& a, const Plans::TimeProfile& b)
+{
+  if (a.size() != b.size() || a.lastValid() != b.lastValid())
+    return false;
+
+  Plans::TimeProfile::const_iterator itr = a.begin();
+  for (; itr != a.end(); ++itr)
+  {
+    Plans::TimeProfile::const_iterator other = b.find(itr->first);
+    if (other == b.end())
+      return false;
+
+    if (itr->second.durations.size() != other->second.durations.size())
+      return false;
+
+    for (unsigned i = 0; i < itr->second.durations.size(); ++i)
+    {
+      if (std::fabs(itr->second.durations[i] - other->second.durations[i]) > 0.01)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+int
+main(void)
+{
+  Test test("Plans::TimeProfile");
+
+  std::vector<float> act(1, 100.0f);
+  std::vector<float> rpm(1, 1500.0f);
+  std::vector<float> mps(1, 2.0f);
+  Plans::SpeedModel model(act, rpm, mps);
+
+  std::vector<IMC::PlanManeuver*> nodes;
+  nodes.push_back(createGoto("1", 41.185, -8.706));
+  nodes.push_back(createGoto("2", 41.186, -8.705));
+  nodes.push_back(createGoto("3", 41.184, -8.704));
+
+  IMC::EstimatedState start = createState(41.180, -8.710);
+  IMC::EstimatedState other = createState(41.185, -8.706);
+
+  Plans::TimeProfile full(&model);
+  full.parse(nodes, &start);
+
+  Plans::TimeProfile reference(&model);
+  reference.parse(nodes, &other);
+
+  {
+    Plans::TimeProfile reused(&model);
+    test.boolean("reference is reused", reused.parse(nodes, &start, reference));
+    test.boolean("reused profiles match full parse", sameProfiles(full, reused));
+    test.boolean("duration is finite", reused.isDurationFinite());
+  }
+
+  {
+    Plans::TimeProfile reused(&model);
+    reused.parse(nodes, &other);
+    reused.parse(nodes, &start, reference);
+    test.boolean("previous parse is discarded", sameProfiles(full, reused));
+  }
+
+  {
+    IMC::Elevator elev;
+    elev.speed = 1.5;
+    elev.speed_units = IMC::SUNITS_METERS_PS;
+
+    IMC::PlanManeuver* first = nodes.front();
+    nodes.front() = new IMC::PlanManeuver;
+    nodes.front()->maneuver_id = "1";
+    nodes.front()->data.set(elev);
+
+    Plans::TimeProfile reused(&model);
+    test.boolean("non-anchored first maneuver is rejected",
+                 !reused.parse(nodes, &start, reference));
+
+    delete nodes.front();
+    nodes.front() = first;
+  }
+
+  for (unsigned i = 0; i < nodes.size(); ++i)
+    delete nodes[i];
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,228 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+// Utility program to convert LSF logs to column files and to query them.   *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Open a log, which may be compressed.
+//! @param[in] path log file or log folder.
+//! @return input stream or NULL if the log does not exist.
+static std::istream*
+openLog(Path path)
+{
+  if (path.isDirectory())
+  {
+    Path base = path / "Data.lsf";
+    path = base;
+    if (!path.isFile())
+      path = base + ".gz";
+    if (!path.isFile())
+      path = base + ".lz4";
+  }
+
+  if (!path.isFile())
+    return NULL;
+
+  Compression::Methods method = Compression::Factory::detect(path.c_str());
+  if (method == Compression::METHOD_UNKNOWN)
+    return new std::ifstream(path.c_str(), std::ios::binary);
+
+  return new Compression::FileInput(path.c_str(), method);
+}
+
+//! Convert a log.
+//! @param[in] is log stream.
+//! @param[in] writer column writer.
+//! @return number of converted messages.
+static unsigned
+convert(std::istream& is, IMC::ColumnWriter& writer)
+{
+  ByteBuffer bfr;
+  unsigned count = 0;
+  uint16_t size = 0;
+
+  while (true)
+  {
+    try
+    {
+      if ((size = IMC::Packet::read(is, bfr)) == 0)
+        break;
+
+      writer.write(IMC::MessageView(bfr.getBuffer(), size));
+      ++count;
+    }
+    catch (IMC::InvalidCrc&)
+    {
+      std::cerr << "WARNING: skipping packet with invalid CRC" << std::endl;
+    }
+  }
+
+  writer.close();
+  return count;
+}
+
+int
+main(int argc, char** argv)
+{
+  OptionParser options;
+  options.executable("dune-lsf2columns")
+  .program(DUNE_SHORT_NAME)
+  .copyright(DUNE_COPYRIGHT)
+  .email(DUNE_CONTACT)
+  .version(getFullVersion())
+  .date(getCompileDate())
+  .arch(DUNE_SYSTEM_NAME)
+  .description("Convert an LSF log to one file per message, entity and field, "
+               "or print the values of a field of converted logs.")
+  .add("-i", "--input",
+       "Log file or log folder to convert", "FILE")
+  .add("-o", "--output",
+       "Folder of column files", "FOLDER")
+  .add("-z", "--compression",
+       "Block compression: none, zlib, gzip, bzip2 or lz4 (default: lz4)", "METHOD")
+  .add("-b", "--block-rows",
+       "Number of rows of each block (default: 4096)", "ROWS")
+  .add("-q", "--query",
+       "Print the values of a field, given as MESSAGE.ENTITY.FIELD", "COLUMN")
+  .add("-s", "--start",
+       "Start time of the query (default: first value)", "TIME")
+  .add("-e", "--end",
+       "End time of the query (default: last value)", "TIME");
+
+  if (!options.parse(argc, argv))
+  {
+    if (options.bad())
+      std::cerr << "ERROR: " << options.error() << std::endl;
+    options.usage();
+    return 1;
+  }
+
+  std::string output = options.value("--output");
+  std::string input = options.value("--input");
+  std::string query = options.value("--query");
+  if (output.empty() || input.empty() == query.empty())
+  {
+    std::cerr << "ERROR: you must specify the output folder and either an input log or a query." << std::endl;
+    options.usage();
+    return 1;
+  }
+
+  try
+  {
+    if (!query.empty())
+    {
+      std::vector<std::string> parts;
+      String::split(query, ".", parts);
+      unsigned entity = 0;
+      if (parts.size() != 3 || !castLexical(parts[1], entity))
+      {
+        std::cerr << "ERROR: invalid column '" << query << "'." << std::endl;
+        return 1;
+      }
+
+      fp64_t start = -1e300;
+      fp64_t end = 1e300;
+      if (!options.value("--start").empty())
+        castLexical(options.value("--start"), start);
+      if (!options.value("--end").empty())
+        castLexical(options.value("--end"), end);
+
+      IMC::ColumnReader reader(output);
+      std::vector<fp64_t> times;
+      std::vector<fp64_t> values;
+      reader.query(parts[0], entity, parts[2], start, end, times, values);
+
+      for (unsigned i = 0; i < times.size(); ++i)
+        std::printf("%.6f %.9g\n", times[i], values[i]);
+
+      return 0;
+    }
+
+    Compression::Methods method = Compression::METHOD_LZ4;
+    std::string method_name = options.value("--compression");
+    if (method_name == "none")
+    {
+      method = Compression::METHOD_UNKNOWN;
+    }
+    else if (!method_name.empty())
+    {
+      method = Compression::Factory::method(method_name);
+      if (method == Compression::METHOD_UNKNOWN)
+      {
+        std::cerr << "ERROR: unknown compression method '" << method_name << "'." << std::endl;
+        return 1;
+      }
+    }
+
+    unsigned rows = 4096;
+    if (!options.value("--block-rows").empty())
+      castLexical(options.value("--block-rows"), rows);
+
+    std::istream* is = openLog(input);
+    if (is == NULL)
+    {
+      std::cerr << "ERROR: " << input << " does not exist." << std::endl;
+      return 1;
+    }
+
+    IMC::ColumnWriter writer(output, method, rows);
+    unsigned count = 0;
+
+    try
+    {
+      count = convert(*is, writer);
+    }
+    catch (...)
+    {
+      delete is;
+      throw;
+    }
+
+    delete is;
+    std::cerr << "Converted " << count << " messages to "
+              << writer.getColumnCount() << " columns." << std::endl;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -48,8 +48,8 @@ usage(void)
             << "\t-D addr: filter using destination adreess\n"
             << "\t-v [0-2]: verbosity level\n\n"
             << "f1 ... fn can be:\n"
-            << "\t* Gzipped LSF files (.gz extension)\n"
-            << "\t* LLF log dir names (will look for Data.lsf.gz in it)\n"
+            << "\t* Compressed LSF files (.gz, .bz2 or .lz4 extension)\n"
+            << "\t* LLF log dir names (will look for Data.lsf.gz or Data.lsf.lz4 in it)\n"
             << "\t* plain LSF files\n";
 }
 
@@ -194,9 +194,12 @@ main(int argc, char** argv)
 
     if (file.isDirectory())
     {
-      file = file / "Data.lsf";
+      Path base = file / "Data.lsf";
+      file = base;
       if (!file.isFile())
-        file += ".gz";
+        file = base + ".gz";
+      if (!file.isFile())
+        file = base + ".lz4";
     }
 
     if (!file.isFile())
@@ -226,14 +229,23 @@ main(int argc, char** argv)
     double time_origin = m->getTimeStamp();
     if (begin >= 0)
     {
-      do
+      if (m->getTimeStamp() - time_origin < begin)
       {
-        if (m->getTimeStamp() - time_origin >= begin)
-          break;
         delete m;
-        m = IMC::Packet::deserialize(*is);
+        m = 0;
+
+        // Skip packets before the start time without decoding them.
+        uint16_t size;
+        while ((size = IMC::Packet::read(*is, bb)) != 0)
+        {
+          IMC::MessageView view(bb.getBuffer(), size);
+          if (view.getTimeStamp() - time_origin >= begin)
+          {
+            m = view.toMessage();
+            break;
+          }
+        }
       }
-      while (m);
 
       if (!m)
       {
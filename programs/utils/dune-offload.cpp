@@ -0,0 +1,617 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+// Utility program to copy log folders from a vehicle, transferring only  *
+// the blocks that are missing or differ from the local copy.             *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+//! Maximum length of one transfer.
+static const uint64_t c_max_transfer = 8 * 1024 * 1024;
+//! Maximum number of consecutive failures of one stream.
+static const unsigned c_max_failures = 10;
+//! Maximum number of verification passes.
+static const unsigned c_max_passes = 3;
+
+//! Client of the DUNE FTP server.
+class Client
+{
+public:
+  Client(const Address& addr, uint16_t port):
+    m_sock(new TCPSocket)
+  {
+    m_sock->setReceiveTimeout(30);
+    m_sock->setSendTimeout(30);
+    m_sock->connect(addr, port);
+
+    if (readReply() != 220)
+      throw std::runtime_error("unexpected server banner");
+
+    command("USER offload", 230);
+    command("TYPE I", 200);
+  }
+
+  ~Client(void)
+  {
+    try
+    {
+      send("QUIT");
+    }
+    catch (...)
+    { }
+
+    delete m_sock;
+  }
+
+  //! Send a command and check the reply code.
+  //! @param[in] cmd command.
+  //! @param[in] code expected reply code.
+  //! @return reply text.
+  std::string
+  command(const std::string& cmd, unsigned code)
+  {
+    send(cmd);
+    std::string text;
+    unsigned rv = readReply(&text);
+    if (rv != code)
+      throw std::runtime_error(String::str("'%s' failed: %u %s", cmd.c_str(), rv, text.c_str()));
+    return text;
+  }
+
+  //! Execute a command with a data connection and collect the data.
+  //! @param[in] cmd command.
+  //! @return received data.
+  std::string
+  retrieve(const std::string& cmd)
+  {
+    std::string rv;
+    char bfr[4096];
+
+    TCPSocket* data = openData(cmd);
+    try
+    {
+      while (true)
+        rv.append(bfr, data->read(bfr, sizeof(bfr)));
+    }
+    catch (Network::ConnectionClosed&)
+    { }
+
+    delete data;
+    closeData();
+    return rv;
+  }
+
+  //! Retrieve a byte range of a file and write it to a local file.
+  //! @param[in] remote remote file.
+  //! @param[in] begin first byte.
+  //! @param[in] length number of bytes.
+  //! @param[in] local local file.
+  //! @param[in] method transfer compression.
+  //! @return number of bytes received from the network.
+  uint64_t
+  retrieve(const std::string& remote, uint64_t begin, uint64_t length,
+           const Path& local, Compression::Methods method)
+  {
+    std::fstream ofs(local.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+    ofs.seekp(begin, std::ios::beg);
+    if (!ofs)
+      throw std::runtime_error(String::str("failed to open %s", local.c_str()));
+
+    command(String::str("RANG %llu %llu", (unsigned long long)begin,
+                        (unsigned long long)(begin + length - 1)), 350);
+
+    Compression::Decompressor* dec = NULL;
+    if (method != Compression::METHOD_UNKNOWN)
+      dec = Compression::Factory::decompressor(method);
+
+    std::vector<char> in(64 * 1024);
+    std::vector<char> out(256 * 1024);
+    uint64_t received = 0;
+    uint64_t written = 0;
+
+    TCPSocket* data = openData("RETR " + remote);
+    try
+    {
+      while (true)
+      {
+        size_t n = data->read(&in[0], in.size());
+        received += n;
+
+        if (dec == NULL)
+        {
+          ofs.write(&in[0], n);
+          written += n;
+          continue;
+        }
+
+        size_t idx = 0;
+        while (idx < n || dec->pending())
+        {
+          dec->decompress(&out[0], out.size(), &in[idx], n - idx);
+          idx += dec->processed();
+          ofs.write(&out[0], dec->decompressed());
+          written += dec->decompressed();
+        }
+      }
+    }
+    catch (Network::ConnectionClosed&)
+    { }
+    catch (...)
+    {
+      delete data;
+      delete dec;
+      throw;
+    }
+
+    delete data;
+    delete dec;
+    closeData();
+
+    if (written != length || !ofs)
+      throw std::runtime_error(String::str("short transfer of %s", remote.c_str()));
+
+    return received;
+  }
+
+private:
+  //! Control connection.
+  TCPSocket* m_sock;
+  //! Received data not yet parsed.
+  std::string m_rx;
+
+  void
+  send(const std::string& cmd)
+  {
+    std::string line = cmd + "\r\n";
+    m_sock->write(line.c_str(), line.size());
+  }
+
+  //! Read one reply.
+  //! @param[out] text reply text.
+  //! @return reply code.
+  unsigned
+  readReply(std::string* text = NULL)
+  {
+    while (true)
+    {
+      size_t pos = m_rx.find("\r\n");
+      if (pos == std::string::npos)
+      {
+        char bfr[512];
+        m_rx.append(bfr, m_sock->read(bfr, sizeof(bfr)));
+        continue;
+      }
+
+      std::string line = m_rx.substr(0, pos);
+      m_rx.erase(0, pos + 2);
+
+      // Skip lines of multi-line replies.
+      unsigned code = 0;
+      if (line.size() < 4 || line[3] != ' ' || std::sscanf(line.c_str(), "%u", &code) != 1)
+        continue;
+
+      if (text)
+        *text = line.substr(4);
+      return code;
+    }
+  }
+
+  //! Open a passive data connection and issue a command using it.
+  //! @param[in] cmd command.
+  //! @return data connection.
+  TCPSocket*
+  openData(const std::string& cmd)
+  {
+    std::string text = command("PASV", 227);
+    unsigned p[6];
+    size_t pos = text.find('(');
+    if (pos == std::string::npos
+        || std::sscanf(text.c_str() + pos, "(%u,%u,%u,%u,%u,%u)", p, p + 1, p + 2, p + 3, p + 4, p + 5) != 6)
+      throw std::runtime_error("invalid reply to PASV: " + text);
+
+    TCPSocket* data = new TCPSocket;
+    try
+    {
+      data->setReceiveTimeout(30);
+      data->connect(Address(String::str("%u.%u.%u.%u", p[0], p[1], p[2], p[3]).c_str()),
+                    (p[4] << 8) | p[5]);
+      command(cmd, 150);
+    }
+    catch (...)
+    {
+      delete data;
+      throw;
+    }
+
+    return data;
+  }
+
+  //! Wait for the end of a data transfer.
+  void
+  closeData(void)
+  {
+    std::string text;
+    unsigned code = readReply(&text);
+    if (code != 226)
+      throw std::runtime_error(String::str("transfer failed: %u %s", code, text.c_str()));
+  }
+};
+
+//! Transfer of a byte range of a file.
+struct Job
+{
+  //! Remote file.
+  std::string remote;
+  //! Local file.
+  Path local;
+  //! First byte.
+  uint64_t begin;
+  //! Number of bytes.
+  uint64_t length;
+};
+
+//! Order jobs by length.
+static bool
+shorter(const Job& a, const Job& b)
+{
+  return a.length < b.length;
+}
+
+//! Job list shared by streams.
+struct Jobs
+{
+  //! Pending jobs.
+  std::vector<Job> pending;
+  //! Bytes received from the network.
+  uint64_t received;
+  //! Bytes written to local files.
+  uint64_t written;
+  //! Lock.
+  Mutex lock;
+};
+
+//! Transfer stream with its own connection.
+class Stream: public Thread
+{
+public:
+  Stream(const Address& addr, uint16_t port, Compression::Methods method, Jobs& jobs):
+    m_addr(addr),
+    m_port(port),
+    m_method(method),
+    m_jobs(jobs)
+  { }
+
+private:
+  Address m_addr;
+  uint16_t m_port;
+  Compression::Methods m_method;
+  Jobs& m_jobs;
+
+  //! Take the next job.
+  //! @param[out] job job.
+  //! @return true if a job was taken, false if no jobs are left.
+  bool
+  take(Job& job)
+  {
+    ScopedMutex l(m_jobs.lock);
+    if (m_jobs.pending.empty())
+      return false;
+
+    job = m_jobs.pending.back();
+    m_jobs.pending.pop_back();
+    return true;
+  }
+
+  void
+  run(void)
+  {
+    Client* client = NULL;
+    unsigned failures = 0;
+    Job job;
+
+    while (take(job))
+    {
+      try
+      {
+        if (client == NULL)
+        {
+          client = new Client(m_addr, m_port);
+          if (m_method != Compression::METHOD_UNKNOWN)
+            client->command("XCMP " + Compression::Factory::method(m_method), 200);
+        }
+
+        uint64_t received = client->retrieve(job.remote, job.begin, job.length, job.local, m_method);
+        failures = 0;
+
+        ScopedMutex l(m_jobs.lock);
+        m_jobs.received += received;
+        m_jobs.written += job.length;
+      }
+      catch (std::exception& e)
+      {
+        std::cerr << "WARNING: " << job.remote << ": " << e.what() << std::endl;
+        Memory::clear(client);
+
+        {
+          ScopedMutex l(m_jobs.lock);
+          m_jobs.pending.push_back(job);
+        }
+
+        if (++failures >= c_max_failures)
+          break;
+
+        Delay::wait(std::min(1 << failures, 30));
+      }
+    }
+
+    delete client;
+  }
+};
+
+//! Remote file.
+struct RemoteFile
+{
+  //! Remote path.
+  std::string remote;
+  //! Local path.
+  Path local;
+  //! Remote manifest.
+  Manifest manifest;
+};
+
+//! List files in a remote folder, recursively.
+//! @param[in] client FTP client.
+//! @param[in] remote remote folder.
+//! @param[out] files remote files.
+static void
+listFiles(Client& client, const std::string& remote, std::vector<std::string>& files)
+{
+  std::string listing = client.retrieve("MLSD " + remote);
+  std::vector<std::string> lines;
+  String::split(listing, "\r\n", lines);
+
+  for (unsigned i = 0; i < lines.size(); ++i)
+  {
+    size_t pos = lines[i].find("; ");
+    if (pos == std::string::npos)
+      continue;
+
+    std::string name = lines[i].substr(pos + 2);
+    if (name.empty() || name == "." || name == "..")
+      continue;
+
+    std::string path = (remote == "/" ? "" : remote) + "/" + name;
+
+    if (String::startsWith(lines[i], "Type=dir"))
+      listFiles(client, path, files);
+    else if (String::startsWith(lines[i], "Type=file"))
+      files.push_back(path);
+  }
+}
+
+//! Queue the blocks of a file that differ from the local copy.
+//! @param[in] file remote file.
+//! @param[out] jobs job list.
+//! @return number of bytes to transfer.
+static uint64_t
+queueFile(const RemoteFile& file, Jobs& jobs)
+{
+  Manifest local(file.manifest.getBlockSize());
+  local.compute(file.local);
+
+  // Local files cannot be truncated portably, start over instead.
+  if (local.getSize() > file.manifest.getSize())
+  {
+    file.local.remove();
+    local = Manifest(file.manifest.getBlockSize());
+  }
+
+  if (!file.local.exists())
+  {
+    file.local.dirname().create();
+    std::ofstream ofs(file.local.c_str(), std::ios::binary);
+  }
+
+  std::vector<Manifest::Range> ranges = file.manifest.diff(local, c_max_transfer);
+
+  uint64_t bytes = 0;
+  for (unsigned i = 0; i < ranges.size(); ++i)
+  {
+    Job job;
+    job.remote = file.remote;
+    job.local = file.local;
+    job.begin = ranges[i].first;
+    job.length = ranges[i].second;
+    jobs.pending.push_back(job);
+    bytes += job.length;
+  }
+
+  return bytes;
+}
+
+int
+main(int argc, char** argv)
+{
+  OptionParser options;
+  options.executable("dune-offload")
+  .program(DUNE_SHORT_NAME)
+  .copyright(DUNE_COPYRIGHT)
+  .email(DUNE_CONTACT)
+  .version(getFullVersion())
+  .date(getCompileDate())
+  .arch(DUNE_SYSTEM_NAME)
+  .description("Synchronize a local folder with a folder of a vehicle's FTP server, "
+               "transferring only missing or changed blocks. Interrupted "
+               "transfers resume when the program is run again.")
+  .add("-s", "--server",
+       "Vehicle address", "ADDRESS")
+  .add("-p", "--port",
+       "FTP control port (default: 30021)", "PORT")
+  .add("-r", "--remote",
+       "Remote folder (default: /)", "FOLDER")
+  .add("-l", "--local",
+       "Local folder", "FOLDER")
+  .add("-j", "--streams",
+       "Number of parallel transfer streams (default: 4)", "COUNT")
+  .add("-z", "--compression",
+       "Transfer compression: none, gzip or lz4 (default: none)", "METHOD");
+
+  if (!options.parse(argc, argv))
+  {
+    if (options.bad())
+      std::cerr << "ERROR: " << options.error() << std::endl;
+    options.usage();
+    return 1;
+  }
+
+  std::string addr = options.value("--server");
+  std::string local = options.value("--local");
+  if (addr.empty() || local.empty())
+  {
+    std::cerr << "ERROR: you must specify the vehicle address and the local folder." << std::endl;
+    options.usage();
+    return 1;
+  }
+
+  uint16_t port = 30021;
+  castLexical(options.value("--port"), port);
+
+  std::string remote = options.value("--remote");
+  if (remote.empty())
+    remote = "/";
+
+  unsigned streams = 4;
+  castLexical(options.value("--streams"), streams);
+  streams = std::max(streams, 1u);
+
+  Compression::Methods method = Compression::METHOD_UNKNOWN;
+  std::string method_name = options.value("--compression");
+  if (!method_name.empty() && method_name != "none")
+  {
+    method = Compression::Factory::method(method_name);
+    if (method == Compression::METHOD_UNKNOWN)
+    {
+      std::cerr << "ERROR: unknown compression method: " << method_name << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<RemoteFile> files;
+
+  try
+  {
+    Client client(Address(addr.c_str()), port);
+
+    std::vector<std::string> names;
+    listFiles(client, remote, names);
+
+    for (unsigned i = 0; i < names.size(); ++i)
+    {
+      RemoteFile file;
+      file.remote = names[i];
+      file.local = Path(local) / names[i].substr(remote == "/" ? 0 : remote.size());
+      if (!file.manifest.parse(client.retrieve("XMAN " + names[i])))
+      {
+        std::cerr << "WARNING: " << names[i] << ": invalid manifest" << std::endl;
+        continue;
+      }
+
+      files.push_back(file);
+    }
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return 1;
+  }
+
+  double start = Clock::get();
+  Jobs jobs;
+  jobs.received = 0;
+  jobs.written = 0;
+
+  for (unsigned pass = 0; pass < c_max_passes; ++pass)
+  {
+    uint64_t total = 0;
+    for (unsigned i = 0; i < files.size(); ++i)
+    {
+      uint64_t bytes = queueFile(files[i], jobs);
+      if (bytes > 0 && pass == 0)
+        std::cout << files[i].remote << ": " << bytes << " of "
+                  << files[i].manifest.getSize() << " bytes" << std::endl;
+      total += bytes;
+    }
+
+    if (total == 0)
+    {
+      double elapsed = Clock::get() - start;
+      std::cout << "synchronized " << files.size() << " files: "
+                << jobs.written << " bytes written, " << jobs.received
+                << " bytes received in " << elapsed << " s" << std::endl;
+      return 0;
+    }
+
+    // Streams take jobs from the back, larger ranges go first so
+    // that streams finish at about the same time.
+    std::sort(jobs.pending.begin(), jobs.pending.end(), shorter);
+
+    std::vector<Stream*> workers;
+    for (unsigned i = 0; i < streams; ++i)
+    {
+      workers.push_back(new Stream(Address(addr.c_str()), port, method, jobs));
+      workers.back()->start();
+    }
+
+    for (unsigned i = 0; i < workers.size(); ++i)
+    {
+      workers[i]->join();
+      delete workers[i];
+    }
+
+    if (!jobs.pending.empty())
+    {
+      std::cerr << "ERROR: transfer interrupted, run again to resume" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cerr << "ERROR: local files differ from the vehicle after "
+            << c_max_passes << " passes" << std::endl;
+  return 1;
+}
@@ -38,8 +38,10 @@ namespace DUNE
 #include <DUNE/Algorithms/Base64.hpp>
 #include <DUNE/Algorithms/CRC8.hpp>
 #include <DUNE/Algorithms/CRC16.hpp>
+#include <DUNE/Algorithms/CRC32.hpp>
 #include <DUNE/Algorithms/FletcherChecksum.hpp>
 #include <DUNE/Algorithms/MD5.hpp>
+#include <DUNE/Algorithms/ReedSolomon.hpp>
 #include <DUNE/Algorithms/XORChecksum.hpp>
 #include <DUNE/Algorithms/UNESCO1983.hpp>
 
@@ -0,0 +1,70 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_ALGORITHMS_CRC32_HPP_INCLUDED_
+#define DUNE_ALGORITHMS_CRC32_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Algorithms
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM CRC32;
+
+    extern const uint32_t c_crc32_ieee_table[256];
+
+    //! CRC-32 Algorithm (IEEE 802.3, as used by zlib and PNG).
+    //! The polynomial used is 0x04C11DB7 (reflected 0xEDB88320).
+    class CRC32
+    {
+    public:
+      //! Compute the CRC-32 of a given data buffer.
+      //! @param buffer data buffer.
+      //! @param len data buffer length.
+      //! @param crc CRC-32 value to update.
+      //! @return computed CRC-32.
+      static inline uint32_t
+      compute(const uint8_t* buffer, size_t len, uint32_t crc = 0)
+      {
+        crc = ~crc;
+
+        while (len--)
+          crc = (crc >> 8) ^ c_crc32_ieee_table[(crc ^ *buffer++) & 0xff];
+
+        return ~crc;
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,181 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Algorithms/ReedSolomon.hpp>
+
+namespace DUNE
+{
+  namespace Algorithms
+  {
+    //! Primitive polynomial x^8 + x^4 + x^3 + x^2 + 1.
+    static const unsigned c_polynomial = 0x11d;
+
+    ReedSolomon::ReedSolomon(unsigned data_count, unsigned parity_count):
+      m_data_count(data_count),
+      m_parity_count(parity_count)
+    {
+      if (data_count == 0 || data_count + parity_count > 256)
+        throw std::invalid_argument("invalid number of blocks");
+
+      unsigned value = 1;
+      for (unsigned i = 0; i < 255; ++i)
+      {
+        m_exp[i] = (uint8_t)value;
+        m_log[value] = (uint8_t)i;
+
+        value <<= 1;
+        if (value & 0x100)
+          value ^= c_polynomial;
+      }
+
+      for (unsigned i = 255; i < 512; ++i)
+        m_exp[i] = m_exp[i - 255];
+
+      m_log[0] = 0;
+    }
+
+    void
+    ReedSolomon::encode(const uint8_t* const* data, unsigned index, uint8_t* parity, unsigned size) const
+    {
+      std::memset(parity, 0, size);
+
+      for (unsigned i = 0; i < m_data_count; ++i)
+        addScaled(parity, data[i], coefficient(index, i), size);
+    }
+
+    bool
+    ReedSolomon::decode(const uint8_t* const* blocks, uint8_t* const* data, unsigned size) const
+    {
+      unsigned k = m_data_count;
+
+      // Pick the first k blocks available.
+      std::vector<unsigned> rows;
+      for (unsigned i = 0; i < k + m_parity_count && rows.size() < k; ++i)
+      {
+        if (blocks[i] != NULL)
+          rows.push_back(i);
+      }
+
+      if (rows.size() < k)
+        return false;
+
+      if (rows.back() < k)
+        return true;
+
+      // Matrix of the chosen blocks and its inverse.
+      std::vector<uint8_t> mat(k * k, 0);
+      std::vector<uint8_t> inv(k * k, 0);
+
+      for (unsigned r = 0; r < k; ++r)
+      {
+        inv[r * k + r] = 1;
+
+        if (rows[r] < k)
+        {
+          mat[r * k + rows[r]] = 1;
+          continue;
+        }
+
+        for (unsigned c = 0; c < k; ++c)
+          mat[r * k + c] = coefficient(rows[r] - k, c);
+      }
+
+      for (unsigned c = 0; c < k; ++c)
+      {
+        unsigned pivot = c;
+        while (mat[pivot * k + c] == 0)
+        {
+          // Cauchy sub-matrices are never singular.
+          if (++pivot == k)
+            return false;
+        }
+
+        if (pivot != c)
+        {
+          for (unsigned i = 0; i < k; ++i)
+          {
+            std::swap(mat[pivot * k + i], mat[c * k + i]);
+            std::swap(inv[pivot * k + i], inv[c * k + i]);
+          }
+        }
+
+        uint8_t scale = invert(mat[c * k + c]);
+        for (unsigned i = 0; i < k; ++i)
+        {
+          mat[c * k + i] = multiply(mat[c * k + i], scale);
+          inv[c * k + i] = multiply(inv[c * k + i], scale);
+        }
+
+        for (unsigned r = 0; r < k; ++r)
+        {
+          uint8_t factor = mat[r * k + c];
+          if (r == c || factor == 0)
+            continue;
+
+          for (unsigned i = 0; i < k; ++i)
+          {
+            mat[r * k + i] ^= multiply(factor, mat[c * k + i]);
+            inv[r * k + i] ^= multiply(factor, inv[c * k + i]);
+          }
+        }
+      }
+
+      for (unsigned i = 0; i < k; ++i)
+      {
+        if (blocks[i] != NULL)
+          continue;
+
+        std::memset(data[i], 0, size);
+        for (unsigned r = 0; r < k; ++r)
+          addScaled(data[i], blocks[rows[r]], inv[i * k + r], size);
+      }
+
+      return true;
+    }
+
+    void
+    ReedSolomon::addScaled(uint8_t* dst, const uint8_t* src, uint8_t coef, unsigned size) const
+    {
+      if (coef == 0)
+        return;
+
+      unsigned log_coef = m_log[coef];
+
+      for (unsigned i = 0; i < size; ++i)
+      {
+        if (src[i] != 0)
+          dst[i] ^= m_exp[m_log[src[i]] + log_coef];
+      }
+    }
+  }
+}
@@ -0,0 +1,140 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_ALGORITHMS_REED_SOLOMON_HPP_INCLUDED_
+#define DUNE_ALGORITHMS_REED_SOLOMON_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Algorithms
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ReedSolomon;
+
+    //! Systematic Reed-Solomon erasure code over GF(2^8).
+    //! Data blocks are sent unchanged and followed by parity blocks
+    //! computed with a Cauchy matrix, so any combination of data and
+    //! parity blocks with as many blocks as the data can recover it.
+    //! The total number of blocks is limited to 256.
+    class ReedSolomon
+    {
+    public:
+      //! Constructor.
+      //! @param[in] data_count number of data blocks.
+      //! @param[in] parity_count number of parity blocks.
+      ReedSolomon(unsigned data_count, unsigned parity_count);
+
+      //! Get the number of data blocks.
+      //! @return number of data blocks.
+      unsigned
+      getDataCount(void) const
+      {
+        return m_data_count;
+      }
+
+      //! Get the number of parity blocks.
+      //! @return number of parity blocks.
+      unsigned
+      getParityCount(void) const
+      {
+        return m_parity_count;
+      }
+
+      //! Compute a parity block.
+      //! @param[in] data data blocks.
+      //! @param[in] index index of the parity block.
+      //! @param[out] parity parity block.
+      //! @param[in] size size of each block.
+      void
+      encode(const uint8_t* const* data, unsigned index, uint8_t* parity, unsigned size) const;
+
+      //! Recover missing data blocks. Data blocks that are present
+      //! are not written.
+      //! @param[in] blocks data blocks followed by parity blocks,
+      //! NULL if missing.
+      //! @param[out] data data blocks.
+      //! @param[in] size size of each block.
+      //! @return true if the data was recovered, false if there are
+      //! not enough blocks.
+      bool
+      decode(const uint8_t* const* blocks, uint8_t* const* data, unsigned size) const;
+
+    private:
+      //! Number of data blocks.
+      unsigned m_data_count;
+      //! Number of parity blocks.
+      unsigned m_parity_count;
+      //! Exponential table.
+      uint8_t m_exp[512];
+      //! Logarithm table.
+      uint8_t m_log[256];
+
+      //! Multiply two field elements.
+      uint8_t
+      multiply(uint8_t a, uint8_t b) const
+      {
+        if (a == 0 || b == 0)
+          return 0;
+
+        return m_exp[m_log[a] + m_log[b]];
+      }
+
+      //! Invert a non-zero field element.
+      uint8_t
+      invert(uint8_t a) const
+      {
+        return m_exp[255 - m_log[a]];
+      }
+
+      //! Get the coefficient of a data block in a parity block.
+      //! @param[in] parity index of the parity block.
+      //! @param[in] data index of the data block.
+      //! @return coefficient.
+      uint8_t
+      coefficient(unsigned parity, unsigned data) const
+      {
+        return invert((uint8_t)((m_data_count + parity) ^ data));
+      }
+
+      //! Add a block multiplied by a coefficient to another.
+      //! @param[in,out] dst destination block.
+      //! @param[in] src source block.
+      //! @param[in] coef coefficient.
+      //! @param[in] size size of the blocks.
+      void
+      addScaled(uint8_t* dst, const uint8_t* src, uint8_t coef, unsigned size) const;
+    };
+  }
+}
+
+#endif
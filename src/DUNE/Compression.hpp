@@ -43,8 +43,13 @@ namespace DUNE
 #include <DUNE/Compression/GzipCompressor.hpp>
 #include <DUNE/Compression/Bzip2Compressor.hpp>
 #include <DUNE/Compression/ZlibCompressor.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
 #include <DUNE/Compression/Bzip2Decompressor.hpp>
 #include <DUNE/Compression/ZlibDecompressor.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
+#include <DUNE/Compression/DictionaryCompressor.hpp>
+#include <DUNE/Compression/DictionaryDecompressor.hpp>
+#include <DUNE/Compression/ParallelCompressor.hpp>
 #include <DUNE/Compression/StreamBuffer.hpp>
 #include <DUNE/Compression/FilterInput.hpp>
 #include <DUNE/Compression/FilterOutput.hpp>
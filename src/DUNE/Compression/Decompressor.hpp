@@ -93,6 +93,15 @@ namespace DUNE
         return m_unprocessed;
       }
 
+      //! Check if decoded data is waiting to be returned, in which
+      //! case decompress() produces output without further input.
+      //! @return true if decoded data is pending, false otherwise.
+      virtual bool
+      pending(void) const
+      {
+        return false;
+      }
+
     protected:
       virtual unsigned long
       decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len) = 0;
@@ -0,0 +1,76 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Utils/String.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/DictionaryCompressor.hpp>
+
+// Zlib headers.
+#include <zlib/zlib.h>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    unsigned long
+    DictionaryCompressor::compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len)
+    {
+      z_stream stream;
+      stream.zalloc = 0;
+      stream.zfree = 0;
+      stream.opaque = 0;
+
+      int rv = deflateInit2(&stream, level(), Z_DEFLATED, -MAX_WBITS, 9, Z_DEFAULT_STRATEGY);
+      if (rv == Z_MEM_ERROR)
+        throw OutOfMemory();
+
+      if (rv != Z_OK)
+        throw Error("compressor initialization failed");
+
+      if (!m_dictionary.empty())
+        deflateSetDictionary(&stream, (const Bytef*)&m_dictionary[0], (uInt)m_dictionary.size());
+
+      stream.next_in = (Bytef*)src;
+      stream.avail_in = (uInt)src_len;
+      stream.next_out = (Bytef*)dst;
+      stream.avail_out = (uInt)dst_len;
+
+      rv = deflate(&stream, Z_FINISH);
+      unsigned long compressed_length = stream.total_out;
+      deflateEnd(&stream);
+
+      if (rv == Z_STREAM_END)
+        return compressed_length;
+
+      if (rv == Z_OK || rv == Z_BUF_ERROR)
+        throw BufferTooShort(dst_len);
+
+      throw Error(Utils::String::str("compressor error %d", rv));
+    }
+  }
+}
@@ -0,0 +1,72 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_DICTIONARY_COMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_DICTIONARY_COMPRESSOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Compressor.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM DictionaryCompressor;
+
+    //! Compressor of small, independent blocks using raw deflate
+    //! with a preset dictionary. The dictionary should contain
+    //! byte sequences that are common in the data being
+    //! compressed and must be shared with the decompressor. No
+    //! headers or checksums are added to the compressed data.
+    class DictionaryCompressor: public Compressor
+    {
+    public:
+      //! Constructor.
+      //! @param[in] dictionary preset dictionary.
+      //! @param[in] a_level compression level.
+      DictionaryCompressor(const std::vector<char>& dictionary, int a_level = -1):
+        Compressor(a_level),
+        m_dictionary(dictionary)
+      { }
+
+    protected:
+      virtual unsigned long
+      compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len);
+
+    private:
+      //! Preset dictionary.
+      std::vector<char> m_dictionary;
+    };
+  }
+}
+
+#endif
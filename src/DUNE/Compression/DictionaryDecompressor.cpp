@@ -0,0 +1,81 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Utils/String.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/DictionaryDecompressor.hpp>
+
+// Zlib headers.
+#include <zlib/zlib.h>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    unsigned long
+    DictionaryDecompressor::decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len)
+    {
+      z_stream stream;
+      stream.zalloc = 0;
+      stream.zfree = 0;
+      stream.opaque = 0;
+      stream.next_in = 0;
+      stream.avail_in = 0;
+
+      if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+        throw Error("decompressor initialization failed");
+
+      if (!m_dictionary.empty())
+        inflateSetDictionary(&stream, (const Bytef*)&m_dictionary[0], (uInt)m_dictionary.size());
+
+      stream.next_in = (Bytef*)src;
+      stream.avail_in = (uInt)src_len;
+      stream.next_out = (Bytef*)dst;
+      stream.avail_out = (uInt)dst_len;
+
+      int rv = inflate(&stream, Z_FINISH);
+      unsigned long decompressed_length = stream.total_out;
+      unprocessed_len = stream.avail_in;
+      inflateEnd(&stream);
+
+      if (rv == Z_STREAM_END)
+        return decompressed_length;
+
+      if (rv == Z_DATA_ERROR)
+        throw CorruptedData();
+
+      if (rv == Z_BUF_ERROR && stream.avail_out == 0)
+        throw BufferTooShort(dst_len);
+
+      if (rv == Z_BUF_ERROR)
+        throw UnexpectedEOD();
+
+      throw Error(Utils::String::str("decompressor error %d", rv));
+    }
+  }
+}
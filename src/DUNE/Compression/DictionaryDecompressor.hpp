@@ -22,48 +22,43 @@
 // language governing permissions and limitations at                        *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Ricardo Martins                                                  *
+// Author: agent                                                            *
 //***************************************************************************
 
-#ifndef SENSORS_EDGETECH_2205_ESTIMATED_STATE_ENTRY_HPP_INCLUDED_
-#define SENSORS_EDGETECH_2205_ESTIMATED_STATE_ENTRY_HPP_INCLUDED_
+#ifndef DUNE_COMPRESSION_DICTIONARY_DECOMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_DICTIONARY_DECOMPRESSOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
 
 // DUNE headers.
-#include <DUNE/DUNE.hpp>
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Decompressor.hpp>
 
-namespace Sensors
+namespace DUNE
 {
-  namespace Edgetech2205
+  namespace Compression
   {
-    using DUNE_NAMESPACES;
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM DictionaryDecompressor;
 
-    class EstimatedStateEntry
+    //! Decompressor of blocks produced by DictionaryCompressor.
+    class DictionaryDecompressor: public Decompressor
     {
     public:
-      EstimatedStateEntry(const IMC::EstimatedState& state):
-        m_state(state)
-      {
-        m_time = state.getTimeStamp();
-        int millisecond = (state.getTimeStamp() - m_time) * 1000;
-        m_time *= 1000;
-        m_time += millisecond;
-      }
-
-      const IMC::EstimatedState*
-      getEstimatedState(void) const
-      {
-        return &m_state;
-      }
+      //! Constructor.
+      //! @param[in] dictionary preset dictionary.
+      DictionaryDecompressor(const std::vector<char>& dictionary):
+        m_dictionary(dictionary)
+      { }
 
-      int64_t
-      getTime(void) const
-      {
-        return m_time;
-      }
+    protected:
+      virtual unsigned long
+      decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len);
 
     private:
-      IMC::EstimatedState m_state;
-      int64_t m_time;
+      //! Preset dictionary.
+      std::vector<char> m_dictionary;
     };
   }
 }
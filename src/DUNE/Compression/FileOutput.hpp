@@ -43,9 +43,15 @@ namespace DUNE
     class FileOutput: public std::ostream
     {
     public:
-      FileOutput(const char* filename, Methods method):
+      //! Create compressed file.
+      //! @param[in] filename file name.
+      //! @param[in] method compression method.
+      //! @param[in] threads number of compression threads, zero to
+      //! compress on the writing thread.
+      FileOutput(const char* filename, Methods method, unsigned threads = 0):
         std::ostream(0),
         m_method(method),
+        m_threads(threads),
         m_stream(filename, std::ios::binary | std::ios::out),
         m_buffer(0)
       {
@@ -63,12 +69,13 @@ namespace DUNE
         if (m_buffer)
           delete m_buffer;
 
-        m_buffer = new StreamBuffer(&stream, m_method);
+        m_buffer = new StreamBuffer(&stream, m_method, m_threads);
         rdbuf(m_buffer);
       }
 
     protected:
       Methods m_method;
+      unsigned m_threads;
       std::ofstream m_stream;
       StreamBuffer* m_buffer;
     };
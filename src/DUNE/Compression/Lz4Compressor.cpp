@@ -0,0 +1,115 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#include <algorithm>
+#include <cstring>
+
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
+
+#include <lz4/lz4.h>
+#include <lz4/lz4hc.h>
+#include <lz4/xxhash.h>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Frame magic number.
+    static const uint32_t c_magic = 0x184D2204;
+    //! Block size.
+    static const unsigned long c_block_size = 64 * 1024;
+    //! Frame header size: magic, flags, block descriptor, content size
+    //! and header checksum.
+    static const unsigned long c_header_size = 4 + 2 + 8 + 1;
+
+    //! Store a 32-bit value in little endian byte order.
+    static void
+    encode32(uint32_t value, char* dst)
+    {
+      for (unsigned i = 0; i < 4; ++i)
+        dst[i] = (char)(value >> (8 * i));
+    }
+
+    unsigned long
+    Lz4Compressor::compressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len)
+    {
+      if (dst_len < compressBound(src_len))
+        throw BufferTooShort(dst_len);
+
+      // Version 1, independent blocks, content size and checksum.
+      char* ptr = dst;
+      encode32(c_magic, ptr);
+      ptr[4] = 0x6C;
+      // Maximum block size of 64 KiB.
+      ptr[5] = 0x40;
+      encode32((uint32_t)src_len, ptr + 6);
+      encode32((uint32_t)((uint64_t)src_len >> 32), ptr + 10);
+      ptr[14] = (char)((XXH32(ptr + 4, 10, 0) >> 8) & 0xff);
+      ptr += c_header_size;
+
+      for (unsigned long done = 0; done < src_len; )
+      {
+        int size = (int)std::min(c_block_size, src_len - done);
+        int rv;
+
+        if (level() > 0)
+          rv = LZ4_compressHC_limitedOutput(src + done, ptr + 4, size, size - 1);
+        else
+          rv = LZ4_compress_limitedOutput(src + done, ptr + 4, size, size - 1);
+
+        if (rv <= 0)
+        {
+          // Incompressible data is stored as is.
+          encode32((uint32_t)size | 0x80000000u, ptr);
+          std::memcpy(ptr + 4, src + done, size);
+          rv = size;
+        }
+        else
+        {
+          encode32((uint32_t)rv, ptr);
+        }
+
+        ptr += 4 + rv;
+        done += size;
+      }
+
+      // End mark and content checksum.
+      encode32(0, ptr);
+      encode32(XXH32(src, (int)src_len, 0), ptr + 4);
+      ptr += 8;
+
+      return ptr - dst;
+    }
+
+    unsigned long
+    Lz4Compressor::compressBound(unsigned long length) const
+    {
+      return c_header_size + length + (length / c_block_size + 1) * 4 + 8;
+    }
+  }
+}
@@ -0,0 +1,283 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#include <algorithm>
+#include <cstring>
+
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
+
+#include <lz4/lz4.h>
+#include <lz4/xxhash.h>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Frame magic number.
+    static const uint32_t c_magic = 0x184D2204;
+    //! Magic number of skippable frames (lower 4 bits are free).
+    static const uint32_t c_skip_magic = 0x184D2A50;
+    //! Size of history used by linked blocks.
+    static const unsigned long c_history = 64 * 1024;
+
+    //! Read a 32-bit value in little endian byte order.
+    static uint32_t
+    decode32(const char* src)
+    {
+      const uint8_t* ptr = (const uint8_t*)src;
+      return ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | ((uint32_t)ptr[3] << 24);
+    }
+
+    struct Lz4Decompressor::PrivateData
+    {
+      //! Content checksum state.
+      XXH32_stateSpace_t content;
+    };
+
+    Lz4Decompressor::Lz4Decompressor(void):
+      Decompressor(),
+      m_flags(0),
+      m_block_max(0),
+      m_block_size(0),
+      m_block_raw(false),
+      m_out_idx(0),
+      m_out_end(0),
+      m_last(0),
+      m_history(0)
+    {
+      m_private = new PrivateData;
+      expect(ST_MAGIC, 4);
+    }
+
+    Lz4Decompressor::~Lz4Decompressor(void)
+    {
+      delete m_private;
+    }
+
+    void
+    Lz4Decompressor::expect(State state, unsigned long size)
+    {
+      m_state = state;
+      m_need = size;
+      m_field.clear();
+    }
+
+    unsigned long
+    Lz4Decompressor::decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len)
+    {
+      unsigned long written = 0;
+      unsigned long used = 0;
+
+      while (true)
+      {
+        // Return decoded data first.
+        if (m_out_idx < m_out_end)
+        {
+          unsigned long n = std::min(m_out_end - m_out_idx, dst_len - written);
+          std::memcpy(dst + written, &m_out[m_out_idx], n);
+          m_out_idx += n;
+          written += n;
+
+          if (m_out_idx < m_out_end)
+            break;
+        }
+
+        if (used == src_len)
+          break;
+
+        if (m_state == ST_SKIP)
+        {
+          unsigned long n = std::min(m_need, src_len - used);
+          used += n;
+          m_need -= n;
+
+          if (m_need == 0)
+            expect(ST_MAGIC, 4);
+          continue;
+        }
+
+        // Parse complete fields in place.
+        if (m_field.empty() && src_len - used >= m_need)
+        {
+          used += m_need;
+          parseField(src + used - m_need);
+          continue;
+        }
+
+        unsigned long n = std::min(m_need - m_field.size(), src_len - used);
+        m_field.insert(m_field.end(), src + used, src + used + n);
+        used += n;
+
+        if (m_field.size() == m_need)
+          parseField(&m_field[0]);
+      }
+
+      unprocessed_len = src_len - used;
+      return written;
+    }
+
+    void
+    Lz4Decompressor::parseField(const char* data)
+    {
+      switch (m_state)
+      {
+        case ST_MAGIC:
+        {
+          uint32_t magic = decode32(data);
+          if (magic == c_magic)
+            expect(ST_DESCRIPTOR, 2);
+          else if ((magic & 0xfffffff0) == c_skip_magic)
+            expect(ST_SKIP_SIZE, 4);
+          else
+            throw CorruptedData();
+          break;
+        }
+
+        case ST_SKIP_SIZE:
+          m_need = decode32(data);
+          m_field.clear();
+          m_state = (m_need == 0) ? ST_MAGIC : ST_SKIP;
+          if (m_need == 0)
+            m_need = 4;
+          break;
+
+        case ST_DESCRIPTOR:
+        {
+          uint8_t flags = data[0];
+          uint8_t bd = data[1];
+
+          // Read flags first to know the size of the descriptor.
+          if (m_need == 2)
+          {
+            if ((flags >> 6) != 1)
+              throw Error("unsupported LZ4 frame version");
+
+            if (m_field.empty())
+              m_field.assign(data, data + 2);
+            m_need = 3 + ((flags & 0x08) ? 8 : 0) + ((flags & 0x01) ? 4 : 0);
+            break;
+          }
+
+          if (((XXH32(data, m_need - 1, 0) >> 8) & 0xff) != (uint8_t)data[m_need - 1])
+            throw CorruptedData();
+
+          unsigned index = (bd >> 4) & 0x07;
+          if (index < 4)
+            throw CorruptedData();
+
+          m_flags = flags;
+          m_block_max = 1ul << (8 + 2 * index);
+          m_out.resize(c_history + m_block_max);
+          m_history = 0;
+          m_last = 0;
+          XXH32_resetState(&m_private->content, 0);
+          expect(ST_BLOCK_SIZE, 4);
+          break;
+        }
+
+        case ST_BLOCK_SIZE:
+        {
+          uint32_t value = decode32(data);
+          if (value == 0)
+          {
+            expect((m_flags & 0x04) ? ST_CHECKSUM : ST_MAGIC, 4);
+            break;
+          }
+
+          m_block_raw = (value & 0x80000000u) != 0;
+          m_block_size = value & 0x7fffffffu;
+          if (m_block_size > m_block_max)
+            throw CorruptedData();
+
+          expect(ST_BLOCK_DATA, m_block_size + ((m_flags & 0x10) ? 4 : 0));
+          break;
+        }
+
+        case ST_BLOCK_DATA:
+          decodeBlock(data);
+          expect(ST_BLOCK_SIZE, 4);
+          break;
+
+        case ST_CHECKSUM:
+          if (decode32(data) != XXH32_intermediateDigest(&m_private->content))
+            throw CorruptedData();
+          expect(ST_MAGIC, 4);
+          break;
+
+        case ST_SKIP:
+          break;
+      }
+    }
+
+    void
+    Lz4Decompressor::decodeBlock(const char* data)
+    {
+      if ((m_flags & 0x10) && XXH32(data, m_block_size, 0) != decode32(data + m_block_size))
+        throw CorruptedData();
+
+      // Linked blocks may reference up to 64 KiB of previous output,
+      // which is kept just before the decoding position.
+      bool linked = (m_flags & 0x20) == 0;
+      unsigned long base = 0;
+      if (linked)
+      {
+        base = c_history;
+        unsigned long keep = std::min(c_history, m_history + m_last);
+        std::memmove(&m_out[base - keep], &m_out[base + m_last - keep], keep);
+        m_history = keep;
+      }
+
+      char* out = &m_out[base];
+      int rv;
+
+      if (m_block_raw)
+      {
+        std::memcpy(out, data, m_block_size);
+        rv = m_block_size;
+      }
+      else if (linked)
+      {
+        rv = LZ4_decompress_safe_withPrefix64k(data, out, m_block_size, m_block_max);
+      }
+      else
+      {
+        rv = LZ4_decompress_safe(data, out, m_block_size, m_block_max);
+      }
+
+      if (rv < 0)
+        throw CorruptedData();
+
+      if (m_flags & 0x04)
+        XXH32_update(&m_private->content, out, rv);
+
+      m_out_idx = base;
+      m_out_end = base + rv;
+      m_last = rv;
+    }
+  }
+}
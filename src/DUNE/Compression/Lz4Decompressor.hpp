@@ -0,0 +1,130 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_LZ4_DECOMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_LZ4_DECOMPRESSOR_HPP_INCLUDED_
+
+#include <vector>
+
+#include <DUNE/Compression/Decompressor.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Lz4Decompressor;
+
+    //! Decoder of concatenated LZ4 frames. Input can be split at any
+    //! point. Independent and linked blocks are supported, skippable
+    //! frames are ignored, and block and content checksums are
+    //! verified when present.
+    class Lz4Decompressor: public Decompressor
+    {
+    public:
+      Lz4Decompressor(void);
+
+      virtual
+      ~Lz4Decompressor(void);
+
+      //! Check if decoded data is waiting to be returned.
+      //! @return true if decoded data is pending, false otherwise.
+      virtual bool
+      pending(void) const
+      {
+        return m_out_idx < m_out_end;
+      }
+
+    protected:
+      virtual unsigned long
+      decompressBlock(char* dst, unsigned long dst_len, char* src, unsigned long src_len, unsigned long& unprocessed_len);
+
+    private:
+      //! Decoder states.
+      enum State
+      {
+        //! Reading frame magic number.
+        ST_MAGIC,
+        //! Reading frame descriptor.
+        ST_DESCRIPTOR,
+        //! Reading size of skippable frame.
+        ST_SKIP_SIZE,
+        //! Skipping frame.
+        ST_SKIP,
+        //! Reading block size.
+        ST_BLOCK_SIZE,
+        //! Reading block data.
+        ST_BLOCK_DATA,
+        //! Reading content checksum.
+        ST_CHECKSUM
+      };
+
+      // Forward declaration of private data.
+      struct PrivateData;
+      //! Private data, used to store xxhash state.
+      PrivateData* m_private;
+      //! Decoder state.
+      State m_state;
+      //! Bytes needed to complete the current field.
+      unsigned long m_need;
+      //! Field being read.
+      std::vector<char> m_field;
+      //! Frame flags.
+      uint8_t m_flags;
+      //! Maximum block size.
+      unsigned long m_block_max;
+      //! Size of the current block.
+      unsigned long m_block_size;
+      //! True if the current block is not compressed.
+      bool m_block_raw;
+      //! Decoded data, preceded by history for linked blocks.
+      std::vector<char> m_out;
+      //! Index of the first decoded byte not yet returned.
+      unsigned long m_out_idx;
+      //! End of decoded data.
+      unsigned long m_out_end;
+      //! Size of the last decoded block.
+      unsigned long m_last;
+      //! Bytes of history before the decoding position.
+      unsigned long m_history;
+
+      void
+      reset(void);
+
+      void
+      expect(State state, unsigned long size);
+
+      void
+      parseField(const char* data);
+
+      void
+      decodeBlock(const char* data);
+    };
+  }
+}
+
+#endif
@@ -37,6 +37,7 @@ namespace DUNE
       METHOD_ZLIB,
       METHOD_GZIP,
       METHOD_BZIP2,
+      METHOD_LZ4,
       METHOD_UNKNOWN
     };
   }
@@ -0,0 +1,235 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Compression/ParallelCompressor.hpp>
+#include <DUNE/Compression/Compressor.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Block in flight.
+    struct ParallelCompressor::Job
+    {
+      //! Sequence number.
+      uint64_t seq;
+      //! Uncompressed data.
+      Utils::ByteBuffer input;
+      //! Compressed data.
+      Utils::ByteBuffer output;
+    };
+
+    //! Worker thread with its own compressor.
+    class ParallelCompressor::Worker: public Concurrency::Thread
+    {
+    public:
+      Worker(ParallelCompressor& parent, Methods method):
+        m_parent(parent),
+        m_compressor(Factory::compressor(method))
+      { }
+
+      ~Worker(void)
+      {
+        delete m_compressor;
+      }
+
+    private:
+      //! Parent.
+      ParallelCompressor& m_parent;
+      //! Compressor.
+      Compressor* m_compressor;
+
+      void
+      run(void)
+      {
+        Job* job = NULL;
+
+        while ((job = m_parent.take(this)) != NULL)
+        {
+          try
+          {
+            m_compressor->compress(job->output, job->input);
+          }
+          catch (std::exception& e)
+          {
+            Concurrency::ScopedCondition l(m_parent.m_cond);
+            if (m_parent.m_error.empty())
+              m_parent.m_error = e.what();
+            job->output.setSize(0);
+          }
+
+          m_parent.complete(job);
+        }
+      }
+    };
+
+    ParallelCompressor::ParallelCompressor(std::ostream* stream, Methods method, unsigned workers):
+      m_stream(stream),
+      m_submit_seq(0),
+      m_write_seq(0),
+      m_max_jobs(2 * std::max(workers, 1u)),
+      m_writing(false)
+    {
+      for (unsigned i = 0; i < std::max(workers, 1u); ++i)
+      {
+        m_workers.push_back(new Worker(*this, method));
+        m_workers.back()->start();
+      }
+    }
+
+    ParallelCompressor::~ParallelCompressor(void)
+    {
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+        m_workers[i]->stop();
+
+      m_cond.lock();
+      m_cond.broadcast();
+      m_cond.unlock();
+
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+      {
+        m_workers[i]->join();
+        delete m_workers[i];
+      }
+
+      m_stream->flush();
+
+      for (unsigned i = 0; i < m_free.size(); ++i)
+        delete m_free[i];
+    }
+
+    void
+    ParallelCompressor::write(const char* data, unsigned size)
+    {
+      Job* job = NULL;
+
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        checkError();
+
+        while (m_submit_seq - m_write_seq >= m_max_jobs)
+          m_cond.wait();
+
+        if (m_free.empty())
+        {
+          job = new Job;
+        }
+        else
+        {
+          job = m_free.back();
+          m_free.pop_back();
+        }
+      }
+
+      // Copy outside the lock, the job is not visible to the workers yet.
+      job->input.setSize(0);
+      job->input.appendSigned(data, size);
+
+      Concurrency::ScopedCondition l(m_cond);
+      job->seq = m_submit_seq++;
+      m_queue.push_back(job);
+      m_cond.broadcast();
+    }
+
+    void
+    ParallelCompressor::flush(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      while (m_write_seq != m_submit_seq)
+        m_cond.wait();
+
+      checkError();
+    }
+
+    ParallelCompressor::Job*
+    ParallelCompressor::take(Worker* worker)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      // Drain queued blocks before stopping.
+      while (m_queue.empty() && !worker->isStopping())
+        m_cond.wait();
+
+      if (m_queue.empty())
+        return NULL;
+
+      Job* job = m_queue.front();
+      m_queue.erase(m_queue.begin());
+      return job;
+    }
+
+    void
+    ParallelCompressor::complete(Job* job)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      m_done[job->seq] = job;
+
+      // Only one worker writes at a time, the others leave their
+      // blocks behind for it.
+      if (m_writing)
+        return;
+
+      m_writing = true;
+
+      std::map<uint64_t, Job*>::iterator itr;
+      while ((itr = m_done.find(m_write_seq)) != m_done.end())
+      {
+        Job* next = itr->second;
+        m_done.erase(itr);
+
+        m_cond.unlock();
+        m_stream->write(next->output.getBufferSigned(), next->output.getSize());
+        m_stream->flush();
+        m_cond.lock();
+
+        m_free.push_back(next);
+        ++m_write_seq;
+        m_cond.broadcast();
+      }
+
+      m_writing = false;
+    }
+
+    void
+    ParallelCompressor::checkError(void)
+    {
+      if (!m_error.empty())
+        throw Error(m_error);
+    }
+  }
+}
@@ -0,0 +1,137 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_PARALLEL_COMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_PARALLEL_COMPRESSOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Methods.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ParallelCompressor;
+
+    //! Compresses blocks of data on a pool of worker threads and
+    //! writes them to an output stream in submission order. Every
+    //! block is compressed independently, so the output is a sequence
+    //! of complete gzip members, bzip2 streams or LZ4 frames that
+    //! standard tools read as a single file.
+    //!
+    //! At most two blocks per worker are in flight: when the workers
+    //! fall behind, write() blocks the caller instead of buffering
+    //! without bound.
+    class ParallelCompressor
+    {
+    public:
+      //! Constructor.
+      //! @param[in] stream output stream, written only by the workers.
+      //! @param[in] method compression method.
+      //! @param[in] workers number of worker threads.
+      ParallelCompressor(std::ostream* stream, Methods method, unsigned workers);
+
+      //! Destructor. Waits until all submitted blocks are written.
+      ~ParallelCompressor(void);
+
+      //! Submit a block for compression.
+      //! @param[in] data block data.
+      //! @param[in] size block size.
+      void
+      write(const char* data, unsigned size);
+
+      //! Wait until all submitted blocks are written and flush the
+      //! output stream.
+      void
+      flush(void);
+
+    private:
+      // Forward declarations.
+      struct Job;
+      class Worker;
+
+      //! Output stream.
+      std::ostream* m_stream;
+      //! Worker threads.
+      std::vector<Worker*> m_workers;
+      //! Blocks waiting for compression.
+      std::vector<Job*> m_queue;
+      //! Compressed blocks waiting to be written, by sequence number.
+      std::map<uint64_t, Job*> m_done;
+      //! Unused jobs.
+      std::vector<Job*> m_free;
+      //! Sequence number of the next submitted block.
+      uint64_t m_submit_seq;
+      //! Sequence number of the next block to write.
+      uint64_t m_write_seq;
+      //! Maximum number of blocks in flight.
+      unsigned m_max_jobs;
+      //! True while a worker is writing to the output stream.
+      bool m_writing;
+      //! Error raised by a worker.
+      std::string m_error;
+      //! Protects shared state.
+      Concurrency::Condition m_cond;
+
+      //! Take the next block to compress, waiting if needed.
+      //! @param[in] worker calling worker.
+      //! @return job or NULL if the worker must stop.
+      Job*
+      take(Worker* worker);
+
+      //! Hand back a compressed block and write all blocks that are
+      //! ready, in order.
+      //! @param[in] job compressed job.
+      void
+      complete(Job* job);
+
+      //! Throw the first worker error, if any. Must be called with
+      //! the lock held.
+      void
+      checkError(void);
+
+      // Non-copyable.
+      ParallelCompressor(const ParallelCompressor&);
+
+      ParallelCompressor&
+      operator=(const ParallelCompressor&);
+
+      friend class Worker;
+    };
+  }
+}
+
+#endif
@@ -38,6 +38,7 @@
 #include <DUNE/Compression/Factory.hpp>
 #include <DUNE/Compression/Compressor.hpp>
 #include <DUNE/Compression/Decompressor.hpp>
+#include <DUNE/Compression/ParallelCompressor.hpp>
 
 static const unsigned c_put_bfr_size = 128 * 1024;
 static const unsigned c_get_bfr_size = 256 * 1024;
@@ -46,13 +47,18 @@ namespace DUNE
 {
   namespace Compression
   {
-    StreamBuffer::StreamBuffer(std::ostream* stream, Methods method):
+    StreamBuffer::StreamBuffer(std::ostream* stream, Methods method, unsigned threads):
       m_method(method),
       m_ostream(stream),
       m_istream(0),
-      m_dec(0)
+      m_com(0),
+      m_dec(0),
+      m_par(0)
     {
-      m_com = Factory::compressor(method);
+      if (threads > 0)
+        m_par = new ParallelCompressor(stream, method, threads);
+      else
+        m_com = Factory::compressor(method);
     }
 
     StreamBuffer::StreamBuffer(std::istream* stream, Methods method):
@@ -60,6 +66,7 @@ namespace DUNE
       m_ostream(0),
       m_istream(stream),
       m_com(0),
+      m_par(0),
       m_get_bfr_idx(0),
       m_get_bfr_rem(0)
     {
@@ -72,7 +79,10 @@ namespace DUNE
       sync();
 
       if (m_ostream)
+      {
         delete m_com;
+        delete m_par;
+      }
 
       if (m_istream)
         delete m_dec;
@@ -81,6 +91,15 @@ namespace DUNE
     int
     StreamBuffer::sync(void)
     {
+      if (m_par)
+      {
+        // Workers write and flush the output stream.
+        if (m_bfr.getSize() > 0)
+          m_par->write(m_bfr.getBufferSigned(), m_bfr.getSize());
+        m_bfr.setSize(0);
+        return 1;
+      }
+
       if (m_ostream)
       {
         m_com->compress(m_com_bfr, m_bfr);
@@ -124,7 +143,7 @@ namespace DUNE
 
       while (chunk_rem > 0)
       {
-        if (m_get_bfr_rem == 0)
+        if (m_get_bfr_rem == 0 && !m_dec->pending())
         {
           if (m_istream->eof())
           {
@@ -45,6 +45,7 @@ namespace DUNE
     // Forward declarations.
     class Compressor;
     class Decompressor;
+    class ParallelCompressor;
 
     // Export DLL Symbol.
     class DUNE_DLL_SYM StreamBuffer;
@@ -52,7 +53,12 @@ namespace DUNE
     class StreamBuffer: public std::streambuf
     {
     public:
-      StreamBuffer(std::ostream* stream, Methods method);
+      //! Create an output buffer.
+      //! @param[in] stream output stream.
+      //! @param[in] method compression method.
+      //! @param[in] threads number of compression threads, zero to
+      //! compress on the writing thread.
+      StreamBuffer(std::ostream* stream, Methods method, unsigned threads = 0);
 
       StreamBuffer(std::istream* stream, Methods method);
 
@@ -97,6 +103,8 @@ namespace DUNE
       Compressor* m_com;
       //! Decompressor.
       Decompressor* m_dec;
+      //! Parallel compressor.
+      ParallelCompressor* m_par;
       //! Internal buffer.
       Utils::ByteBuffer m_bfr;
       //! Internal compression buffer.
@@ -94,7 +94,8 @@ namespace DUNE
 
       if (t > 0)
       {
-        t += m_clock_monotonic ? Time::Clock::get() : Time::Clock::getSinceEpoch();
+        uint64_t now = m_clock_monotonic ? Time::Clock::getSystemNsec() : Time::Clock::getSystemSinceEpochNsec();
+        t = Time::Clock::toSystem(t) + now / Time::c_nsec_per_sec_fp;
 
         timespec ts = DUNE_TIMESPEC_INIT_SEC_FP(t);
         rv = pthread_cond_timedwait(&m_cond, &m_mutex, &ts);
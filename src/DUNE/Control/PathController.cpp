@@ -640,12 +640,9 @@ namespace DUNE
       // Apply new LLH reference.
       if (change_ref)
       {
-        WGS84::displacement(lat, lon, 0,
-                            m_pcs.start_lat, m_pcs.start_lon, 0,
-                            &m_ts.start.x, &m_ts.start.y);
-        WGS84::displacement(lat, lon, 0,
-                            m_pcs.end_lat, m_pcs.end_lon, 0,
-                            &m_ts.end.x, &m_ts.end.y);
+        m_frame.setReference(lat, lon);
+        m_frame.toNED(m_pcs.start_lat, m_pcs.start_lon, 0, m_ts.start.x, m_ts.start.y);
+        m_frame.toNED(m_pcs.end_lat, m_pcs.end_lon, 0, m_ts.end.x, m_ts.end.y);
       }
 
       double now = Clock::get();
@@ -448,6 +448,8 @@ namespace DUNE
       IMC::ControlLoops m_cloops;
       //! EstimatedState message
       IMC::EstimatedState m_estate;
+      //! Local frame at the EstimatedState reference.
+      Coordinates::LocalFrame m_frame;
       //! DesiredZ reference
       IMC::DesiredZ m_zref;
       //! DesiredSpeed reference
@@ -0,0 +1,259 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Coordinates/LocalFrame.hpp>
+#include <DUNE/Coordinates/WGS84.hpp>
+#include <DUNE/Math/Angles.hpp>
+#include <DUNE/Math/Constants.hpp>
+
+namespace DUNE
+{
+  namespace Coordinates
+  {
+    //! Number of iterations of the fast inverse conversion.
+    static const unsigned c_fast_iterations = 3;
+
+    LocalFrame::LocalFrame(Mode mode):
+      m_mode(mode),
+      m_lat(0),
+      m_lon(0),
+      m_hae(0)
+    {
+      update();
+    }
+
+    LocalFrame::LocalFrame(double lat, double lon, double hae, Mode mode):
+      m_mode(mode),
+      m_lat(lat),
+      m_lon(lon),
+      m_hae(hae)
+    {
+      update();
+    }
+
+    void
+    LocalFrame::setReference(double lat, double lon, double hae)
+    {
+      if (lat == m_lat && lon == m_lon && hae == m_hae)
+        return;
+
+      m_lat = lat;
+      m_lon = lon;
+      m_hae = hae;
+      update();
+    }
+
+    void
+    LocalFrame::update(void)
+    {
+      m_slat = std::sin(m_lat);
+      m_clat = std::cos(m_lat);
+      m_slon = std::sin(m_lon);
+      m_clon = std::cos(m_lon);
+
+      double w2 = 1.0 - c_wgs84_e2 * m_slat * m_slat;
+      double w = std::sqrt(w2);
+      double rn = c_wgs84_a / w;
+      double rm = c_wgs84_a * (1.0 - c_wgs84_e2) / (w2 * w);
+
+      m_ecef[0] = (rn + m_hae) * m_clat * m_clon;
+      m_ecef[1] = (rn + m_hae) * m_clat * m_slon;
+      m_ecef[2] = ((1.0 - c_wgs84_e2) * rn + m_hae) * m_slat;
+
+      m_rm = rm + m_hae;
+      m_rn = rn + m_hae;
+      m_drm = 3.0 * rm * c_wgs84_e2 * m_slat * m_clat / w2;
+      m_drn = rn * c_wgs84_e2 * m_slat * m_clat / w2;
+    }
+
+    void
+    LocalFrame::toNEDExact(double lat, double lon, double hae, double& n, double& e, double& d) const
+    {
+      double slat = std::sin(lat);
+      double clat = std::cos(lat);
+      double rn = c_wgs84_a / std::sqrt(1.0 - c_wgs84_e2 * slat * slat);
+
+      double ox = (rn + hae) * clat * std::cos(lon) - m_ecef[0];
+      double oy = (rn + hae) * clat * std::sin(lon) - m_ecef[1];
+      double oz = ((1.0 - c_wgs84_e2) * rn + hae) * slat - m_ecef[2];
+
+      double t = m_clon * ox + m_slon * oy;
+      n = -m_slat * t + m_clat * oz;
+      e = -m_slon * ox + m_clon * oy;
+      d = -m_clat * t - m_slat * oz;
+    }
+
+    void
+    LocalFrame::toNEDFast(double lat, double lon, double hae, double& n, double& e, double& d) const
+    {
+      double dlat = lat - m_lat;
+      double dlon = lon - m_lon;
+      double dh = hae - m_hae;
+
+      // Keep longitude differences in [-pi, pi].
+      if (dlon > Math::c_pi)
+        dlon -= Math::c_two_pi;
+      else if (dlon < -Math::c_pi)
+        dlon += Math::c_two_pi;
+
+      n = (m_rm + dh + 0.5 * m_drm * dlat) * dlat + 0.5 * m_rn * m_slat * m_clat * dlon * dlon;
+      e = (m_rn + dh + m_drn * dlat) * (m_clat - m_slat * dlat) * dlon;
+      d = -dh + 0.5 * (n * n / m_rm + e * e / m_rn);
+    }
+
+    void
+    LocalFrame::fromNEDExact(double n, double e, double d, double& lat, double& lon, double& hae) const
+    {
+      double t = -m_slat * n - m_clat * d;
+      double x = m_ecef[0] + m_clon * t - m_slon * e;
+      double y = m_ecef[1] + m_slon * t + m_clon * e;
+      double z = m_ecef[2] + m_clat * n - m_slat * d;
+
+      // Closed form solution by Heikkinen (1982).
+      double a2 = c_wgs84_a * c_wgs84_a;
+      double b2 = a2 * (1.0 - c_wgs84_e2);
+      double e4 = c_wgs84_e2 * c_wgs84_e2;
+      double p2 = x * x + y * y;
+      double p = std::sqrt(p2);
+      double z2 = z * z;
+
+      double f = 54.0 * b2 * z2;
+      double g = p2 + (1.0 - c_wgs84_e2) * z2 - e4 * a2;
+      double c = e4 * f * p2 / (g * g * g);
+      double s = std::pow(1.0 + c + std::sqrt(c * c + 2.0 * c), 1.0 / 3.0);
+      double k = s + 1.0 + 1.0 / s;
+      double pk = f / (3.0 * k * k * g * g);
+      double q = std::sqrt(1.0 + 2.0 * e4 * pk);
+      double r0 = -(pk * c_wgs84_e2 * p) / (1.0 + q)
+        + std::sqrt(0.5 * a2 * (1.0 + 1.0 / q)
+                    - pk * (1.0 - c_wgs84_e2) * z2 / (q * (1.0 + q))
+                    - 0.5 * pk * p2);
+      double u = p - c_wgs84_e2 * r0;
+      double uu = std::sqrt(u * u + z2);
+      double vv = std::sqrt(u * u + (1.0 - c_wgs84_e2) * z2);
+      double z0 = b2 * z / (c_wgs84_a * vv);
+
+      lat = std::atan2(z + c_wgs84_ep2 * z0, p);
+      lon = std::atan2(y, x);
+      hae = uu * (1.0 - b2 / (c_wgs84_a * vv));
+    }
+
+    void
+    LocalFrame::fromNEDFast(double n, double e, double d, double& lat, double& lon, double& hae) const
+    {
+      double dlat = n / m_rm;
+      double dlon = e / (m_rn * m_clat);
+      double dh = -d;
+
+      // Fixed point iteration on the forward series.
+      for (unsigned i = 0; i < c_fast_iterations; ++i)
+      {
+        double fn;
+        double fe;
+        double fd;
+        toNEDFast(m_lat + dlat, m_lon + dlon, m_hae + dh, fn, fe, fd);
+        dlat += (n - fn) / m_rm;
+        dlon += (e - fe) / (m_rn * m_clat);
+        dh += fd - d;
+      }
+
+      lat = m_lat + dlat;
+      lon = Math::Angles::normalizeRadian(m_lon + dlon);
+      hae = m_hae + dh;
+    }
+
+    void
+    LocalFrame::toNED(double lat, double lon, double hae, double& n, double& e, double& d) const
+    {
+      if (m_mode == MODE_FAST)
+        toNEDFast(lat, lon, hae, n, e, d);
+      else
+        toNEDExact(lat, lon, hae, n, e, d);
+    }
+
+    void
+    LocalFrame::fromNED(double n, double e, double d, double& lat, double& lon, double& hae) const
+    {
+      if (m_mode == MODE_FAST)
+        fromNEDFast(n, e, d, lat, lon, hae);
+      else
+        fromNEDExact(n, e, d, lat, lon, hae);
+    }
+
+    void
+    LocalFrame::toNED(size_t count, const double* lat, const double* lon, const double* hae,
+                      double* n, double* e, double* d) const
+    {
+      double dummy;
+
+      // Mode is tested once so that the loops can be vectorized.
+      if (m_mode == MODE_FAST)
+      {
+        for (size_t i = 0; i < count; ++i)
+          toNEDFast(lat[i], lon[i], hae ? hae[i] : 0.0, n[i], e[i], d ? d[i] : dummy);
+      }
+      else
+      {
+        for (size_t i = 0; i < count; ++i)
+          toNEDExact(lat[i], lon[i], hae ? hae[i] : 0.0, n[i], e[i], d ? d[i] : dummy);
+      }
+    }
+
+    void
+    LocalFrame::fromNED(size_t count, const double* n, const double* e, const double* d,
+                        double* lat, double* lon, double* hae) const
+    {
+      double dummy;
+
+      if (m_mode == MODE_FAST)
+      {
+        for (size_t i = 0; i < count; ++i)
+          fromNEDFast(n[i], e[i], d ? d[i] : 0.0, lat[i], lon[i], hae ? hae[i] : dummy);
+      }
+      else
+      {
+        for (size_t i = 0; i < count; ++i)
+          fromNEDExact(n[i], e[i], d ? d[i] : 0.0, lat[i], lon[i], hae ? hae[i] : dummy);
+      }
+    }
+
+    void
+    LocalFrame::getBearingAndRange(double lat, double lon, double& bearing, double& range) const
+    {
+      double n;
+      double e;
+      double d;
+      toNED(lat, lon, m_hae, n, e, d);
+      bearing = std::atan2(e, n);
+      range = std::sqrt(n * n + e * e);
+    }
+  }
+}
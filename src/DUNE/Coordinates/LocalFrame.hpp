@@ -0,0 +1,238 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_COORDINATES_LOCAL_FRAME_HPP_INCLUDED_
+#define DUNE_COORDINATES_LOCAL_FRAME_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Coordinates
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LocalFrame;
+
+    //! North-East-Down frame tangent to the WGS-84 ellipsoid at a
+    //! reference point.
+    //!
+    //! The ECEF position of the reference and the rotation to the
+    //! local frame are computed once, so converting many points
+    //! against the same reference costs a fraction of the
+    //! corresponding WGS84::displacement() and WGS84::displace()
+    //! calls. In exact mode results match WGS84::displacement() and
+    //! geodetic coordinates are recovered in closed form. In fast
+    //! mode a second order series around the reference is used,
+    //! with no trigonometric functions per point; its error is below
+    //! 1 mm up to 2 km and below 0.4 m up to 20 km from the reference
+    //! at latitudes up to 70 degrees.
+    class LocalFrame
+    {
+    public:
+      //! Conversion modes.
+      enum Mode
+      {
+        //! Exact conversion through ECEF coordinates.
+        MODE_EXACT,
+        //! Series expansion around the reference.
+        MODE_FAST
+      };
+
+      //! Create frame at latitude and longitude zero.
+      //! @param[in] mode conversion mode.
+      LocalFrame(Mode mode = MODE_EXACT);
+
+      //! Create frame.
+      //! @param[in] lat reference latitude (rad).
+      //! @param[in] lon reference longitude (rad).
+      //! @param[in] hae reference height above ellipsoid (m).
+      //! @param[in] mode conversion mode.
+      LocalFrame(double lat, double lon, double hae = 0, Mode mode = MODE_EXACT);
+
+      //! Change the reference point. Nothing is recomputed if the
+      //! reference did not change.
+      //! @param[in] lat reference latitude (rad).
+      //! @param[in] lon reference longitude (rad).
+      //! @param[in] hae reference height above ellipsoid (m).
+      void
+      setReference(double lat, double lon, double hae = 0);
+
+      //! Get reference latitude.
+      //! @return latitude (rad).
+      double
+      getLatitude(void) const
+      {
+        return m_lat;
+      }
+
+      //! Get reference longitude.
+      //! @return longitude (rad).
+      double
+      getLongitude(void) const
+      {
+        return m_lon;
+      }
+
+      //! Get reference height.
+      //! @return height above ellipsoid (m).
+      double
+      getHeight(void) const
+      {
+        return m_hae;
+      }
+
+      //! Set conversion mode.
+      //! @param[in] mode conversion mode.
+      void
+      setMode(Mode mode)
+      {
+        m_mode = mode;
+      }
+
+      //! Get conversion mode.
+      //! @return conversion mode.
+      Mode
+      getMode(void) const
+      {
+        return m_mode;
+      }
+
+      //! Compute the North-East-Down position of a point.
+      //! @param[in] lat latitude (rad).
+      //! @param[in] lon longitude (rad).
+      //! @param[in] hae height above ellipsoid (m).
+      //! @param[out] n north offset (m).
+      //! @param[out] e east offset (m).
+      //! @param[out] d down offset (m).
+      void
+      toNED(double lat, double lon, double hae, double& n, double& e, double& d) const;
+
+      //! Compute the North-East position of a point.
+      //! @param[in] lat latitude (rad).
+      //! @param[in] lon longitude (rad).
+      //! @param[in] hae height above ellipsoid (m).
+      //! @param[out] n north offset (m).
+      //! @param[out] e east offset (m).
+      void
+      toNED(double lat, double lon, double hae, double& n, double& e) const
+      {
+        double d;
+        toNED(lat, lon, hae, n, e, d);
+      }
+
+      //! Compute the geodetic coordinates of a North-East-Down
+      //! position.
+      //! @param[in] n north offset (m).
+      //! @param[in] e east offset (m).
+      //! @param[in] d down offset (m).
+      //! @param[out] lat latitude (rad).
+      //! @param[out] lon longitude (rad).
+      //! @param[out] hae height above ellipsoid (m).
+      void
+      fromNED(double n, double e, double d, double& lat, double& lon, double& hae) const;
+
+      //! Convert arrays of points to North-East-Down positions.
+      //! @param[in] count number of points.
+      //! @param[in] lat latitudes (rad).
+      //! @param[in] lon longitudes (rad).
+      //! @param[in] hae heights above ellipsoid (m) or NULL if zero.
+      //! @param[out] n north offsets (m).
+      //! @param[out] e east offsets (m).
+      //! @param[out] d down offsets (m) or NULL if not needed.
+      void
+      toNED(size_t count, const double* lat, const double* lon, const double* hae,
+            double* n, double* e, double* d) const;
+
+      //! Convert arrays of North-East-Down positions to geodetic
+      //! coordinates.
+      //! @param[in] count number of points.
+      //! @param[in] n north offsets (m).
+      //! @param[in] e east offsets (m).
+      //! @param[in] d down offsets (m) or NULL if zero.
+      //! @param[out] lat latitudes (rad).
+      //! @param[out] lon longitudes (rad).
+      //! @param[out] hae heights above ellipsoid (m) or NULL if not
+      //! needed.
+      void
+      fromNED(size_t count, const double* n, const double* e, const double* d,
+              double* lat, double* lon, double* hae) const;
+
+      //! Get North-East bearing and range to a point at the height
+      //! of the reference.
+      //! @param[in] lat latitude (rad).
+      //! @param[in] lon longitude (rad).
+      //! @param[out] bearing bearing (rad).
+      //! @param[out] range range (m).
+      void
+      getBearingAndRange(double lat, double lon, double& bearing, double& range) const;
+
+    private:
+      //! Conversion mode.
+      Mode m_mode;
+      //! Reference latitude (rad).
+      double m_lat;
+      //! Reference longitude (rad).
+      double m_lon;
+      //! Reference height (m).
+      double m_hae;
+      //! Reference ECEF coordinates (m).
+      double m_ecef[3];
+      //! Sine and cosine of reference latitude and longitude.
+      double m_slat, m_clat, m_slon, m_clon;
+      //! Meridian radius of curvature plus height (m).
+      double m_rm;
+      //! Prime vertical radius of curvature plus height (m).
+      double m_rn;
+      //! Derivative of the meridian radius with latitude (m/rad).
+      double m_drm;
+      //! Derivative of the prime vertical radius with latitude (m/rad).
+      double m_drn;
+
+      //! Compute reference dependent terms.
+      void
+      update(void);
+
+      void
+      toNEDExact(double lat, double lon, double hae, double& n, double& e, double& d) const;
+
+      void
+      toNEDFast(double lat, double lon, double hae, double& n, double& e, double& d) const;
+
+      void
+      fromNEDExact(double n, double e, double d, double& lat, double& lon, double& hae) const;
+
+      void
+      fromNEDFast(double n, double e, double d, double& lat, double& lon, double& hae) const;
+    };
+  }
+}
+
+#endif
@@ -38,6 +38,8 @@ namespace DUNE
 #include <DUNE/FileSystem/Path.hpp>
 #include <DUNE/FileSystem/Directory.hpp>
 #include <DUNE/FileSystem/FileLock.hpp>
+#include <DUNE/FileSystem/Manifest.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
 #include <DUNE/FileSystem/Exceptions.hpp>
 
 #endif
@@ -0,0 +1,165 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// DUNE headers.
+#include <DUNE/FileSystem/Manifest.hpp>
+
+// Vendor headers.
+#include <lz4/xxhash.h>
+
+namespace DUNE
+{
+  namespace FileSystem
+  {
+    //! Format identifier.
+    static const char* c_magic = "DMAN";
+    //! Format version.
+    static const unsigned c_version = 1;
+
+    const uint32_t Manifest::c_block_size;
+
+    Manifest::Manifest(uint32_t block_size):
+      m_size(0),
+      m_block_size(std::max(block_size, 1u))
+    { }
+
+    void
+    Manifest::compute(const Path& path)
+    {
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      compute(ifs);
+    }
+
+    void
+    Manifest::compute(std::istream& is)
+    {
+      std::vector<char> bfr(m_block_size);
+
+      m_size = 0;
+      m_hashes.clear();
+
+      while (is)
+      {
+        is.read(&bfr[0], bfr.size());
+        std::streamsize n = is.gcount();
+        if (n <= 0)
+          break;
+
+        m_hashes.push_back(XXH32(&bfr[0], (int)n, 0));
+        m_size += n;
+      }
+    }
+
+    std::vector<Manifest::Range>
+    Manifest::diff(const Manifest& other, uint64_t max_length) const
+    {
+      std::vector<Range> ranges;
+
+      for (unsigned i = 0; i < m_hashes.size(); ++i)
+      {
+        uint64_t begin = (uint64_t)i * m_block_size;
+        uint64_t length = std::min((uint64_t)m_block_size, m_size - begin);
+
+        // Blocks match if checksums and lengths are the same, a
+        // partial last block never matches a longer one.
+        if (i < other.m_hashes.size()
+            && m_block_size == other.m_block_size
+            && m_hashes[i] == other.m_hashes[i]
+            && length == std::min((uint64_t)m_block_size, other.m_size - begin))
+          continue;
+
+        if (!ranges.empty()
+            && ranges.back().first + ranges.back().second == begin
+            && (max_length == 0 || ranges.back().second + length <= max_length))
+          ranges.back().second += length;
+        else
+          ranges.push_back(Range(begin, length));
+      }
+
+      return ranges;
+    }
+
+    std::string
+    Manifest::str(void) const
+    {
+      std::ostringstream os;
+      os << c_magic << " " << c_version << " " << m_size << " " << m_block_size << "\n";
+
+      char hex[16];
+      for (unsigned i = 0; i < m_hashes.size(); ++i)
+      {
+        std::sprintf(hex, "%08x\n", m_hashes[i]);
+        os << hex;
+      }
+
+      return os.str();
+    }
+
+    bool
+    Manifest::parse(const std::string& text)
+    {
+      std::istringstream is(text);
+      std::string magic;
+      unsigned version = 0;
+      uint64_t size = 0;
+      uint32_t block_size = 0;
+
+      if (!(is >> magic >> version >> size >> block_size))
+        return false;
+
+      if (magic != c_magic || version != c_version || block_size == 0)
+        return false;
+
+      uint64_t count = (size + block_size - 1) / block_size;
+      std::vector<uint32_t> hashes;
+      hashes.reserve(count);
+
+      std::string word;
+      while (is >> word)
+      {
+        unsigned long value = 0;
+        if (std::sscanf(word.c_str(), "%lx", &value) != 1)
+          return false;
+        hashes.push_back((uint32_t)value);
+      }
+
+      if (hashes.size() != count)
+        return false;
+
+      m_size = size;
+      m_block_size = block_size;
+      m_hashes.swap(hashes);
+      return true;
+    }
+  }
+}
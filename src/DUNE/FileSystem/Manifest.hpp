@@ -0,0 +1,144 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_FILE_SYSTEM_MANIFEST_HPP_INCLUDED_
+#define DUNE_FILE_SYSTEM_MANIFEST_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+
+namespace DUNE
+{
+  namespace FileSystem
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Manifest;
+
+    //! List of checksums of the fixed-size blocks of a file. Comparing
+    //! the manifests of two copies of a file tells which byte ranges
+    //! must be transferred to bring one up to date with the other.
+    //! Blocks are hashed with XXH32.
+    class Manifest
+    {
+    public:
+      //! Byte range (first byte, number of bytes).
+      typedef std::pair<uint64_t, uint64_t> Range;
+
+      //! Default block size.
+      static const uint32_t c_block_size = 1024 * 1024;
+
+      //! Constructor.
+      //! @param[in] block_size block size in bytes.
+      Manifest(uint32_t block_size = c_block_size);
+
+      //! Compute the manifest of a file. A missing file has an empty
+      //! manifest.
+      //! @param[in] path file path.
+      void
+      compute(const Path& path);
+
+      //! Compute the manifest of a stream.
+      //! @param[in] is input stream.
+      void
+      compute(std::istream& is);
+
+      //! Get size of the file.
+      //! @return file size in bytes.
+      uint64_t
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Get block size.
+      //! @return block size in bytes.
+      uint32_t
+      getBlockSize(void) const
+      {
+        return m_block_size;
+      }
+
+      //! Get number of blocks.
+      //! @return number of blocks.
+      unsigned
+      getBlockCount(void) const
+      {
+        return m_hashes.size();
+      }
+
+      //! Get checksum of a block.
+      //! @param[in] index block index.
+      //! @return block checksum.
+      uint32_t
+      getHash(unsigned index) const
+      {
+        return m_hashes[index];
+      }
+
+      //! Get the byte ranges of this file that differ from, or are
+      //! missing in, another copy. Adjacent blocks are merged and
+      //! ranges are split at a maximum length.
+      //! @param[in] other manifest of the other copy, must have the
+      //! same block size.
+      //! @param[in] max_length maximum length of a range, zero for no
+      //! limit.
+      //! @return list of byte ranges.
+      std::vector<Range>
+      diff(const Manifest& other, uint64_t max_length = 0) const;
+
+      //! Convert to text: a header line with the format version, file
+      //! size and block size followed by one hexadecimal checksum per
+      //! line.
+      //! @return manifest text.
+      std::string
+      str(void) const;
+
+      //! Parse text produced by str().
+      //! @param[in] text manifest text.
+      //! @return true if the text is a valid manifest, false otherwise.
+      bool
+      parse(const std::string& text);
+
+    private:
+      //! File size.
+      uint64_t m_size;
+      //! Block size.
+      uint32_t m_block_size;
+      //! Block checksums.
+      std::vector<uint32_t> m_hashes;
+    };
+  }
+}
+
+#endif
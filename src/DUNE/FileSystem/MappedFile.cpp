@@ -0,0 +1,166 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_SYS_TYPES_H)
+#  include <sys/types.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
+
+namespace DUNE
+{
+  namespace FileSystem
+  {
+    MappedFile::MappedFile(void):
+      m_base(NULL),
+      m_size(0),
+      m_mapped(false)
+    { }
+
+    MappedFile::~MappedFile(void)
+    {
+      close();
+    }
+
+    void
+    MappedFile::open(const Path& path)
+    {
+      close();
+
+#if defined(DUNE_SYS_HAS_FCNTL_H) && defined(DUNE_SYS_HAS_SYS_STAT_H)
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw FileReadError(path.str());
+
+      struct stat st;
+      if (::fstat(fd, &st) != 0)
+      {
+        FileReadError e(path.str());
+        ::close(fd);
+        throw e;
+      }
+
+      m_size = st.st_size;
+
+#  if defined(DUNE_SYS_HAS_MMAP)
+      if (m_size > 0)
+      {
+        void* ptr = ::mmap(NULL, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (ptr != MAP_FAILED)
+        {
+          m_base = static_cast<uint8_t*>(ptr);
+          m_mapped = true;
+        }
+      }
+#  endif
+
+      if (!m_mapped)
+      {
+        m_base = new uint8_t[m_size + 1];
+
+        size_t done = 0;
+        while (done < m_size)
+        {
+          ssize_t rv = ::read(fd, m_base + done, m_size - done);
+          if (rv <= 0)
+            break;
+
+          done += rv;
+        }
+
+        if (done != m_size)
+        {
+          ::close(fd);
+          close();
+          throw FileReadError(path.str(), "failed to read");
+        }
+      }
+
+      ::close(fd);
+#else
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      if (!ifs.is_open())
+        throw FileReadError(path.str(), "failed to open");
+
+      ifs.seekg(0, std::ios::end);
+      m_size = ifs.tellg();
+      ifs.seekg(0, std::ios::beg);
+      m_base = new uint8_t[m_size + 1];
+      ifs.read((char*)m_base, m_size);
+
+      if ((size_t)ifs.gcount() != m_size)
+      {
+        close();
+        throw FileReadError(path.str(), "failed to read");
+      }
+#endif
+    }
+
+    void
+    MappedFile::close(void)
+    {
+      if (m_base != NULL)
+      {
+#if defined(DUNE_SYS_HAS_MMAP)
+        if (m_mapped)
+          ::munmap(m_base, m_size);
+        else
+          delete [] m_base;
+#else
+        delete [] m_base;
+#endif
+      }
+
+      m_base = NULL;
+      m_size = 0;
+      m_mapped = false;
+    }
+  }
+}
@@ -22,118 +22,86 @@
 // language governing permissions and limitations at                        *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Ricardo Martins                                                  *
+// Author: agent                                                            *
 //***************************************************************************
 
-#ifndef SENSORS_EDGETECH_2205_LOG_HPP_INCLUDED_
-#define SENSORS_EDGETECH_2205_LOG_HPP_INCLUDED_
+#ifndef DUNE_FILE_SYSTEM_MAPPED_FILE_HPP_INCLUDED_
+#define DUNE_FILE_SYSTEM_MAPPED_FILE_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
-#include <queue>
-#include <fstream>
+#include <cstddef>
 
 // DUNE headers.
-#include <DUNE/DUNE.hpp>
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/Path.hpp>
 
-// Local headers.
-#include "Packet.hpp"
-
-namespace Sensors
+namespace DUNE
 {
-  namespace Edgetech2205
+  namespace FileSystem
   {
-    using DUNE_NAMESPACES;
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MappedFile;
 
-    class Log: public Concurrency::Thread
+    //! Read-only view of the contents of a file. Files are memory
+    //! mapped when the system supports it and read into memory
+    //! otherwise, so callers always see one contiguous buffer.
+    class MappedFile
     {
     public:
-      Log(Tasks::Task* parent, const Path& path, size_t buffer_count = 10):
-        m_parent(parent)
-      {
-        for (size_t i = 0; i < buffer_count; ++i)
-          m_clean.push(new Packet());
+      //! Create an empty view.
+      MappedFile(void);
 
-        m_stream.open(path.c_str(), std::ofstream::app | std::ios::binary);
-        m_path = path;
-      }
-
-      ~Log(void)
-      {
-        processDirtyQueue();
-        m_stream.close();
-        clearCleanQueue();
-      }
+      //! Release the file contents.
+      ~MappedFile(void);
 
-      Path
-      getPath(void)
-      {
-        return m_path;
-      }
+      //! Map a file, releasing the previous one.
+      //! @param[in] path file path.
+      //! @throw FileReadError if the file cannot be read.
+      void
+      open(const Path& path);
 
+      //! Release the file contents.
       void
-      put(Packet* packet)
-      {
-        m_dirty.push(packet);
-      }
+      close(void);
 
-      Packet*
-      get(void)
+      //! Get file contents.
+      //! @return pointer to file contents or NULL if no file is open.
+      const uint8_t*
+      getData(void) const
       {
-        Packet* packet = m_clean.pop();
-        if (packet == NULL)
-          packet = new Packet();
-
-        return packet;
+        return m_base;
       }
 
-    private:
-      //! Parent task.
-      Tasks::Task* m_parent;
-      //! Dirty packet queue.
-      Concurrency::TSQueue<Packet*> m_dirty;
-      //! Clean packet queue.
-      Concurrency::TSQueue<Packet*> m_clean;
-      //! Log path.
-      Path m_path;
-      //! Log output stream.
-      std::ofstream m_stream;
-
-      void
-      processDirtyQueue(void)
+      //! Get file size.
+      //! @return file size in bytes.
+      size_t
+      getSize(void) const
       {
-        while (!m_dirty.empty())
-        {
-          Packet* packet = m_dirty.pop();
-          if (packet != NULL)
-          {
-            m_stream.write((const char*)packet->getData(), packet->getSize());
-            m_clean.push(packet);
-          }
-        }
+        return m_size;
       }
 
-      void
-      clearCleanQueue(void)
+      //! Check if the file is memory mapped.
+      //! @return true if the file is memory mapped, false if it was
+      //! read into memory.
+      bool
+      isMapped(void) const
       {
-        while (!m_clean.empty())
-        {
-          Packet* packet = m_clean.pop();
-          if (packet != NULL)
-            delete packet;
-        }
+        return m_mapped;
       }
 
-      void
-      run(void)
-      {
-        while (isRunning())
-        {
-          if (m_dirty.waitForItems(1.0))
-          {
-            processDirtyQueue();
-          }
-        }
-      }
+    private:
+      //! Mapped or allocated memory.
+      uint8_t* m_base;
+      //! File size.
+      size_t m_size;
+      //! True if memory is mapped.
+      bool m_mapped;
+
+      // Non-copyable.
+      MappedFile(const MappedFile&);
+
+      MappedFile&
+      operator=(const MappedFile&);
     };
   }
 }
@@ -570,6 +570,39 @@ namespace DUNE
       std::fclose(ofd);
     }
 
+    void
+    Path::rename(const Path& destination) const
+    {
+      // Microsoft Windows implementation.
+#if defined(DUNE_OS_WINDOWS)
+      if (MoveFileEx(c_str(), destination.c_str(), MOVEFILE_REPLACE_EXISTING) == 0)
+        throw System::Error(GetLastError(), "renaming path", m_path);
+
+#else
+      if (std::rename(c_str(), destination.c_str()) != 0)
+        throw System::Error(errno, "renaming path", m_path);
+#endif
+    }
+
+    void
+    Path::link(const Path& destination) const
+    {
+      // POSIX implementation.
+#if defined(DUNE_OS_POSIX)
+      if (::link(c_str(), destination.c_str()) != 0)
+        throw System::Error(errno, "linking path", m_path);
+
+      // Microsoft Windows implementation.
+#elif defined(DUNE_OS_WINDOWS)
+      if (CreateHardLink(destination.c_str(), c_str(), NULL) == 0)
+        throw System::Error(GetLastError(), "linking path", m_path);
+
+      // Lacking implementation.
+#else
+#  error Path::link() is not yet implemented in this system.
+#endif
+    }
+
     void
     Path::normalize(void)
     {
@@ -194,6 +194,18 @@ namespace DUNE
       void
       copy(const Path& destination) const;
 
+      //! Atomically rename the path, replacing the destination
+      //! if it exists.
+      //! @param destination new path.
+      void
+      rename(const Path& destination) const;
+
+      //! Create a hard link to the path. Both paths must reside
+      //! on the same filesystem.
+      //! @param destination path of the new link.
+      void
+      link(const Path& destination) const;
+
       Path
       absolute(void) const
       {
@@ -0,0 +1,742 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Hardware/Recorder.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_SYS_TYPES_H)
+#  include <sys/types.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_UIO_H)
+#  include <sys/uio.h>
+#endif
+
+namespace DUNE
+{
+  namespace Hardware
+  {
+    //! Period between file synchronizations (s).
+    static const double c_sync_period = 1.0;
+    //! Period of throughput computation (s).
+    static const double c_rate_period = 1.0;
+    //! Maximum number of buffers written in a single call.
+    static const unsigned c_batch_max = 64;
+
+    struct Recorder::File
+    {
+      //! Recorder writing the file.
+      Recorder* owner;
+      //! File path.
+      FileSystem::Path path;
+      //! File descriptor.
+      int fd;
+      //! Storage error or zero.
+      int error;
+      //! True if there is data not yet synchronized.
+      bool dirty;
+      //! True to remove the file on close if it is empty.
+      bool remove_empty;
+      //! Time of last synchronization.
+      double sync_time;
+    };
+
+    //! I/O thread shared by all recorders writing to the same
+    //! storage volume.
+    class RecorderVolume: public Concurrency::Thread
+    {
+    public:
+      //! Operation types.
+      enum OperationType
+      {
+        //! Open file.
+        OP_OPEN,
+        //! Write buffer.
+        OP_WRITE,
+        //! Close file.
+        OP_CLOSE
+      };
+
+      //! Queued operation.
+      struct Operation
+      {
+        //! Operation type.
+        OperationType type;
+        //! Recorder that queued the operation.
+        Recorder* owner;
+        //! Target file.
+        Recorder::File* file;
+        //! Buffer to write.
+        Recorder::Buffer* buffer;
+      };
+
+      //! Get the I/O thread of the volume where a file resides,
+      //! starting it if needed.
+      //! @param[in] path file path.
+      //! @return I/O thread.
+      static RecorderVolume*
+      acquire(const FileSystem::Path& path)
+      {
+        uint64_t key = getKey(path);
+
+        Concurrency::ScopedMutex l(s_lock);
+
+        std::map<uint64_t, RecorderVolume*>::iterator itr = s_volumes.find(key);
+        if (itr != s_volumes.end())
+        {
+          ++itr->second->m_refs;
+          return itr->second;
+        }
+
+        RecorderVolume* volume = new RecorderVolume(key);
+        s_volumes[key] = volume;
+        volume->start();
+        return volume;
+      }
+
+      //! Release an I/O thread. The last release stops the thread
+      //! after all queued operations are done.
+      //! @param[in] volume I/O thread.
+      static void
+      release(RecorderVolume* volume)
+      {
+        {
+          Concurrency::ScopedMutex l(s_lock);
+
+          if (--volume->m_refs > 0)
+            return;
+
+          s_volumes.erase(volume->m_key);
+        }
+
+        volume->stop();
+        volume->m_cond.lock();
+        volume->m_cond.broadcast();
+        volume->m_cond.unlock();
+        volume->join();
+        delete volume;
+      }
+
+      //! Queue an operation.
+      //! @param[in] type operation type.
+      //! @param[in] owner recorder.
+      //! @param[in] file target file.
+      //! @param[in] buffer buffer or NULL.
+      void
+      push(OperationType type, Recorder* owner, Recorder::File* file,
+           Recorder::Buffer* buffer = NULL)
+      {
+        Operation op;
+        op.type = type;
+        op.owner = owner;
+        op.file = file;
+        op.buffer = buffer;
+
+        Concurrency::ScopedCondition l(m_cond);
+        m_queue.push_back(op);
+        m_cond.signal();
+      }
+
+    private:
+      //! Volume identifier.
+      uint64_t m_key;
+      //! Number of recorders using this volume.
+      unsigned m_refs;
+      //! Operation queue.
+      std::deque<Operation> m_queue;
+      //! Protects the operation queue.
+      Concurrency::Condition m_cond;
+      //! Open files.
+      std::set<Recorder::File*> m_files;
+      //! Running I/O threads.
+      static std::map<uint64_t, RecorderVolume*> s_volumes;
+      //! Protects the I/O thread map.
+      static Concurrency::Mutex s_lock;
+
+      RecorderVolume(uint64_t key):
+        m_key(key),
+        m_refs(1)
+      { }
+
+      //! Find the device holding a path or its closest existing
+      //! parent.
+      //! @param[in] path file path.
+      //! @return device identifier.
+      static uint64_t
+      getKey(const FileSystem::Path& path)
+      {
+#if defined(DUNE_SYS_HAS_STAT)
+        std::string dir = path.dirname(false).str();
+
+        while (!dir.empty())
+        {
+          struct stat st;
+          if (::stat(dir.c_str(), &st) == 0)
+            return (uint64_t)st.st_dev;
+
+          std::string::size_type idx = dir.find_last_of(FileSystem::Path::separator());
+          if (idx == std::string::npos)
+            break;
+
+          dir.resize(idx);
+        }
+#else
+        (void)path;
+#endif
+        return 0;
+      }
+
+      void
+      openFile(const Operation& op)
+      {
+        Recorder::File* file = op.file;
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+        try
+        {
+          file->path.dirname().create();
+        }
+        catch (...)
+        { }
+
+        do
+        {
+          file->fd = ::open(file->path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+        }
+        while (file->fd < 0 && errno == EINTR);
+
+        if (file->fd < 0)
+          fail(file, errno);
+#else
+        fail(file, ENOSYS);
+#endif
+
+        file->dirty = false;
+        file->sync_time = Time::Clock::get();
+        m_files.insert(file);
+        op.owner->onDone();
+      }
+
+      void
+      closeFile(const Operation& op)
+      {
+        Recorder::File* file = op.file;
+
+        if (file->fd >= 0)
+        {
+          if (file->dirty)
+            syncFile(file);
+
+          bool empty = false;
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+          struct stat st;
+          if (file->remove_empty && ::fstat(file->fd, &st) == 0)
+            empty = (st.st_size == 0);
+#endif
+
+          ::close(file->fd);
+
+          if (empty)
+            ::unlink(file->path.c_str());
+        }
+
+        m_files.erase(file);
+        delete file;
+        op.owner->onDone();
+      }
+
+      //! Write a run of buffers destined to the same file.
+      //! @param[in] batch operations.
+      //! @param[in] first index of first write operation.
+      //! @return index of the next operation to process.
+      size_t
+      writeFile(const std::vector<Operation>& batch, size_t first)
+      {
+        Recorder::File* file = batch[first].file;
+
+        size_t last = first + 1;
+        while (last < batch.size() && last - first < c_batch_max
+               && batch[last].type == OP_WRITE && batch[last].file == file)
+          ++last;
+
+        bool written = false;
+
+        if (file->fd >= 0 && file->error == 0)
+        {
+          int rv = writeBuffers(file->fd, batch, first, last);
+
+          if (rv == 0)
+          {
+            written = true;
+            file->dirty = true;
+          }
+          else
+          {
+            fail(file, rv);
+          }
+        }
+
+        for (size_t i = first; i < last; ++i)
+          batch[i].owner->onWritten(batch[i].buffer, written);
+
+        return last;
+      }
+
+      //! Write buffers, retrying on short writes.
+      //! @return zero on success, error number otherwise.
+      static int
+      writeBuffers(int fd, const std::vector<Operation>& batch, size_t first, size_t last)
+      {
+#if defined(DUNE_SYS_HAS_WRITEV)
+        struct iovec iov[c_batch_max];
+        int count = 0;
+
+        for (size_t i = first; i < last; ++i, ++count)
+        {
+          iov[count].iov_base = batch[i].buffer->data;
+          iov[count].iov_len = batch[i].buffer->size;
+        }
+
+        struct iovec* itr = iov;
+        while (count > 0)
+        {
+          ssize_t rv = ::writev(fd, itr, count);
+          if (rv < 0)
+          {
+            if (errno == EINTR)
+              continue;
+
+            return errno;
+          }
+
+          size_t n = rv;
+          while (count > 0 && n >= itr->iov_len)
+          {
+            n -= itr->iov_len;
+            ++itr;
+            --count;
+          }
+
+          if (count > 0)
+          {
+            itr->iov_base = (uint8_t*)itr->iov_base + n;
+            itr->iov_len -= n;
+          }
+        }
+#elif defined(DUNE_SYS_HAS_UNISTD_H)
+        for (size_t i = first; i < last; ++i)
+        {
+          const uint8_t* data = batch[i].buffer->data;
+          size_t size = batch[i].buffer->size;
+
+          while (size > 0)
+          {
+            ssize_t rv = ::write(fd, data, size);
+            if (rv < 0)
+            {
+              if (errno == EINTR)
+                continue;
+
+              return errno;
+            }
+
+            data += rv;
+            size -= rv;
+          }
+        }
+#else
+        (void)fd;
+        (void)batch;
+        (void)first;
+        (void)last;
+        return ENOSYS;
+#endif
+
+        return 0;
+      }
+
+      void
+      syncFile(Recorder::File* file)
+      {
+        int rv = 0;
+
+#if defined(DUNE_SYS_HAS_FDATASYNC)
+        rv = ::fdatasync(file->fd);
+#elif defined(DUNE_SYS_HAS_FSYNC)
+        rv = ::fsync(file->fd);
+#endif
+
+        if (rv != 0 && file->error == 0)
+          fail(file, errno);
+
+        file->dirty = false;
+        file->sync_time = Time::Clock::get();
+      }
+
+      //! Synchronize files with data older than the sync period.
+      void
+      syncFiles(void)
+      {
+        double now = Time::Clock::get();
+
+        std::set<Recorder::File*>::iterator itr = m_files.begin();
+        for (; itr != m_files.end(); ++itr)
+        {
+          Recorder::File* file = *itr;
+          if (file->dirty && now - file->sync_time >= c_sync_period)
+            syncFile(file);
+        }
+      }
+
+      void
+      fail(Recorder::File* file, int error)
+      {
+        file->error = error;
+        file->owner->onFailed(file, error);
+      }
+
+      void
+      process(const std::vector<Operation>& batch)
+      {
+        size_t i = 0;
+        while (i < batch.size())
+        {
+          switch (batch[i].type)
+          {
+            case OP_OPEN:
+              openFile(batch[i++]);
+              break;
+
+            case OP_WRITE:
+              i = writeFile(batch, i);
+              break;
+
+            case OP_CLOSE:
+              closeFile(batch[i++]);
+              break;
+          }
+        }
+      }
+
+      void
+      run(void)
+      {
+        std::vector<Operation> batch;
+
+        while (true)
+        {
+          m_cond.lock();
+
+          if (m_queue.empty() && !isStopping())
+            m_cond.wait(c_sync_period);
+
+          batch.assign(m_queue.begin(), m_queue.end());
+          m_queue.clear();
+
+          bool done = batch.empty() && isStopping();
+          m_cond.unlock();
+
+          if (done)
+            break;
+
+          process(batch);
+          syncFiles();
+        }
+      }
+    };
+
+    std::map<uint64_t, RecorderVolume*> RecorderVolume::s_volumes;
+    Concurrency::Mutex RecorderVolume::s_lock;
+
+    Recorder::Recorder(size_t buffer_count, size_t buffer_size):
+      m_file(NULL),
+      m_volume(NULL),
+      m_buffer(NULL),
+      m_buffers(buffer_count),
+      m_buffer_size(buffer_size),
+      m_pending(0),
+      m_failed(false),
+      m_rate_bytes(0),
+      m_rate_time(Time::Clock::get())
+    {
+      std::memset(&m_stats, 0, sizeof(m_stats));
+
+      m_storage = new uint8_t[buffer_count * buffer_size];
+      m_free.reserve(buffer_count);
+
+      for (size_t i = 0; i < buffer_count; ++i)
+      {
+        m_buffers[i].data = m_storage + i * buffer_size;
+        m_buffers[i].size = 0;
+        m_free.push_back(&m_buffers[i]);
+      }
+    }
+
+    Recorder::~Recorder(void)
+    {
+      close();
+      sync();
+
+      if (m_volume != NULL)
+        RecorderVolume::release(m_volume);
+
+      delete [] m_storage;
+    }
+
+    void
+    Recorder::open(const FileSystem::Path& path)
+    {
+      close();
+
+      RecorderVolume* volume = RecorderVolume::acquire(path);
+      if (m_volume != NULL)
+        RecorderVolume::release(m_volume);
+      m_volume = volume;
+
+      File* file = new File;
+      file->owner = this;
+      file->path = path;
+      file->fd = -1;
+      file->error = 0;
+      file->dirty = false;
+      file->remove_empty = false;
+      file->sync_time = 0;
+
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_file = file;
+        m_failed = false;
+        ++m_pending;
+      }
+
+      m_path = path;
+      m_volume->push(RecorderVolume::OP_OPEN, this, file);
+    }
+
+    void
+    Recorder::close(bool remove_empty)
+    {
+      if (m_file == NULL)
+        return;
+
+      flush();
+
+      File* file = m_file;
+      file->remove_empty = remove_empty;
+
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_file = NULL;
+        ++m_pending;
+      }
+
+      m_path.clear();
+      m_volume->push(RecorderVolume::OP_CLOSE, this, file);
+    }
+
+    bool
+    Recorder::write(const void* const* data, const size_t* sizes, size_t count)
+    {
+      if (m_file == NULL)
+        return false;
+
+      size_t total = 0;
+      for (size_t i = 0; i < count; ++i)
+        total += sizes[i];
+
+      // Records are either queued or dropped as a whole.
+      {
+        Concurrency::ScopedCondition l(m_cond);
+
+        size_t room = (m_buffer == NULL) ? 0 : m_buffer_size - m_buffer->size;
+        size_t needed = 0;
+        if (total > room)
+          needed = (total - room + m_buffer_size - 1) / m_buffer_size;
+
+        if (m_failed || needed > m_free.size())
+        {
+          m_stats.dropped += total;
+          return false;
+        }
+      }
+
+      for (size_t i = 0; i < count; ++i)
+        copy(static_cast<const uint8_t*>(data[i]), sizes[i]);
+
+      return true;
+    }
+
+    void
+    Recorder::copy(const uint8_t* data, size_t size)
+    {
+      while (size > 0)
+      {
+        if (m_buffer == NULL)
+        {
+          Concurrency::ScopedCondition l(m_cond);
+          m_buffer = m_free.back();
+          m_free.pop_back();
+          m_buffer->size = 0;
+        }
+
+        size_t count = std::min(size, m_buffer_size - m_buffer->size);
+        std::memcpy(m_buffer->data + m_buffer->size, data, count);
+        m_buffer->size += count;
+        data += count;
+        size -= count;
+
+        if (m_buffer->size == m_buffer_size)
+          submit();
+      }
+    }
+
+    void
+    Recorder::flush(void)
+    {
+      if (m_buffer != NULL && m_buffer->size > 0)
+        submit();
+    }
+
+    void
+    Recorder::sync(void)
+    {
+      flush();
+
+      Concurrency::ScopedCondition l(m_cond);
+      while (m_pending > 0)
+        m_cond.wait();
+    }
+
+    bool
+    Recorder::hasFailed(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      return m_failed;
+    }
+
+    Recorder::Statistics
+    Recorder::getStatistics(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      updateRate();
+      return m_stats;
+    }
+
+    void
+    Recorder::submit(void)
+    {
+      Buffer* buffer = m_buffer;
+      m_buffer = NULL;
+
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_stats.backlog += buffer->size;
+        ++m_pending;
+      }
+
+      m_volume->push(RecorderVolume::OP_WRITE, this, m_file, buffer);
+    }
+
+    void
+    Recorder::updateRate(void)
+    {
+      double now = Time::Clock::get();
+      double elapsed = now - m_rate_time;
+
+      if (elapsed < c_rate_period)
+        return;
+
+      m_stats.rate = (m_stats.written - m_rate_bytes) / elapsed;
+      m_rate_bytes = m_stats.written;
+      m_rate_time = now;
+    }
+
+    void
+    Recorder::onWritten(Buffer* buffer, bool written)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      m_stats.backlog -= buffer->size;
+      if (written)
+        m_stats.written += buffer->size;
+      else
+        m_stats.dropped += buffer->size;
+
+      m_free.push_back(buffer);
+      updateRate();
+
+      --m_pending;
+      m_cond.broadcast();
+    }
+
+    void
+    Recorder::onFailed(File* file, int error)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      m_stats.error = error;
+      if (file == m_file)
+        m_failed = true;
+    }
+
+    void
+    Recorder::onDone(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      --m_pending;
+      m_cond.broadcast();
+    }
+  }
+}
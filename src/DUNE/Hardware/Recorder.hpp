@@ -0,0 +1,236 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_HARDWARE_RECORDER_HPP_INCLUDED_
+#define DUNE_HARDWARE_RECORDER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+
+namespace DUNE
+{
+  namespace Hardware
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Recorder;
+
+    // Forward declaration.
+    class RecorderVolume;
+
+    //! Asynchronous recorder of raw device data.
+    //!
+    //! Data handed to write() is copied into a fixed set of pooled
+    //! buffers and written by an I/O thread shared by all recorders
+    //! on the same storage volume. Full buffers are written in batches
+    //! with scatter/gather I/O and synchronized periodically. When no
+    //! buffer is free or storage fails (e.g., the disk is full) data
+    //! is dropped instead of blocking the caller. Recording resumes on
+    //! the next call to open().
+    class Recorder
+    {
+    public:
+      //! Recorder statistics.
+      struct Statistics
+      {
+        //! Bytes written to storage.
+        uint64_t written;
+        //! Bytes waiting to be written.
+        uint64_t backlog;
+        //! Bytes dropped.
+        uint64_t dropped;
+        //! Write throughput (bytes/s).
+        double rate;
+        //! Last storage error (errno) or zero.
+        int error;
+      };
+
+      //! Constructor.
+      //! @param[in] buffer_count number of pooled buffers.
+      //! @param[in] buffer_size size of each buffer in bytes.
+      Recorder(size_t buffer_count = 16, size_t buffer_size = 64 * 1024);
+
+      //! Destructor. Pending data is written before returning.
+      ~Recorder(void);
+
+      //! Start recording to a file, closing the current one. Data is
+      //! appended if the file already exists.
+      //! @param[in] path file path.
+      void
+      open(const FileSystem::Path& path);
+
+      //! Stop recording. Pending data is written in the background.
+      //! @param[in] remove_empty remove the file if nothing was
+      //! written to it.
+      void
+      close(bool remove_empty = false);
+
+      //! Test if a file is open.
+      //! @return true if a file is open, false otherwise.
+      bool
+      isOpen(void) const
+      {
+        return m_file != NULL;
+      }
+
+      //! Get path of the current file.
+      //! @return file path.
+      const FileSystem::Path&
+      getPath(void) const
+      {
+        return m_path;
+      }
+
+      //! Append data to the current file. This function never blocks
+      //! on storage.
+      //! @param[in] data data.
+      //! @param[in] size number of bytes.
+      //! @return true if data was queued, false if it was dropped.
+      bool
+      write(const void* data, size_t size)
+      {
+        return write(&data, &size, 1);
+      }
+
+      //! Append several blocks of data as a single record. Either all
+      //! blocks are queued or all are dropped.
+      //! @param[in] data blocks.
+      //! @param[in] sizes number of bytes of each block.
+      //! @param[in] count number of blocks.
+      //! @return true if data was queued, false if it was dropped.
+      bool
+      write(const void* const* data, const size_t* sizes, size_t count);
+
+      //! Queue the partially filled buffer for writing.
+      void
+      flush(void);
+
+      //! Wait until all queued data has been written.
+      void
+      sync(void);
+
+      //! Test if storage has failed since the file was opened.
+      //! @return true if storage failed, false otherwise.
+      bool
+      hasFailed(void);
+
+      //! Get recorder statistics.
+      //! @return statistics.
+      Statistics
+      getStatistics(void);
+
+    private:
+      //! Pooled buffer.
+      struct Buffer
+      {
+        //! Buffer data.
+        uint8_t* data;
+        //! Number of used bytes.
+        size_t size;
+      };
+
+      // Opaque file state, owned by the I/O thread.
+      struct File;
+
+      //! Current file path.
+      FileSystem::Path m_path;
+      //! Current file.
+      File* m_file;
+      //! I/O thread of the current file's volume.
+      RecorderVolume* m_volume;
+      //! Buffer being filled.
+      Buffer* m_buffer;
+      //! Buffers.
+      std::vector<Buffer> m_buffers;
+      //! Free buffers.
+      std::vector<Buffer*> m_free;
+      //! Buffer storage.
+      uint8_t* m_storage;
+      //! Buffer size.
+      size_t m_buffer_size;
+      //! Number of operations not yet processed by the I/O thread.
+      unsigned m_pending;
+      //! True if storage of the current file failed.
+      bool m_failed;
+      //! Statistics.
+      Statistics m_stats;
+      //! Bytes written at the start of the rate window.
+      uint64_t m_rate_bytes;
+      //! Start of the rate window.
+      double m_rate_time;
+      //! Protects buffers, statistics and pending count.
+      Concurrency::Condition m_cond;
+
+      //! Copy data to pooled buffers, queueing full buffers. Enough
+      //! buffers must be free.
+      //! @param[in] data data.
+      //! @param[in] size number of bytes.
+      void
+      copy(const uint8_t* data, size_t size);
+
+      //! Queue the buffer being filled.
+      void
+      submit(void);
+
+      //! Update throughput estimate. Must be called with the lock
+      //! held.
+      void
+      updateRate(void);
+
+      //! Called by the I/O thread after a buffer was processed.
+      //! @param[in] buffer buffer.
+      //! @param[in] written true if the buffer was written.
+      void
+      onWritten(Buffer* buffer, bool written);
+
+      //! Called by the I/O thread when storage fails.
+      //! @param[in] file file.
+      //! @param[in] error error number.
+      void
+      onFailed(File* file, int error);
+
+      //! Called by the I/O thread after any other operation.
+      void
+      onDone(void);
+
+      // Non-copyable.
+      Recorder(const Recorder&);
+
+      Recorder&
+      operator=(const Recorder&);
+
+      friend class RecorderVolume;
+    };
+  }
+}
+
+#endif
@@ -59,6 +59,14 @@
 #  include <sys/select.h>
 #endif
 
+#if defined(DUNE_SYS_HAS_SYS_IOCTL_H)
+#  include <sys/ioctl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_LINUX_SERIAL_H)
+#  include <linux/serial.h>
+#endif
+
 // Microsoft Windows headers.
 #if defined(DUNE_SYS_HAS_WINDOWS_H)
 #  include <windows.h>
@@ -540,6 +548,41 @@ namespace DUNE
 #endif
     }
 
+    bool
+    SerialPort::setLowLatency(bool enabled)
+    {
+      bool rv = false;
+
+#if defined(DUNE_OS_POSIX)
+#  if defined(DUNE_SYS_HAS_LINUX_SERIAL_H) && defined(TIOCGSERIAL) && defined(ASYNC_LOW_LATENCY)
+      serial_struct ss;
+      if (ioctl(m_handle, TIOCGSERIAL, &ss) == 0)
+      {
+        if (enabled)
+          ss.flags |= ASYNC_LOW_LATENCY;
+        else
+          ss.flags &= ~ASYNC_LOW_LATENCY;
+
+        rv = (ioctl(m_handle, TIOCSSERIAL, &ss) == 0);
+      }
+#  endif
+
+      if (enabled)
+      {
+        if (m_options.c_cc[VMIN] > 1)
+          m_options.c_cc[VMIN] = 1;
+        m_options.c_cc[VTIME] = 0;
+
+        if (tcsetattr(m_handle, TCSANOW, &(m_options)) == -1)
+          throw Error("setting low latency", System::Error::getLastMessage());
+      }
+#elif defined(DUNE_OS_WINDOWS)
+      (void)enabled;
+#endif
+
+      return rv;
+    }
+
     void
     SerialPort::sendBreak(int duration)
     {
@@ -167,6 +167,18 @@ namespace DUNE
       void
       setNonBlocking(void);
 
+      //! Enable/disable low latency mode. When enabled the device
+      //! driver is asked to deliver received bytes immediately
+      //! (ASYNC_LOW_LATENCY) instead of batching them, and the
+      //! terminal is configured to complete reads as soon as one byte
+      //! is available (VMIN at most one, VTIME zero). Disabling only
+      //! clears the driver flag.
+      //! @param[in] enabled true to enable, false to disable.
+      //! @return true if the device driver accepted the request,
+      //! false if it does not support low latency mode.
+      bool
+      setLowLatency(bool enabled);
+
       void
       sendBreak(int duration);
 
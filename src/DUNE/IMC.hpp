@@ -47,7 +47,14 @@ namespace DUNE
 #include <DUNE/IMC/Parser.hpp>
 #include <DUNE/IMC/Exceptions.hpp>
 #include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/IMC/MessageView.hpp>
+#include <DUNE/IMC/Columns.hpp>
+#include <DUNE/IMC/ColumnWriter.hpp>
+#include <DUNE/IMC/ColumnReader.hpp>
 #include <DUNE/IMC/Blob.hpp>
 #include <DUNE/IMC/IridiumMessageDefinitions.hpp>
+#include <DUNE/IMC/CompactStream.hpp>
+#include <DUNE/IMC/CompactProfile.hpp>
+#include <DUNE/IMC/CompactCodec.hpp>
 
 #endif
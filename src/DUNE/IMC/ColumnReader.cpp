@@ -0,0 +1,265 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Decompressor.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+#include <DUNE/IMC/ColumnReader.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Decode a little endian value.
+    //! @param[in] ptr pointer to the value.
+    //! @param[in] type field type.
+    //! @return value.
+    static fp64_t
+    decode(const uint8_t* ptr, MessageView::FieldType type)
+    {
+      switch (type)
+      {
+        case MessageView::FT_INT8:
+          return (int8_t)ptr[0];
+        case MessageView::FT_UINT8:
+          return ptr[0];
+        case MessageView::FT_INT16:
+          return (int16_t)decodeColumnValue(ptr, 2);
+        case MessageView::FT_UINT16:
+          return (uint16_t)decodeColumnValue(ptr, 2);
+        case MessageView::FT_INT32:
+          return (int32_t)decodeColumnValue(ptr, 4);
+        case MessageView::FT_UINT32:
+          return (uint32_t)decodeColumnValue(ptr, 4);
+        case MessageView::FT_INT64:
+          return (fp64_t)(int64_t)decodeColumnValue(ptr, 8);
+        case MessageView::FT_FP32:
+          {
+            uint32_t bits = (uint32_t)decodeColumnValue(ptr, 4);
+            fp32_t value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+          }
+        default:
+          return decodeColumnDouble(ptr);
+      }
+    }
+
+    ColumnReader::Column::Column(const FileSystem::Path& path):
+      m_path(path.str()),
+      m_type(MessageView::FT_FP64),
+      m_rows(0),
+      m_decompressor(NULL)
+    {
+      try
+      {
+        m_file.open(path);
+      }
+      catch (FileSystem::FileReadError& e)
+      {
+        throw ColumnError(m_path, e.what());
+      }
+
+      const uint8_t* base = m_file.getData();
+      size_t size = m_file.getSize();
+
+      if (size < c_column_footer_size)
+        throw ColumnError(m_path, "file is truncated");
+
+      const uint8_t* footer = base + size - c_column_footer_size;
+      if (std::memcmp(footer + 16, c_column_magic, sizeof(c_column_magic)) != 0)
+        throw ColumnError(m_path, "invalid signature");
+
+      uint64_t index = decodeColumnValue(footer, 8);
+      uint32_t count = (uint32_t)decodeColumnValue(footer + 8, 4);
+      if (footer[12] > MessageView::FT_FP64)
+        throw ColumnError(m_path, "invalid field type");
+
+      m_type = (MessageView::FieldType)footer[12];
+
+      if (index + (uint64_t)count * c_column_entry_size != size - c_column_footer_size)
+        throw ColumnError(m_path, "invalid block index");
+
+      unsigned field_size = MessageView::getFieldSize(m_type);
+      const uint8_t* ptr = base + index;
+      m_blocks.resize(count);
+
+      for (unsigned i = 0; i < count; ++i, ptr += c_column_entry_size)
+      {
+        ColumnBlock& block = m_blocks[i];
+        block.offset = decodeColumnValue(ptr, 8);
+        block.size = (uint32_t)decodeColumnValue(ptr + 8, 4);
+        block.rows = (uint32_t)decodeColumnValue(ptr + 12, 4);
+        block.min = decodeColumnDouble(ptr + 16);
+        block.max = decodeColumnDouble(ptr + 24);
+
+        if (block.offset + block.size > index)
+          throw ColumnError(m_path, "invalid block index");
+
+        m_rows += block.rows;
+      }
+
+      Compression::Methods method = (Compression::Methods)footer[13];
+      if (method != Compression::METHOD_UNKNOWN)
+      {
+        m_decompressor = Compression::Factory::decompressor(method);
+        if (m_decompressor == NULL)
+          throw ColumnError(m_path, "unsupported compression method");
+      }
+      else
+      {
+        for (unsigned i = 0; i < count; ++i)
+        {
+          if (m_blocks[i].size != m_blocks[i].rows * field_size)
+            throw ColumnError(m_path, "invalid block size");
+        }
+      }
+    }
+
+    ColumnReader::Column::~Column(void)
+    {
+      delete m_decompressor;
+    }
+
+    void
+    ColumnReader::Column::readBlock(unsigned index, std::vector<fp64_t>& values)
+    {
+      const ColumnBlock& block = m_blocks[index];
+      unsigned field_size = MessageView::getFieldSize(m_type);
+      unsigned size = block.rows * field_size;
+      const uint8_t* data = m_file.getData() + block.offset;
+
+      if (m_decompressor != NULL)
+      {
+        m_bfr.resize(size + 1);
+
+        // Consume the whole block, so frame trailers do not leak
+        // into the next one.
+        unsigned done = 0;
+        unsigned used = 0;
+        while (used < block.size && done <= size)
+        {
+          m_decompressor->decompress((char*)&m_bfr[done], m_bfr.size() - done,
+                                     (char*)data + used, block.size - used);
+          if (m_decompressor->decompressed() == 0 && m_decompressor->processed() == 0)
+            break;
+
+          done += m_decompressor->decompressed();
+          used += m_decompressor->processed();
+        }
+
+        if (done != size)
+          throw ColumnError(m_path, "invalid compressed block");
+
+        data = &m_bfr[0];
+      }
+
+      values.reserve(values.size() + block.rows);
+      for (unsigned i = 0; i < block.rows; ++i, data += field_size)
+        values.push_back(decode(data, m_type));
+    }
+
+    ColumnReader::ColumnReader(const FileSystem::Path& dir):
+      m_dir(dir)
+    { }
+
+    ColumnReader::~ColumnReader(void)
+    {
+      std::map<std::string, Column*>::iterator itr = m_columns.begin();
+      for (; itr != m_columns.end(); ++itr)
+        delete itr->second;
+    }
+
+    bool
+    ColumnReader::hasColumn(const std::string& message, unsigned entity, const std::string& field) const
+    {
+      std::string name = getColumnName(message, entity, field);
+      if (m_columns.find(name) != m_columns.end())
+        return true;
+
+      return (m_dir / name).exists();
+    }
+
+    ColumnReader::Column&
+    ColumnReader::getColumn(const std::string& message, unsigned entity, const std::string& field)
+    {
+      std::string name = getColumnName(message, entity, field);
+      std::map<std::string, Column*>::iterator itr = m_columns.find(name);
+      if (itr != m_columns.end())
+        return *itr->second;
+
+      Column* col = new Column(m_dir / name);
+      m_columns[name] = col;
+      return *col;
+    }
+
+    unsigned
+    ColumnReader::query(const std::string& message, unsigned entity, const std::string& field,
+                        fp64_t start, fp64_t end, std::vector<fp64_t>& times, std::vector<fp64_t>& values)
+    {
+      Column& time = getColumn(message, entity, c_column_time);
+      Column& data = getColumn(message, entity, field);
+
+      if (time.getBlockCount() != data.getBlockCount())
+        throw ColumnError(getColumnName(message, entity, field), "blocks do not match time stamps");
+
+      unsigned count = 0;
+
+      for (unsigned i = 0; i < time.getBlockCount(); ++i)
+      {
+        const ColumnBlock& block = time.getBlock(i);
+        if (block.max < start || block.min > end)
+          continue;
+
+        m_times.clear();
+        m_values.clear();
+        time.readBlock(i, m_times);
+        data.readBlock(i, m_values);
+
+        if (m_times.size() != m_values.size())
+          throw ColumnError(getColumnName(message, entity, field), "blocks do not match time stamps");
+
+        for (unsigned j = 0; j < m_times.size(); ++j)
+        {
+          if (m_times[j] < start || m_times[j] > end)
+            continue;
+
+          times.push_back(m_times[j]);
+          values.push_back(m_values[j]);
+          ++count;
+        }
+      }
+
+      return count;
+    }
+  }
+}
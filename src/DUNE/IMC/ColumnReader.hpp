@@ -0,0 +1,190 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COLUMN_READER_HPP_INCLUDED_
+#define DUNE_IMC_COLUMN_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+#include <DUNE/IMC/Columns.hpp>
+#include <DUNE/IMC/MessageView.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    class Decompressor;
+  }
+
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ColumnReader;
+
+    //! Queries column files written by ColumnWriter. Columns are
+    //! memory mapped when first used, so a query only touches the
+    //! files and blocks it needs.
+    class ColumnReader
+    {
+    public:
+      //! Column file.
+      class Column
+      {
+      public:
+        //! Open a column file.
+        //! @param[in] path file path.
+        Column(const FileSystem::Path& path);
+
+        //! Destructor.
+        ~Column(void);
+
+        //! Get field type.
+        //! @return field type.
+        MessageView::FieldType
+        getType(void) const
+        {
+          return m_type;
+        }
+
+        //! Get number of rows.
+        //! @return number of rows.
+        uint64_t
+        getRows(void) const
+        {
+          return m_rows;
+        }
+
+        //! Get number of blocks.
+        //! @return number of blocks.
+        unsigned
+        getBlockCount(void) const
+        {
+          return m_blocks.size();
+        }
+
+        //! Get a block index entry.
+        //! @param[in] index block index.
+        //! @return block.
+        const ColumnBlock&
+        getBlock(unsigned index) const
+        {
+          return m_blocks[index];
+        }
+
+        //! Decode the values of a block.
+        //! @param[in] index block index.
+        //! @param[out] values vector where values are appended.
+        void
+        readBlock(unsigned index, std::vector<fp64_t>& values);
+
+      private:
+        //! File path.
+        std::string m_path;
+        //! File contents.
+        FileSystem::MappedFile m_file;
+        //! Field type.
+        MessageView::FieldType m_type;
+        //! Block index.
+        std::vector<ColumnBlock> m_blocks;
+        //! Number of rows.
+        uint64_t m_rows;
+        //! Decompressor or NULL if blocks are not compressed.
+        Compression::Decompressor* m_decompressor;
+        //! Decompression buffer.
+        std::vector<uint8_t> m_bfr;
+
+        // Non-copyable.
+        Column(const Column&);
+
+        Column&
+        operator=(const Column&);
+      };
+
+      //! Constructor.
+      //! @param[in] dir folder with column files.
+      ColumnReader(const FileSystem::Path& dir);
+
+      //! Destructor.
+      ~ColumnReader(void);
+
+      //! Check if a column exists.
+      //! @param[in] message message abbreviation.
+      //! @param[in] entity source entity.
+      //! @param[in] field field abbreviation or c_column_time.
+      //! @return true if the column exists, false otherwise.
+      bool
+      hasColumn(const std::string& message, unsigned entity, const std::string& field) const;
+
+      //! Get a column, opening it if needed.
+      //! @param[in] message message abbreviation.
+      //! @param[in] entity source entity.
+      //! @param[in] field field abbreviation or c_column_time.
+      //! @return column.
+      Column&
+      getColumn(const std::string& message, unsigned entity, const std::string& field);
+
+      //! Read the values of a field in a time interval. Blocks
+      //! outside the interval are skipped without being decoded.
+      //! @param[in] message message abbreviation.
+      //! @param[in] entity source entity.
+      //! @param[in] field field abbreviation.
+      //! @param[in] start start time.
+      //! @param[in] end end time.
+      //! @param[out] times vector where time stamps are appended.
+      //! @param[out] values vector where values are appended.
+      //! @return number of values read.
+      unsigned
+      query(const std::string& message, unsigned entity, const std::string& field,
+            fp64_t start, fp64_t end, std::vector<fp64_t>& times, std::vector<fp64_t>& values);
+
+    private:
+      //! Folder with column files.
+      FileSystem::Path m_dir;
+      //! Open columns by file name.
+      std::map<std::string, Column*> m_columns;
+      //! Time stamps of the current query.
+      std::vector<fp64_t> m_times;
+      //! Values of the current query.
+      std::vector<fp64_t> m_values;
+
+      // Non-copyable.
+      ColumnReader(const ColumnReader&);
+
+      ColumnReader&
+      operator=(const ColumnReader&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,243 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+
+// DUNE headers.
+#include <DUNE/Compression/Compressor.hpp>
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/IMC/ColumnWriter.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    ColumnWriter::ColumnWriter(const FileSystem::Path& dir, Compression::Methods method, unsigned block_rows):
+      m_dir(dir),
+      m_method(method),
+      m_compressor(NULL),
+      m_block_rows(block_rows == 0 ? 1 : block_rows),
+      m_columns(0)
+    {
+      m_dir.create();
+
+      if (m_method != Compression::METHOD_UNKNOWN)
+        m_compressor = Compression::Factory::compressor(m_method);
+    }
+
+    ColumnWriter::~ColumnWriter(void)
+    {
+      try
+      {
+        close();
+      }
+      catch (...)
+      { }
+
+      delete m_compressor;
+    }
+
+    void
+    ColumnWriter::write(const MessageView& view)
+    {
+      if (view.isNull())
+        return;
+
+      uint32_t key = ((uint32_t)view.getId() << 8) | view.getSourceEntity();
+      std::map<uint32_t, Group*>::iterator itr = m_groups.find(key);
+      Group* group = (itr == m_groups.end()) ? createGroup(view) : itr->second;
+
+      uint8_t value[8];
+      std::vector<Column*>::iterator col = group->columns.begin();
+
+      encodeColumnValue(view.getTimeStamp(), value);
+      append(*col, value, view.getTimeStamp());
+
+      for (++col; col != group->columns.end(); ++col)
+      {
+        view.readField(*(*col)->field, value);
+        append(*col, value, view.readFieldFP(*(*col)->field));
+      }
+
+      if (++group->rows == m_block_rows)
+        flush(group);
+    }
+
+    void
+    ColumnWriter::close(void)
+    {
+      std::map<uint32_t, Group*>::iterator itr = m_groups.begin();
+      for (; itr != m_groups.end(); ++itr)
+      {
+        Group* group = itr->second;
+        flush(group);
+
+        for (unsigned i = 0; i < group->columns.size(); ++i)
+        {
+          finish(group->columns[i]);
+          delete group->columns[i];
+        }
+
+        delete group;
+      }
+
+      m_groups.clear();
+    }
+
+    ColumnWriter::Group*
+    ColumnWriter::createGroup(const MessageView& view)
+    {
+      Group* group = new Group;
+      group->rows = 0;
+      std::string name = view.getName();
+
+      Column* col = new Column;
+      col->path = m_dir / getColumnName(name, view.getSourceEntity(), c_column_time);
+      col->field = NULL;
+      col->type = MessageView::FT_FP64;
+      group->columns.push_back(col);
+
+      const MessageView::Field* field = MessageView::getFields(view.getId());
+      for (; field != NULL && field->name != NULL; ++field)
+      {
+        col = new Column;
+        col->path = m_dir / getColumnName(name, view.getSourceEntity(), field->name);
+        col->field = field;
+        col->type = field->type;
+        group->columns.push_back(col);
+      }
+
+      for (unsigned i = 0; i < group->columns.size(); ++i)
+      {
+        col = group->columns[i];
+        col->min = 0;
+        col->max = 0;
+        col->size = 0;
+        col->data.reserve(m_block_rows * MessageView::getFieldSize(col->type));
+
+        // Truncate files left by previous conversions.
+        std::ofstream ofs(col->path.c_str(), std::ios::binary | std::ios::trunc);
+        if (!ofs.is_open())
+          throw ColumnError(col->path.str(), "failed to create");
+      }
+
+      m_groups[((uint32_t)view.getId() << 8) | view.getSourceEntity()] = group;
+      m_columns += group->columns.size();
+      return group;
+    }
+
+    void
+    ColumnWriter::append(Column* col, const uint8_t* value, fp64_t number)
+    {
+      if (col->data.empty())
+      {
+        col->min = number;
+        col->max = number;
+      }
+      else if (number < col->min)
+      {
+        col->min = number;
+      }
+      else if (number > col->max)
+      {
+        col->max = number;
+      }
+
+      col->data.insert(col->data.end(), value, value + MessageView::getFieldSize(col->type));
+    }
+
+    void
+    ColumnWriter::flush(Group* group)
+    {
+      if (group->rows == 0)
+        return;
+
+      Utils::ByteBuffer bfr;
+
+      for (unsigned i = 0; i < group->columns.size(); ++i)
+      {
+        Column* col = group->columns[i];
+        const char* data = (const char*)&col->data[0];
+        uint32_t size = col->data.size();
+
+        if (m_compressor != NULL)
+        {
+          m_compressor->compress(bfr, (char*)data, size);
+          data = bfr.getBufferSigned();
+          size = bfr.getSize();
+        }
+
+        std::ofstream ofs(col->path.c_str(), std::ios::binary | std::ios::app);
+        ofs.write(data, size);
+        if (!ofs.good())
+          throw ColumnError(col->path.str(), "failed to write");
+
+        ColumnBlock block;
+        block.offset = col->size;
+        block.size = size;
+        block.rows = group->rows;
+        block.min = col->min;
+        block.max = col->max;
+        col->blocks.push_back(block);
+        col->size += size;
+        col->data.clear();
+      }
+
+      group->rows = 0;
+    }
+
+    void
+    ColumnWriter::finish(Column* col)
+    {
+      std::vector<uint8_t> bfr(col->blocks.size() * c_column_entry_size + c_column_footer_size);
+      uint8_t* ptr = &bfr[0];
+
+      for (unsigned i = 0; i < col->blocks.size(); ++i, ptr += c_column_entry_size)
+      {
+        const ColumnBlock& block = col->blocks[i];
+        encodeColumnValue(block.offset, 8, ptr);
+        encodeColumnValue(block.size, 4, ptr + 8);
+        encodeColumnValue(block.rows, 4, ptr + 12);
+        encodeColumnValue(block.min, ptr + 16);
+        encodeColumnValue(block.max, ptr + 24);
+      }
+
+      encodeColumnValue(col->size, 8, ptr);
+      encodeColumnValue(col->blocks.size(), 4, ptr + 8);
+      ptr[12] = (uint8_t)col->type;
+      ptr[13] = (uint8_t)m_method;
+      encodeColumnValue(0, 2, ptr + 14);
+      std::memcpy(ptr + 16, c_column_magic, sizeof(c_column_magic));
+
+      std::ofstream ofs(col->path.c_str(), std::ios::binary | std::ios::app);
+      ofs.write((const char*)&bfr[0], bfr.size());
+      if (!ofs.good())
+        throw ColumnError(col->path.str(), "failed to write");
+    }
+  }
+}
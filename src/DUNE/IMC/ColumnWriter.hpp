@@ -0,0 +1,167 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COLUMN_WRITER_HPP_INCLUDED_
+#define DUNE_IMC_COLUMN_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Compression/Methods.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+#include <DUNE/IMC/Columns.hpp>
+#include <DUNE/IMC/MessageView.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    class Compressor;
+  }
+
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ColumnWriter;
+
+    //! Transposes serialized messages into column files (see
+    //! Columns.hpp). Only fixed size fields at a constant offset are
+    //! stored. Blocks are kept in memory until full, so files are
+    //! only opened when a block is written.
+    class ColumnWriter
+    {
+    public:
+      //! Constructor.
+      //! @param[in] dir output folder, created if needed.
+      //! @param[in] method block compression method, METHOD_UNKNOWN to
+      //! store blocks uncompressed.
+      //! @param[in] block_rows number of rows of each block.
+      ColumnWriter(const FileSystem::Path& dir,
+                   Compression::Methods method = Compression::METHOD_LZ4,
+                   unsigned block_rows = 4096);
+
+      //! Destructor. Closes all columns.
+      ~ColumnWriter(void);
+
+      //! Append the fields of a message.
+      //! @param[in] view message view.
+      void
+      write(const MessageView& view);
+
+      //! Write remaining blocks and block indexes.
+      void
+      close(void);
+
+      //! Get the number of columns written.
+      //! @return number of columns.
+      unsigned
+      getColumnCount(void) const
+      {
+        return m_columns;
+      }
+
+    private:
+      //! Column being written.
+      struct Column
+      {
+        //! File path.
+        FileSystem::Path path;
+        //! Field or NULL for time stamps.
+        const MessageView::Field* field;
+        //! Field type.
+        MessageView::FieldType type;
+        //! Values of the current block.
+        std::vector<uint8_t> data;
+        //! Minimum value of the current block.
+        fp64_t min;
+        //! Maximum value of the current block.
+        fp64_t max;
+        //! Blocks written so far.
+        std::vector<ColumnBlock> blocks;
+        //! Size of the file.
+        uint64_t size;
+      };
+
+      //! Columns of a message and source entity.
+      struct Group
+      {
+        //! Columns, time stamps first.
+        std::vector<Column*> columns;
+        //! Rows of the current block.
+        unsigned rows;
+      };
+
+      //! Output folder.
+      FileSystem::Path m_dir;
+      //! Compression method.
+      Compression::Methods m_method;
+      //! Compressor or NULL.
+      Compression::Compressor* m_compressor;
+      //! Number of rows of each block.
+      unsigned m_block_rows;
+      //! Groups by message identifier and source entity.
+      std::map<uint32_t, Group*> m_groups;
+      //! Number of columns.
+      unsigned m_columns;
+
+      //! Create the columns of a message and source entity.
+      //! @param[in] view message view.
+      //! @return group.
+      Group*
+      createGroup(const MessageView& view);
+
+      //! Append a value to a column.
+      //! @param[in] col column.
+      //! @param[in] value little endian value.
+      //! @param[in] number value as double.
+      void
+      append(Column* col, const uint8_t* value, fp64_t number);
+
+      //! Write the current block of all columns of a group.
+      //! @param[in] group group.
+      void
+      flush(Group* group);
+
+      //! Write the block index and footer of a column.
+      //! @param[in] col column.
+      void
+      finish(Column* col);
+
+      // Non-copyable.
+      ColumnWriter(const ColumnWriter&);
+
+      ColumnWriter&
+      operator=(const ColumnWriter&);
+    };
+  }
+}
+
+#endif
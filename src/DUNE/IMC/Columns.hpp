@@ -0,0 +1,166 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COLUMNS_HPP_INCLUDED_
+#define DUNE_IMC_COLUMNS_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/String.hpp>
+
+//! @file
+//! Format of column files, written by ColumnWriter and read by
+//! ColumnReader.
+//!
+//! Each (message, source entity, field) is stored in its own file,
+//! named after getColumnName(), along with a time stamp column per
+//! message and source entity. Columns of the same message and entity
+//! are split in blocks with the same rows. A column file holds the
+//! blocks, each compressed on its own, followed by the block index
+//! and a footer. All values are little endian.
+//!
+//! Block index entry (c_column_entry_size bytes):
+//! - offset of the block (uint64_t).
+//! - compressed size (uint32_t).
+//! - number of rows (uint32_t).
+//! - minimum value (fp64_t).
+//! - maximum value (fp64_t).
+//!
+//! Footer (c_column_footer_size bytes):
+//! - offset of the block index (uint64_t).
+//! - number of blocks (uint32_t).
+//! - field type, as in MessageView::FieldType (uint8_t).
+//! - compression method, as in Compression::Methods (uint8_t).
+//! - reserved (uint16_t).
+//! - magic number (c_column_magic).
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Magic number at the end of column files.
+    static const char c_column_magic[4] = {'D', 'C', 'O', 'L'};
+    //! Size of a block index entry.
+    static const unsigned c_column_entry_size = 32;
+    //! Size of the footer.
+    static const unsigned c_column_footer_size = 20;
+    //! Name of time stamp columns.
+    static const char* const c_column_time = "_timestamp";
+    //! Column file extension.
+    static const char* const c_column_extension = ".col";
+
+    //! Column file error.
+    class ColumnError: public std::runtime_error
+    {
+    public:
+      ColumnError(const std::string& path, const std::string& msg):
+        std::runtime_error("column file " + path + ": " + msg)
+      { }
+    };
+
+    //! Block of a column file.
+    struct ColumnBlock
+    {
+      //! Offset in the file.
+      uint64_t offset;
+      //! Compressed size.
+      uint32_t size;
+      //! Number of rows.
+      uint32_t rows;
+      //! Minimum value.
+      fp64_t min;
+      //! Maximum value.
+      fp64_t max;
+    };
+
+    //! Get the file name of a column.
+    //! @param[in] message message abbreviation.
+    //! @param[in] entity source entity.
+    //! @param[in] field field abbreviation or c_column_time.
+    //! @return file name.
+    inline std::string
+    getColumnName(const std::string& message, unsigned entity, const std::string& field)
+    {
+      return Utils::String::str("%s.%u.%s%s", message.c_str(), entity,
+                                field.c_str(), c_column_extension);
+    }
+
+    //! Encode an unsigned integer in little endian byte order.
+    //! @param[in] value value.
+    //! @param[in] size number of bytes.
+    //! @param[out] dst destination.
+    inline void
+    encodeColumnValue(uint64_t value, unsigned size, uint8_t* dst)
+    {
+      for (unsigned i = 0; i < size; ++i)
+        dst[i] = (uint8_t)(value >> (8 * i));
+    }
+
+    //! Decode an unsigned integer in little endian byte order.
+    //! @param[in] src source.
+    //! @param[in] size number of bytes.
+    //! @return value.
+    inline uint64_t
+    decodeColumnValue(const uint8_t* src, unsigned size)
+    {
+      uint64_t value = 0;
+      for (unsigned i = 0; i < size; ++i)
+        value |= (uint64_t)src[i] << (8 * i);
+      return value;
+    }
+
+    //! Encode a double in little endian byte order.
+    //! @param[in] value value.
+    //! @param[out] dst destination (8 bytes).
+    inline void
+    encodeColumnValue(fp64_t value, uint8_t* dst)
+    {
+      uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      encodeColumnValue(bits, sizeof(bits), dst);
+    }
+
+    //! Decode a double in little endian byte order.
+    //! @param[in] src source (8 bytes).
+    //! @return value.
+    inline fp64_t
+    decodeColumnDouble(const uint8_t* src)
+    {
+      uint64_t bits = decodeColumnValue(src, sizeof(bits));
+      fp64_t value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,262 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Compression/DictionaryCompressor.hpp>
+#include <DUNE/Compression/DictionaryDecompressor.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/IMC/Constants.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/CompactStream.hpp>
+#include <DUNE/IMC/CompactCodec.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    CompactCodec::CompactCodec(void):
+      m_time_res(0.001),
+      m_compressor(NULL),
+      m_decompressor(NULL)
+    {
+      m_ref.sync = DUNE_IMC_CONST_SYNC;
+      m_ref.mgid = 0;
+      m_ref.size = 0;
+      m_ref.timestamp = 0;
+      m_ref.src = DUNE_IMC_CONST_NULL_ID;
+      m_ref.src_ent = DUNE_IMC_CONST_UNK_EID;
+      m_ref.dst = DUNE_IMC_CONST_NULL_ID;
+      m_ref.dst_ent = DUNE_IMC_CONST_UNK_EID;
+
+      std::vector<CompactProfile*> profiles;
+      CompactProfile::createDefaults(profiles);
+      for (unsigned i = 0; i < profiles.size(); ++i)
+        addProfile(profiles[i]);
+    }
+
+    CompactCodec::~CompactCodec(void)
+    {
+      clearProfiles();
+      delete m_compressor;
+      delete m_decompressor;
+    }
+
+    void
+    CompactCodec::addProfile(CompactProfile* profile)
+    {
+      std::map<uint16_t, CompactProfile*>::iterator itr = m_profiles.find(profile->getId());
+      if (itr != m_profiles.end())
+      {
+        delete itr->second;
+        itr->second = profile;
+        return;
+      }
+
+      m_profiles[profile->getId()] = profile;
+    }
+
+    void
+    CompactCodec::clearProfiles(void)
+    {
+      std::map<uint16_t, CompactProfile*>::iterator itr = m_profiles.begin();
+      for (; itr != m_profiles.end(); ++itr)
+        delete itr->second;
+
+      m_profiles.clear();
+    }
+
+    void
+    CompactCodec::setDictionary(const std::vector<char>& dictionary)
+    {
+      delete m_compressor;
+      delete m_decompressor;
+      m_compressor = NULL;
+      m_decompressor = NULL;
+
+      if (dictionary.empty())
+        return;
+
+      m_compressor = new Compression::DictionaryCompressor(dictionary, 9);
+      m_decompressor = new Compression::DictionaryDecompressor(dictionary);
+    }
+
+    unsigned
+    CompactCodec::encode(const Message* msg, Utils::ByteBuffer& bfr)
+    {
+      uint8_t flags = 0;
+
+      // Encode fields.
+      m_fields.setSize(0);
+      CompactWriter fields(m_fields);
+
+      std::map<uint16_t, CompactProfile*>::const_iterator itr = m_profiles.find(msg->getId());
+      if (itr != m_profiles.end() && itr->second->encode(msg, fields))
+      {
+        flags |= FL_PROFILE;
+      }
+      else
+      {
+        m_fields.setSize(msg->getPayloadSerializationSize());
+        msg->serializeFields(m_fields.getBuffer());
+      }
+
+      // Deflate fields.
+      if (m_compressor != NULL && m_fields.getSize() > 0)
+      {
+        m_compressor->compress(m_deflated, m_fields);
+
+        if (m_deflated.getSize() + 2 < m_fields.getSize())
+          flags |= FL_DEFLATED;
+      }
+
+      // Encode header.
+      if (msg->getSource() != m_ref.src)
+        flags |= FL_SRC;
+      if (msg->getSourceEntity() != m_ref.src_ent)
+        flags |= FL_SRC_ENT;
+      if (msg->getDestination() != m_ref.dst)
+        flags |= FL_DST;
+      if (msg->getDestinationEntity() != m_ref.dst_ent)
+        flags |= FL_DST_ENT;
+
+      bfr.setSize(0);
+      CompactWriter writer(bfr);
+      writer.writeByte(flags);
+      writer.writeUnsigned(msg->getId());
+
+      if (flags & FL_SRC)
+        writer.writeUnsigned(msg->getSource());
+      if (flags & FL_SRC_ENT)
+        writer.writeByte(msg->getSourceEntity());
+      if (flags & FL_DST)
+        writer.writeUnsigned(msg->getDestination());
+      if (flags & FL_DST_ENT)
+        writer.writeByte(msg->getDestinationEntity());
+
+      writer.writeQuantized(msg->getTimeStamp() - m_ref.timestamp, m_time_res);
+
+      if (flags & FL_DEFLATED)
+      {
+        writer.writeUnsigned(m_fields.getSize());
+        writer.writeBytes(m_deflated.getBuffer(), m_deflated.getSize());
+      }
+      else
+      {
+        writer.writeBytes(m_fields.getBuffer(), m_fields.getSize());
+      }
+
+      return bfr.getSize();
+    }
+
+    Message*
+    CompactCodec::decode(const uint8_t* bfr, unsigned size)
+    {
+      CompactReader reader(bfr, size);
+
+      uint8_t flags = reader.readByte();
+      uint64_t id = reader.readUnsigned();
+
+      uint16_t src = m_ref.src;
+      uint8_t src_ent = m_ref.src_ent;
+      uint16_t dst = m_ref.dst;
+      uint8_t dst_ent = m_ref.dst_ent;
+
+      if (flags & FL_SRC)
+        src = (uint16_t)reader.readUnsigned();
+      if (flags & FL_SRC_ENT)
+        src_ent = reader.readByte();
+      if (flags & FL_DST)
+        dst = (uint16_t)reader.readUnsigned();
+      if (flags & FL_DST_ENT)
+        dst_ent = reader.readByte();
+
+      double timestamp = m_ref.timestamp + reader.readQuantized(m_time_res);
+
+      // Retrieve fields.
+      const uint8_t* fields = reader.getPointer();
+      unsigned fields_size = reader.getRemaining();
+
+      if (flags & FL_DEFLATED)
+      {
+        if (m_decompressor == NULL)
+          throw UnsupportedFormat();
+
+        uint64_t inflated_size = reader.readUnsigned();
+        if (inflated_size > DUNE_IMC_CONST_MAX_SIZE)
+          throw InvalidFormat();
+
+        m_fields.setSize((uint32_t)inflated_size);
+        m_decompressor->decompress(m_fields.getBufferSigned(), m_fields.getSize(),
+                                   (char*)reader.getPointer(), reader.getRemaining());
+
+        if (m_decompressor->decompressed() != inflated_size)
+          throw InvalidFormat();
+
+        fields = m_fields.getBuffer();
+        fields_size = (unsigned)inflated_size;
+      }
+
+      Message* msg = Factory::produce((uint32_t)id);
+      if (msg == NULL)
+        throw InvalidMessageId((uint32_t)id);
+
+      try
+      {
+        if (flags & FL_PROFILE)
+        {
+          std::map<uint16_t, CompactProfile*>::const_iterator itr = m_profiles.find(msg->getId());
+          if (itr == m_profiles.end())
+            throw UnsupportedFormat();
+
+          CompactReader freader(fields, fields_size);
+          itr->second->decode(msg, freader);
+        }
+        else
+        {
+          msg->deserializeFields(fields, fields_size);
+        }
+      }
+      catch (...)
+      {
+        delete msg;
+        throw;
+      }
+
+      msg->setTimeStamp(timestamp);
+      msg->setSource(src);
+      msg->setSourceEntity(src_ent);
+      msg->setDestination(dst);
+      msg->setDestinationEntity(dst_ent);
+
+      return msg;
+    }
+  }
+}
@@ -0,0 +1,170 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COMPACT_CODEC_HPP_INCLUDED_
+#define DUNE_IMC_COMPACT_CODEC_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+#include <DUNE/IMC/Header.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/CompactProfile.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Forward declarations.
+    class DictionaryCompressor;
+    class DictionaryDecompressor;
+  }
+
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM CompactCodec;
+
+    //! Bandwidth optimized encoding of IMC messages, meant for
+    //! links where every byte counts (satellite, acoustic).
+    //!
+    //! Header fields are encoded as differences to a reference
+    //! header that must be shared by both ends of the link: only
+    //! addresses that differ from the reference are transmitted and
+    //! the time stamp is sent as a variable length integer counting
+    //! time steps since the reference time stamp. Since each encoded
+    //! message only depends on the reference, lost messages do not
+    //! affect the decoding of other messages.
+    //!
+    //! Message fields are encoded using the profile registered for
+    //! the message type, if any, or the standard IMC serialization
+    //! otherwise. When a dictionary is configured, the encoded
+    //! fields are also deflated if that makes them smaller.
+    //!
+    //! Encoded messages carry no synchronization or checksum and
+    //! are meant to be carried by framed and protected links.
+    class CompactCodec
+    {
+    public:
+      //! Constructor. The default profiles are registered.
+      CompactCodec(void);
+
+      //! Destructor.
+      ~CompactCodec(void);
+
+      //! Set the reference header.
+      //! @param[in] ref reference header.
+      void
+      setReference(const Header& ref)
+      {
+        m_ref = ref;
+      }
+
+      //! Set the time stamp resolution.
+      //! @param[in] resolution time stamp resolution (s).
+      void
+      setTimeResolution(double resolution)
+      {
+        m_time_res = resolution;
+      }
+
+      //! Register a profile, replacing any profile previously
+      //! registered for the same message type.
+      //! @param[in] profile profile, ownership is transferred.
+      void
+      addProfile(CompactProfile* profile);
+
+      //! Remove all registered profiles.
+      void
+      clearProfiles(void);
+
+      //! Set the shared dictionary used to deflate message fields.
+      //! @param[in] dictionary dictionary or empty to disable.
+      void
+      setDictionary(const std::vector<char>& dictionary);
+
+      //! Encode a message.
+      //! @param[in] msg message.
+      //! @param[out] bfr destination buffer.
+      //! @return number of bytes of the encoded message.
+      unsigned
+      encode(const Message* msg, Utils::ByteBuffer& bfr);
+
+      //! Decode a message.
+      //! @param[in] bfr buffer.
+      //! @param[in] size buffer size.
+      //! @return decoded message, owned by the caller.
+      Message*
+      decode(const uint8_t* bfr, unsigned size);
+
+    private:
+      //! Flags of the first byte of an encoded message.
+      enum Flags
+      {
+        //! Source address is present.
+        FL_SRC = 0x01,
+        //! Source entity is present.
+        FL_SRC_ENT = 0x02,
+        //! Destination address is present.
+        FL_DST = 0x04,
+        //! Destination entity is present.
+        FL_DST_ENT = 0x08,
+        //! Fields are encoded with a profile.
+        FL_PROFILE = 0x10,
+        //! Fields are deflated.
+        FL_DEFLATED = 0x20
+      };
+
+      //! Reference header.
+      Header m_ref;
+      //! Time stamp resolution.
+      double m_time_res;
+      //! Profiles indexed by message identification number.
+      std::map<uint16_t, CompactProfile*> m_profiles;
+      //! Dictionary compressor.
+      Compression::DictionaryCompressor* m_compressor;
+      //! Dictionary decompressor.
+      Compression::DictionaryDecompressor* m_decompressor;
+      //! Buffer for message fields.
+      Utils::ByteBuffer m_fields;
+      //! Buffer for deflated message fields.
+      Utils::ByteBuffer m_deflated;
+
+      // Non-copyable.
+      CompactCodec(const CompactCodec&);
+
+      CompactCodec&
+      operator=(const CompactCodec&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,167 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Math/General.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/IMC/CompactProfile.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Check if a quantized value can be represented.
+    //! @param[in] value value.
+    //! @param[in] resolution quantization step.
+    //! @return true if value can be quantized, false otherwise.
+    static bool
+    isQuantizable(double value, double resolution)
+    {
+      if (Math::isNaN(value))
+        return false;
+
+      return std::fabs(value / resolution) < 4.0e18;
+    }
+
+    void
+    CompactProfile::createDefaults(std::vector<CompactProfile*>& profiles)
+    {
+      profiles.push_back(new EstimatedStateProfile);
+      profiles.push_back(new ScalarProfile(Voltage::getIdStatic(), 0.001));
+      profiles.push_back(new ScalarProfile(Current::getIdStatic(), 0.001));
+      profiles.push_back(new ScalarProfile(Temperature::getIdStatic(), 0.001));
+      profiles.push_back(new ScalarProfile(Pressure::getIdStatic(), 0.01));
+      profiles.push_back(new ScalarProfile(Depth::getIdStatic(), 0.001));
+      profiles.push_back(new ScalarProfile(Rpm::getIdStatic(), 1.0));
+      profiles.push_back(new ScalarProfile(Salinity::getIdStatic(), 0.001));
+      profiles.push_back(new ScalarProfile(Conductivity::getIdStatic(), 0.0001));
+      profiles.push_back(new ScalarProfile(SoundSpeed::getIdStatic(), 0.01));
+      profiles.push_back(new ScalarProfile(CpuUsage::getIdStatic(), 1.0));
+    }
+
+    bool
+    ScalarProfile::encode(const Message* msg, CompactWriter& writer) const
+    {
+      double value = msg->getValueFP();
+
+      if (!isQuantizable(value, m_resolution))
+        return false;
+
+      writer.writeQuantized(value, m_resolution);
+      return true;
+    }
+
+    void
+    ScalarProfile::decode(Message* msg, CompactReader& reader) const
+    {
+      msg->setValueFP(reader.readQuantized(m_resolution));
+    }
+
+    uint16_t
+    EstimatedStateProfile::getId(void) const
+    {
+      return EstimatedState::getIdStatic();
+    }
+
+    bool
+    EstimatedStateProfile::encode(const Message* msg, CompactWriter& writer) const
+    {
+      const EstimatedState* es = static_cast<const EstimatedState*>(msg);
+
+      const double angles[] = {es->lat, es->lon};
+      const double positions[] = {es->height, es->x, es->y, es->z, es->depth, es->alt};
+      const double attitudes[] = {es->phi, es->theta, es->psi};
+      const double speeds[] = {es->u, es->v, es->w, es->vx, es->vy, es->vz};
+      const double rates[] = {es->p, es->q, es->r};
+
+      for (unsigned i = 0; i < 2; ++i)
+      {
+        if (!isQuantizable(angles[i], m_angle))
+          return false;
+      }
+
+      for (unsigned i = 0; i < 6; ++i)
+      {
+        if (!isQuantizable(positions[i], m_position) || !isQuantizable(speeds[i], m_speed))
+          return false;
+      }
+
+      for (unsigned i = 0; i < 3; ++i)
+      {
+        if (!isQuantizable(attitudes[i], m_attitude) || !isQuantizable(rates[i], m_rate))
+          return false;
+      }
+
+      for (unsigned i = 0; i < 2; ++i)
+        writer.writeQuantized(angles[i], m_angle);
+
+      for (unsigned i = 0; i < 6; ++i)
+        writer.writeQuantized(positions[i], m_position);
+
+      for (unsigned i = 0; i < 3; ++i)
+        writer.writeQuantized(attitudes[i], m_attitude);
+
+      for (unsigned i = 0; i < 6; ++i)
+        writer.writeQuantized(speeds[i], m_speed);
+
+      for (unsigned i = 0; i < 3; ++i)
+        writer.writeQuantized(rates[i], m_rate);
+
+      return true;
+    }
+
+    void
+    EstimatedStateProfile::decode(Message* msg, CompactReader& reader) const
+    {
+      EstimatedState* es = static_cast<EstimatedState*>(msg);
+
+      es->lat = reader.readQuantized(m_angle);
+      es->lon = reader.readQuantized(m_angle);
+      es->height = reader.readQuantized(m_position);
+      es->x = reader.readQuantized(m_position);
+      es->y = reader.readQuantized(m_position);
+      es->z = reader.readQuantized(m_position);
+      es->depth = reader.readQuantized(m_position);
+      es->alt = reader.readQuantized(m_position);
+      es->phi = reader.readQuantized(m_attitude);
+      es->theta = reader.readQuantized(m_attitude);
+      es->psi = reader.readQuantized(m_attitude);
+      es->u = reader.readQuantized(m_speed);
+      es->v = reader.readQuantized(m_speed);
+      es->w = reader.readQuantized(m_speed);
+      es->vx = reader.readQuantized(m_speed);
+      es->vy = reader.readQuantized(m_speed);
+      es->vz = reader.readQuantized(m_speed);
+      es->p = reader.readQuantized(m_rate);
+      es->q = reader.readQuantized(m_rate);
+      es->r = reader.readQuantized(m_rate);
+    }
+  }
+}
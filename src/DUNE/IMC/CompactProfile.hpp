@@ -0,0 +1,154 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COMPACT_PROFILE_HPP_INCLUDED_
+#define DUNE_IMC_COMPACT_PROFILE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/CompactStream.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM CompactProfile;
+
+    //! Compact encoding of the fields of one message type. Profiles
+    //! may quantize fields, in which case decoding is lossy within
+    //! the resolution defined by the profile.
+    class CompactProfile
+    {
+    public:
+      virtual
+      ~CompactProfile(void)
+      { }
+
+      //! Get the identification number of the message handled by
+      //! this profile.
+      //! @return message identification number.
+      virtual uint16_t
+      getId(void) const = 0;
+
+      //! Encode message fields.
+      //! @param[in] msg message.
+      //! @param[out] writer destination.
+      //! @return true if the message was encoded, false if the
+      //! message cannot be represented by this profile.
+      virtual bool
+      encode(const Message* msg, CompactWriter& writer) const = 0;
+
+      //! Decode message fields.
+      //! @param[out] msg message.
+      //! @param[in] reader source.
+      virtual void
+      decode(Message* msg, CompactReader& reader) const = 0;
+
+      //! Create the default set of profiles.
+      //! @param[out] profiles list of profiles, owned by the caller.
+      static void
+      createDefaults(std::vector<CompactProfile*>& profiles);
+    };
+
+    //! Profile for messages whose only field is a scalar named
+    //! 'value'.
+    class ScalarProfile: public CompactProfile
+    {
+    public:
+      //! Constructor.
+      //! @param[in] id message identification number.
+      //! @param[in] resolution quantization step.
+      ScalarProfile(uint16_t id, double resolution):
+        m_id(id),
+        m_resolution(resolution)
+      { }
+
+      uint16_t
+      getId(void) const
+      {
+        return m_id;
+      }
+
+      bool
+      encode(const Message* msg, CompactWriter& writer) const;
+
+      void
+      decode(Message* msg, CompactReader& reader) const;
+
+    private:
+      //! Message identification number.
+      uint16_t m_id;
+      //! Quantization step.
+      double m_resolution;
+    };
+
+    //! Profile for EstimatedState messages.
+    class EstimatedStateProfile: public CompactProfile
+    {
+    public:
+      //! Constructor.
+      //! @param[in] angle resolution of geodetic coordinates (rad).
+      //! @param[in] position resolution of positions and
+      //! heights (m).
+      //! @param[in] attitude resolution of Euler angles (rad).
+      //! @param[in] speed resolution of linear velocities (m/s).
+      //! @param[in] rate resolution of angular velocities (rad/s).
+      EstimatedStateProfile(double angle = 1e-9, double position = 0.01,
+                            double attitude = 1e-4, double speed = 0.01,
+                            double rate = 1e-4):
+        m_angle(angle),
+        m_position(position),
+        m_attitude(attitude),
+        m_speed(speed),
+        m_rate(rate)
+      { }
+
+      uint16_t
+      getId(void) const;
+
+      bool
+      encode(const Message* msg, CompactWriter& writer) const;
+
+      void
+      decode(Message* msg, CompactReader& reader) const;
+
+    private:
+      double m_angle;
+      double m_position;
+      double m_attitude;
+      double m_speed;
+      double m_rate;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,214 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_COMPACT_STREAM_HPP_INCLUDED_
+#define DUNE_IMC_COMPACT_STREAM_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Writer of variable length integers and quantized values used
+    //! by the compact encoding. Unsigned integers are written seven
+    //! bits at a time, least significant group first, with the most
+    //! significant bit of each byte flagging continuation. Signed
+    //! integers are zigzag encoded before being written.
+    class CompactWriter
+    {
+    public:
+      //! Constructor.
+      //! @param[in] bfr buffer where data is appended.
+      CompactWriter(Utils::ByteBuffer& bfr):
+        m_bfr(bfr)
+      { }
+
+      //! Write an unsigned integer.
+      //! @param[in] value value.
+      void
+      writeUnsigned(uint64_t value)
+      {
+        uint8_t tmp[10];
+        unsigned n = 0;
+
+        while (value >= 0x80)
+        {
+          tmp[n++] = (uint8_t)(value | 0x80);
+          value >>= 7;
+        }
+
+        tmp[n++] = (uint8_t)value;
+        m_bfr.append(tmp, n);
+      }
+
+      //! Write a signed integer.
+      //! @param[in] value value.
+      void
+      writeSigned(int64_t value)
+      {
+        writeUnsigned(((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+      }
+
+      //! Write a floating point value quantized to a given
+      //! resolution.
+      //! @param[in] value value.
+      //! @param[in] resolution quantization step.
+      void
+      writeQuantized(double value, double resolution)
+      {
+        writeSigned((int64_t)std::floor(value / resolution + 0.5));
+      }
+
+      //! Write one byte.
+      //! @param[in] value value.
+      void
+      writeByte(uint8_t value)
+      {
+        m_bfr.append(&value, 1);
+      }
+
+      //! Write raw bytes.
+      //! @param[in] data data.
+      //! @param[in] size number of bytes.
+      void
+      writeBytes(const uint8_t* data, unsigned size)
+      {
+        m_bfr.append(data, size);
+      }
+
+    private:
+      //! Destination buffer.
+      Utils::ByteBuffer& m_bfr;
+    };
+
+    //! Reader of data written by CompactWriter.
+    class CompactReader
+    {
+    public:
+      //! Constructor.
+      //! @param[in] bfr buffer.
+      //! @param[in] size buffer size.
+      CompactReader(const uint8_t* bfr, unsigned size):
+        m_ptr(bfr),
+        m_end(bfr + size)
+      { }
+
+      //! Read an unsigned integer.
+      //! @return value.
+      uint64_t
+      readUnsigned(void)
+      {
+        uint64_t value = 0;
+
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+          uint8_t byte = readByte();
+          value |= (uint64_t)(byte & 0x7f) << shift;
+
+          if ((byte & 0x80) == 0)
+            return value;
+        }
+
+        throw InvalidFormat();
+      }
+
+      //! Read a signed integer.
+      //! @return value.
+      int64_t
+      readSigned(void)
+      {
+        uint64_t value = readUnsigned();
+        return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+      }
+
+      //! Read a quantized floating point value.
+      //! @param[in] resolution quantization step.
+      //! @return value.
+      double
+      readQuantized(double resolution)
+      {
+        return readSigned() * resolution;
+      }
+
+      //! Read one byte.
+      //! @return value.
+      uint8_t
+      readByte(void)
+      {
+        if (m_ptr >= m_end)
+          throw BufferTooShort();
+
+        return *m_ptr++;
+      }
+
+      //! Skip bytes.
+      //! @param[in] size number of bytes.
+      //! @return pointer to the first skipped byte.
+      const uint8_t*
+      skip(unsigned size)
+      {
+        if (size > getRemaining())
+          throw BufferTooShort();
+
+        const uint8_t* ptr = m_ptr;
+        m_ptr += size;
+        return ptr;
+      }
+
+      //! Get the current read position.
+      //! @return read pointer.
+      const uint8_t*
+      getPointer(void) const
+      {
+        return m_ptr;
+      }
+
+      //! Get the number of unread bytes.
+      //! @return number of unread bytes.
+      unsigned
+      getRemaining(void) const
+      {
+        return (unsigned)(m_end - m_ptr);
+      }
+
+    private:
+      //! Read pointer.
+      const uint8_t* m_ptr;
+      //! End of buffer.
+      const uint8_t* m_end;
+    };
+  }
+}
+
+#endif
@@ -56,6 +56,8 @@ namespace DUNE
         m_header.dst = AddressResolver::invalid();
         m_header.dst_ent = DUNE_IMC_CONST_UNK_EID;
         m_header.timestamp = -1.0;
+        m_trace_origin = -1.0;
+        m_trace_hops = 0;
       }
 
       //! Default destructor.
@@ -200,6 +202,61 @@ namespace DUNE
         (void)subid;
       }
 
+      //! Set causal trace metadata. The trace identifies the sample
+      //! that started the chain of messages leading to this one. It
+      //! is only meaningful inside a process and is never serialized.
+      //! @param[in] origin time stamp of the originating message.
+      //! @param[in] hops number of tasks the chain went through.
+      void
+      setTrace(double origin, unsigned hops)
+      {
+        m_trace_origin = origin;
+        m_trace_hops = hops;
+      }
+
+      //! Set causal trace metadata of a message produced as a
+      //! consequence of another one.
+      //! @param[in] cause message that caused this one.
+      void
+      setTrace(const Message& cause)
+      {
+        if (cause.hasTrace())
+          setTrace(cause.m_trace_origin, cause.m_trace_hops + 1);
+        else
+          setTrace(cause.getTimeStamp(), 1);
+      }
+
+      //! Remove causal trace metadata.
+      void
+      clearTrace(void)
+      {
+        setTrace(-1.0, 0);
+      }
+
+      //! Test if the message carries causal trace metadata.
+      //! @return true if a trace is present, false otherwise.
+      bool
+      hasTrace(void) const
+      {
+        return m_trace_origin >= 0;
+      }
+
+      //! Get the time stamp of the message that started the chain.
+      //! @return time stamp or a negative value if there is no trace.
+      double
+      getTraceOrigin(void) const
+      {
+        return m_trace_origin;
+      }
+
+      //! Get the number of tasks the chain went through.
+      //! @return number of hops.
+      unsigned
+      getTraceHops(void) const
+      {
+        return m_trace_hops;
+      }
+
       //! Get the field 'value' on messages containing a field with
       //! such an abbreviation with floating point type.
       //! @return value of field 'value', 0.0 otherwise.
@@ -314,6 +371,10 @@ namespace DUNE
     protected:
       //! Message header.
       Header m_header;
+      //! Time stamp of the message that started the causal chain.
+      double m_trace_origin;
+      //! Number of tasks the causal chain went through.
+      unsigned m_trace_hops;
 
       //! Set the timestamp of nested messages.
       //! @param[in] value timestamp.
@@ -0,0 +1,360 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Algorithms/CRC16.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/MessageView.hpp>
+#include <DUNE/IMC/Views.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Read the length prefix of a variable size field.
+    //! @param[in] ptr pointer to the serialized field.
+    //! @param[in] reversed true if fields are byte swapped.
+    //! @return length.
+    static uint16_t
+    readLength(const uint8_t* ptr, bool reversed)
+    {
+      uint16_t value;
+      if (reversed)
+        Utils::ByteCopy::rcopy(value, ptr);
+      else
+        Utils::ByteCopy::copy(value, ptr);
+      return value;
+    }
+
+    MessageView::MessageView(void):
+      m_packet(NULL),
+      m_payload(NULL),
+      m_size(0),
+      m_id(DUNE_IMC_CONST_NULL_ID),
+      m_reversed(false)
+    { }
+
+    MessageView::MessageView(const uint8_t* bfr, unsigned bfr_len):
+      m_packet(bfr),
+      m_payload(bfr + DUNE_IMC_CONST_HEADER_SIZE),
+      m_size(0),
+      m_id(DUNE_IMC_CONST_NULL_ID),
+      m_reversed(false)
+    {
+      if (bfr_len < DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE)
+        throw BufferTooShort();
+
+      uint16_t sync = 0;
+      Utils::ByteCopy::copy(sync, bfr);
+      if (sync == DUNE_IMC_CONST_SYNC_REV)
+        m_reversed = true;
+      else if (sync != DUNE_IMC_CONST_SYNC)
+        throw InvalidSync(sync);
+
+      m_id = read<uint16_t>(bfr + 2);
+      m_size = read<uint16_t>(bfr + 4);
+
+      unsigned total = DUNE_IMC_CONST_HEADER_SIZE + m_size;
+      if (total + DUNE_IMC_CONST_FOOTER_SIZE > bfr_len)
+        throw BufferTooShort();
+
+      if (read<uint16_t>(bfr + total) != Algorithms::CRC16::compute(bfr, total))
+        throw InvalidCrc();
+
+      // Validate field layout once, so accessors can trust offsets.
+      measure(m_id, m_payload, m_size, m_reversed);
+    }
+
+    MessageView::MessageView(const MessageView& parent, const uint8_t* ptr, const uint8_t* end):
+      m_packet(parent.m_packet),
+      m_payload(NULL),
+      m_size(0),
+      m_id(DUNE_IMC_CONST_NULL_ID),
+      m_reversed(parent.m_reversed)
+    {
+      m_id = read<uint16_t>(ptr);
+      if (m_id == DUNE_IMC_CONST_NULL_ID)
+        return;
+
+      m_payload = ptr + 2;
+      m_size = measure(m_id, m_payload, end - m_payload, m_reversed);
+    }
+
+    std::string
+    MessageView::getName(void) const
+    {
+      return Factory::getAbbrevFromId(m_id);
+    }
+
+    uint16_t
+    MessageView::getSubId(void) const
+    {
+      switch (m_id)
+      {
+#define MESSAGE(id, abbrev)                                     \
+        case id: return abbrev##View(*this).getSubId();
+#include <DUNE/IMC/Factory.def>
+        default:
+          return 0;
+      }
+    }
+
+    Message*
+    MessageView::toMessage(void) const
+    {
+      if (isNull())
+        return NULL;
+
+      Message* msg = Factory::produce(m_id);
+      if (msg == NULL)
+        throw InvalidMessageId(m_id);
+
+      try
+      {
+        if (m_reversed)
+          msg->reverseDeserializeFields(m_payload, m_size);
+        else
+          msg->deserializeFields(m_payload, m_size);
+      }
+      catch (...)
+      {
+        delete msg;
+        throw;
+      }
+
+      msg->setTimeStamp(getTimeStamp());
+      msg->setSource(getSource());
+      msg->setSourceEntity(getSourceEntity());
+      msg->setDestination(getDestination());
+      msg->setDestinationEntity(getDestinationEntity());
+
+      return msg;
+    }
+
+    const MessageView::Field*
+    MessageView::getFields(uint16_t id)
+    {
+      switch (id)
+      {
+#define MESSAGE(id, abbrev)                                     \
+        case id: return abbrev##View::getFieldsStatic();
+#include <DUNE/IMC/Factory.def>
+        default:
+          return NULL;
+      }
+    }
+
+    unsigned
+    MessageView::getFieldSize(FieldType type)
+    {
+      switch (type)
+      {
+        case FT_INT8:
+        case FT_UINT8:
+          return 1;
+        case FT_INT16:
+        case FT_UINT16:
+          return 2;
+        case FT_INT32:
+        case FT_UINT32:
+        case FT_FP32:
+          return 4;
+        default:
+          return 8;
+      }
+    }
+
+    void
+    MessageView::readField(const Field& field, uint8_t* dst) const
+    {
+      const uint8_t* src = m_payload + field.offset;
+      unsigned size = getFieldSize(field.type);
+
+      // Fields are stored in the byte order of the sender.
+#if defined(DUNE_CPU_BIG_ENDIAN)
+      bool swap = !m_reversed;
+#else
+      bool swap = m_reversed;
+#endif
+
+      for (unsigned i = 0; i < size; ++i)
+        dst[i] = swap ? src[size - 1 - i] : src[i];
+    }
+
+    fp64_t
+    MessageView::readFieldFP(const Field& field) const
+    {
+      const uint8_t* ptr = m_payload + field.offset;
+
+      switch (field.type)
+      {
+        case FT_INT8:
+          return (int8_t)*ptr;
+        case FT_UINT8:
+          return *ptr;
+        case FT_INT16:
+          return read<int16_t>(ptr);
+        case FT_UINT16:
+          return read<uint16_t>(ptr);
+        case FT_INT32:
+          return read<int32_t>(ptr);
+        case FT_UINT32:
+          return read<uint32_t>(ptr);
+        case FT_INT64:
+          {
+            uint8_t bytes[8];
+            readField(field, bytes);
+            uint64_t value = 0;
+            for (unsigned i = 0; i < 8; ++i)
+              value |= (uint64_t)bytes[i] << (8 * i);
+            return (fp64_t)(int64_t)value;
+          }
+        case FT_FP32:
+          return read<fp32_t>(ptr);
+        default:
+          return read<fp64_t>(ptr);
+      }
+    }
+
+    void
+    MessageView::checkId(uint16_t id) const
+    {
+      if (!isNull() && m_id != id)
+        throw InvalidMessageId(m_id);
+    }
+
+    DataView
+    MessageView::readData(const uint8_t* ptr) const
+    {
+      return DataView((const char*)ptr + 2, readLength(ptr, m_reversed));
+    }
+
+    MessageView
+    MessageView::readInline(const uint8_t* ptr) const
+    {
+      return MessageView(*this, ptr, getPayloadEnd());
+    }
+
+    MessageListView
+    MessageView::readList(const uint8_t* ptr) const
+    {
+      return MessageListView(*this, ptr);
+    }
+
+    const uint8_t*
+    MessageView::skip(const uint8_t* ptr, const uint8_t* end, unsigned size)
+    {
+      if ((unsigned)(end - ptr) < size)
+        throw BufferTooShort();
+
+      return ptr + size;
+    }
+
+    const uint8_t*
+    MessageView::skipData(const uint8_t* ptr, const uint8_t* end, bool reversed)
+    {
+      ptr = skip(ptr, end, 2);
+      return skip(ptr, end, readLength(ptr - 2, reversed));
+    }
+
+    const uint8_t*
+    MessageView::skipInline(const uint8_t* ptr, const uint8_t* end, bool reversed)
+    {
+      ptr = skip(ptr, end, 2);
+
+      uint16_t id = readLength(ptr - 2, reversed);
+      if (id == DUNE_IMC_CONST_NULL_ID)
+        return ptr;
+
+      return ptr + measure(id, ptr, end - ptr, reversed);
+    }
+
+    const uint8_t*
+    MessageView::skipList(const uint8_t* ptr, const uint8_t* end, bool reversed)
+    {
+      ptr = skip(ptr, end, 2);
+
+      uint16_t count = readLength(ptr - 2, reversed);
+      for (unsigned i = 0; i < count; ++i)
+        ptr = skipInline(ptr, end, reversed);
+
+      return ptr;
+    }
+
+    uint16_t
+    MessageView::measure(uint16_t id, const uint8_t* bfr, unsigned size, bool reversed)
+    {
+      switch (id)
+      {
+#define MESSAGE(id, abbrev)                                             \
+        case id: return abbrev##View::measure(bfr, size, reversed);
+#include <DUNE/IMC/Factory.def>
+        default:
+          throw InvalidMessageId(id);
+      }
+    }
+
+    MessageListView::MessageListView(void):
+      m_first(NULL),
+      m_count(0),
+      m_cursor_index(0),
+      m_cursor(NULL)
+    { }
+
+    MessageListView::MessageListView(const MessageView& parent, const uint8_t* ptr):
+      m_parent(parent),
+      m_first(ptr + 2),
+      m_count(readLength(ptr, parent.m_reversed)),
+      m_cursor_index(0),
+      m_cursor(m_first)
+    { }
+
+    MessageView
+    MessageListView::get(unsigned index) const
+    {
+      if (index >= m_count)
+        throw std::out_of_range("message list index");
+
+      if (index < m_cursor_index)
+      {
+        m_cursor_index = 0;
+        m_cursor = m_first;
+      }
+
+      const uint8_t* end = m_parent.getPayloadEnd();
+      for (; m_cursor_index < index; ++m_cursor_index)
+        m_cursor = MessageView::skipInline(m_cursor, end, m_parent.m_reversed);
+
+      return MessageView(m_parent, m_cursor, end);
+    }
+  }
+}
@@ -0,0 +1,445 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_MESSAGE_VIEW_HPP_INCLUDED_
+#define DUNE_IMC_MESSAGE_VIEW_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/IMC/Constants.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM DataView;
+    class DUNE_DLL_SYM MessageView;
+    class DUNE_DLL_SYM MessageListView;
+
+    // Forward declarations.
+    class Message;
+
+    //! Read-only reference to the contents of a 'plaintext' or
+    //! 'rawdata' field inside a serialized packet.
+    class DataView
+    {
+    public:
+      //! Constructor.
+      //! @param[in] data pointer to the first byte.
+      //! @param[in] size number of bytes.
+      DataView(const char* data = NULL, uint16_t size = 0):
+        m_data(data),
+        m_size(size)
+      { }
+
+      //! Get pointer to the first byte.
+      //! @return pointer to the first byte.
+      const char*
+      getData(void) const
+      {
+        return m_data;
+      }
+
+      //! Get number of bytes.
+      //! @return number of bytes.
+      uint16_t
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Test if the field is empty.
+      //! @return true if the field is empty, false otherwise.
+      bool
+      empty(void) const
+      {
+        return m_size == 0;
+      }
+
+      //! Copy the contents to a string.
+      //! @return field contents.
+      std::string
+      str(void) const
+      {
+        return std::string(m_data, m_size);
+      }
+
+      //! Compare the contents with a string without copying.
+      //! @param[in] other string.
+      //! @return true if the contents are equal, false otherwise.
+      bool
+      operator==(const std::string& other) const
+      {
+        return other.size() == m_size && other.compare(0, m_size, m_data, m_size) == 0;
+      }
+
+    private:
+      //! First byte.
+      const char* m_data;
+      //! Number of bytes.
+      uint16_t m_size;
+    };
+
+    //! Read-only view of a serialized message. The packet is
+    //! validated when the view is created, but fields are only decoded
+    //! when they are accessed, so scanning a log for a message
+    //! identifier, a source or a couple of fields does not allocate
+    //! memory. The wrapped buffer must outlive the view and all views
+    //! obtained from it.
+    //!
+    //! Typed views of each message are generated in
+    //! DUNE/IMC/Views.hpp, which must be included explicitly.
+    class MessageView
+    {
+    public:
+      //! Type of a fixed size field.
+      enum FieldType
+      {
+        FT_INT8,
+        FT_UINT8,
+        FT_INT16,
+        FT_UINT16,
+        FT_INT32,
+        FT_UINT32,
+        FT_INT64,
+        FT_FP32,
+        FT_FP64
+      };
+
+      //! Fixed size field at a constant offset of the serialized
+      //! message fields.
+      struct Field
+      {
+        //! Field abbreviation.
+        const char* name;
+        //! Field type.
+        FieldType type;
+        //! Offset from the first field.
+        uint16_t offset;
+      };
+
+      //! Create a null view.
+      MessageView(void);
+
+      //! Wrap a serialized packet. The synchronization number, the
+      //! CRC and the layout of the message fields are checked.
+      //! @param[in] bfr packet buffer.
+      //! @param[in] bfr_len buffer size.
+      MessageView(const uint8_t* bfr, unsigned bfr_len);
+
+      //! Test if the view refers to a null inline message.
+      //! @return true if the view is null, false otherwise.
+      bool
+      isNull(void) const
+      {
+        return m_payload == NULL;
+      }
+
+      //! Test if the packet was serialized with the opposite byte
+      //! order.
+      //! @return true if fields are byte swapped, false otherwise.
+      bool
+      isReversed(void) const
+      {
+        return m_reversed;
+      }
+
+      //! Get message identification number.
+      //! @return message identification number.
+      uint16_t
+      getId(void) const
+      {
+        return m_id;
+      }
+
+      //! Get message abbreviation.
+      //! @return message abbreviation.
+      std::string
+      getName(void) const;
+
+      //! Get message sub-identification number.
+      //! @return message sub-identification number.
+      uint16_t
+      getSubId(void) const;
+
+      //! Get packet time stamp. Inline messages share the header of
+      //! the enclosing packet.
+      //! @return time stamp.
+      fp64_t
+      getTimeStamp(void) const
+      {
+        return read<fp64_t>(m_packet + 6);
+      }
+
+      //! Get source address.
+      //! @return source address.
+      uint16_t
+      getSource(void) const
+      {
+        return read<uint16_t>(m_packet + 14);
+      }
+
+      //! Get source entity.
+      //! @return source entity.
+      uint8_t
+      getSourceEntity(void) const
+      {
+        return m_packet[16];
+      }
+
+      //! Get destination address.
+      //! @return destination address.
+      uint16_t
+      getDestination(void) const
+      {
+        return read<uint16_t>(m_packet + 17);
+      }
+
+      //! Get destination entity.
+      //! @return destination entity.
+      uint8_t
+      getDestinationEntity(void) const
+      {
+        return m_packet[19];
+      }
+
+      //! Get serialized message fields.
+      //! @return pointer to the first field.
+      const uint8_t*
+      getPayload(void) const
+      {
+        return m_payload;
+      }
+
+      //! Get size of the serialized message fields.
+      //! @return number of bytes.
+      uint16_t
+      getPayloadSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Decode all fields into a new message object.
+      //! @return message object (owned by the caller) or NULL if the
+      //! view is null.
+      Message*
+      toMessage(void) const;
+
+      //! Get the fixed size fields of a message that can be read
+      //! without decoding the preceding fields.
+      //! @param[in] id message identification number.
+      //! @return array terminated by a field with a NULL name or NULL
+      //! if the message is unknown.
+      static const Field*
+      getFields(uint16_t id);
+
+      //! Get the serialized size of a field type.
+      //! @param[in] type field type.
+      //! @return number of bytes.
+      static unsigned
+      getFieldSize(FieldType type);
+
+      //! Copy the value of a field in little endian byte order.
+      //! @param[in] field field of this message.
+      //! @param[out] dst destination buffer.
+      void
+      readField(const Field& field, uint8_t* dst) const;
+
+      //! Read the value of a field as a double.
+      //! @param[in] field field of this message.
+      //! @return field value.
+      fp64_t
+      readFieldFP(const Field& field) const;
+
+    protected:
+      //! Narrow a view to a given message type.
+      //! @param[in] id expected message identification number.
+      void
+      checkId(uint16_t id) const;
+
+      //! Read a fixed size value.
+      //! @param[in] ptr pointer to the serialized value.
+      //! @return value.
+      template <typename T>
+      T
+      read(const uint8_t* ptr) const
+      {
+        T value;
+        if (m_reversed)
+          Utils::ByteCopy::rcopy(value, ptr);
+        else
+          Utils::ByteCopy::copy(value, ptr);
+        return value;
+      }
+
+      //! Read a 'plaintext' or 'rawdata' field.
+      //! @param[in] ptr pointer to the serialized field.
+      //! @return field contents.
+      DataView
+      readData(const uint8_t* ptr) const;
+
+      //! Read a 'message' field.
+      //! @param[in] ptr pointer to the serialized field.
+      //! @return view of the inline message.
+      MessageView
+      readInline(const uint8_t* ptr) const;
+
+      //! Read a 'message-list' field.
+      //! @param[in] ptr pointer to the serialized field.
+      //! @return view of the message list.
+      MessageListView
+      readList(const uint8_t* ptr) const;
+
+      //! Skip a run of fixed size fields.
+      //! @param[in] ptr pointer to the first field.
+      //! @param[in] end end of the buffer.
+      //! @param[in] size number of bytes to skip.
+      //! @return pointer to the next field.
+      static const uint8_t*
+      skip(const uint8_t* ptr, const uint8_t* end, unsigned size);
+
+      //! Skip a 'plaintext' or 'rawdata' field.
+      //! @param[in] ptr pointer to the serialized field.
+      //! @param[in] end end of the buffer.
+      //! @param[in] reversed true if fields are byte swapped.
+      //! @return pointer to the next field.
+      static const uint8_t*
+      skipData(const uint8_t* ptr, const uint8_t* end, bool reversed);
+
+      //! Skip a 'message' field.
+      //! @param[in] ptr pointer to the serialized field.
+      //! @param[in] end end of the buffer.
+      //! @param[in] reversed true if fields are byte swapped.
+      //! @return pointer to the next field.
+      static const uint8_t*
+      skipInline(const uint8_t* ptr, const uint8_t* end, bool reversed);
+
+      //! Skip a 'message-list' field.
+      //! @param[in] ptr pointer to the serialized field.
+      //! @param[in] end end of the buffer.
+      //! @param[in] reversed true if fields are byte swapped.
+      //! @return pointer to the next field.
+      static const uint8_t*
+      skipList(const uint8_t* ptr, const uint8_t* end, bool reversed);
+
+      //! Compute the serialized size of the fields of a message.
+      //! @param[in] id message identification number.
+      //! @param[in] bfr pointer to the first field.
+      //! @param[in] size number of available bytes.
+      //! @param[in] reversed true if fields are byte swapped.
+      //! @return number of bytes used by the fields.
+      static uint16_t
+      measure(uint16_t id, const uint8_t* bfr, unsigned size, bool reversed);
+
+      //! Get pointer to the end of the serialized fields.
+      //! @return pointer past the last field.
+      const uint8_t*
+      getPayloadEnd(void) const
+      {
+        return m_payload + m_size;
+      }
+
+    private:
+      //! Packet header (shared by inline messages).
+      const uint8_t* m_packet;
+      //! Message fields.
+      const uint8_t* m_payload;
+      //! Size of message fields.
+      uint16_t m_size;
+      //! Message identification number.
+      uint16_t m_id;
+      //! True if the packet was serialized with the opposite byte order.
+      bool m_reversed;
+
+      //! Create a view of a message nested in another.
+      //! @param[in] parent view of the enclosing message.
+      //! @param[in] ptr pointer to the message identification number.
+      //! @param[in] end end of the enclosing message.
+      MessageView(const MessageView& parent, const uint8_t* ptr, const uint8_t* end);
+
+      friend class MessageListView;
+    };
+
+    //! Read-only view of a 'message-list' field.
+    class MessageListView
+    {
+    public:
+      //! Create an empty list.
+      MessageListView(void);
+
+      //! Get number of messages.
+      //! @return number of messages.
+      uint16_t
+      size(void) const
+      {
+        return m_count;
+      }
+
+      //! Test if the list is empty.
+      //! @return true if the list is empty, false otherwise.
+      bool
+      empty(void) const
+      {
+        return m_count == 0;
+      }
+
+      //! Get a message of the list. Messages are located by walking
+      //! the list, so iterating in order costs one step per message.
+      //! @param[in] index message index.
+      //! @return view of the message.
+      MessageView
+      get(unsigned index) const;
+
+    private:
+      //! View of the enclosing message.
+      MessageView m_parent;
+      //! First message of the list.
+      const uint8_t* m_first;
+      //! Number of messages.
+      uint16_t m_count;
+      //! Index of the last located message.
+      mutable unsigned m_cursor_index;
+      //! Last located message.
+      mutable const uint8_t* m_cursor;
+
+      //! Constructor.
+      //! @param[in] parent view of the enclosing message.
+      //! @param[in] ptr pointer to the serialized field.
+      MessageListView(const MessageView& parent, const uint8_t* ptr);
+
+      friend class MessageView;
+    };
+  }
+}
+
+#endif
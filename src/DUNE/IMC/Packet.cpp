@@ -135,6 +135,18 @@ namespace DUNE
 
     Message*
     Packet::deserialize(std::istream& ifs, Utils::ByteBuffer& bfr)
+    {
+      uint16_t size = read(ifs, bfr);
+      if (size == 0)
+        return 0;
+
+      Header hdr;
+      deserializeHeader(hdr, bfr.getBuffer(), size);
+      return deserializePayload(hdr, bfr.getBuffer(), size, 0);
+    }
+
+    uint16_t
+    Packet::read(std::istream& ifs, Utils::ByteBuffer& bfr)
     {
       // Get the message header.
       bfr.setSize(DUNE_IMC_CONST_HEADER_SIZE);
@@ -151,14 +163,17 @@ namespace DUNE
       deserializeHeader(hdr, bfr.getBuffer(), DUNE_IMC_CONST_HEADER_SIZE);
 
       // Get remaining data.
-      uint16_t remaining = hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      unsigned remaining = hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      if (DUNE_IMC_CONST_HEADER_SIZE + remaining > DUNE_IMC_CONST_MAX_SIZE)
+        throw InvalidMessageSize(DUNE_IMC_CONST_HEADER_SIZE + remaining);
+
       bfr.setSize(DUNE_IMC_CONST_HEADER_SIZE + remaining);
       ifs.read(bfr.getBufferSigned() + DUNE_IMC_CONST_HEADER_SIZE, remaining);
 
-      if (ifs.gcount() < remaining)
+      if ((unsigned)ifs.gcount() < remaining)
         throw BufferTooShort();
 
-      return deserializePayload(hdr, bfr.getBuffer(), DUNE_IMC_CONST_HEADER_SIZE + remaining, 0);
+      return DUNE_IMC_CONST_HEADER_SIZE + remaining;
     }
 
     uint16_t
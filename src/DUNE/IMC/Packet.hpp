@@ -83,6 +83,14 @@ namespace DUNE
       static Message*
       deserialize(std::istream& ifs, Utils::ByteBuffer& bfr);
 
+      //! Read a serialized packet without decoding it.
+      //! @param[in] ifs input stream.
+      //! @param[out] bfr destination buffer.
+      //! @return packet size or 0 if the end of the stream was
+      //! reached.
+      static uint16_t
+      read(std::istream& ifs, Utils::ByteBuffer& bfr);
+
       static uint16_t
       serializeHeader(const Message* msg, uint8_t* bfr, uint16_t bfr_len);
 
@@ -0,0 +1,9528 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Automatically generated.                                                 *
+//***************************************************************************
+// IMC XML MD5: 4606c32356d598296311edecb407d6c1                            *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/IMC/Views.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    uint16_t
+    EntityStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EntityStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"state", FT_UINT8, 0},
+        {"flags", FT_UINT8, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    QueryEntityStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    QueryEntityStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    EntityInfoView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 4);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EntityInfoView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    EntityInfoView::component(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    EntityInfoView::act_time(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    uint16_t
+    EntityInfoView::deact_time(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return read<uint16_t>(ptr__);
+    }
+
+    uint16_t
+    QueryEntityInfoView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    QueryEntityInfoView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    EntityListView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EntityListView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CpuUsageView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CpuUsageView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TransportBindingsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TransportBindingsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TransportBindingsView::message_id(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    uint16_t
+    RestartSystemView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    RestartSystemView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DevCalibrationControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DevCalibrationControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DevCalibrationStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DevCalibrationStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"total_steps", FT_UINT8, 0},
+        {"step_number", FT_UINT8, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    DevCalibrationStateView::flags(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    EntityActivationStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EntityActivationStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"state", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    QueryEntityActivationStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    QueryEntityActivationStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VehicleOperationalLimitsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 69);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VehicleOperationalLimitsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {"speed_min", FT_FP32, 1},
+        {"speed_max", FT_FP32, 5},
+        {"long_accel", FT_FP32, 9},
+        {"alt_max_msl", FT_FP32, 13},
+        {"dive_fraction_max", FT_FP32, 17},
+        {"climb_fraction_max", FT_FP32, 21},
+        {"bank_max", FT_FP32, 25},
+        {"p_max", FT_FP32, 29},
+        {"pitch_min", FT_FP32, 33},
+        {"pitch_max", FT_FP32, 37},
+        {"q_max", FT_FP32, 41},
+        {"g_min", FT_FP32, 45},
+        {"g_max", FT_FP32, 49},
+        {"g_lat_max", FT_FP32, 53},
+        {"rpm_min", FT_FP32, 57},
+        {"rpm_max", FT_FP32, 61},
+        {"rpm_rate_max", FT_FP32, 65},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    MsgListView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    MsgListView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SimulatedStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 80);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SimulatedStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"height", FT_FP32, 16},
+        {"x", FT_FP32, 20},
+        {"y", FT_FP32, 24},
+        {"z", FT_FP32, 28},
+        {"phi", FT_FP32, 32},
+        {"theta", FT_FP32, 36},
+        {"psi", FT_FP32, 40},
+        {"u", FT_FP32, 44},
+        {"v", FT_FP32, 48},
+        {"w", FT_FP32, 52},
+        {"p", FT_FP32, 56},
+        {"q", FT_FP32, 60},
+        {"r", FT_FP32, 64},
+        {"svx", FT_FP32, 68},
+        {"svy", FT_FP32, 72},
+        {"svz", FT_FP32, 76},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LeakSimulationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LeakSimulationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    UASimulationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 3);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UASimulationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"speed", FT_UINT16, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DynamicsSimParamView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 9);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DynamicsSimParamView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {"tas2acc_pgain", FT_FP32, 1},
+        {"bank2p_pgain", FT_FP32, 5},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    StorageUsageView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    StorageUsageView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"available", FT_UINT32, 0},
+        {"value", FT_UINT8, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CacheControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CacheControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageView
+    CacheControlView::message(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readInline(ptr__);
+    }
+
+    uint16_t
+    LoggingControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LoggingControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LogBookEntryView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 9);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LogBookEntryView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"htime", FT_FP64, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    LogBookEntryView::text(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 9;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    LogBookControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 9);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LogBookControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"command", FT_UINT8, 0},
+        {"htime", FT_FP64, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ReplayControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ReplayControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ClockControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 10);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ClockControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {"clock", FT_FP64, 1},
+        {"tz", FT_INT8, 9},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    HistoricCTDView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    HistoricCTDView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"conductivity", FT_FP32, 0},
+        {"temperature", FT_FP32, 4},
+        {"depth", FT_FP32, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    HistoricTelemetryView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    HistoricTelemetryView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"altitude", FT_FP32, 0},
+        {"roll", FT_UINT16, 4},
+        {"pitch", FT_UINT16, 6},
+        {"yaw", FT_UINT16, 8},
+        {"speed", FT_INT16, 10},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    HistoricSonarDataView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 19);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    HistoricSonarDataView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"altitude", FT_FP32, 0},
+        {"width", FT_FP32, 4},
+        {"length", FT_FP32, 8},
+        {"bearing", FT_FP32, 12},
+        {"pxl", FT_INT16, 16},
+        {"encoding", FT_UINT8, 18},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    HistoricEventView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    HistoricEventView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    HistoricEventView::type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    HeartbeatView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    HeartbeatView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AnnounceView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 23);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AnnounceView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    AnnounceView::sys_type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    AnnounceView::owner(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return read<uint16_t>(ptr__);
+    }
+
+    fp64_t
+    AnnounceView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 3;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    AnnounceView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 11;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp32_t
+    AnnounceView::height(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 19;
+      return read<fp32_t>(ptr__);
+    }
+
+    DataView
+    AnnounceView::services(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 23;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    AnnounceServiceView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AnnounceServiceView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    AnnounceServiceView::service_type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    RSSIView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RSSIView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VSWRView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VSWRView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LinkLevelView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LinkLevelView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SmsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SmsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SmsView::timeout(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    DataView
+    SmsView::contents(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    SmsTxView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SmsTxView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"seq", FT_UINT32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SmsTxView::timeout(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    DataView
+    SmsTxView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    SmsRxView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SmsRxView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    SmsRxView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    SmsStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SmsStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"seq", FT_UINT32, 0},
+        {"state", FT_UINT8, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TextMessageView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TextMessageView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    TextMessageView::text(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    IridiumMsgRxView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 24);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    IridiumMsgRxView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp64_t
+    IridiumMsgRxView::htime(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    IridiumMsgRxView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    IridiumMsgRxView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp64_t>(ptr__);
+    }
+
+    DataView
+    IridiumMsgRxView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 24;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    IridiumMsgTxView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    IridiumMsgTxView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"req_id", FT_UINT16, 0},
+        {"ttl", FT_UINT16, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    IridiumMsgTxView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    IridiumTxStatusView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 3);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    IridiumTxStatusView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"req_id", FT_UINT16, 0},
+        {"status", FT_UINT8, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GroupMembershipStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 4);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GroupMembershipStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint32_t
+    GroupMembershipStateView::links(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint32_t>(ptr__);
+    }
+
+    uint16_t
+    SystemGroupView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SystemGroupView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    SystemGroupView::action(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    SystemGroupView::grouplist(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    LinkLatencyView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 6);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LinkLatencyView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {"sys_src", FT_UINT16, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ExtendedRSSIView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ExtendedRSSIView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {"units", FT_UINT8, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    HistoricDataView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    HistoricDataView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"base_lat", FT_FP32, 0},
+        {"base_lon", FT_FP32, 4},
+        {"base_time", FT_FP32, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CompressedHistoryView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CompressedHistoryView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"base_lat", FT_FP32, 0},
+        {"base_lon", FT_FP32, 4},
+        {"base_time", FT_FP32, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    HistoricSampleView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 11);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    HistoricSampleView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"sys_id", FT_UINT16, 0},
+        {"priority", FT_INT8, 2},
+        {"x", FT_INT16, 3},
+        {"y", FT_INT16, 5},
+        {"z", FT_INT16, 7},
+        {"t", FT_INT16, 9},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    HistoricDataQueryView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    HistoricDataQueryView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"req_id", FT_UINT16, 0},
+        {"type", FT_UINT8, 2},
+        {"max_size", FT_UINT16, 3},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    HistoricDataView
+    HistoricDataQueryView::data(void) const
+    {
+      return HistoricDataView(readInline(getPayload() + 5));
+    }
+
+    uint16_t
+    RemoteCommandView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RemoteCommandView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"original_source", FT_UINT16, 0},
+        {"destination", FT_UINT16, 2},
+        {"timeout", FT_FP64, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LblRangeView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LblRangeView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"range", FT_FP32, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LblBeaconView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 23);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LblBeaconView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp64_t
+    LblBeaconView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    LblBeaconView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp32_t
+    LblBeaconView::depth(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint8_t
+    LblBeaconView::query_channel(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 20;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    LblBeaconView::reply_channel(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 21;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    LblBeaconView::transponder_delay(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 22;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    LblConfigView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LblConfigView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AcousticMessageView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AcousticMessageView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AcousticOperationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AcousticOperationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp32_t
+    AcousticOperationView::range(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    MessageView
+    AcousticOperationView::msg(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return readInline(ptr__);
+    }
+
+    uint16_t
+    AcousticSystemsQueryView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    AcousticSystemsQueryView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AcousticSystemsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AcousticSystemsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AcousticLinkView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 6);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AcousticLinkView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp32_t
+    AcousticLinkView::rssi(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    AcousticLinkView::integrity(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return read<uint16_t>(ptr__);
+    }
+
+    uint16_t
+    RpmView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RpmView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_INT16, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VoltageView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VoltageView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CurrentView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CurrentView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GpsFixView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 56);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GpsFixView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"validity", FT_UINT16, 0},
+        {"type", FT_UINT8, 2},
+        {"utc_year", FT_UINT16, 3},
+        {"utc_month", FT_UINT8, 5},
+        {"utc_day", FT_UINT8, 6},
+        {"utc_time", FT_FP32, 7},
+        {"lat", FT_FP64, 11},
+        {"lon", FT_FP64, 19},
+        {"height", FT_FP32, 27},
+        {"satellites", FT_UINT8, 31},
+        {"cog", FT_FP32, 32},
+        {"sog", FT_FP32, 36},
+        {"hdop", FT_FP32, 40},
+        {"vdop", FT_FP32, 44},
+        {"hacc", FT_FP32, 48},
+        {"vacc", FT_FP32, 52},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    EulerAnglesView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 40);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EulerAnglesView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"time", FT_FP64, 0},
+        {"phi", FT_FP64, 8},
+        {"theta", FT_FP64, 16},
+        {"psi", FT_FP64, 24},
+        {"psi_magnetic", FT_FP64, 32},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    EulerAnglesDeltaView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 36);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EulerAnglesDeltaView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"time", FT_FP64, 0},
+        {"x", FT_FP64, 8},
+        {"y", FT_FP64, 16},
+        {"z", FT_FP64, 24},
+        {"timestep", FT_FP32, 32},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AngularVelocityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 32);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AngularVelocityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"time", FT_FP64, 0},
+        {"x", FT_FP64, 8},
+        {"y", FT_FP64, 16},
+        {"z", FT_FP64, 24},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AccelerationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 32);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AccelerationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"time", FT_FP64, 0},
+        {"x", FT_FP64, 8},
+        {"y", FT_FP64, 16},
+        {"z", FT_FP64, 24},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    MagneticFieldView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 32);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    MagneticFieldView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"time", FT_FP64, 0},
+        {"x", FT_FP64, 8},
+        {"y", FT_FP64, 16},
+        {"z", FT_FP64, 24},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GroundVelocityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 25);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GroundVelocityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"validity", FT_UINT8, 0},
+        {"x", FT_FP64, 1},
+        {"y", FT_FP64, 9},
+        {"z", FT_FP64, 17},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    WaterVelocityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 25);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    WaterVelocityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"validity", FT_UINT8, 0},
+        {"x", FT_FP64, 1},
+        {"y", FT_FP64, 9},
+        {"z", FT_FP64, 17},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VelocityDeltaView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 32);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VelocityDeltaView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"time", FT_FP64, 0},
+        {"x", FT_FP64, 8},
+        {"y", FT_FP64, 16},
+        {"z", FT_FP64, 24},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DeviceStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 24);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DeviceStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"x", FT_FP32, 0},
+        {"y", FT_FP32, 4},
+        {"z", FT_FP32, 8},
+        {"phi", FT_FP32, 12},
+        {"theta", FT_FP32, 16},
+        {"psi", FT_FP32, 20},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    BeamConfigView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    BeamConfigView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"beam_width", FT_FP32, 0},
+        {"beam_height", FT_FP32, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DistanceView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 4);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DistanceView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"validity", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageListView
+    DistanceView::beam_config(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    fp32_t
+    DistanceView::value(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    TemperatureView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TemperatureView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PressureView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PressureView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DepthView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DepthView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DepthOffsetView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DepthOffsetView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SoundSpeedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SoundSpeedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    WaterDensityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    WaterDensityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ConductivityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ConductivityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SalinityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SalinityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    WindSpeedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    WindSpeedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"direction", FT_FP32, 0},
+        {"speed", FT_FP32, 4},
+        {"turbulence", FT_FP32, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    RelativeHumidityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RelativeHumidityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DevDataTextView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DevDataTextView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DevDataBinaryView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DevDataBinaryView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SonarDataView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 14);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SonarDataView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"frequency", FT_UINT32, 1},
+        {"min_range", FT_UINT16, 5},
+        {"max_range", FT_UINT16, 7},
+        {"bits_per_point", FT_UINT8, 9},
+        {"scale_factor", FT_FP32, 10},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    SonarDataView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 14;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    PulseView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    PulseView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PulseDetectionControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PulseDetectionControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FuelLevelView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FuelLevelView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {"confidence", FT_FP32, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GpsNavDataView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 68);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GpsNavDataView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"itow", FT_UINT32, 0},
+        {"lat", FT_FP64, 4},
+        {"lon", FT_FP64, 12},
+        {"height_ell", FT_FP32, 20},
+        {"height_sea", FT_FP32, 24},
+        {"hacc", FT_FP32, 28},
+        {"vacc", FT_FP32, 32},
+        {"vel_n", FT_FP32, 36},
+        {"vel_e", FT_FP32, 40},
+        {"vel_d", FT_FP32, 44},
+        {"speed", FT_FP32, 48},
+        {"gspeed", FT_FP32, 52},
+        {"heading", FT_FP32, 56},
+        {"sacc", FT_FP32, 60},
+        {"cacc", FT_FP32, 64},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ServoPositionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ServoPositionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"value", FT_FP32, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DataSanityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DataSanityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"sane", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    RhodamineDyeView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RhodamineDyeView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CrudeOilView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CrudeOilView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FineOilView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FineOilView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TurbidityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TurbidityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ChlorophyllView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ChlorophyllView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FluoresceinView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FluoresceinView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PhycocyaninView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PhycocyaninView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PhycoerythrinView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PhycoerythrinView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GpsFixRtkView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 58);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GpsFixRtkView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"validity", FT_UINT16, 0},
+        {"type", FT_UINT8, 2},
+        {"tow", FT_UINT32, 3},
+        {"base_lat", FT_FP64, 7},
+        {"base_lon", FT_FP64, 15},
+        {"base_height", FT_FP32, 23},
+        {"n", FT_FP32, 27},
+        {"e", FT_FP32, 31},
+        {"d", FT_FP32, 35},
+        {"v_n", FT_FP32, 39},
+        {"v_e", FT_FP32, 43},
+        {"v_d", FT_FP32, 47},
+        {"satellites", FT_UINT8, 51},
+        {"iar_hyp", FT_UINT16, 52},
+        {"iar_ratio", FT_FP32, 54},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    EstimatedStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 88);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EstimatedStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"height", FT_FP32, 16},
+        {"x", FT_FP32, 20},
+        {"y", FT_FP32, 24},
+        {"z", FT_FP32, 28},
+        {"phi", FT_FP32, 32},
+        {"theta", FT_FP32, 36},
+        {"psi", FT_FP32, 40},
+        {"u", FT_FP32, 44},
+        {"v", FT_FP32, 48},
+        {"w", FT_FP32, 52},
+        {"vx", FT_FP32, 56},
+        {"vy", FT_FP32, 60},
+        {"vz", FT_FP32, 64},
+        {"p", FT_FP32, 68},
+        {"q", FT_FP32, 72},
+        {"r", FT_FP32, 76},
+        {"depth", FT_FP32, 80},
+        {"alt", FT_FP32, 84},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ExternalNavDataView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ExternalNavDataView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    EstimatedStateView
+    ExternalNavDataView::state(void) const
+    {
+      return EstimatedStateView(readInline(getPayload()));
+    }
+
+    uint8_t
+    ExternalNavDataView::type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    DissolvedOxygenView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DissolvedOxygenView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AirSaturationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AirSaturationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ThrottleView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ThrottleView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PHView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PHView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    RedoxView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RedoxView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CameraZoomView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 3);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CameraZoomView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"zoom", FT_UINT8, 1},
+        {"action", FT_UINT8, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SetThrusterActuationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SetThrusterActuationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"value", FT_FP32, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SetServoPositionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SetServoPositionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"value", FT_FP32, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SetControlSurfaceDeflectionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SetControlSurfaceDeflectionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"angle", FT_FP32, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    RemoteActionsRequestView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RemoteActionsRequestView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    RemoteActionsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RemoteActionsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ButtonEventView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ButtonEventView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"button", FT_UINT8, 0},
+        {"value", FT_UINT8, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LcdControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LcdControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PowerOperationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 13);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PowerOperationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {"time_remain", FT_FP32, 1},
+        {"sched_time", FT_FP64, 5},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PowerChannelControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 9);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PowerChannelControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    PowerChannelControlView::op(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    fp64_t
+    PowerChannelControlView::sched_time(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return read<fp64_t>(ptr__);
+    }
+
+    uint16_t
+    QueryPowerChannelStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    QueryPowerChannelStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PowerChannelStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PowerChannelStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    PowerChannelStateView::state(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    LedBrightnessView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LedBrightnessView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    LedBrightnessView::value(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    QueryLedBrightnessView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    QueryLedBrightnessView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SetLedBrightnessView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SetLedBrightnessView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    SetLedBrightnessView::value(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    SetPWMView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 9);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SetPWMView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"period", FT_UINT32, 1},
+        {"duty_cycle", FT_UINT32, 5},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PWMView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 9);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PWMView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"period", FT_UINT32, 1},
+        {"duty_cycle", FT_UINT32, 5},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    EstimatedStreamVelocityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 24);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EstimatedStreamVelocityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"x", FT_FP64, 0},
+        {"y", FT_FP64, 8},
+        {"z", FT_FP64, 16},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    IndicatedSpeedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    IndicatedSpeedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TrueSpeedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TrueSpeedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    NavigationUncertaintyView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 56);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    NavigationUncertaintyView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"x", FT_FP32, 0},
+        {"y", FT_FP32, 4},
+        {"z", FT_FP32, 8},
+        {"phi", FT_FP32, 12},
+        {"theta", FT_FP32, 16},
+        {"psi", FT_FP32, 20},
+        {"p", FT_FP32, 24},
+        {"q", FT_FP32, 28},
+        {"r", FT_FP32, 32},
+        {"u", FT_FP32, 36},
+        {"v", FT_FP32, 40},
+        {"w", FT_FP32, 44},
+        {"bias_psi", FT_FP32, 48},
+        {"bias_r", FT_FP32, 52},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    NavigationDataView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 36);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    NavigationDataView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"bias_psi", FT_FP32, 0},
+        {"bias_r", FT_FP32, 4},
+        {"cog", FT_FP32, 8},
+        {"cyaw", FT_FP32, 12},
+        {"lbl_rej_level", FT_FP32, 16},
+        {"gps_rej_level", FT_FP32, 20},
+        {"custom_x", FT_FP32, 24},
+        {"custom_y", FT_FP32, 28},
+        {"custom_z", FT_FP32, 32},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GpsFixRejectionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GpsFixRejectionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"utc_time", FT_FP32, 0},
+        {"reason", FT_UINT8, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LblRangeAcceptanceView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 6);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LblRangeAcceptanceView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"id", FT_UINT8, 0},
+        {"range", FT_FP32, 1},
+        {"acceptance", FT_UINT8, 5},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DvlRejectionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 10);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DvlRejectionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"reason", FT_UINT8, 1},
+        {"value", FT_FP32, 2},
+        {"timestep", FT_FP32, 6},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LblEstimateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 20);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LblEstimateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    LblBeaconView
+    LblEstimateView::beacon(void) const
+    {
+      return LblBeaconView(readInline(getPayload()));
+    }
+
+    fp32_t
+    LblEstimateView::x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LblEstimateView::y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LblEstimateView::var_x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LblEstimateView::var_y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 12;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LblEstimateView::distance(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    AlignmentStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AlignmentStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"state", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GroupStreamVelocityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 24);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GroupStreamVelocityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"x", FT_FP64, 0},
+        {"y", FT_FP64, 8},
+        {"z", FT_FP64, 16},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AirflowView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AirflowView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"va", FT_FP32, 0},
+        {"aoa", FT_FP32, 4},
+        {"ssa", FT_FP32, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredHeadingView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredHeadingView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredZView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredZView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {"z_units", FT_UINT8, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredSpeedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 9);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredSpeedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {"speed_units", FT_UINT8, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredRollView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredRollView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredPitchView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredPitchView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredVerticalRateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredVerticalRateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredPathView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 56);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredPathView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"path_ref", FT_UINT32, 0},
+        {"start_lat", FT_FP64, 4},
+        {"start_lon", FT_FP64, 12},
+        {"start_z", FT_FP32, 20},
+        {"start_z_units", FT_UINT8, 24},
+        {"end_lat", FT_FP64, 25},
+        {"end_lon", FT_FP64, 33},
+        {"end_z", FT_FP32, 41},
+        {"end_z_units", FT_UINT8, 45},
+        {"speed", FT_FP32, 46},
+        {"speed_units", FT_UINT8, 50},
+        {"lradius", FT_FP32, 51},
+        {"flags", FT_UINT8, 55},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 49);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"x", FT_FP64, 0},
+        {"y", FT_FP64, 8},
+        {"z", FT_FP64, 16},
+        {"k", FT_FP64, 24},
+        {"m", FT_FP64, 32},
+        {"n", FT_FP64, 40},
+        {"flags", FT_UINT8, 48},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredHeadingRateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredHeadingRateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredVelocityView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 49);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredVelocityView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"u", FT_FP64, 0},
+        {"v", FT_FP64, 8},
+        {"w", FT_FP64, 16},
+        {"p", FT_FP64, 24},
+        {"q", FT_FP64, 32},
+        {"r", FT_FP64, 40},
+        {"flags", FT_UINT8, 48},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PathControlStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 81);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PathControlStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"path_ref", FT_UINT32, 0},
+        {"start_lat", FT_FP64, 4},
+        {"start_lon", FT_FP64, 12},
+        {"start_z", FT_FP32, 20},
+        {"start_z_units", FT_UINT8, 24},
+        {"end_lat", FT_FP64, 25},
+        {"end_lon", FT_FP64, 33},
+        {"end_z", FT_FP32, 41},
+        {"end_z_units", FT_UINT8, 45},
+        {"lradius", FT_FP32, 46},
+        {"flags", FT_UINT8, 50},
+        {"x", FT_FP32, 51},
+        {"y", FT_FP32, 55},
+        {"z", FT_FP32, 59},
+        {"vx", FT_FP32, 63},
+        {"vy", FT_FP32, 67},
+        {"vz", FT_FP32, 71},
+        {"course_error", FT_FP32, 75},
+        {"eta", FT_UINT16, 79},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AllocatedControlTorquesView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 24);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AllocatedControlTorquesView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"k", FT_FP64, 0},
+        {"m", FT_FP64, 8},
+        {"n", FT_FP64, 16},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ControlParcelView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 16);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ControlParcelView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"p", FT_FP32, 0},
+        {"i", FT_FP32, 4},
+        {"d", FT_FP32, 8},
+        {"a", FT_FP32, 12},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    BrakeView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    BrakeView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredLinearStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 74);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredLinearStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"x", FT_FP64, 0},
+        {"y", FT_FP64, 8},
+        {"z", FT_FP64, 16},
+        {"vx", FT_FP64, 24},
+        {"vy", FT_FP64, 32},
+        {"vz", FT_FP64, 40},
+        {"ax", FT_FP64, 48},
+        {"ay", FT_FP64, 56},
+        {"az", FT_FP64, 64},
+        {"flags", FT_UINT16, 72},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DesiredThrottleView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 8);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DesiredThrottleView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP64, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GotoView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 52);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GotoView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"speed", FT_FP32, 23},
+        {"speed_units", FT_UINT8, 27},
+        {"roll", FT_FP64, 28},
+        {"pitch", FT_FP64, 36},
+        {"yaw", FT_FP64, 44},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PopUpView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 35);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PopUpView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"speed", FT_FP32, 23},
+        {"speed_units", FT_UINT8, 27},
+        {"duration", FT_UINT16, 28},
+        {"radius", FT_FP32, 30},
+        {"flags", FT_UINT8, 34},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TeleoperationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TeleoperationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LoiterView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 48);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LoiterView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"duration", FT_UINT16, 23},
+        {"speed", FT_FP32, 25},
+        {"speed_units", FT_UINT8, 29},
+        {"type", FT_UINT8, 30},
+        {"radius", FT_FP32, 31},
+        {"length", FT_FP32, 35},
+        {"bearing", FT_FP64, 39},
+        {"direction", FT_UINT8, 47},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    IdleManeuverView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    IdleManeuverView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"duration", FT_UINT16, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LowLevelControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LowLevelControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LowLevelControlView::duration(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    DataView
+    LowLevelControlView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    RowsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 59);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RowsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"speed", FT_FP32, 23},
+        {"speed_units", FT_UINT8, 27},
+        {"bearing", FT_FP64, 28},
+        {"cross_angle", FT_FP64, 36},
+        {"width", FT_FP32, 44},
+        {"length", FT_FP32, 48},
+        {"hstep", FT_FP32, 52},
+        {"coff", FT_UINT8, 56},
+        {"alternation", FT_UINT8, 57},
+        {"flags", FT_UINT8, 58},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PathPointView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PathPointView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"x", FT_FP32, 0},
+        {"y", FT_FP32, 4},
+        {"z", FT_FP32, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FollowPathView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 28);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FollowPathView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"speed", FT_FP32, 23},
+        {"speed_units", FT_UINT8, 27},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    FollowPathView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 28;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    YoYoView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 36);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    YoYoView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"amplitude", FT_FP32, 23},
+        {"pitch", FT_FP32, 27},
+        {"speed", FT_FP32, 31},
+        {"speed_units", FT_UINT8, 35},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TeleoperationDoneView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    TeleoperationDoneView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    StationKeepingView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 32);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    StationKeepingView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"z", FT_FP32, 16},
+        {"z_units", FT_UINT8, 20},
+        {"radius", FT_FP32, 21},
+        {"duration", FT_UINT16, 25},
+        {"speed", FT_FP32, 27},
+        {"speed_units", FT_UINT8, 31},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ElevatorView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 38);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ElevatorView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"flags", FT_UINT8, 2},
+        {"lat", FT_FP64, 3},
+        {"lon", FT_FP64, 11},
+        {"start_z", FT_FP32, 19},
+        {"start_z_units", FT_UINT8, 23},
+        {"end_z", FT_FP32, 24},
+        {"end_z_units", FT_UINT8, 28},
+        {"radius", FT_FP32, 29},
+        {"speed", FT_FP32, 33},
+        {"speed_units", FT_UINT8, 37},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TrajectoryPointView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 16);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TrajectoryPointView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"x", FT_FP32, 0},
+        {"y", FT_FP32, 4},
+        {"z", FT_FP32, 8},
+        {"t", FT_FP32, 12},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FollowTrajectoryView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 28);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FollowTrajectoryView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"speed", FT_FP32, 23},
+        {"speed_units", FT_UINT8, 27},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    FollowTrajectoryView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 28;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    CustomManeuverView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CustomManeuverView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    CustomManeuverView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    VehicleFormationParticipantView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 14);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VehicleFormationParticipantView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"vid", FT_UINT16, 0},
+        {"off_x", FT_FP32, 2},
+        {"off_y", FT_FP32, 6},
+        {"off_z", FT_FP32, 10},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VehicleFormationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 26);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 8);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VehicleFormationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"z", FT_FP32, 16},
+        {"z_units", FT_UINT8, 20},
+        {"speed", FT_FP32, 21},
+        {"speed_units", FT_UINT8, 25},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageListView
+    VehicleFormationView::participants(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 26;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    fp64_t
+    VehicleFormationView::start_time(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 26;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    DataView
+    VehicleFormationView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 26;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    StopManeuverView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    StopManeuverView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    RegisterManeuverView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RegisterManeuverView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"mid", FT_UINT16, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ManeuverControlStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 3);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ManeuverControlStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"state", FT_UINT8, 0},
+        {"eta", FT_UINT16, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FollowSystemView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 22);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FollowSystemView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"system", FT_UINT16, 0},
+        {"duration", FT_UINT16, 2},
+        {"speed", FT_FP32, 4},
+        {"speed_units", FT_UINT8, 8},
+        {"x", FT_FP32, 9},
+        {"y", FT_FP32, 13},
+        {"z", FT_FP32, 17},
+        {"z_units", FT_UINT8, 21},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CommsRelayView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 31);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CommsRelayView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"speed", FT_FP32, 16},
+        {"speed_units", FT_UINT8, 20},
+        {"duration", FT_UINT16, 21},
+        {"sys_a", FT_UINT16, 23},
+        {"sys_b", FT_UINT16, 25},
+        {"move_threshold", FT_FP32, 27},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PolygonVertexView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 16);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PolygonVertexView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CoverAreaView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 26);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CoverAreaView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"z", FT_FP32, 16},
+        {"z_units", FT_UINT8, 20},
+        {"speed", FT_FP32, 21},
+        {"speed_units", FT_UINT8, 25},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    CoverAreaView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 26;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    CompassCalibrationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 43);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CompassCalibrationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"pitch", FT_FP32, 23},
+        {"amplitude", FT_FP32, 27},
+        {"duration", FT_UINT16, 31},
+        {"speed", FT_FP32, 33},
+        {"speed_units", FT_UINT8, 37},
+        {"radius", FT_FP32, 38},
+        {"direction", FT_UINT8, 42},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FormationParametersView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormationParametersView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    FormationParametersView::reference_frame(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    MessageListView
+    FormationParametersView::participants(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return readList(ptr__);
+    }
+
+    DataView
+    FormationParametersView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    FormationPlanExecutionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 30);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormationPlanExecutionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    FormationPlanExecutionView::formation_name(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    FormationPlanExecutionView::plan_id(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    FormationPlanExecutionView::description(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    fp32_t
+    FormationPlanExecutionView::leader_speed(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationPlanExecutionView::leader_bank_lim(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationPlanExecutionView::pos_sim_err_lim(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationPlanExecutionView::pos_sim_err_wrn(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 12;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    FormationPlanExecutionView::pos_sim_err_timeout(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<uint16_t>(ptr__);
+    }
+
+    fp32_t
+    FormationPlanExecutionView::converg_max(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 18;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    FormationPlanExecutionView::converg_timeout(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 22;
+      return read<uint16_t>(ptr__);
+    }
+
+    uint16_t
+    FormationPlanExecutionView::comms_timeout(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 24;
+      return read<uint16_t>(ptr__);
+    }
+
+    fp32_t
+    FormationPlanExecutionView::turb_lim(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 26;
+      return read<fp32_t>(ptr__);
+    }
+
+    DataView
+    FormationPlanExecutionView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 30;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    FollowReferenceView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 15);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FollowReferenceView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"control_src", FT_UINT16, 0},
+        {"control_ent", FT_UINT8, 2},
+        {"timeout", FT_FP32, 3},
+        {"loiter_radius", FT_FP32, 7},
+        {"altitude_interval", FT_FP32, 11},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ReferenceView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 20);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ReferenceView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"flags", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DesiredSpeedView
+    ReferenceView::speed(void) const
+    {
+      return DesiredSpeedView(readInline(getPayload() + 1));
+    }
+
+    DesiredZView
+    ReferenceView::z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return DesiredZView(readInline(ptr__));
+    }
+
+    fp64_t
+    ReferenceView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    ReferenceView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp32_t
+    ReferenceView::radius(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    FollowRefStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 3);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FollowRefStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"control_src", FT_UINT16, 0},
+        {"control_ent", FT_UINT8, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    ReferenceView
+    FollowRefStateView::reference(void) const
+    {
+      return ReferenceView(readInline(getPayload() + 3));
+    }
+
+    uint8_t
+    FollowRefStateView::state(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 3;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    FollowRefStateView::proximity(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 3;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    RelativeStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 84);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RelativeStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp32_t
+    RelativeStateView::dist(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::err(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::ctrl_imp(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rel_dir_x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 12;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rel_dir_y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rel_dir_z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 20;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::err_x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 24;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::err_y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 28;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::err_z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 32;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rf_err_x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 36;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rf_err_y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 40;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rf_err_z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 44;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rf_err_vx(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 48;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rf_err_vy(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 52;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::rf_err_vz(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 56;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::ss_x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 60;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::ss_y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 64;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::ss_z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 68;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::virt_err_x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 72;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::virt_err_y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 76;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RelativeStateView::virt_err_z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 80;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    FormationMonitorView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 72);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormationMonitorView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"ax_cmd", FT_FP32, 0},
+        {"ay_cmd", FT_FP32, 4},
+        {"az_cmd", FT_FP32, 8},
+        {"ax_des", FT_FP32, 12},
+        {"ay_des", FT_FP32, 16},
+        {"az_des", FT_FP32, 20},
+        {"virt_err_x", FT_FP32, 24},
+        {"virt_err_y", FT_FP32, 28},
+        {"virt_err_z", FT_FP32, 32},
+        {"surf_fdbk_x", FT_FP32, 36},
+        {"surf_fdbk_y", FT_FP32, 40},
+        {"surf_fdbk_z", FT_FP32, 44},
+        {"surf_unkn_x", FT_FP32, 48},
+        {"surf_unkn_y", FT_FP32, 52},
+        {"surf_unkn_z", FT_FP32, 56},
+        {"ss_x", FT_FP32, 60},
+        {"ss_y", FT_FP32, 64},
+        {"ss_z", FT_FP32, 68},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DislodgeView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 7);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DislodgeView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"rpm", FT_FP32, 2},
+        {"direction", FT_UINT8, 6},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FormationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 42);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    FormationView::type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    FormationView::op(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    FormationView::group_name(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return readData(ptr__);
+    }
+
+    DataView
+    FormationView::plan_id(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    FormationView::description(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint8_t
+    FormationView::reference_frame(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    MessageListView
+    FormationView::participants(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return readList(ptr__);
+    }
+
+    fp32_t
+    FormationView::leader_bank_lim(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationView::leader_speed_min(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationView::leader_speed_max(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationView::leader_alt_min(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 12;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationView::leader_alt_max(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationView::pos_sim_err_lim(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 20;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    FormationView::pos_sim_err_wrn(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 24;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    FormationView::pos_sim_err_timeout(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 28;
+      return read<uint16_t>(ptr__);
+    }
+
+    fp32_t
+    FormationView::converg_max(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 30;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    FormationView::converg_timeout(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 34;
+      return read<uint16_t>(ptr__);
+    }
+
+    uint16_t
+    FormationView::comms_timeout(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 36;
+      return read<uint16_t>(ptr__);
+    }
+
+    fp32_t
+    FormationView::turb_lim(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 38;
+      return read<fp32_t>(ptr__);
+    }
+
+    DataView
+    FormationView::custom(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ += 42;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    LaunchView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 28);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LaunchView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"speed", FT_FP32, 23},
+        {"speed_units", FT_UINT8, 27},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DropView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 28);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DropView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"speed", FT_FP32, 23},
+        {"speed_units", FT_UINT8, 27},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ScheduledGotoView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 35);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ScheduledGotoView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"arrival_time", FT_FP64, 0},
+        {"lat", FT_FP64, 8},
+        {"lon", FT_FP64, 16},
+        {"z", FT_FP32, 24},
+        {"z_units", FT_UINT8, 28},
+        {"travel_z", FT_FP32, 29},
+        {"travel_z_units", FT_UINT8, 33},
+        {"delayed", FT_UINT8, 34},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    RowsCoverageView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 59);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RowsCoverageView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"z", FT_FP32, 16},
+        {"z_units", FT_UINT8, 20},
+        {"speed", FT_FP32, 21},
+        {"speed_units", FT_UINT8, 25},
+        {"bearing", FT_FP64, 26},
+        {"cross_angle", FT_FP64, 34},
+        {"width", FT_FP32, 42},
+        {"length", FT_FP32, 46},
+        {"coff", FT_UINT8, 50},
+        {"angAperture", FT_FP32, 51},
+        {"range", FT_UINT16, 55},
+        {"overlap", FT_UINT8, 57},
+        {"flags", FT_UINT8, 58},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SampleView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 31);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SampleView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z", FT_FP32, 18},
+        {"z_units", FT_UINT8, 22},
+        {"speed", FT_FP32, 23},
+        {"speed_units", FT_UINT8, 27},
+        {"syringe0", FT_UINT8, 28},
+        {"syringe1", FT_UINT8, 29},
+        {"syringe2", FT_UINT8, 30},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ImageTrackingView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    ImageTrackingView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TakeoffView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 30);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TakeoffView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"z", FT_FP32, 16},
+        {"z_units", FT_UINT8, 20},
+        {"speed", FT_FP32, 21},
+        {"speed_units", FT_UINT8, 25},
+        {"takeoff_pitch", FT_FP32, 26},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    LandView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 43);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LandView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"z", FT_FP32, 16},
+        {"z_units", FT_UINT8, 20},
+        {"speed", FT_FP32, 21},
+        {"speed_units", FT_UINT8, 25},
+        {"abort_z", FT_FP32, 26},
+        {"bearing", FT_FP64, 30},
+        {"glide_slope", FT_UINT8, 38},
+        {"glide_slope_alt", FT_FP32, 39},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VehicleStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 17);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 8);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VehicleStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op_mode", FT_UINT8, 0},
+        {"error_count", FT_UINT8, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VehicleStateView::maneuver_type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    fp64_t
+    VehicleStateView::maneuver_stime(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return read<fp64_t>(ptr__);
+    }
+
+    uint16_t
+    VehicleStateView::maneuver_eta(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 10;
+      return read<uint16_t>(ptr__);
+    }
+
+    uint32_t
+    VehicleStateView::control_loops(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 12;
+      return read<uint32_t>(ptr__);
+    }
+
+    uint8_t
+    VehicleStateView::flags(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    VehicleStateView::last_error(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 17;
+      return readData(ptr__);
+    }
+
+    fp64_t
+    VehicleStateView::last_error_time(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 17;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    uint16_t
+    VehicleCommandView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VehicleCommandView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"request_id", FT_UINT16, 1},
+        {"command", FT_UINT8, 3},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VehicleCommandView::calib_time(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    DataView
+    VehicleCommandView::info(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    MonitorEntityStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    MonitorEntityStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"command", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    EntityMonitoringStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 8);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EntityMonitoringStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"mcount", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    EntityMonitoringStateView::ecount(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    EntityMonitoringStateView::enames(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return readData(ptr__);
+    }
+
+    uint8_t
+    EntityMonitoringStateView::ccount(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    EntityMonitoringStateView::cnames(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return readData(ptr__);
+    }
+
+    DataView
+    EntityMonitoringStateView::last_error(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    fp64_t
+    EntityMonitoringStateView::last_error_time(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    uint16_t
+    OperationalLimitsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 53);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    OperationalLimitsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"mask", FT_UINT8, 0},
+        {"max_depth", FT_FP32, 1},
+        {"min_altitude", FT_FP32, 5},
+        {"max_altitude", FT_FP32, 9},
+        {"min_speed", FT_FP32, 13},
+        {"max_speed", FT_FP32, 17},
+        {"max_vrate", FT_FP32, 21},
+        {"lat", FT_FP64, 25},
+        {"lon", FT_FP64, 33},
+        {"orientation", FT_FP32, 41},
+        {"width", FT_FP32, 45},
+        {"length", FT_FP32, 49},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GetOperationalLimitsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    GetOperationalLimitsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CalibrationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CalibrationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"duration", FT_UINT16, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ControlLoopsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 9);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ControlLoopsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"enable", FT_UINT8, 0},
+        {"mask", FT_UINT32, 1},
+        {"scope_ref", FT_UINT32, 5},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    VehicleMediumView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VehicleMediumView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"medium", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CollisionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CollisionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {"type", FT_UINT8, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FormStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 15);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"PosSimErr", FT_FP32, 0},
+        {"Converg", FT_FP32, 4},
+        {"Turbulence", FT_FP32, 8},
+        {"PosSimMon", FT_UINT8, 12},
+        {"CommMon", FT_UINT8, 13},
+        {"ConvergMon", FT_UINT8, 14},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AutopilotModeView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    AutopilotModeView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"autonomy", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FormationStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 17);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormationStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"op", FT_UINT8, 1},
+        {"PosSimErr", FT_FP32, 2},
+        {"Converg", FT_FP32, 6},
+        {"Turbulence", FT_FP32, 10},
+        {"PosSimMon", FT_UINT8, 14},
+        {"CommMon", FT_UINT8, 15},
+        {"ConvergMon", FT_UINT8, 16},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ReportControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ReportControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {"comm_interface", FT_UINT8, 1},
+        {"period", FT_UINT16, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    AbortView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    AbortView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PlanVariableView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanVariableView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    PlanVariableView::value(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint8_t
+    PlanVariableView::type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    PlanVariableView::access(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    PlanManeuverView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanManeuverView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageView
+    PlanManeuverView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readInline(ptr__);
+    }
+
+    MessageListView
+    PlanManeuverView::start_actions(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    MessageListView
+    PlanManeuverView::end_actions(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    PlanTransitionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanTransitionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    PlanTransitionView::dest_man(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    PlanTransitionView::conditions(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    MessageListView
+    PlanTransitionView::actions(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    PlanSpecificationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanSpecificationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    PlanSpecificationView::description(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    PlanSpecificationView::vnamespace(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    MessageListView
+    PlanSpecificationView::variables(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    DataView
+    PlanSpecificationView::start_man_id(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    MessageListView
+    PlanSpecificationView::maneuvers(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    MessageListView
+    PlanSpecificationView::transitions(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    MessageListView
+    PlanSpecificationView::start_actions(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    MessageListView
+    PlanSpecificationView::end_actions(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      ptr__ = skipList(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    EmergencyControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EmergencyControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"command", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    PlanSpecificationView
+    EmergencyControlView::plan(void) const
+    {
+      return PlanSpecificationView(readInline(getPayload() + 1));
+    }
+
+    uint16_t
+    EmergencyControlStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EmergencyControlStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"state", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    EmergencyControlStateView::comm_level(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    PlanDBView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanDBView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"op", FT_UINT8, 1},
+        {"request_id", FT_UINT16, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageView
+    PlanDBView::arg(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readInline(ptr__);
+    }
+
+    DataView
+    PlanDBView::info(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    PlanDBInformationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 12);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanDBInformationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PlanDBInformationView::plan_size(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    fp64_t
+    PlanDBInformationView::change_time(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return read<fp64_t>(ptr__);
+    }
+
+    uint16_t
+    PlanDBInformationView::change_sid(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 10;
+      return read<uint16_t>(ptr__);
+    }
+
+    DataView
+    PlanDBInformationView::change_sname(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 12;
+      return readData(ptr__);
+    }
+
+    DataView
+    PlanDBInformationView::md5(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 12;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    PlanDBStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 16);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanDBStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"plan_count", FT_UINT16, 0},
+        {"plan_size", FT_UINT32, 2},
+        {"change_time", FT_FP64, 6},
+        {"change_sid", FT_UINT16, 14},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    PlanDBStateView::md5(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 16;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    MessageListView
+    PlanDBStateView::plans_info(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 16;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    PlanControlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanControlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"op", FT_UINT8, 1},
+        {"request_id", FT_UINT16, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PlanControlView::flags(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    MessageView
+    PlanControlView::arg(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return readInline(ptr__);
+    }
+
+    DataView
+    PlanControlView::info(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 4;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipInline(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    PlanControlStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 8);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 7);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanControlStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"state", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    int32_t
+    PlanControlStateView::plan_eta(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<int32_t>(ptr__);
+    }
+
+    fp32_t
+    PlanControlStateView::plan_progress(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return read<fp32_t>(ptr__);
+    }
+
+    DataView
+    PlanControlStateView::man_id(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    PlanControlStateView::man_type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint16_t>(ptr__);
+    }
+
+    int32_t
+    PlanControlStateView::man_eta(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return read<int32_t>(ptr__);
+    }
+
+    uint8_t
+    PlanControlStateView::last_outcome(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 6;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    PlanGenerationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanGenerationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"cmd", FT_UINT8, 0},
+        {"op", FT_UINT8, 1},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    PlanGenerationView::params(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    LeaderStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 81);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    LeaderStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    LeaderStateView::op(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    fp64_t
+    LeaderStateView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    LeaderStateView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 9;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::height(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 17;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 21;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 25;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 29;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::phi(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 33;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::theta(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 37;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::psi(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 41;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::vx(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 45;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::vy(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 49;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::vz(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 53;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::p(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 57;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::q(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 61;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::r(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 65;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::svx(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 69;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::svy(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 73;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    LeaderStateView::svz(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 77;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    PlanStatisticsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PlanStatisticsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    PlanStatisticsView::type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    PlanStatisticsView::properties(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    PlanStatisticsView::durations(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return readData(ptr__);
+    }
+
+    DataView
+    PlanStatisticsView::distances(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    PlanStatisticsView::actions(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    PlanStatisticsView::fuel(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    ReportedStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 56);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ReportedStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"depth", FT_FP64, 16},
+        {"roll", FT_FP64, 24},
+        {"pitch", FT_FP64, 32},
+        {"yaw", FT_FP64, 40},
+        {"rcp_time", FT_FP64, 48},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    ReportedStateView::s_type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 56;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    RemoteSensorInfoView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 24);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RemoteSensorInfoView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    RemoteSensorInfoView::sensor_class(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    fp64_t
+    RemoteSensorInfoView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    RemoteSensorInfoView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp32_t
+    RemoteSensorInfoView::alt(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    RemoteSensorInfoView::heading(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 20;
+      return read<fp32_t>(ptr__);
+    }
+
+    DataView
+    RemoteSensorInfoView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 24;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    MapPointView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 20);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    MapPointView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP64, 0},
+        {"lon", FT_FP64, 8},
+        {"alt", FT_FP32, 16},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    MapFeatureView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    MapFeatureView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    MapFeatureView::feature_type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    MapFeatureView::rgb_red(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    MapFeatureView::rgb_green(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 2;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint8_t
+    MapFeatureView::rgb_blue(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 3;
+      return read<uint8_t>(ptr__);
+    }
+
+    MessageListView
+    MapFeatureView::feature(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return readList(ptr__);
+    }
+
+    uint16_t
+    MapView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    MapView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageListView
+    MapView::features(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    CcuEventView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CcuEventView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageView
+    CcuEventView::arg(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readInline(ptr__);
+    }
+
+    uint16_t
+    VehicleLinksView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    VehicleLinksView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageListView
+    VehicleLinksView::links(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    TrexObservationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TrexObservationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    TrexObservationView::predicate(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    TrexObservationView::attributes(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    TrexCommandView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TrexCommandView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"command", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    TrexCommandView::goal_xml(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    TrexAttributeView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TrexAttributeView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    TrexAttributeView::attr_type(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    TrexAttributeView::min(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return readData(ptr__);
+    }
+
+    DataView
+    TrexAttributeView::max(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    TrexTokenView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TrexTokenView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    TrexTokenView::predicate(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    MessageListView
+    TrexTokenView::attributes(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    TrexOperationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TrexOperationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    TrexTokenView
+    TrexOperationView::token(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 1;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return TrexTokenView(readInline(ptr__));
+    }
+
+    uint16_t
+    TrexPlanView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TrexPlanView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageListView
+    TrexPlanView::tokens(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    EventView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EventView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    EventView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    CompressedImageView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CompressedImageView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"frameid", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ImageTxSettingsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ImageTxSettingsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"fps", FT_UINT8, 0},
+        {"quality", FT_UINT8, 1},
+        {"reps", FT_UINT8, 2},
+        {"tsize", FT_UINT8, 3},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    RemoteStateView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 17);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    RemoteStateView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"lat", FT_FP32, 0},
+        {"lon", FT_FP32, 4},
+        {"depth", FT_UINT8, 8},
+        {"speed", FT_FP32, 9},
+        {"psi", FT_FP32, 13},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    TargetView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 29);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    TargetView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp64_t
+    TargetView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    TargetView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp32_t
+    TargetView::z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint8_t
+    TargetView::z_units(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 20;
+      return read<uint8_t>(ptr__);
+    }
+
+    fp32_t
+    TargetView::cog(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 21;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    TargetView::sog(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 25;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    EntityParameterView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EntityParameterView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    EntityParameterView::value(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    EntityParametersView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    EntityParametersView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageListView
+    EntityParametersView::params(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    QueryEntityParametersView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    QueryEntityParametersView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    QueryEntityParametersView::visibility(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    DataView
+    QueryEntityParametersView::scope(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    SetEntityParametersView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SetEntityParametersView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    MessageListView
+    SetEntityParametersView::params(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readList(ptr__);
+    }
+
+    uint16_t
+    SaveEntityParametersView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SaveEntityParametersView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CreateSessionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CreateSessionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"timeout", FT_UINT32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    CloseSessionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    CloseSessionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"sessid", FT_UINT32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SessionSubscriptionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SessionSubscriptionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"sessid", FT_UINT32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SessionKeepAliveView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SessionKeepAliveView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"sessid", FT_UINT32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SessionStatusView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SessionStatusView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"sessid", FT_UINT32, 0},
+        {"status", FT_UINT8, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PushEntityParametersView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PushEntityParametersView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    PopEntityParametersView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    PopEntityParametersView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    IoEventView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    IoEventView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    UamTxFrameView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UamTxFrameView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"seq", FT_UINT16, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint8_t
+    UamTxFrameView::flags(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    UamTxFrameView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    UamRxFrameView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UamRxFrameView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    UamRxFrameView::sys_dst(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint8_t
+    UamRxFrameView::flags(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<uint8_t>(ptr__);
+    }
+
+    DataView
+    UamRxFrameView::data(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 1;
+      return readData(ptr__);
+    }
+
+    uint16_t
+    UamTxStatusView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 3);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UamTxStatusView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"seq", FT_UINT16, 0},
+        {"value", FT_UINT8, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    UamRxRangeView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 2);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 4);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UamRxRangeView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"seq", FT_UINT16, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp32_t
+    UamRxRangeView::value(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ += 2;
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    FormCtrlParamView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 21);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormCtrlParamView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"Action", FT_UINT8, 0},
+        {"LonGain", FT_FP32, 1},
+        {"LatGain", FT_FP32, 5},
+        {"BondThick", FT_UINT32, 9},
+        {"LeadGain", FT_FP32, 13},
+        {"DeconflGain", FT_FP32, 17},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FormationEvalView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 12);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormationEvalView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"err_mean", FT_FP32, 0},
+        {"dist_min_abs", FT_FP32, 4},
+        {"dist_min_mean", FT_FP32, 8},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FormationControlParamsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 41);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormationControlParamsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"Action", FT_UINT8, 0},
+        {"lon_gain", FT_FP32, 1},
+        {"lat_gain", FT_FP32, 5},
+        {"bond_thick", FT_FP32, 9},
+        {"lead_gain", FT_FP32, 13},
+        {"deconfl_gain", FT_FP32, 17},
+        {"accel_switch_gain", FT_FP32, 21},
+        {"safe_dist", FT_FP32, 25},
+        {"deconflict_offset", FT_FP32, 29},
+        {"accel_safe_margin", FT_FP32, 33},
+        {"accel_lim_x", FT_FP32, 37},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    FormationEvaluationView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 22);
+      ptr__ = skipInline(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    FormationEvaluationView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"type", FT_UINT8, 0},
+        {"op", FT_UINT8, 1},
+        {"err_mean", FT_FP32, 2},
+        {"dist_min_abs", FT_FP32, 6},
+        {"dist_min_mean", FT_FP32, 10},
+        {"roll_rate_mean", FT_FP32, 14},
+        {"time", FT_FP32, 18},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    FormationControlParamsView
+    FormationEvaluationView::controlparams(void) const
+    {
+      return FormationControlParamsView(readInline(getPayload() + 22));
+    }
+
+    uint16_t
+    MessagePartView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 3);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    MessagePartView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"uid", FT_UINT8, 0},
+        {"frag_number", FT_UINT8, 1},
+        {"num_frags", FT_UINT8, 2},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    NeptusBlobView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    NeptusBlobView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    NeptusBlobView::content(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    AbortedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    AbortedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    UsblAnglesView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 10);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UsblAnglesView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"target", FT_UINT16, 0},
+        {"bearing", FT_FP32, 2},
+        {"elevation", FT_FP32, 6},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    UsblPositionView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 14);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UsblPositionView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"target", FT_UINT16, 0},
+        {"x", FT_FP32, 2},
+        {"y", FT_FP32, 6},
+        {"z", FT_FP32, 10},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    UsblFixView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 23);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UsblFixView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"target", FT_UINT16, 0},
+        {"lat", FT_FP64, 2},
+        {"lon", FT_FP64, 10},
+        {"z_units", FT_UINT8, 18},
+        {"z", FT_FP32, 19},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    ParametersXmlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skipData(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    ParametersXmlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    DataView
+    ParametersXmlView::config(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return readData(ptr__);
+    }
+
+    uint16_t
+    GetParametersXmlView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      (void)bfr__;
+      (void)size__;
+      (void)reversed__;
+      return 0;
+    }
+
+    const MessageView::Field*
+    GetParametersXmlView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    SetImageCoordsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    SetImageCoordsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"camId", FT_UINT8, 0},
+        {"x", FT_UINT16, 1},
+        {"y", FT_UINT16, 3},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GetImageCoordsView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GetImageCoordsView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"camId", FT_UINT8, 0},
+        {"x", FT_UINT16, 1},
+        {"y", FT_UINT16, 3},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    GetWorldCoordinatesView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 29);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    GetWorldCoordinatesView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"tracking", FT_UINT8, 0},
+        {"lat", FT_FP64, 1},
+        {"lon", FT_FP64, 9},
+        {"x", FT_FP32, 17},
+        {"y", FT_FP32, 21},
+        {"z", FT_FP32, 25},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    UsblAnglesExtendedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 32);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UsblAnglesExtendedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp32_t
+    UsblAnglesExtendedView::lbearing(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblAnglesExtendedView::lelevation(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblAnglesExtendedView::bearing(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblAnglesExtendedView::elevation(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 12;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblAnglesExtendedView::phi(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblAnglesExtendedView::theta(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 20;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblAnglesExtendedView::psi(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 24;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblAnglesExtendedView::accuracy(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 28;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    UsblPositionExtendedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 40);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UsblPositionExtendedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp32_t
+    UsblPositionExtendedView::x(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::y(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 4;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::n(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 12;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::e(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::d(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 20;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::phi(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 24;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::theta(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 28;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::psi(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 32;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblPositionExtendedView::accuracy(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 36;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    UsblFixExtendedView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 25);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UsblFixExtendedView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp64_t
+    UsblFixExtendedView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    UsblFixExtendedView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp64_t>(ptr__);
+    }
+
+    uint8_t
+    UsblFixExtendedView::z_units(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<uint8_t>(ptr__);
+    }
+
+    fp32_t
+    UsblFixExtendedView::z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 17;
+      return read<fp32_t>(ptr__);
+    }
+
+    fp32_t
+    UsblFixExtendedView::accuracy(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 21;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint16_t
+    UsblModemView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skipData(ptr__, end__, reversed__);
+      ptr__ = skip(ptr__, end__, 21);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UsblModemView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    fp64_t
+    UsblModemView::lat(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      return read<fp64_t>(ptr__);
+    }
+
+    fp64_t
+    UsblModemView::lon(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 8;
+      return read<fp64_t>(ptr__);
+    }
+
+    fp32_t
+    UsblModemView::z(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 16;
+      return read<fp32_t>(ptr__);
+    }
+
+    uint8_t
+    UsblModemView::z_units(void) const
+    {
+      const uint8_t* ptr__ = getPayload();
+      const uint8_t* end__ = getPayloadEnd();
+      ptr__ = skipData(ptr__, end__, isReversed());
+      ptr__ += 20;
+      return read<uint8_t>(ptr__);
+    }
+
+    uint16_t
+    UsblConfigView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 1);
+      ptr__ = skipList(ptr__, end__, reversed__);
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    UsblConfigView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"op", FT_UINT8, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    DissolvedOrganicMatterView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 5);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    DissolvedOrganicMatterView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {"type", FT_UINT8, 4},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+
+    uint16_t
+    OpticalBackscatterView::measure(const uint8_t* bfr__, unsigned size__, bool reversed__)
+    {
+      const uint8_t* ptr__ = bfr__;
+      const uint8_t* end__ = bfr__ + size__;
+      ptr__ = skip(ptr__, end__, 4);
+      (void)reversed__;
+      return ptr__ - bfr__;
+    }
+
+    const MessageView::Field*
+    OpticalBackscatterView::getFieldsStatic(void)
+    {
+      static const Field fields__[] =
+      {
+        {"value", FT_FP32, 0},
+        {NULL, FT_UINT8, 0}
+      };
+      return fields__;
+    }
+  }
+}
@@ -0,0 +1,20744 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Automatically generated.                                                 *
+//***************************************************************************
+// IMC XML MD5: 4606c32356d598296311edecb407d6c1                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_VIEWS_HPP_INCLUDED_
+#define DUNE_IMC_VIEWS_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/MessageView.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Read-only view of Entity State.
+    class EntityStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EntityStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EntityStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EntityStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 1;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EntityState*
+      toMessage(void) const
+      {
+        return static_cast<EntityState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! State.
+      uint8_t
+      state(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Complementary description.
+      DataView
+      description(void) const
+      {
+        return readData(getPayload() + 2);
+      }
+    };
+
+    //! Read-only view of Query Entity State.
+    class QueryEntityStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      QueryEntityStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      QueryEntityStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      QueryEntityStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 2;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      QueryEntityState*
+      toMessage(void) const
+      {
+        return static_cast<QueryEntityState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Entity Information.
+    class EntityInfoView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EntityInfoView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EntityInfoView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EntityInfoView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 3;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      EntityInfo*
+      toMessage(void) const
+      {
+        return static_cast<EntityInfo*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entity Identifier.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Label.
+      DataView
+      label(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Component name.
+      DataView
+      component(void) const;
+
+      //! Activation Time.
+      uint16_t
+      act_time(void) const;
+
+      //! Deactivation Time.
+      uint16_t
+      deact_time(void) const;
+    };
+
+    //! Read-only view of Query Entity Information.
+    class QueryEntityInfoView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      QueryEntityInfoView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      QueryEntityInfoView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      QueryEntityInfoView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 4;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      QueryEntityInfo*
+      toMessage(void) const
+      {
+        return static_cast<QueryEntityInfo*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entity Identifier.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Entity List.
+    class EntityListView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EntityListView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EntityListView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EntityListView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 5;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EntityList*
+      toMessage(void) const
+      {
+        return static_cast<EntityList*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! list.
+      DataView
+      list(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of CPU Usage.
+    class CpuUsageView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CpuUsageView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CpuUsageView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CpuUsageView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 7;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CpuUsage*
+      toMessage(void) const
+      {
+        return static_cast<CpuUsage*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Usage percentage.
+      uint8_t
+      value(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Transport Bindings.
+    class TransportBindingsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TransportBindingsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TransportBindingsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TransportBindingsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 8;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TransportBindings*
+      toMessage(void) const
+      {
+        return static_cast<TransportBindings*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Consumer name.
+      DataView
+      consumer(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Message Identifier.
+      uint16_t
+      message_id(void) const;
+    };
+
+    //! Read-only view of Restart System.
+    class RestartSystemView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RestartSystemView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RestartSystemView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RestartSystemView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 9;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RestartSystem*
+      toMessage(void) const
+      {
+        return static_cast<RestartSystem*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Device Calibration Control.
+    class DevCalibrationControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DevCalibrationControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DevCalibrationControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DevCalibrationControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 12;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DevCalibrationControl*
+      toMessage(void) const
+      {
+        return static_cast<DevCalibrationControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Device Calibration State.
+    class DevCalibrationStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DevCalibrationStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DevCalibrationStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DevCalibrationStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 13;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DevCalibrationState*
+      toMessage(void) const
+      {
+        return static_cast<DevCalibrationState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Total Steps.
+      uint8_t
+      total_steps(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Current Step Number.
+      uint8_t
+      step_number(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Description.
+      DataView
+      step(void) const
+      {
+        return readData(getPayload() + 2);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const;
+    };
+
+    //! Read-only view of Entity Activation State.
+    class EntityActivationStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EntityActivationStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EntityActivationStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EntityActivationStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 14;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EntityActivationState*
+      toMessage(void) const
+      {
+        return static_cast<EntityActivationState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! State.
+      uint8_t
+      state(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Error.
+      DataView
+      error(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Query Entity Activation State.
+    class QueryEntityActivationStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      QueryEntityActivationStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      QueryEntityActivationStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      QueryEntityActivationStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 15;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      QueryEntityActivationState*
+      toMessage(void) const
+      {
+        return static_cast<QueryEntityActivationState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Vehicle Operational Limits.
+    class VehicleOperationalLimitsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VehicleOperationalLimitsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VehicleOperationalLimitsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VehicleOperationalLimitsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 16;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VehicleOperationalLimits*
+      toMessage(void) const
+      {
+        return static_cast<VehicleOperationalLimits*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Action on the vehicle operational limits.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Minimum speed.
+      fp32_t
+      speed_min(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+
+      //! Maximum speed.
+      fp32_t
+      speed_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 5);
+      }
+
+      //! Longitudinal maximum acceleration.
+      fp32_t
+      long_accel(void) const
+      {
+        return read<fp32_t>(getPayload() + 9);
+      }
+
+      //! Maximum MSL altitude.
+      fp32_t
+      alt_max_msl(void) const
+      {
+        return read<fp32_t>(getPayload() + 13);
+      }
+
+      //! Maximum Dive Rate Speed Fraction.
+      fp32_t
+      dive_fraction_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 17);
+      }
+
+      //! Maximum Climb Rate Speed Fraction.
+      fp32_t
+      climb_fraction_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Bank limit.
+      fp32_t
+      bank_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 25);
+      }
+
+      //! Bank rate limit.
+      fp32_t
+      p_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 29);
+      }
+
+      //! Minimum pitch angle.
+      fp32_t
+      pitch_min(void) const
+      {
+        return read<fp32_t>(getPayload() + 33);
+      }
+
+      //! Maximum pitch angle.
+      fp32_t
+      pitch_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 37);
+      }
+
+      //! Maximum pitch rate.
+      fp32_t
+      q_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 41);
+      }
+
+      //! Minimum load factor.
+      fp32_t
+      g_min(void) const
+      {
+        return read<fp32_t>(getPayload() + 45);
+      }
+
+      //! Maximum load factor.
+      fp32_t
+      g_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 49);
+      }
+
+      //! Maximum lateral load factor.
+      fp32_t
+      g_lat_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 53);
+      }
+
+      //! Minimum RPMs.
+      fp32_t
+      rpm_min(void) const
+      {
+        return read<fp32_t>(getPayload() + 57);
+      }
+
+      //! Maximum RPMs.
+      fp32_t
+      rpm_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 61);
+      }
+
+      //! Maximum RPM rate.
+      fp32_t
+      rpm_rate_max(void) const
+      {
+        return read<fp32_t>(getPayload() + 65);
+      }
+    };
+
+    //! Read-only view of Message List.
+    class MsgListView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      MsgListView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      MsgListView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      MsgListView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 20;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      MsgList*
+      toMessage(void) const
+      {
+        return static_cast<MsgList*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Messages.
+      MessageListView
+      msgs(void) const
+      {
+        return readList(getPayload());
+      }
+    };
+
+    //! Read-only view of Simulated State.
+    class SimulatedStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SimulatedStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SimulatedStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SimulatedStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 50;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SimulatedState*
+      toMessage(void) const
+      {
+        return static_cast<SimulatedState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude (WGS-84).
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude (WGS-84).
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Height (WGS-84).
+      fp32_t
+      height(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Offset north (m).
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+
+      //! Offset east (m).
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 24);
+      }
+
+      //! Offset down (m).
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 28);
+      }
+
+      //! Rotation over x axis.
+      fp32_t
+      phi(void) const
+      {
+        return read<fp32_t>(getPayload() + 32);
+      }
+
+      //! Rotation over y axis.
+      fp32_t
+      theta(void) const
+      {
+        return read<fp32_t>(getPayload() + 36);
+      }
+
+      //! Rotation over z axis.
+      fp32_t
+      psi(void) const
+      {
+        return read<fp32_t>(getPayload() + 40);
+      }
+
+      //! Body-Fixed xx Linear Velocity.
+      fp32_t
+      u(void) const
+      {
+        return read<fp32_t>(getPayload() + 44);
+      }
+
+      //! Body-Fixed yy Linear Velocity.
+      fp32_t
+      v(void) const
+      {
+        return read<fp32_t>(getPayload() + 48);
+      }
+
+      //! Body-Fixed zz Linear Velocity.
+      fp32_t
+      w(void) const
+      {
+        return read<fp32_t>(getPayload() + 52);
+      }
+
+      //! Angular Velocity in x.
+      fp32_t
+      p(void) const
+      {
+        return read<fp32_t>(getPayload() + 56);
+      }
+
+      //! Angular Velocity in y.
+      fp32_t
+      q(void) const
+      {
+        return read<fp32_t>(getPayload() + 60);
+      }
+
+      //! Angular Velocity in z.
+      fp32_t
+      r(void) const
+      {
+        return read<fp32_t>(getPayload() + 64);
+      }
+
+      //! Stream Velocity X (North).
+      fp32_t
+      svx(void) const
+      {
+        return read<fp32_t>(getPayload() + 68);
+      }
+
+      //! Stream Velocity Y (East).
+      fp32_t
+      svy(void) const
+      {
+        return read<fp32_t>(getPayload() + 72);
+      }
+
+      //! Stream Velocity Z (Down).
+      fp32_t
+      svz(void) const
+      {
+        return read<fp32_t>(getPayload() + 76);
+      }
+    };
+
+    //! Read-only view of Leak Simulation.
+    class LeakSimulationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LeakSimulationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LeakSimulationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LeakSimulationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 51;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LeakSimulation*
+      toMessage(void) const
+      {
+        return static_cast<LeakSimulation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Leak Entities.
+      DataView
+      entities(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Underwater Acoustics Simulation.
+    class UASimulationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UASimulationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UASimulationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UASimulationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 52;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UASimulation*
+      toMessage(void) const
+      {
+        return static_cast<UASimulation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Transmission Speed.
+      uint16_t
+      speed(void) const
+      {
+        return read<uint16_t>(getPayload() + 1);
+      }
+
+      //! Data.
+      DataView
+      data(void) const
+      {
+        return readData(getPayload() + 3);
+      }
+    };
+
+    //! Read-only view of Dynamics Simulation Parameters.
+    class DynamicsSimParamView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DynamicsSimParamView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DynamicsSimParamView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DynamicsSimParamView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 53;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DynamicsSimParam*
+      toMessage(void) const
+      {
+        return static_cast<DynamicsSimParam*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Action on the Vehicle Simulation Parameters.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! TAS to Longitudinal Acceleration Gain.
+      fp32_t
+      tas2acc_pgain(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+
+      //! Bank to Bank Rate Gain.
+      fp32_t
+      bank2p_pgain(void) const
+      {
+        return read<fp32_t>(getPayload() + 5);
+      }
+    };
+
+    //! Read-only view of Storage Usage.
+    class StorageUsageView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      StorageUsageView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      StorageUsageView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      StorageUsageView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 100;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      StorageUsage*
+      toMessage(void) const
+      {
+        return static_cast<StorageUsage*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Available.
+      uint32_t
+      available(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+
+      //! Usage.
+      uint8_t
+      value(void) const
+      {
+        return read<uint8_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Cache Control.
+    class CacheControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CacheControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CacheControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CacheControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 101;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CacheControl*
+      toMessage(void) const
+      {
+        return static_cast<CacheControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Control Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Snapshot destination.
+      DataView
+      snapshot(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Message.
+      MessageView
+      message(void) const;
+    };
+
+    //! Read-only view of Logging Control.
+    class LoggingControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LoggingControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LoggingControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LoggingControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 102;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LoggingControl*
+      toMessage(void) const
+      {
+        return static_cast<LoggingControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Control Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Log Label / Path.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Log Book Entry.
+    class LogBookEntryView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LogBookEntryView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LogBookEntryView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LogBookEntryView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 103;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LogBookEntry*
+      toMessage(void) const
+      {
+        return static_cast<LogBookEntry*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Timestamp.
+      fp64_t
+      htime(void) const
+      {
+        return read<fp64_t>(getPayload() + 1);
+      }
+
+      //! Context.
+      DataView
+      context(void) const
+      {
+        return readData(getPayload() + 9);
+      }
+
+      //! Text.
+      DataView
+      text(void) const;
+    };
+
+    //! Read-only view of Log Book Control.
+    class LogBookControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LogBookControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LogBookControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LogBookControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 104;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LogBookControl*
+      toMessage(void) const
+      {
+        return static_cast<LogBookControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Command.
+      uint8_t
+      command(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Timestamp.
+      fp64_t
+      htime(void) const
+      {
+        return read<fp64_t>(getPayload() + 1);
+      }
+
+      //! Messages.
+      MessageListView
+      msg(void) const
+      {
+        return readList(getPayload() + 9);
+      }
+    };
+
+    //! Read-only view of Replay Control.
+    class ReplayControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ReplayControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ReplayControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ReplayControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 105;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ReplayControl*
+      toMessage(void) const
+      {
+        return static_cast<ReplayControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! File To Replay.
+      DataView
+      file(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Clock Control.
+    class ClockControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ClockControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ClockControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ClockControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 106;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ClockControl*
+      toMessage(void) const
+      {
+        return static_cast<ClockControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Clock.
+      fp64_t
+      clock(void) const
+      {
+        return read<fp64_t>(getPayload() + 1);
+      }
+
+      //! Timezone.
+      int8_t
+      tz(void) const
+      {
+        return read<int8_t>(getPayload() + 9);
+      }
+    };
+
+    //! Read-only view of Historic CTD.
+    class HistoricCTDView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      HistoricCTDView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      HistoricCTDView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      HistoricCTDView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 107;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      HistoricCTD*
+      toMessage(void) const
+      {
+        return static_cast<HistoricCTD*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Conductivity.
+      fp32_t
+      conductivity(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Temperature.
+      fp32_t
+      temperature(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Depth.
+      fp32_t
+      depth(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+    };
+
+    //! Read-only view of Historic Telemetry.
+    class HistoricTelemetryView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      HistoricTelemetryView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      HistoricTelemetryView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      HistoricTelemetryView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 108;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      HistoricTelemetry*
+      toMessage(void) const
+      {
+        return static_cast<HistoricTelemetry*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Altitude.
+      fp32_t
+      altitude(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Roll.
+      uint16_t
+      roll(void) const
+      {
+        return read<uint16_t>(getPayload() + 4);
+      }
+
+      //! Pitch.
+      uint16_t
+      pitch(void) const
+      {
+        return read<uint16_t>(getPayload() + 6);
+      }
+
+      //! Yaw.
+      uint16_t
+      yaw(void) const
+      {
+        return read<uint16_t>(getPayload() + 8);
+      }
+
+      //! Speed.
+      int16_t
+      speed(void) const
+      {
+        return read<int16_t>(getPayload() + 10);
+      }
+    };
+
+    //! Read-only view of Historic Sonar Data.
+    class HistoricSonarDataView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      HistoricSonarDataView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      HistoricSonarDataView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      HistoricSonarDataView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 109;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      HistoricSonarData*
+      toMessage(void) const
+      {
+        return static_cast<HistoricSonarData*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Altitude.
+      fp32_t
+      altitude(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Width.
+      fp32_t
+      width(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Length.
+      fp32_t
+      length(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Bearing.
+      fp32_t
+      bearing(void) const
+      {
+        return read<fp32_t>(getPayload() + 12);
+      }
+
+      //! Pixels Per Line.
+      int16_t
+      pxl(void) const
+      {
+        return read<int16_t>(getPayload() + 16);
+      }
+
+      //! Encoding.
+      uint8_t
+      encoding(void) const
+      {
+        return read<uint8_t>(getPayload() + 18);
+      }
+
+      //! SonarData.
+      DataView
+      sonar_data(void) const
+      {
+        return readData(getPayload() + 19);
+      }
+    };
+
+    //! Read-only view of Historic Event.
+    class HistoricEventView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      HistoricEventView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      HistoricEventView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      HistoricEventView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 110;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      HistoricEvent*
+      toMessage(void) const
+      {
+        return static_cast<HistoricEvent*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Event.
+      DataView
+      text(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Event Type.
+      uint8_t
+      type(void) const;
+    };
+
+    //! Read-only view of Heartbeat.
+    class HeartbeatView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      HeartbeatView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      HeartbeatView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      HeartbeatView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 150;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Heartbeat*
+      toMessage(void) const
+      {
+        return static_cast<Heartbeat*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Announce.
+    class AnnounceView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AnnounceView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AnnounceView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AnnounceView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 151;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Announce*
+      toMessage(void) const
+      {
+        return static_cast<Announce*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! System Name.
+      DataView
+      sys_name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! System Type.
+      uint8_t
+      sys_type(void) const;
+
+      //! Control Owner.
+      uint16_t
+      owner(void) const;
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const;
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const;
+
+      //! Height WGS-84.
+      fp32_t
+      height(void) const;
+
+      //! Services.
+      DataView
+      services(void) const;
+    };
+
+    //! Read-only view of Announce Service.
+    class AnnounceServiceView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AnnounceServiceView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AnnounceServiceView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AnnounceServiceView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 152;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AnnounceService*
+      toMessage(void) const
+      {
+        return static_cast<AnnounceService*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Service.
+      DataView
+      service(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! ServiceType.
+      uint8_t
+      service_type(void) const;
+    };
+
+    //! Read-only view of Receive Signal Strength Information.
+    class RSSIView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RSSIView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RSSIView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RSSIView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 153;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RSSI*
+      toMessage(void) const
+      {
+        return static_cast<RSSI*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Voltage Standing Wave Ratio.
+    class VSWRView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VSWRView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VSWRView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VSWRView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 154;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VSWR*
+      toMessage(void) const
+      {
+        return static_cast<VSWR*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Link Level.
+    class LinkLevelView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LinkLevelView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LinkLevelView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LinkLevelView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 155;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LinkLevel*
+      toMessage(void) const
+      {
+        return static_cast<LinkLevel*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of SMS.
+    class SmsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SmsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SmsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SmsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 156;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Sms*
+      toMessage(void) const
+      {
+        return static_cast<Sms*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Number.
+      DataView
+      number(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const;
+
+      //! Contents.
+      DataView
+      contents(void) const;
+    };
+
+    //! Read-only view of SMS Transmit.
+    class SmsTxView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SmsTxView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SmsTxView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SmsTxView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 157;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SmsTx*
+      toMessage(void) const
+      {
+        return static_cast<SmsTx*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Sequence Number.
+      uint32_t
+      seq(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+
+      //! Destination.
+      DataView
+      destination(void) const
+      {
+        return readData(getPayload() + 4);
+      }
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const;
+
+      //! Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of SMS Receive.
+    class SmsRxView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SmsRxView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SmsRxView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SmsRxView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 158;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SmsRx*
+      toMessage(void) const
+      {
+        return static_cast<SmsRx*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Source.
+      DataView
+      source(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of SMS State.
+    class SmsStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SmsStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SmsStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SmsStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 159;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SmsState*
+      toMessage(void) const
+      {
+        return static_cast<SmsState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Sequence Number.
+      uint32_t
+      seq(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+
+      //! State.
+      uint8_t
+      state(void) const
+      {
+        return read<uint8_t>(getPayload() + 4);
+      }
+
+      //! Error Message.
+      DataView
+      error(void) const
+      {
+        return readData(getPayload() + 5);
+      }
+    };
+
+    //! Read-only view of Text Message.
+    class TextMessageView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TextMessageView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TextMessageView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TextMessageView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 160;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TextMessage*
+      toMessage(void) const
+      {
+        return static_cast<TextMessage*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Origin.
+      DataView
+      origin(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Text.
+      DataView
+      text(void) const;
+    };
+
+    //! Read-only view of Received Iridium Message.
+    class IridiumMsgRxView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      IridiumMsgRxView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      IridiumMsgRxView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      IridiumMsgRxView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 170;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      IridiumMsgRx*
+      toMessage(void) const
+      {
+        return static_cast<IridiumMsgRx*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Origin Identifier.
+      DataView
+      origin(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Timestamp.
+      fp64_t
+      htime(void) const;
+
+      //! Latitude Reference.
+      fp64_t
+      lat(void) const;
+
+      //! Longitude Reference.
+      fp64_t
+      lon(void) const;
+
+      //! Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of Transmit Iridium Message.
+    class IridiumMsgTxView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      IridiumMsgTxView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      IridiumMsgTxView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      IridiumMsgTxView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 171;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      IridiumMsgTx*
+      toMessage(void) const
+      {
+        return static_cast<IridiumMsgTx*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Request Identifier.
+      uint16_t
+      req_id(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Time to live.
+      uint16_t
+      ttl(void) const
+      {
+        return read<uint16_t>(getPayload() + 2);
+      }
+
+      //! Destination Identifier.
+      DataView
+      destination(void) const
+      {
+        return readData(getPayload() + 4);
+      }
+
+      //! Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of Iridium Transmission Status.
+    class IridiumTxStatusView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      IridiumTxStatusView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      IridiumTxStatusView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      IridiumTxStatusView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 172;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      IridiumTxStatus*
+      toMessage(void) const
+      {
+        return static_cast<IridiumTxStatus*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Request Identifier.
+      uint16_t
+      req_id(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Status Code.
+      uint8_t
+      status(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! Status Text.
+      DataView
+      text(void) const
+      {
+        return readData(getPayload() + 3);
+      }
+    };
+
+    //! Read-only view of Group Membership State.
+    class GroupMembershipStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GroupMembershipStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GroupMembershipStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GroupMembershipStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 180;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GroupMembershipState*
+      toMessage(void) const
+      {
+        return static_cast<GroupMembershipState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Group Name.
+      DataView
+      group_name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Communication Links Assertion.
+      uint32_t
+      links(void) const;
+    };
+
+    //! Read-only view of System Group.
+    class SystemGroupView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SystemGroupView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SystemGroupView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SystemGroupView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 181;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SystemGroup*
+      toMessage(void) const
+      {
+        return static_cast<SystemGroup*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Group Name.
+      DataView
+      groupname(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Group List Action.
+      uint8_t
+      action(void) const;
+
+      //! Systems Name List.
+      DataView
+      grouplist(void) const;
+    };
+
+    //! Read-only view of Link Latency.
+    class LinkLatencyView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LinkLatencyView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LinkLatencyView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LinkLatencyView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 182;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LinkLatency*
+      toMessage(void) const
+      {
+        return static_cast<LinkLatency*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Communications Source System ID.
+      uint16_t
+      sys_src(void) const
+      {
+        return read<uint16_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Extended Receive Signal Strength Information.
+    class ExtendedRSSIView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ExtendedRSSIView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ExtendedRSSIView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ExtendedRSSIView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 183;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ExtendedRSSI*
+      toMessage(void) const
+      {
+        return static_cast<ExtendedRSSI*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! RSSI Units.
+      uint8_t
+      units(void) const
+      {
+        return read<uint8_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Historic Data Series.
+    class HistoricDataView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      HistoricDataView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      HistoricDataView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      HistoricDataView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 184;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      HistoricData*
+      toMessage(void) const
+      {
+        return static_cast<HistoricData*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Base Latitude.
+      fp32_t
+      base_lat(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Base Longitude.
+      fp32_t
+      base_lon(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Base Timestamp.
+      fp32_t
+      base_time(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Data.
+      MessageListView
+      data(void) const
+      {
+        return readList(getPayload() + 12);
+      }
+    };
+
+    //! Read-only view of Compressed Historic Data Series.
+    class CompressedHistoryView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CompressedHistoryView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CompressedHistoryView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CompressedHistoryView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 185;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CompressedHistory*
+      toMessage(void) const
+      {
+        return static_cast<CompressedHistory*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Base Latitude.
+      fp32_t
+      base_lat(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Base Longitude.
+      fp32_t
+      base_lon(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Base Timestamp.
+      fp32_t
+      base_time(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Data.
+      DataView
+      data(void) const
+      {
+        return readData(getPayload() + 12);
+      }
+    };
+
+    //! Read-only view of Historic Data Sample.
+    class HistoricSampleView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      HistoricSampleView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      HistoricSampleView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      HistoricSampleView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 186;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      HistoricSample*
+      toMessage(void) const
+      {
+        return static_cast<HistoricSample*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Original System Id.
+      uint16_t
+      sys_id(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Priority.
+      int8_t
+      priority(void) const
+      {
+        return read<int8_t>(getPayload() + 2);
+      }
+
+      //! X offset.
+      int16_t
+      x(void) const
+      {
+        return read<int16_t>(getPayload() + 3);
+      }
+
+      //! Y offset.
+      int16_t
+      y(void) const
+      {
+        return read<int16_t>(getPayload() + 5);
+      }
+
+      //! Z offset.
+      int16_t
+      z(void) const
+      {
+        return read<int16_t>(getPayload() + 7);
+      }
+
+      //! Time offset.
+      int16_t
+      t(void) const
+      {
+        return read<int16_t>(getPayload() + 9);
+      }
+
+      //! Data Sample.
+      MessageView
+      sample(void) const
+      {
+        return readInline(getPayload() + 11);
+      }
+    };
+
+    //! Read-only view of Historic Data Query.
+    class HistoricDataQueryView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      HistoricDataQueryView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      HistoricDataQueryView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      HistoricDataQueryView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 187;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      HistoricDataQuery*
+      toMessage(void) const
+      {
+        return static_cast<HistoricDataQuery*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Request Id.
+      uint16_t
+      req_id(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Request Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! Maximum Size.
+      uint16_t
+      max_size(void) const
+      {
+        return read<uint16_t>(getPayload() + 3);
+      }
+
+      //! Data.
+      HistoricDataView
+      data(void) const;
+    };
+
+    //! Read-only view of Remote Command.
+    class RemoteCommandView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RemoteCommandView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RemoteCommandView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RemoteCommandView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 188;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RemoteCommand*
+      toMessage(void) const
+      {
+        return static_cast<RemoteCommand*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Original Source.
+      uint16_t
+      original_source(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Destination.
+      uint16_t
+      destination(void) const
+      {
+        return read<uint16_t>(getPayload() + 2);
+      }
+
+      //! Timeout.
+      fp64_t
+      timeout(void) const
+      {
+        return read<fp64_t>(getPayload() + 4);
+      }
+
+      //! Command.
+      MessageView
+      cmd(void) const
+      {
+        return readInline(getPayload() + 12);
+      }
+    };
+
+    //! Read-only view of LBL Range.
+    class LblRangeView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LblRangeView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LblRangeView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LblRangeView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 200;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      LblRange*
+      toMessage(void) const
+      {
+        return static_cast<LblRange*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Beacon Identification Number.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Range.
+      fp32_t
+      range(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of LBL Beacon Configuration.
+    class LblBeaconView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LblBeaconView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LblBeaconView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LblBeaconView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 202;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LblBeacon*
+      toMessage(void) const
+      {
+        return static_cast<LblBeacon*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Beacon Name.
+      DataView
+      beacon(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const;
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const;
+
+      //! Depth.
+      fp32_t
+      depth(void) const;
+
+      //! Interrogation channel.
+      uint8_t
+      query_channel(void) const;
+
+      //! Reply channel.
+      uint8_t
+      reply_channel(void) const;
+
+      //! Transponder delay.
+      uint8_t
+      transponder_delay(void) const;
+    };
+
+    //! Read-only view of LBL Configuration.
+    class LblConfigView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LblConfigView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LblConfigView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LblConfigView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 203;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LblConfig*
+      toMessage(void) const
+      {
+        return static_cast<LblConfig*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Beacons.
+      MessageListView
+      beacons(void) const
+      {
+        return readList(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Acoustic Message.
+    class AcousticMessageView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AcousticMessageView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AcousticMessageView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AcousticMessageView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 206;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AcousticMessage*
+      toMessage(void) const
+      {
+        return static_cast<AcousticMessage*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Message to send.
+      MessageView
+      message(void) const
+      {
+        return readInline(getPayload());
+      }
+    };
+
+    //! Read-only view of Acoustic Operation.
+    class AcousticOperationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AcousticOperationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AcousticOperationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AcousticOperationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 211;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AcousticOperation*
+      toMessage(void) const
+      {
+        return static_cast<AcousticOperation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! System.
+      DataView
+      system(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Range.
+      fp32_t
+      range(void) const;
+
+      //! Message To Send.
+      MessageView
+      msg(void) const;
+    };
+
+    //! Read-only view of Acoustic Systems Query.
+    class AcousticSystemsQueryView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AcousticSystemsQueryView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AcousticSystemsQueryView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AcousticSystemsQueryView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 212;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AcousticSystemsQuery*
+      toMessage(void) const
+      {
+        return static_cast<AcousticSystemsQuery*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Acoustic Systems.
+    class AcousticSystemsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AcousticSystemsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AcousticSystemsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AcousticSystemsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 213;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AcousticSystems*
+      toMessage(void) const
+      {
+        return static_cast<AcousticSystems*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! System List.
+      DataView
+      list(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of Acoustic Link Quality.
+    class AcousticLinkView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AcousticLinkView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AcousticLinkView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AcousticLinkView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 214;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AcousticLink*
+      toMessage(void) const
+      {
+        return static_cast<AcousticLink*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Peer Name.
+      DataView
+      peer(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Received Signal Strength Indicator.
+      fp32_t
+      rssi(void) const;
+
+      //! Signal Integrity Level.
+      uint16_t
+      integrity(void) const;
+    };
+
+    //! Read-only view of Revolutions Per Minute.
+    class RpmView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RpmView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RpmView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RpmView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 250;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Rpm*
+      toMessage(void) const
+      {
+        return static_cast<Rpm*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      int16_t
+      value(void) const
+      {
+        return read<int16_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Voltage.
+    class VoltageView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VoltageView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VoltageView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VoltageView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 251;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Voltage*
+      toMessage(void) const
+      {
+        return static_cast<Voltage*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured Voltage Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Current.
+    class CurrentView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CurrentView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CurrentView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CurrentView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 252;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Current*
+      toMessage(void) const
+      {
+        return static_cast<Current*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured Current Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of GPS Fix.
+    class GpsFixView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GpsFixView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GpsFixView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GpsFixView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 253;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GpsFix*
+      toMessage(void) const
+      {
+        return static_cast<GpsFix*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Validity.
+      uint16_t
+      validity(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! UTC Year.
+      uint16_t
+      utc_year(void) const
+      {
+        return read<uint16_t>(getPayload() + 3);
+      }
+
+      //! UTC Month.
+      uint8_t
+      utc_month(void) const
+      {
+        return read<uint8_t>(getPayload() + 5);
+      }
+
+      //! UTC Day.
+      uint8_t
+      utc_day(void) const
+      {
+        return read<uint8_t>(getPayload() + 6);
+      }
+
+      //! UTC Time of Fix.
+      fp32_t
+      utc_time(void) const
+      {
+        return read<fp32_t>(getPayload() + 7);
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 11);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 19);
+      }
+
+      //! Height above WGS-84 ellipsoid.
+      fp32_t
+      height(void) const
+      {
+        return read<fp32_t>(getPayload() + 27);
+      }
+
+      //! Number of Satellites.
+      uint8_t
+      satellites(void) const
+      {
+        return read<uint8_t>(getPayload() + 31);
+      }
+
+      //! Course Over Ground.
+      fp32_t
+      cog(void) const
+      {
+        return read<fp32_t>(getPayload() + 32);
+      }
+
+      //! Speed Over Ground.
+      fp32_t
+      sog(void) const
+      {
+        return read<fp32_t>(getPayload() + 36);
+      }
+
+      //! Horizontal Dilution of Precision.
+      fp32_t
+      hdop(void) const
+      {
+        return read<fp32_t>(getPayload() + 40);
+      }
+
+      //! Vertical Dilution of Precision.
+      fp32_t
+      vdop(void) const
+      {
+        return read<fp32_t>(getPayload() + 44);
+      }
+
+      //! Horizontal Accuracy Estimate.
+      fp32_t
+      hacc(void) const
+      {
+        return read<fp32_t>(getPayload() + 48);
+      }
+
+      //! Vertical Accuracy Estimate.
+      fp32_t
+      vacc(void) const
+      {
+        return read<fp32_t>(getPayload() + 52);
+      }
+    };
+
+    //! Read-only view of Euler Angles.
+    class EulerAnglesView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EulerAnglesView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EulerAnglesView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EulerAnglesView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 254;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EulerAngles*
+      toMessage(void) const
+      {
+        return static_cast<EulerAngles*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Device Time.
+      fp64_t
+      time(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Roll Angle.
+      fp64_t
+      phi(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Pitch Angle.
+      fp64_t
+      theta(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Yaw Angle (True).
+      fp64_t
+      psi(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+
+      //! Yaw Angle (Magnetic).
+      fp64_t
+      psi_magnetic(void) const
+      {
+        return read<fp64_t>(getPayload() + 32);
+      }
+    };
+
+    //! Read-only view of Euler Angles Delta.
+    class EulerAnglesDeltaView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EulerAnglesDeltaView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EulerAnglesDeltaView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EulerAnglesDeltaView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 255;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EulerAnglesDelta*
+      toMessage(void) const
+      {
+        return static_cast<EulerAnglesDelta*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Device Time.
+      fp64_t
+      time(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! X.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Y.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Z.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+
+      //! Timestep.
+      fp32_t
+      timestep(void) const
+      {
+        return read<fp32_t>(getPayload() + 32);
+      }
+    };
+
+    //! Read-only view of Angular Velocity.
+    class AngularVelocityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AngularVelocityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AngularVelocityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AngularVelocityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 256;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AngularVelocity*
+      toMessage(void) const
+      {
+        return static_cast<AngularVelocity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Device Time.
+      fp64_t
+      time(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! X.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Y.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Z.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+    };
+
+    //! Read-only view of Acceleration.
+    class AccelerationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AccelerationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AccelerationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AccelerationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 257;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Acceleration*
+      toMessage(void) const
+      {
+        return static_cast<Acceleration*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Device Time.
+      fp64_t
+      time(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! X.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Y.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Z.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+    };
+
+    //! Read-only view of Magnetic Field.
+    class MagneticFieldView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      MagneticFieldView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      MagneticFieldView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      MagneticFieldView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 258;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      MagneticField*
+      toMessage(void) const
+      {
+        return static_cast<MagneticField*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Device Time.
+      fp64_t
+      time(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! X.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Y.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Z.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+    };
+
+    //! Read-only view of Ground Velocity.
+    class GroundVelocityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GroundVelocityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GroundVelocityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GroundVelocityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 259;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GroundVelocity*
+      toMessage(void) const
+      {
+        return static_cast<GroundVelocity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Validity.
+      uint8_t
+      validity(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! X.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload() + 1);
+      }
+
+      //! Y.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 9);
+      }
+
+      //! Z.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 17);
+      }
+    };
+
+    //! Read-only view of Water Velocity.
+    class WaterVelocityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      WaterVelocityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      WaterVelocityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      WaterVelocityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 260;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      WaterVelocity*
+      toMessage(void) const
+      {
+        return static_cast<WaterVelocity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Validity.
+      uint8_t
+      validity(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! X.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload() + 1);
+      }
+
+      //! Y.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 9);
+      }
+
+      //! Z.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 17);
+      }
+    };
+
+    //! Read-only view of Velocity Delta.
+    class VelocityDeltaView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VelocityDeltaView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VelocityDeltaView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VelocityDeltaView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 261;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VelocityDelta*
+      toMessage(void) const
+      {
+        return static_cast<VelocityDelta*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Device Time.
+      fp64_t
+      time(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! X.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Y.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Z.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+    };
+
+    //! Read-only view of Device State.
+    class DeviceStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DeviceStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DeviceStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DeviceStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 282;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DeviceState*
+      toMessage(void) const
+      {
+        return static_cast<DeviceState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Device Position - X.
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Device Position - Y.
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Device Position - Z.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Device Rotation - X.
+      fp32_t
+      phi(void) const
+      {
+        return read<fp32_t>(getPayload() + 12);
+      }
+
+      //! Device Rotation - Y.
+      fp32_t
+      theta(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Device Rotation - Z.
+      fp32_t
+      psi(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+    };
+
+    //! Read-only view of Beam Configuration.
+    class BeamConfigView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      BeamConfigView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      BeamConfigView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      BeamConfigView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 283;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      BeamConfig*
+      toMessage(void) const
+      {
+        return static_cast<BeamConfig*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Beam Width.
+      fp32_t
+      beam_width(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Beam Height.
+      fp32_t
+      beam_height(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Distance.
+    class DistanceView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DistanceView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DistanceView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DistanceView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 262;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Distance*
+      toMessage(void) const
+      {
+        return static_cast<Distance*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Validity.
+      uint8_t
+      validity(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Location.
+      MessageListView
+      location(void) const
+      {
+        return readList(getPayload() + 1);
+      }
+
+      //! Beam Configuration.
+      MessageListView
+      beam_config(void) const;
+
+      //! Measured Distance.
+      fp32_t
+      value(void) const;
+    };
+
+    //! Read-only view of Temperature.
+    class TemperatureView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TemperatureView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TemperatureView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TemperatureView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 263;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Temperature*
+      toMessage(void) const
+      {
+        return static_cast<Temperature*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured Temperature.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Pressure.
+    class PressureView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PressureView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PressureView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PressureView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 264;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Pressure*
+      toMessage(void) const
+      {
+        return static_cast<Pressure*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured Pressure.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Depth.
+    class DepthView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DepthView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DepthView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DepthView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 265;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Depth*
+      toMessage(void) const
+      {
+        return static_cast<Depth*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured Depth.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Depth Offset.
+    class DepthOffsetView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DepthOffsetView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DepthOffsetView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DepthOffsetView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 266;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DepthOffset*
+      toMessage(void) const
+      {
+        return static_cast<DepthOffset*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured Offset.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Sound Speed.
+    class SoundSpeedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SoundSpeedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SoundSpeedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SoundSpeedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 267;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SoundSpeed*
+      toMessage(void) const
+      {
+        return static_cast<SoundSpeed*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Computed Sound Speed.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Water Density.
+    class WaterDensityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      WaterDensityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      WaterDensityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      WaterDensityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 268;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      WaterDensity*
+      toMessage(void) const
+      {
+        return static_cast<WaterDensity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Computed Water Density.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Conductivity.
+    class ConductivityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ConductivityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ConductivityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ConductivityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 269;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Conductivity*
+      toMessage(void) const
+      {
+        return static_cast<Conductivity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured Conductivity.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Salinity.
+    class SalinityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SalinityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SalinityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SalinityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 270;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Salinity*
+      toMessage(void) const
+      {
+        return static_cast<Salinity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured Salinity.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Wind Speed.
+    class WindSpeedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      WindSpeedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      WindSpeedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      WindSpeedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 271;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      WindSpeed*
+      toMessage(void) const
+      {
+        return static_cast<WindSpeed*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Direction.
+      fp32_t
+      direction(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Turbulence.
+      fp32_t
+      turbulence(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+    };
+
+    //! Read-only view of Relative Humidity.
+    class RelativeHumidityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RelativeHumidityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RelativeHumidityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RelativeHumidityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 272;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RelativeHumidity*
+      toMessage(void) const
+      {
+        return static_cast<RelativeHumidity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Relative Humidity Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Device Data (Text).
+    class DevDataTextView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DevDataTextView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DevDataTextView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DevDataTextView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 273;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DevDataText*
+      toMessage(void) const
+      {
+        return static_cast<DevDataText*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      DataView
+      value(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of Device Data (Binary).
+    class DevDataBinaryView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DevDataBinaryView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DevDataBinaryView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DevDataBinaryView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 274;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DevDataBinary*
+      toMessage(void) const
+      {
+        return static_cast<DevDataBinary*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      DataView
+      value(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of Sonar Data.
+    class SonarDataView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SonarDataView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SonarDataView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SonarDataView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 276;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SonarData*
+      toMessage(void) const
+      {
+        return static_cast<SonarData*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Frequency.
+      uint32_t
+      frequency(void) const
+      {
+        return read<uint32_t>(getPayload() + 1);
+      }
+
+      //! Minimum Range.
+      uint16_t
+      min_range(void) const
+      {
+        return read<uint16_t>(getPayload() + 5);
+      }
+
+      //! Maximum Range.
+      uint16_t
+      max_range(void) const
+      {
+        return read<uint16_t>(getPayload() + 7);
+      }
+
+      //! Bits Per Data Point.
+      uint8_t
+      bits_per_point(void) const
+      {
+        return read<uint8_t>(getPayload() + 9);
+      }
+
+      //! Scaling Factor.
+      fp32_t
+      scale_factor(void) const
+      {
+        return read<fp32_t>(getPayload() + 10);
+      }
+
+      //! Beam Configuration.
+      MessageListView
+      beam_config(void) const
+      {
+        return readList(getPayload() + 14);
+      }
+
+      //! Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of Pulse.
+    class PulseView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PulseView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PulseView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PulseView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 277;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Pulse*
+      toMessage(void) const
+      {
+        return static_cast<Pulse*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Pulse Detection Control.
+    class PulseDetectionControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PulseDetectionControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PulseDetectionControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PulseDetectionControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 278;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PulseDetectionControl*
+      toMessage(void) const
+      {
+        return static_cast<PulseDetectionControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Fuel Level.
+    class FuelLevelView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FuelLevelView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FuelLevelView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FuelLevelView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 279;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FuelLevel*
+      toMessage(void) const
+      {
+        return static_cast<FuelLevel*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Confidence Level.
+      fp32_t
+      confidence(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Operation Modes.
+      DataView
+      opmodes(void) const
+      {
+        return readData(getPayload() + 8);
+      }
+    };
+
+    //! Read-only view of GPS Navigation Data.
+    class GpsNavDataView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GpsNavDataView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GpsNavDataView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GpsNavDataView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 280;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GpsNavData*
+      toMessage(void) const
+      {
+        return static_cast<GpsNavData*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! GPS Millisecond Time of Week.
+      uint32_t
+      itow(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+
+      //! Latitude.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 4);
+      }
+
+      //! Longitude.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 12);
+      }
+
+      //! Height above ellipsoid.
+      fp32_t
+      height_ell(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+
+      //! Height above sea level.
+      fp32_t
+      height_sea(void) const
+      {
+        return read<fp32_t>(getPayload() + 24);
+      }
+
+      //! Horizontal Accuracy Estimate.
+      fp32_t
+      hacc(void) const
+      {
+        return read<fp32_t>(getPayload() + 28);
+      }
+
+      //! Vertical Accuracy Estimate.
+      fp32_t
+      vacc(void) const
+      {
+        return read<fp32_t>(getPayload() + 32);
+      }
+
+      //! NED North Velocity.
+      fp32_t
+      vel_n(void) const
+      {
+        return read<fp32_t>(getPayload() + 36);
+      }
+
+      //! NED East Velocity.
+      fp32_t
+      vel_e(void) const
+      {
+        return read<fp32_t>(getPayload() + 40);
+      }
+
+      //! NED Down Velocity.
+      fp32_t
+      vel_d(void) const
+      {
+        return read<fp32_t>(getPayload() + 44);
+      }
+
+      //! Speed (3D).
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 48);
+      }
+
+      //! Ground Speed (2D).
+      fp32_t
+      gspeed(void) const
+      {
+        return read<fp32_t>(getPayload() + 52);
+      }
+
+      //! Heading (2D).
+      fp32_t
+      heading(void) const
+      {
+        return read<fp32_t>(getPayload() + 56);
+      }
+
+      //! Speed Accuracy Estimate.
+      fp32_t
+      sacc(void) const
+      {
+        return read<fp32_t>(getPayload() + 60);
+      }
+
+      //! Course / Heading Accuracy Estimate.
+      fp32_t
+      cacc(void) const
+      {
+        return read<fp32_t>(getPayload() + 64);
+      }
+    };
+
+    //! Read-only view of Servo Position.
+    class ServoPositionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ServoPositionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ServoPositionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ServoPositionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 281;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      ServoPosition*
+      toMessage(void) const
+      {
+        return static_cast<ServoPosition*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Identifier.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Position.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Data Sanity.
+    class DataSanityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DataSanityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DataSanityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DataSanityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 284;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DataSanity*
+      toMessage(void) const
+      {
+        return static_cast<DataSanity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Sanity.
+      uint8_t
+      sane(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Rhodamine Dye.
+    class RhodamineDyeView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RhodamineDyeView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RhodamineDyeView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RhodamineDyeView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 285;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RhodamineDye*
+      toMessage(void) const
+      {
+        return static_cast<RhodamineDye*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Crude Oil.
+    class CrudeOilView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CrudeOilView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CrudeOilView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CrudeOilView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 286;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CrudeOil*
+      toMessage(void) const
+      {
+        return static_cast<CrudeOil*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Fine Oil.
+    class FineOilView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FineOilView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FineOilView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FineOilView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 287;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FineOil*
+      toMessage(void) const
+      {
+        return static_cast<FineOil*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Turbidity.
+    class TurbidityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TurbidityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TurbidityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TurbidityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 288;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Turbidity*
+      toMessage(void) const
+      {
+        return static_cast<Turbidity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Chlorophyll.
+    class ChlorophyllView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ChlorophyllView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ChlorophyllView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ChlorophyllView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 289;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Chlorophyll*
+      toMessage(void) const
+      {
+        return static_cast<Chlorophyll*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Fluorescein.
+    class FluoresceinView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FluoresceinView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FluoresceinView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FluoresceinView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 290;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Fluorescein*
+      toMessage(void) const
+      {
+        return static_cast<Fluorescein*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Phycocyanin.
+    class PhycocyaninView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PhycocyaninView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PhycocyaninView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PhycocyaninView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 291;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Phycocyanin*
+      toMessage(void) const
+      {
+        return static_cast<Phycocyanin*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Phycoerythrin.
+    class PhycoerythrinView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PhycoerythrinView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PhycoerythrinView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PhycoerythrinView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 292;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Phycoerythrin*
+      toMessage(void) const
+      {
+        return static_cast<Phycoerythrin*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of GPS Fix RTK.
+    class GpsFixRtkView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GpsFixRtkView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GpsFixRtkView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GpsFixRtkView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 293;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GpsFixRtk*
+      toMessage(void) const
+      {
+        return static_cast<GpsFixRtk*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Validity.
+      uint16_t
+      validity(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! GPS Time of Week.
+      uint32_t
+      tow(void) const
+      {
+        return read<uint32_t>(getPayload() + 3);
+      }
+
+      //! Base Latitude WGS-84.
+      fp64_t
+      base_lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 7);
+      }
+
+      //! Base Longitude WGS-84.
+      fp64_t
+      base_lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 15);
+      }
+
+      //! Base Height above WGS-84 ellipsoid.
+      fp32_t
+      base_height(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Position North.
+      fp32_t
+      n(void) const
+      {
+        return read<fp32_t>(getPayload() + 27);
+      }
+
+      //! Position East.
+      fp32_t
+      e(void) const
+      {
+        return read<fp32_t>(getPayload() + 31);
+      }
+
+      //! Position Down.
+      fp32_t
+      d(void) const
+      {
+        return read<fp32_t>(getPayload() + 35);
+      }
+
+      //! Velocity North.
+      fp32_t
+      v_n(void) const
+      {
+        return read<fp32_t>(getPayload() + 39);
+      }
+
+      //! Velocity East.
+      fp32_t
+      v_e(void) const
+      {
+        return read<fp32_t>(getPayload() + 43);
+      }
+
+      //! Velocity Down.
+      fp32_t
+      v_d(void) const
+      {
+        return read<fp32_t>(getPayload() + 47);
+      }
+
+      //! Number of Satellites.
+      uint8_t
+      satellites(void) const
+      {
+        return read<uint8_t>(getPayload() + 51);
+      }
+
+      //! IAR Hypotheses.
+      uint16_t
+      iar_hyp(void) const
+      {
+        return read<uint16_t>(getPayload() + 52);
+      }
+
+      //! IAR Ratio.
+      fp32_t
+      iar_ratio(void) const
+      {
+        return read<fp32_t>(getPayload() + 54);
+      }
+    };
+
+    //! Read-only view of Estimated State.
+    class EstimatedStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EstimatedStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EstimatedStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EstimatedStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 350;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EstimatedState*
+      toMessage(void) const
+      {
+        return static_cast<EstimatedState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude (WGS-84).
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude (WGS-84).
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Height (WGS-84).
+      fp32_t
+      height(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Offset north.
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+
+      //! Offset east.
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 24);
+      }
+
+      //! Offset down.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 28);
+      }
+
+      //! Rotation over x axis.
+      fp32_t
+      phi(void) const
+      {
+        return read<fp32_t>(getPayload() + 32);
+      }
+
+      //! Rotation over y axis.
+      fp32_t
+      theta(void) const
+      {
+        return read<fp32_t>(getPayload() + 36);
+      }
+
+      //! Rotation over z axis.
+      fp32_t
+      psi(void) const
+      {
+        return read<fp32_t>(getPayload() + 40);
+      }
+
+      //! Body-Fixed xx Velocity.
+      fp32_t
+      u(void) const
+      {
+        return read<fp32_t>(getPayload() + 44);
+      }
+
+      //! Body-Fixed yy Velocity.
+      fp32_t
+      v(void) const
+      {
+        return read<fp32_t>(getPayload() + 48);
+      }
+
+      //! Body-Fixed zz Velocity.
+      fp32_t
+      w(void) const
+      {
+        return read<fp32_t>(getPayload() + 52);
+      }
+
+      //! Ground Velocity X (North).
+      fp32_t
+      vx(void) const
+      {
+        return read<fp32_t>(getPayload() + 56);
+      }
+
+      //! Ground Velocity Y (East).
+      fp32_t
+      vy(void) const
+      {
+        return read<fp32_t>(getPayload() + 60);
+      }
+
+      //! Ground Velocity Z (Down).
+      fp32_t
+      vz(void) const
+      {
+        return read<fp32_t>(getPayload() + 64);
+      }
+
+      //! Angular Velocity in x.
+      fp32_t
+      p(void) const
+      {
+        return read<fp32_t>(getPayload() + 68);
+      }
+
+      //! Angular Velocity in y.
+      fp32_t
+      q(void) const
+      {
+        return read<fp32_t>(getPayload() + 72);
+      }
+
+      //! Angular Velocity in z.
+      fp32_t
+      r(void) const
+      {
+        return read<fp32_t>(getPayload() + 76);
+      }
+
+      //! Depth.
+      fp32_t
+      depth(void) const
+      {
+        return read<fp32_t>(getPayload() + 80);
+      }
+
+      //! Altitude.
+      fp32_t
+      alt(void) const
+      {
+        return read<fp32_t>(getPayload() + 84);
+      }
+    };
+
+    //! Read-only view of External Navigation Data.
+    class ExternalNavDataView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ExternalNavDataView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ExternalNavDataView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ExternalNavDataView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 294;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ExternalNavData*
+      toMessage(void) const
+      {
+        return static_cast<ExternalNavData*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Estimated State.
+      EstimatedStateView
+      state(void) const;
+
+      //! Nav Data Type.
+      uint8_t
+      type(void) const;
+    };
+
+    //! Read-only view of Dissolved Oxygen.
+    class DissolvedOxygenView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DissolvedOxygenView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DissolvedOxygenView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DissolvedOxygenView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 295;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DissolvedOxygen*
+      toMessage(void) const
+      {
+        return static_cast<DissolvedOxygen*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Air Saturation.
+    class AirSaturationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AirSaturationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AirSaturationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AirSaturationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 296;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AirSaturation*
+      toMessage(void) const
+      {
+        return static_cast<AirSaturation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Throttle.
+    class ThrottleView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ThrottleView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ThrottleView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ThrottleView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 297;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Throttle*
+      toMessage(void) const
+      {
+        return static_cast<Throttle*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of pH.
+    class PHView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PHView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PHView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PHView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 298;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PH*
+      toMessage(void) const
+      {
+        return static_cast<PH*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Redox Potential.
+    class RedoxView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RedoxView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RedoxView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RedoxView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 299;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Redox*
+      toMessage(void) const
+      {
+        return static_cast<Redox*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Camera Zoom.
+    class CameraZoomView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CameraZoomView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CameraZoomView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CameraZoomView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 300;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      CameraZoom*
+      toMessage(void) const
+      {
+        return static_cast<CameraZoom*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Camera Number.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Absolute Zoom Level.
+      uint8_t
+      zoom(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Action.
+      uint8_t
+      action(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+    };
+
+    //! Read-only view of Set Thruster Actuation.
+    class SetThrusterActuationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SetThrusterActuationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SetThrusterActuationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SetThrusterActuationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 301;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      SetThrusterActuation*
+      toMessage(void) const
+      {
+        return static_cast<SetThrusterActuation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Thruster Number.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Actuation Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Set Servo Position.
+    class SetServoPositionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SetServoPositionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SetServoPositionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SetServoPositionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 302;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      SetServoPosition*
+      toMessage(void) const
+      {
+        return static_cast<SetServoPosition*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Identifier.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Position.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Set Control Surface Deflection.
+    class SetControlSurfaceDeflectionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SetControlSurfaceDeflectionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SetControlSurfaceDeflectionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SetControlSurfaceDeflectionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 303;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      SetControlSurfaceDeflection*
+      toMessage(void) const
+      {
+        return static_cast<SetControlSurfaceDeflection*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Identifier.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Angle.
+      fp32_t
+      angle(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Remote Actions Request.
+    class RemoteActionsRequestView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RemoteActionsRequestView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RemoteActionsRequestView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RemoteActionsRequestView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 304;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RemoteActionsRequest*
+      toMessage(void) const
+      {
+        return static_cast<RemoteActionsRequest*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Actions.
+      DataView
+      actions(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Remote Actions.
+    class RemoteActionsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RemoteActionsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RemoteActionsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RemoteActionsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 305;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RemoteActions*
+      toMessage(void) const
+      {
+        return static_cast<RemoteActions*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Actions.
+      DataView
+      actions(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of Button Event.
+    class ButtonEventView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ButtonEventView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ButtonEventView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ButtonEventView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 306;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ButtonEvent*
+      toMessage(void) const
+      {
+        return static_cast<ButtonEvent*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Button.
+      uint8_t
+      button(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Value.
+      uint8_t
+      value(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of LCD Control.
+    class LcdControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LcdControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LcdControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LcdControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 307;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LcdControl*
+      toMessage(void) const
+      {
+        return static_cast<LcdControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Text.
+      DataView
+      text(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Power Operation.
+    class PowerOperationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PowerOperationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PowerOperationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PowerOperationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 308;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PowerOperation*
+      toMessage(void) const
+      {
+        return static_cast<PowerOperation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Time Remaining.
+      fp32_t
+      time_remain(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+
+      //! Scheduled Time.
+      fp64_t
+      sched_time(void) const
+      {
+        return read<fp64_t>(getPayload() + 5);
+      }
+    };
+
+    //! Read-only view of Power Channel Control.
+    class PowerChannelControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PowerChannelControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PowerChannelControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PowerChannelControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 309;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PowerChannelControl*
+      toMessage(void) const
+      {
+        return static_cast<PowerChannelControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Channel Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Operation.
+      uint8_t
+      op(void) const;
+
+      //! Scheduled Time.
+      fp64_t
+      sched_time(void) const;
+    };
+
+    //! Read-only view of Query Power Channel State.
+    class QueryPowerChannelStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      QueryPowerChannelStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      QueryPowerChannelStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      QueryPowerChannelStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 310;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      QueryPowerChannelState*
+      toMessage(void) const
+      {
+        return static_cast<QueryPowerChannelState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Power Channel State.
+    class PowerChannelStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PowerChannelStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PowerChannelStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PowerChannelStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 311;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PowerChannelState*
+      toMessage(void) const
+      {
+        return static_cast<PowerChannelState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! State.
+      uint8_t
+      state(void) const;
+    };
+
+    //! Read-only view of LED Brightness.
+    class LedBrightnessView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LedBrightnessView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LedBrightnessView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LedBrightnessView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 312;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LedBrightness*
+      toMessage(void) const
+      {
+        return static_cast<LedBrightness*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Value.
+      uint8_t
+      value(void) const;
+    };
+
+    //! Read-only view of Query LED Brightness.
+    class QueryLedBrightnessView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      QueryLedBrightnessView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      QueryLedBrightnessView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      QueryLedBrightnessView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 313;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      QueryLedBrightness*
+      toMessage(void) const
+      {
+        return static_cast<QueryLedBrightness*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of Set LED Brightness.
+    class SetLedBrightnessView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SetLedBrightnessView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SetLedBrightnessView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SetLedBrightnessView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 314;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SetLedBrightness*
+      toMessage(void) const
+      {
+        return static_cast<SetLedBrightness*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Value.
+      uint8_t
+      value(void) const;
+    };
+
+    //! Read-only view of Set PWM.
+    class SetPWMView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SetPWMView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SetPWMView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SetPWMView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 315;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      SetPWM*
+      toMessage(void) const
+      {
+        return static_cast<SetPWM*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Channel Identifier.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Period.
+      uint32_t
+      period(void) const
+      {
+        return read<uint32_t>(getPayload() + 1);
+      }
+
+      //! Duty Cycle.
+      uint32_t
+      duty_cycle(void) const
+      {
+        return read<uint32_t>(getPayload() + 5);
+      }
+    };
+
+    //! Read-only view of PWM.
+    class PWMView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PWMView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PWMView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PWMView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 316;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      PWM*
+      toMessage(void) const
+      {
+        return static_cast<PWM*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Channel Identifier.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Period.
+      uint32_t
+      period(void) const
+      {
+        return read<uint32_t>(getPayload() + 1);
+      }
+
+      //! Duty Cycle.
+      uint32_t
+      duty_cycle(void) const
+      {
+        return read<uint32_t>(getPayload() + 5);
+      }
+    };
+
+    //! Read-only view of Estimated Stream Velocity.
+    class EstimatedStreamVelocityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EstimatedStreamVelocityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EstimatedStreamVelocityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EstimatedStreamVelocityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 351;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EstimatedStreamVelocity*
+      toMessage(void) const
+      {
+        return static_cast<EstimatedStreamVelocity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! X component (North).
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Y component (East).
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Z component (Down).
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+    };
+
+    //! Read-only view of Indicated Speed.
+    class IndicatedSpeedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      IndicatedSpeedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      IndicatedSpeedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      IndicatedSpeedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 352;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      IndicatedSpeed*
+      toMessage(void) const
+      {
+        return static_cast<IndicatedSpeed*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Measured speed.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of True Speed.
+    class TrueSpeedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TrueSpeedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TrueSpeedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TrueSpeedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 353;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TrueSpeed*
+      toMessage(void) const
+      {
+        return static_cast<TrueSpeed*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Estimated value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Navigation Uncertainty.
+    class NavigationUncertaintyView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      NavigationUncertaintyView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      NavigationUncertaintyView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      NavigationUncertaintyView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 354;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      NavigationUncertainty*
+      toMessage(void) const
+      {
+        return static_cast<NavigationUncertainty*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Variance - x Position.
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Variance - y Position.
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Variance - z Position.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Variance - Roll.
+      fp32_t
+      phi(void) const
+      {
+        return read<fp32_t>(getPayload() + 12);
+      }
+
+      //! Variance - Pitch.
+      fp32_t
+      theta(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Variance - Yaw.
+      fp32_t
+      psi(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+
+      //! Variance - Gyro. Roll Rate.
+      fp32_t
+      p(void) const
+      {
+        return read<fp32_t>(getPayload() + 24);
+      }
+
+      //! Variance - Gyro. Pitch Rate.
+      fp32_t
+      q(void) const
+      {
+        return read<fp32_t>(getPayload() + 28);
+      }
+
+      //! Variance - Gyro. Yaw Rate.
+      fp32_t
+      r(void) const
+      {
+        return read<fp32_t>(getPayload() + 32);
+      }
+
+      //! Variance - Body-Fixed xx Velocity.
+      fp32_t
+      u(void) const
+      {
+        return read<fp32_t>(getPayload() + 36);
+      }
+
+      //! Variance - Body-Fixed yy Velocity.
+      fp32_t
+      v(void) const
+      {
+        return read<fp32_t>(getPayload() + 40);
+      }
+
+      //! Variance - Body-Fixed ww Velocity.
+      fp32_t
+      w(void) const
+      {
+        return read<fp32_t>(getPayload() + 44);
+      }
+
+      //! Variance - Yaw Bias.
+      fp32_t
+      bias_psi(void) const
+      {
+        return read<fp32_t>(getPayload() + 48);
+      }
+
+      //! Variance - Gyro. Yaw Rate Bias.
+      fp32_t
+      bias_r(void) const
+      {
+        return read<fp32_t>(getPayload() + 52);
+      }
+    };
+
+    //! Read-only view of Navigation Data.
+    class NavigationDataView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      NavigationDataView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      NavigationDataView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      NavigationDataView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 355;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      NavigationData*
+      toMessage(void) const
+      {
+        return static_cast<NavigationData*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Yaw Bias.
+      fp32_t
+      bias_psi(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Gyro. Yaw Rate Bias.
+      fp32_t
+      bias_r(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Course Over Ground.
+      fp32_t
+      cog(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Continuous Yaw.
+      fp32_t
+      cyaw(void) const
+      {
+        return read<fp32_t>(getPayload() + 12);
+      }
+
+      //! GPS Rejection Filter Level.
+      fp32_t
+      lbl_rej_level(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! LBL Rejection Filter Level.
+      fp32_t
+      gps_rej_level(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+
+      //! Variance - Custom Variable X.
+      fp32_t
+      custom_x(void) const
+      {
+        return read<fp32_t>(getPayload() + 24);
+      }
+
+      //! Variance - Custom Variable Y.
+      fp32_t
+      custom_y(void) const
+      {
+        return read<fp32_t>(getPayload() + 28);
+      }
+
+      //! Variance - Custom Variable Z.
+      fp32_t
+      custom_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 32);
+      }
+    };
+
+    //! Read-only view of GPS Fix Rejection.
+    class GpsFixRejectionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GpsFixRejectionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GpsFixRejectionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GpsFixRejectionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 356;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GpsFixRejection*
+      toMessage(void) const
+      {
+        return static_cast<GpsFixRejection*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! UTC Time of Fix.
+      fp32_t
+      utc_time(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Reason.
+      uint8_t
+      reason(void) const
+      {
+        return read<uint8_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of LBL Range Acceptance.
+    class LblRangeAcceptanceView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LblRangeAcceptanceView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LblRangeAcceptanceView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LblRangeAcceptanceView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 357;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return id();
+      }
+
+      LblRangeAcceptance*
+      toMessage(void) const
+      {
+        return static_cast<LblRangeAcceptance*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Beacon Identification Number.
+      uint8_t
+      id(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Range.
+      fp32_t
+      range(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+
+      //! Acceptance.
+      uint8_t
+      acceptance(void) const
+      {
+        return read<uint8_t>(getPayload() + 5);
+      }
+    };
+
+    //! Read-only view of DVL Rejection.
+    class DvlRejectionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DvlRejectionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DvlRejectionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DvlRejectionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 358;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DvlRejection*
+      toMessage(void) const
+      {
+        return static_cast<DvlRejection*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type of velocity.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Reason.
+      uint8_t
+      reason(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload() + 2);
+      }
+
+      //! Timestep.
+      fp32_t
+      timestep(void) const
+      {
+        return read<fp32_t>(getPayload() + 6);
+      }
+    };
+
+    //! Read-only view of LBL Beacon Position Estimate.
+    class LblEstimateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LblEstimateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LblEstimateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LblEstimateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 360;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LblEstimate*
+      toMessage(void) const
+      {
+        return static_cast<LblEstimate*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! LBL Beacon Configuration.
+      LblBeaconView
+      beacon(void) const;
+
+      //! North position.
+      fp32_t
+      x(void) const;
+
+      //! East position.
+      fp32_t
+      y(void) const;
+
+      //! North position variance.
+      fp32_t
+      var_x(void) const;
+
+      //! East position variance.
+      fp32_t
+      var_y(void) const;
+
+      //! Distance.
+      fp32_t
+      distance(void) const;
+    };
+
+    //! Read-only view of Alignment State.
+    class AlignmentStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AlignmentStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AlignmentStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AlignmentStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 361;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AlignmentState*
+      toMessage(void) const
+      {
+        return static_cast<AlignmentState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! State.
+      uint8_t
+      state(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of GroupStreamVelocity.
+    class GroupStreamVelocityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GroupStreamVelocityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GroupStreamVelocityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GroupStreamVelocityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 362;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GroupStreamVelocity*
+      toMessage(void) const
+      {
+        return static_cast<GroupStreamVelocity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! X component (North).
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Y component (East).
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Z component (Down).
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+    };
+
+    //! Read-only view of Airflow.
+    class AirflowView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AirflowView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AirflowView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AirflowView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 363;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Airflow*
+      toMessage(void) const
+      {
+        return static_cast<Airflow*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Airspeed.
+      fp32_t
+      va(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Angle of attack.
+      fp32_t
+      aoa(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Sideslip angle.
+      fp32_t
+      ssa(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+    };
+
+    //! Read-only view of Desired Heading.
+    class DesiredHeadingView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredHeadingView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredHeadingView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredHeadingView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 400;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredHeading*
+      toMessage(void) const
+      {
+        return static_cast<DesiredHeading*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Desired Z.
+    class DesiredZView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredZView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredZView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredZView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 401;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredZ*
+      toMessage(void) const
+      {
+        return static_cast<DesiredZ*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Desired Speed.
+    class DesiredSpeedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredSpeedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredSpeedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredSpeedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 402;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredSpeed*
+      toMessage(void) const
+      {
+        return static_cast<DesiredSpeed*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 8);
+      }
+    };
+
+    //! Read-only view of Desired Roll.
+    class DesiredRollView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredRollView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredRollView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredRollView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 403;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredRoll*
+      toMessage(void) const
+      {
+        return static_cast<DesiredRoll*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Desired Pitch.
+    class DesiredPitchView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredPitchView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredPitchView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredPitchView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 404;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredPitch*
+      toMessage(void) const
+      {
+        return static_cast<DesiredPitch*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Desired Vertical Rate.
+    class DesiredVerticalRateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredVerticalRateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredVerticalRateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredVerticalRateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 405;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredVerticalRate*
+      toMessage(void) const
+      {
+        return static_cast<DesiredVerticalRate*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Desired Path.
+    class DesiredPathView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredPathView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredPathView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredPathView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 406;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredPath*
+      toMessage(void) const
+      {
+        return static_cast<DesiredPath*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Path Reference.
+      uint32_t
+      path_ref(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+
+      //! Start Point -- Latitude WGS-84.
+      fp64_t
+      start_lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 4);
+      }
+
+      //! Start Point -- WGS-84 Longitude.
+      fp64_t
+      start_lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 12);
+      }
+
+      //! Start Point -- Z Reference.
+      fp32_t
+      start_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+
+      //! Start Point -- Z Units.
+      uint8_t
+      start_z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 24);
+      }
+
+      //! End Point -- WGS84 Latitude.
+      fp64_t
+      end_lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 25);
+      }
+
+      //! End Point -- WGS-84 Longitude.
+      fp64_t
+      end_lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 33);
+      }
+
+      //! End Point -- Z Reference.
+      fp32_t
+      end_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 41);
+      }
+
+      //! End Point -- Z Units.
+      uint8_t
+      end_z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 45);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 46);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 50);
+      }
+
+      //! Loiter -- Radius.
+      fp32_t
+      lradius(void) const
+      {
+        return read<fp32_t>(getPayload() + 51);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 55);
+      }
+    };
+
+    //! Read-only view of Desired Control.
+    class DesiredControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 407;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredControl*
+      toMessage(void) const
+      {
+        return static_cast<DesiredControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Force along the x axis.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Force along the y axis.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Force along the z axis.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Torque about the x axis.
+      fp64_t
+      k(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+
+      //! Torque about the y axis.
+      fp64_t
+      m(void) const
+      {
+        return read<fp64_t>(getPayload() + 32);
+      }
+
+      //! Torque about the z axis.
+      fp64_t
+      n(void) const
+      {
+        return read<fp64_t>(getPayload() + 40);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 48);
+      }
+    };
+
+    //! Read-only view of Desired Heading Rate.
+    class DesiredHeadingRateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredHeadingRateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredHeadingRateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredHeadingRateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 408;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredHeadingRate*
+      toMessage(void) const
+      {
+        return static_cast<DesiredHeadingRate*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Desired Velocity.
+    class DesiredVelocityView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredVelocityView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredVelocityView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredVelocityView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 409;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredVelocity*
+      toMessage(void) const
+      {
+        return static_cast<DesiredVelocity*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Desired Linear Speed in xx.
+      fp64_t
+      u(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Desired Linear Speed in yy.
+      fp64_t
+      v(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Desired Linear Speed in zz.
+      fp64_t
+      w(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Desired Angular Speed in xx.
+      fp64_t
+      p(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+
+      //! Desired Angular Speed in yy.
+      fp64_t
+      q(void) const
+      {
+        return read<fp64_t>(getPayload() + 32);
+      }
+
+      //! Desired Angular Speed in zz.
+      fp64_t
+      r(void) const
+      {
+        return read<fp64_t>(getPayload() + 40);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 48);
+      }
+    };
+
+    //! Read-only view of Path Control State.
+    class PathControlStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PathControlStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PathControlStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PathControlStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 410;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PathControlState*
+      toMessage(void) const
+      {
+        return static_cast<PathControlState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Path Reference.
+      uint32_t
+      path_ref(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+
+      //! Start Point -- Latitude WGS-84.
+      fp64_t
+      start_lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 4);
+      }
+
+      //! Start Point -- WGS-84 Longitude.
+      fp64_t
+      start_lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 12);
+      }
+
+      //! Start Point -- Z Reference.
+      fp32_t
+      start_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+
+      //! Start Point -- Z Units.
+      uint8_t
+      start_z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 24);
+      }
+
+      //! End Point -- Latitude WGS-84.
+      fp64_t
+      end_lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 25);
+      }
+
+      //! End Point -- WGS-84 Longitude.
+      fp64_t
+      end_lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 33);
+      }
+
+      //! End Point -- Z Reference.
+      fp32_t
+      end_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 41);
+      }
+
+      //! End Point -- Z Units.
+      uint8_t
+      end_z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 45);
+      }
+
+      //! Loiter -- Radius.
+      fp32_t
+      lradius(void) const
+      {
+        return read<fp32_t>(getPayload() + 46);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 50);
+      }
+
+      //! Along Track Position.
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload() + 51);
+      }
+
+      //! Cross Track Position.
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 55);
+      }
+
+      //! Vertical Track Position.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 59);
+      }
+
+      //! Along Track Velocity.
+      fp32_t
+      vx(void) const
+      {
+        return read<fp32_t>(getPayload() + 63);
+      }
+
+      //! Cross Track Velocity.
+      fp32_t
+      vy(void) const
+      {
+        return read<fp32_t>(getPayload() + 67);
+      }
+
+      //! Vertical Track Velocity.
+      fp32_t
+      vz(void) const
+      {
+        return read<fp32_t>(getPayload() + 71);
+      }
+
+      //! Course Error.
+      fp32_t
+      course_error(void) const
+      {
+        return read<fp32_t>(getPayload() + 75);
+      }
+
+      //! Estimated Time to Arrival (ETA).
+      uint16_t
+      eta(void) const
+      {
+        return read<uint16_t>(getPayload() + 79);
+      }
+    };
+
+    //! Read-only view of Allocated Control Torques.
+    class AllocatedControlTorquesView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AllocatedControlTorquesView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AllocatedControlTorquesView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AllocatedControlTorquesView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 411;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AllocatedControlTorques*
+      toMessage(void) const
+      {
+        return static_cast<AllocatedControlTorques*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Torque about the x axis.
+      fp64_t
+      k(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Torque about the y axis.
+      fp64_t
+      m(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Torque about the x axis.
+      fp64_t
+      n(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+    };
+
+    //! Read-only view of Control Parcel.
+    class ControlParcelView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ControlParcelView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ControlParcelView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ControlParcelView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 412;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ControlParcel*
+      toMessage(void) const
+      {
+        return static_cast<ControlParcel*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Proportional Parcel.
+      fp32_t
+      p(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Integrative Parcel.
+      fp32_t
+      i(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Derivative Parcel.
+      fp32_t
+      d(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Anti-Windup Parcel.
+      fp32_t
+      a(void) const
+      {
+        return read<fp32_t>(getPayload() + 12);
+      }
+    };
+
+    //! Read-only view of Brake.
+    class BrakeView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      BrakeView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      BrakeView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      BrakeView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 413;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Brake*
+      toMessage(void) const
+      {
+        return static_cast<Brake*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Desired Linear State.
+    class DesiredLinearStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredLinearStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredLinearStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredLinearStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 414;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredLinearState*
+      toMessage(void) const
+      {
+        return static_cast<DesiredLinearState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Desired pos in xx.
+      fp64_t
+      x(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Desired pos in yy.
+      fp64_t
+      y(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Desired pos in zz.
+      fp64_t
+      z(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Desired Linear Speed in xx.
+      fp64_t
+      vx(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+
+      //! Desired Linear Speed in yy.
+      fp64_t
+      vy(void) const
+      {
+        return read<fp64_t>(getPayload() + 32);
+      }
+
+      //! Desired Linear Speed in zz.
+      fp64_t
+      vz(void) const
+      {
+        return read<fp64_t>(getPayload() + 40);
+      }
+
+      //! Desired Linear Acceleration in xx.
+      fp64_t
+      ax(void) const
+      {
+        return read<fp64_t>(getPayload() + 48);
+      }
+
+      //! Desired Linear Acceleration in yy.
+      fp64_t
+      ay(void) const
+      {
+        return read<fp64_t>(getPayload() + 56);
+      }
+
+      //! Desired Linear Acceleration in zz.
+      fp64_t
+      az(void) const
+      {
+        return read<fp64_t>(getPayload() + 64);
+      }
+
+      //! Flags.
+      uint16_t
+      flags(void) const
+      {
+        return read<uint16_t>(getPayload() + 72);
+      }
+    };
+
+    //! Read-only view of Desired Throttle.
+    class DesiredThrottleView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DesiredThrottleView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DesiredThrottleView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DesiredThrottleView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 415;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DesiredThrottle*
+      toMessage(void) const
+      {
+        return static_cast<DesiredThrottle*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp64_t
+      value(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Goto Maneuver.
+    class GotoView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GotoView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GotoView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GotoView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 450;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Goto*
+      toMessage(void) const
+      {
+        return static_cast<Goto*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 27);
+      }
+
+      //! Roll.
+      fp64_t
+      roll(void) const
+      {
+        return read<fp64_t>(getPayload() + 28);
+      }
+
+      //! Pitch.
+      fp64_t
+      pitch(void) const
+      {
+        return read<fp64_t>(getPayload() + 36);
+      }
+
+      //! Yaw.
+      fp64_t
+      yaw(void) const
+      {
+        return read<fp64_t>(getPayload() + 44);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 52);
+      }
+    };
+
+    //! Read-only view of PopUp Maneuver.
+    class PopUpView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PopUpView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PopUpView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PopUpView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 451;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PopUp*
+      toMessage(void) const
+      {
+        return static_cast<PopUp*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 27);
+      }
+
+      //! Duration.
+      uint16_t
+      duration(void) const
+      {
+        return read<uint16_t>(getPayload() + 28);
+      }
+
+      //! Radius.
+      fp32_t
+      radius(void) const
+      {
+        return read<fp32_t>(getPayload() + 30);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 34);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 35);
+      }
+    };
+
+    //! Read-only view of Teleoperation Maneuver.
+    class TeleoperationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TeleoperationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TeleoperationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TeleoperationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 452;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Teleoperation*
+      toMessage(void) const
+      {
+        return static_cast<Teleoperation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of Loiter Maneuver.
+    class LoiterView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LoiterView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LoiterView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LoiterView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 453;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Loiter*
+      toMessage(void) const
+      {
+        return static_cast<Loiter*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Duration.
+      uint16_t
+      duration(void) const
+      {
+        return read<uint16_t>(getPayload() + 23);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 25);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 29);
+      }
+
+      //! Loiter Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload() + 30);
+      }
+
+      //! Radius.
+      fp32_t
+      radius(void) const
+      {
+        return read<fp32_t>(getPayload() + 31);
+      }
+
+      //! Length.
+      fp32_t
+      length(void) const
+      {
+        return read<fp32_t>(getPayload() + 35);
+      }
+
+      //! Bearing.
+      fp64_t
+      bearing(void) const
+      {
+        return read<fp64_t>(getPayload() + 39);
+      }
+
+      //! Direction.
+      uint8_t
+      direction(void) const
+      {
+        return read<uint8_t>(getPayload() + 47);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 48);
+      }
+    };
+
+    //! Read-only view of Idle Maneuver.
+    class IdleManeuverView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      IdleManeuverView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      IdleManeuverView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      IdleManeuverView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 454;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      IdleManeuver*
+      toMessage(void) const
+      {
+        return static_cast<IdleManeuver*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Duration.
+      uint16_t
+      duration(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 2);
+      }
+    };
+
+    //! Read-only view of Low Level Control Maneuver.
+    class LowLevelControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LowLevelControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LowLevelControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LowLevelControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 455;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LowLevelControl*
+      toMessage(void) const
+      {
+        return static_cast<LowLevelControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Control.
+      MessageView
+      control(void) const
+      {
+        return readInline(getPayload());
+      }
+
+      //! Duration.
+      uint16_t
+      duration(void) const;
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Rows Maneuver.
+    class RowsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RowsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RowsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RowsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 456;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Rows*
+      toMessage(void) const
+      {
+        return static_cast<Rows*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 27);
+      }
+
+      //! Bearing.
+      fp64_t
+      bearing(void) const
+      {
+        return read<fp64_t>(getPayload() + 28);
+      }
+
+      //! Cross Angle.
+      fp64_t
+      cross_angle(void) const
+      {
+        return read<fp64_t>(getPayload() + 36);
+      }
+
+      //! Width.
+      fp32_t
+      width(void) const
+      {
+        return read<fp32_t>(getPayload() + 44);
+      }
+
+      //! Length.
+      fp32_t
+      length(void) const
+      {
+        return read<fp32_t>(getPayload() + 48);
+      }
+
+      //! Horizontal Step.
+      fp32_t
+      hstep(void) const
+      {
+        return read<fp32_t>(getPayload() + 52);
+      }
+
+      //! Curve Offset.
+      uint8_t
+      coff(void) const
+      {
+        return read<uint8_t>(getPayload() + 56);
+      }
+
+      //! Alternation Parameter.
+      uint8_t
+      alternation(void) const
+      {
+        return read<uint8_t>(getPayload() + 57);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 58);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 59);
+      }
+    };
+
+    //! Read-only view of Path Point.
+    class PathPointView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PathPointView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PathPointView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PathPointView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 458;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PathPoint*
+      toMessage(void) const
+      {
+        return static_cast<PathPoint*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! North Offset (m).
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! East Offset (m).
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Down Offset (m).
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+    };
+
+    //! Read-only view of Follow Path Maneuver.
+    class FollowPathView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FollowPathView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FollowPathView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FollowPathView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 457;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FollowPath*
+      toMessage(void) const
+      {
+        return static_cast<FollowPath*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 27);
+      }
+
+      //! Path Points.
+      MessageListView
+      points(void) const
+      {
+        return readList(getPayload() + 28);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Yo-Yo Maneuver.
+    class YoYoView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      YoYoView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      YoYoView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      YoYoView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 459;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      YoYo*
+      toMessage(void) const
+      {
+        return static_cast<YoYo*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Amplitude.
+      fp32_t
+      amplitude(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Pitch Angle.
+      fp32_t
+      pitch(void) const
+      {
+        return read<fp32_t>(getPayload() + 27);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 31);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 35);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 36);
+      }
+    };
+
+    //! Read-only view of Teleoperation Done.
+    class TeleoperationDoneView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TeleoperationDoneView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TeleoperationDoneView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TeleoperationDoneView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 460;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TeleoperationDone*
+      toMessage(void) const
+      {
+        return static_cast<TeleoperationDone*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Station Keeping.
+    class StationKeepingView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      StationKeepingView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      StationKeepingView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      StationKeepingView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 461;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      StationKeeping*
+      toMessage(void) const
+      {
+        return static_cast<StationKeeping*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 20);
+      }
+
+      //! Radius.
+      fp32_t
+      radius(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Duration.
+      uint16_t
+      duration(void) const
+      {
+        return read<uint16_t>(getPayload() + 25);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 27);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 31);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 32);
+      }
+    };
+
+    //! Read-only view of Elevator Maneuver.
+    class ElevatorView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ElevatorView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ElevatorView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ElevatorView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 462;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Elevator*
+      toMessage(void) const
+      {
+        return static_cast<Elevator*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 3);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 11);
+      }
+
+      //! Start Point -- Z Reference.
+      fp32_t
+      start_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 19);
+      }
+
+      //! Start Point -- Z Units.
+      uint8_t
+      start_z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 23);
+      }
+
+      //! End Point -- Z Reference.
+      fp32_t
+      end_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 24);
+      }
+
+      //! End Point -- Z Units.
+      uint8_t
+      end_z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 28);
+      }
+
+      //! Radius.
+      fp32_t
+      radius(void) const
+      {
+        return read<fp32_t>(getPayload() + 29);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 33);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 37);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 38);
+      }
+    };
+
+    //! Read-only view of Trajectory Point.
+    class TrajectoryPointView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TrajectoryPointView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TrajectoryPointView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TrajectoryPointView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 464;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TrajectoryPoint*
+      toMessage(void) const
+      {
+        return static_cast<TrajectoryPoint*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! North Offset (m).
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! East Offset (m).
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Down Offset (m).
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Time Offset (s).
+      fp32_t
+      t(void) const
+      {
+        return read<fp32_t>(getPayload() + 12);
+      }
+    };
+
+    //! Read-only view of Follow Trajectory.
+    class FollowTrajectoryView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FollowTrajectoryView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FollowTrajectoryView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FollowTrajectoryView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 463;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FollowTrajectory*
+      toMessage(void) const
+      {
+        return static_cast<FollowTrajectory*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 27);
+      }
+
+      //! Trajectory Points.
+      MessageListView
+      points(void) const
+      {
+        return readList(getPayload() + 28);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Custom Maneuver.
+    class CustomManeuverView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CustomManeuverView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CustomManeuverView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CustomManeuverView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 465;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CustomManeuver*
+      toMessage(void) const
+      {
+        return static_cast<CustomManeuver*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Maneuver Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload() + 2);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Vehicle Formation Participant.
+    class VehicleFormationParticipantView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VehicleFormationParticipantView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VehicleFormationParticipantView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VehicleFormationParticipantView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 467;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VehicleFormationParticipant*
+      toMessage(void) const
+      {
+        return static_cast<VehicleFormationParticipant*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! ID (IMC address).
+      uint16_t
+      vid(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Formation offset -- Along-track.
+      fp32_t
+      off_x(void) const
+      {
+        return read<fp32_t>(getPayload() + 2);
+      }
+
+      //! Formation offset -- Cross-track.
+      fp32_t
+      off_y(void) const
+      {
+        return read<fp32_t>(getPayload() + 6);
+      }
+
+      //! Formation offset -- Depth/Altitude.
+      fp32_t
+      off_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 10);
+      }
+    };
+
+    //! Read-only view of Vehicle Formation.
+    class VehicleFormationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VehicleFormationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VehicleFormationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VehicleFormationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 466;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VehicleFormation*
+      toMessage(void) const
+      {
+        return static_cast<VehicleFormation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 20);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 25);
+      }
+
+      //! Trajectory Points.
+      MessageListView
+      points(void) const
+      {
+        return readList(getPayload() + 26);
+      }
+
+      //! Formation Participants.
+      MessageListView
+      participants(void) const;
+
+      //! Start Time.
+      fp64_t
+      start_time(void) const;
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Stop Maneuver.
+    class StopManeuverView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      StopManeuverView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      StopManeuverView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      StopManeuverView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 468;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      StopManeuver*
+      toMessage(void) const
+      {
+        return static_cast<StopManeuver*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Register Maneuver.
+    class RegisterManeuverView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RegisterManeuverView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RegisterManeuverView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RegisterManeuverView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 469;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RegisterManeuver*
+      toMessage(void) const
+      {
+        return static_cast<RegisterManeuver*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Maneuver ID.
+      uint16_t
+      mid(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Maneuver Control State.
+    class ManeuverControlStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ManeuverControlStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ManeuverControlStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ManeuverControlStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 470;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ManeuverControlState*
+      toMessage(void) const
+      {
+        return static_cast<ManeuverControlState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! State.
+      uint8_t
+      state(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Completion Time.
+      uint16_t
+      eta(void) const
+      {
+        return read<uint16_t>(getPayload() + 1);
+      }
+
+      //! Info.
+      DataView
+      info(void) const
+      {
+        return readData(getPayload() + 3);
+      }
+    };
+
+    //! Read-only view of Follow System.
+    class FollowSystemView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FollowSystemView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FollowSystemView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FollowSystemView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 471;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FollowSystem*
+      toMessage(void) const
+      {
+        return static_cast<FollowSystem*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! System To Follow.
+      uint16_t
+      system(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Duration.
+      uint16_t
+      duration(void) const
+      {
+        return read<uint16_t>(getPayload() + 2);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 8);
+      }
+
+      //! Offset -- X.
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload() + 9);
+      }
+
+      //! Offset -- Y.
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 13);
+      }
+
+      //! Coordinate -- Z.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 17);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 21);
+      }
+    };
+
+    //! Read-only view of Communications Relay.
+    class CommsRelayView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CommsRelayView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CommsRelayView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CommsRelayView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 472;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CommsRelay*
+      toMessage(void) const
+      {
+        return static_cast<CommsRelay*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 20);
+      }
+
+      //! Duration.
+      uint16_t
+      duration(void) const
+      {
+        return read<uint16_t>(getPayload() + 21);
+      }
+
+      //! System A.
+      uint16_t
+      sys_a(void) const
+      {
+        return read<uint16_t>(getPayload() + 23);
+      }
+
+      //! System B.
+      uint16_t
+      sys_b(void) const
+      {
+        return read<uint16_t>(getPayload() + 25);
+      }
+
+      //! Move threshold.
+      fp32_t
+      move_threshold(void) const
+      {
+        return read<fp32_t>(getPayload() + 27);
+      }
+    };
+
+    //! Read-only view of Polygon Vertex.
+    class PolygonVertexView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PolygonVertexView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PolygonVertexView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PolygonVertexView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 474;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PolygonVertex*
+      toMessage(void) const
+      {
+        return static_cast<PolygonVertex*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+    };
+
+    //! Read-only view of Cover Area.
+    class CoverAreaView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CoverAreaView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CoverAreaView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CoverAreaView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 473;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CoverArea*
+      toMessage(void) const
+      {
+        return static_cast<CoverArea*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 20);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 25);
+      }
+
+      //! Polygon.
+      MessageListView
+      polygon(void) const
+      {
+        return readList(getPayload() + 26);
+      }
+
+      //! CustomParameters.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Compass Calibration Maneuver.
+    class CompassCalibrationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CompassCalibrationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CompassCalibrationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CompassCalibrationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 475;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CompassCalibration*
+      toMessage(void) const
+      {
+        return static_cast<CompassCalibration*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Pitch.
+      fp32_t
+      pitch(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Amplitude.
+      fp32_t
+      amplitude(void) const
+      {
+        return read<fp32_t>(getPayload() + 27);
+      }
+
+      //! Duration.
+      uint16_t
+      duration(void) const
+      {
+        return read<uint16_t>(getPayload() + 31);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 33);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 37);
+      }
+
+      //! Radius.
+      fp32_t
+      radius(void) const
+      {
+        return read<fp32_t>(getPayload() + 38);
+      }
+
+      //! Direction.
+      uint8_t
+      direction(void) const
+      {
+        return read<uint8_t>(getPayload() + 42);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 43);
+      }
+    };
+
+    //! Read-only view of Formation Parameters.
+    class FormationParametersView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormationParametersView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormationParametersView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormationParametersView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 476;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormationParameters*
+      toMessage(void) const
+      {
+        return static_cast<FormationParameters*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Formation Name.
+      DataView
+      formation_name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Formation Reference Frame.
+      uint8_t
+      reference_frame(void) const;
+
+      //! Formation Participants.
+      MessageListView
+      participants(void) const;
+
+      //! Custom settings for formation.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Formation Plan Execution.
+    class FormationPlanExecutionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormationPlanExecutionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormationPlanExecutionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormationPlanExecutionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 477;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormationPlanExecution*
+      toMessage(void) const
+      {
+        return static_cast<FormationPlanExecution*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Target Group Name.
+      DataView
+      group_name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Formation Name.
+      DataView
+      formation_name(void) const;
+
+      //! Formation Plan ID.
+      DataView
+      plan_id(void) const;
+
+      //! Plan Description.
+      DataView
+      description(void) const;
+
+      //! Formation Leader Flight Airspeed.
+      fp32_t
+      leader_speed(void) const;
+
+      //! Formation leader flight bank limit.
+      fp32_t
+      leader_bank_lim(void) const;
+
+      //! Position mismatch limit.
+      fp32_t
+      pos_sim_err_lim(void) const;
+
+      //! Position mismatch threshold.
+      fp32_t
+      pos_sim_err_wrn(void) const;
+
+      //! Position mismatch time-out.
+      uint16_t
+      pos_sim_err_timeout(void) const;
+
+      //! Convergence threshold.
+      fp32_t
+      converg_max(void) const;
+
+      //! Convergence time-out.
+      uint16_t
+      converg_timeout(void) const;
+
+      //! Communications time-out.
+      uint16_t
+      comms_timeout(void) const;
+
+      //! Turbulence limit.
+      fp32_t
+      turb_lim(void) const;
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Follow Reference Maneuver.
+    class FollowReferenceView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FollowReferenceView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FollowReferenceView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FollowReferenceView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 478;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FollowReference*
+      toMessage(void) const
+      {
+        return static_cast<FollowReference*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Controlling Source.
+      uint16_t
+      control_src(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Controlling Entity.
+      uint8_t
+      control_ent(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! Reference Update Timeout.
+      fp32_t
+      timeout(void) const
+      {
+        return read<fp32_t>(getPayload() + 3);
+      }
+
+      //! Loiter Radius.
+      fp32_t
+      loiter_radius(void) const
+      {
+        return read<fp32_t>(getPayload() + 7);
+      }
+
+      //! Altitude Interval.
+      fp32_t
+      altitude_interval(void) const
+      {
+        return read<fp32_t>(getPayload() + 11);
+      }
+    };
+
+    //! Read-only view of Reference To Follow.
+    class ReferenceView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ReferenceView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ReferenceView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ReferenceView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 479;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Reference*
+      toMessage(void) const
+      {
+        return static_cast<Reference*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Speed Reference.
+      DesiredSpeedView
+      speed(void) const;
+
+      //! Z Reference.
+      DesiredZView
+      z(void) const;
+
+      //! Latitude Reference.
+      fp64_t
+      lat(void) const;
+
+      //! Longitude Reference.
+      fp64_t
+      lon(void) const;
+
+      //! Radius.
+      fp32_t
+      radius(void) const;
+    };
+
+    //! Read-only view of Follow Reference State.
+    class FollowRefStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FollowRefStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FollowRefStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FollowRefStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 480;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FollowRefState*
+      toMessage(void) const
+      {
+        return static_cast<FollowRefState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Controlling Source.
+      uint16_t
+      control_src(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Controlling Entity.
+      uint8_t
+      control_ent(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! Reference.
+      ReferenceView
+      reference(void) const;
+
+      //! State.
+      uint8_t
+      state(void) const;
+
+      //! Proximity.
+      uint8_t
+      proximity(void) const;
+    };
+
+    //! Read-only view of Relative State.
+    class RelativeStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RelativeStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RelativeStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RelativeStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 482;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RelativeState*
+      toMessage(void) const
+      {
+        return static_cast<RelativeState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! System Identifier.
+      DataView
+      s_id(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Distance.
+      fp32_t
+      dist(void) const;
+
+      //! Position Error.
+      fp32_t
+      err(void) const;
+
+      //! Control Importance.
+      fp32_t
+      ctrl_imp(void) const;
+
+      //! Relative Direction X (North).
+      fp32_t
+      rel_dir_x(void) const;
+
+      //! Relative Direction Y (East).
+      fp32_t
+      rel_dir_y(void) const;
+
+      //! Relative Direction Z (Down).
+      fp32_t
+      rel_dir_z(void) const;
+
+      //! X Position Error (North).
+      fp32_t
+      err_x(void) const;
+
+      //! Y Position Error (East).
+      fp32_t
+      err_y(void) const;
+
+      //! Z Position Error (Down).
+      fp32_t
+      err_z(void) const;
+
+      //! X Position Error In Relative Frame (North).
+      fp32_t
+      rf_err_x(void) const;
+
+      //! Y Position Error In Relative Frame (East).
+      fp32_t
+      rf_err_y(void) const;
+
+      //! Z Position Error In Relative Frame (Down).
+      fp32_t
+      rf_err_z(void) const;
+
+      //! X Velocity Error In Relative Frame (North).
+      fp32_t
+      rf_err_vx(void) const;
+
+      //! Y Velocity Error In Relative Frame (East).
+      fp32_t
+      rf_err_vy(void) const;
+
+      //! Z Velocity Error In Relative Frame (Down).
+      fp32_t
+      rf_err_vz(void) const;
+
+      //! X Convergence Deviation (North).
+      fp32_t
+      ss_x(void) const;
+
+      //! Y Convergence Deviation (East).
+      fp32_t
+      ss_y(void) const;
+
+      //! Z Convergence Deviation (Down).
+      fp32_t
+      ss_z(void) const;
+
+      //! X Virtual Error (North).
+      fp32_t
+      virt_err_x(void) const;
+
+      //! Y Virtual Error (East).
+      fp32_t
+      virt_err_y(void) const;
+
+      //! Z Virtual Error (Down).
+      fp32_t
+      virt_err_z(void) const;
+    };
+
+    //! Read-only view of Formation Monitoring Data.
+    class FormationMonitorView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormationMonitorView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormationMonitorView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormationMonitorView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 481;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormationMonitor*
+      toMessage(void) const
+      {
+        return static_cast<FormationMonitor*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Commanded X Acceleration (North).
+      fp32_t
+      ax_cmd(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Commanded Y Acceleration (East).
+      fp32_t
+      ay_cmd(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Commanded Z Acceleration (Down).
+      fp32_t
+      az_cmd(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Desired X Acceleration (North).
+      fp32_t
+      ax_des(void) const
+      {
+        return read<fp32_t>(getPayload() + 12);
+      }
+
+      //! Desired Y Acceleration (East).
+      fp32_t
+      ay_des(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Desired Z Acceleration (Down).
+      fp32_t
+      az_des(void) const
+      {
+        return read<fp32_t>(getPayload() + 20);
+      }
+
+      //! X Virtual Error (North).
+      fp32_t
+      virt_err_x(void) const
+      {
+        return read<fp32_t>(getPayload() + 24);
+      }
+
+      //! Y Virtual Error (East).
+      fp32_t
+      virt_err_y(void) const
+      {
+        return read<fp32_t>(getPayload() + 28);
+      }
+
+      //! Z Virtual Error (Down).
+      fp32_t
+      virt_err_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 32);
+      }
+
+      //! X Sliding Surface Feedback (North).
+      fp32_t
+      surf_fdbk_x(void) const
+      {
+        return read<fp32_t>(getPayload() + 36);
+      }
+
+      //! Y Sliding Surface Feedback (East).
+      fp32_t
+      surf_fdbk_y(void) const
+      {
+        return read<fp32_t>(getPayload() + 40);
+      }
+
+      //! Z Sliding Surface Feedback (Down).
+      fp32_t
+      surf_fdbk_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 44);
+      }
+
+      //! X Uncertainty Compensation (North).
+      fp32_t
+      surf_unkn_x(void) const
+      {
+        return read<fp32_t>(getPayload() + 48);
+      }
+
+      //! Y Uncertainty Compensation (East).
+      fp32_t
+      surf_unkn_y(void) const
+      {
+        return read<fp32_t>(getPayload() + 52);
+      }
+
+      //! Z Uncertainty Compensation (Down).
+      fp32_t
+      surf_unkn_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 56);
+      }
+
+      //! X Convergence Deviation (North).
+      fp32_t
+      ss_x(void) const
+      {
+        return read<fp32_t>(getPayload() + 60);
+      }
+
+      //! Y Convergence Deviation (East).
+      fp32_t
+      ss_y(void) const
+      {
+        return read<fp32_t>(getPayload() + 64);
+      }
+
+      //! Z Convergence Deviation (Down).
+      fp32_t
+      ss_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 68);
+      }
+
+      //! Relative State.
+      MessageListView
+      rel_state(void) const
+      {
+        return readList(getPayload() + 72);
+      }
+    };
+
+    //! Read-only view of Dislodge Maneuver.
+    class DislodgeView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DislodgeView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DislodgeView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DislodgeView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 483;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Dislodge*
+      toMessage(void) const
+      {
+        return static_cast<Dislodge*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! RPM.
+      fp32_t
+      rpm(void) const
+      {
+        return read<fp32_t>(getPayload() + 2);
+      }
+
+      //! Direction.
+      uint8_t
+      direction(void) const
+      {
+        return read<uint8_t>(getPayload() + 6);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 7);
+      }
+    };
+
+    //! Read-only view of Formation.
+    class FormationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 484;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Formation*
+      toMessage(void) const
+      {
+        return static_cast<Formation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Formation Name.
+      DataView
+      formation_name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Type.
+      uint8_t
+      type(void) const;
+
+      //! Operation.
+      uint8_t
+      op(void) const;
+
+      //! Target Group Name.
+      DataView
+      group_name(void) const;
+
+      //! Formation Plan ID.
+      DataView
+      plan_id(void) const;
+
+      //! Plan Description.
+      DataView
+      description(void) const;
+
+      //! Formation Reference Frame.
+      uint8_t
+      reference_frame(void) const;
+
+      //! Formation Participants.
+      MessageListView
+      participants(void) const;
+
+      //! Formation Leader Bank Limit.
+      fp32_t
+      leader_bank_lim(void) const;
+
+      //! Formation Leader Minimum Speed.
+      fp32_t
+      leader_speed_min(void) const;
+
+      //! Formation Leader Maximum Speed.
+      fp32_t
+      leader_speed_max(void) const;
+
+      //! Formation Leader Minimum Altitude.
+      fp32_t
+      leader_alt_min(void) const;
+
+      //! Formation Leader Maximum Altitude.
+      fp32_t
+      leader_alt_max(void) const;
+
+      //! Position mismatch limit.
+      fp32_t
+      pos_sim_err_lim(void) const;
+
+      //! Position mismatch threshold.
+      fp32_t
+      pos_sim_err_wrn(void) const;
+
+      //! Position mismatch time-out.
+      uint16_t
+      pos_sim_err_timeout(void) const;
+
+      //! Convergence threshold.
+      fp32_t
+      converg_max(void) const;
+
+      //! Convergence time-out.
+      uint16_t
+      converg_timeout(void) const;
+
+      //! Communications time-out.
+      uint16_t
+      comms_timeout(void) const;
+
+      //! Turbulence limit.
+      fp32_t
+      turb_lim(void) const;
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const;
+    };
+
+    //! Read-only view of Launch Maneuver.
+    class LaunchView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LaunchView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LaunchView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LaunchView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 485;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Launch*
+      toMessage(void) const
+      {
+        return static_cast<Launch*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 27);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 28);
+      }
+    };
+
+    //! Read-only view of Drop Maneuver.
+    class DropView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DropView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DropView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DropView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 486;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Drop*
+      toMessage(void) const
+      {
+        return static_cast<Drop*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 27);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 28);
+      }
+    };
+
+    //! Read-only view of Scheduled Goto.
+    class ScheduledGotoView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ScheduledGotoView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ScheduledGotoView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ScheduledGotoView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 487;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ScheduledGoto*
+      toMessage(void) const
+      {
+        return static_cast<ScheduledGoto*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Time of arrival.
+      fp64_t
+      arrival_time(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Destination Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Destination Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Destination Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 24);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 28);
+      }
+
+      //! Travel Z Reference.
+      fp32_t
+      travel_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 29);
+      }
+
+      //! Travel Z Units.
+      uint8_t
+      travel_z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 33);
+      }
+
+      //! Delayed Behavior.
+      uint8_t
+      delayed(void) const
+      {
+        return read<uint8_t>(getPayload() + 34);
+      }
+    };
+
+    //! Read-only view of Rows Coverage.
+    class RowsCoverageView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RowsCoverageView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RowsCoverageView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RowsCoverageView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 488;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RowsCoverage*
+      toMessage(void) const
+      {
+        return static_cast<RowsCoverage*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 20);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 25);
+      }
+
+      //! Bearing.
+      fp64_t
+      bearing(void) const
+      {
+        return read<fp64_t>(getPayload() + 26);
+      }
+
+      //! Cross Angle.
+      fp64_t
+      cross_angle(void) const
+      {
+        return read<fp64_t>(getPayload() + 34);
+      }
+
+      //! Width.
+      fp32_t
+      width(void) const
+      {
+        return read<fp32_t>(getPayload() + 42);
+      }
+
+      //! Length.
+      fp32_t
+      length(void) const
+      {
+        return read<fp32_t>(getPayload() + 46);
+      }
+
+      //! Curve Offset.
+      uint8_t
+      coff(void) const
+      {
+        return read<uint8_t>(getPayload() + 50);
+      }
+
+      //! Angular Aperture.
+      fp32_t
+      angaperture(void) const
+      {
+        return read<fp32_t>(getPayload() + 51);
+      }
+
+      //! Range.
+      uint16_t
+      range(void) const
+      {
+        return read<uint16_t>(getPayload() + 55);
+      }
+
+      //! Overlap.
+      uint8_t
+      overlap(void) const
+      {
+        return read<uint8_t>(getPayload() + 57);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const
+      {
+        return read<uint8_t>(getPayload() + 58);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 59);
+      }
+    };
+
+    //! Read-only view of Sample Maneuver.
+    class SampleView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SampleView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SampleView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SampleView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 489;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Sample*
+      toMessage(void) const
+      {
+        return static_cast<Sample*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeout.
+      uint16_t
+      timeout(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 22);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 23);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 27);
+      }
+
+      //! Syringe0.
+      uint8_t
+      syringe0(void) const
+      {
+        return read<uint8_t>(getPayload() + 28);
+      }
+
+      //! Syringe1.
+      uint8_t
+      syringe1(void) const
+      {
+        return read<uint8_t>(getPayload() + 29);
+      }
+
+      //! Syringe2.
+      uint8_t
+      syringe2(void) const
+      {
+        return read<uint8_t>(getPayload() + 30);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 31);
+      }
+    };
+
+    //! Read-only view of Image Tracking.
+    class ImageTrackingView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ImageTrackingView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ImageTrackingView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ImageTrackingView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 490;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ImageTracking*
+      toMessage(void) const
+      {
+        return static_cast<ImageTracking*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Takeoff Maneuver.
+    class TakeoffView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TakeoffView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TakeoffView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TakeoffView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 491;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Takeoff*
+      toMessage(void) const
+      {
+        return static_cast<Takeoff*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 20);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 25);
+      }
+
+      //! Pitch Angle.
+      fp32_t
+      takeoff_pitch(void) const
+      {
+        return read<fp32_t>(getPayload() + 26);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 30);
+      }
+    };
+
+    //! Read-only view of Land Maneuver.
+    class LandView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LandView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LandView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LandView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 492;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Land*
+      toMessage(void) const
+      {
+        return static_cast<Land*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 20);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Speed Units.
+      uint8_t
+      speed_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 25);
+      }
+
+      //! Abort Z Reference.
+      fp32_t
+      abort_z(void) const
+      {
+        return read<fp32_t>(getPayload() + 26);
+      }
+
+      //! Bearing.
+      fp64_t
+      bearing(void) const
+      {
+        return read<fp64_t>(getPayload() + 30);
+      }
+
+      //! Glide Slope.
+      uint8_t
+      glide_slope(void) const
+      {
+        return read<uint8_t>(getPayload() + 38);
+      }
+
+      //! Glide Slope Altitude.
+      fp32_t
+      glide_slope_alt(void) const
+      {
+        return read<fp32_t>(getPayload() + 39);
+      }
+
+      //! Custom settings for maneuver.
+      DataView
+      custom(void) const
+      {
+        return readData(getPayload() + 43);
+      }
+    };
+
+    //! Read-only view of Vehicle State.
+    class VehicleStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VehicleStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VehicleStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VehicleStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 500;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VehicleState*
+      toMessage(void) const
+      {
+        return static_cast<VehicleState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation Mode.
+      uint8_t
+      op_mode(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Errors -- Count.
+      uint8_t
+      error_count(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Errors -- Entities.
+      DataView
+      error_ents(void) const
+      {
+        return readData(getPayload() + 2);
+      }
+
+      //! Maneuver -- Type.
+      uint16_t
+      maneuver_type(void) const;
+
+      //! Maneuver -- Start Time.
+      fp64_t
+      maneuver_stime(void) const;
+
+      //! Maneuver -- ETA.
+      uint16_t
+      maneuver_eta(void) const;
+
+      //! Control Loops.
+      uint32_t
+      control_loops(void) const;
+
+      //! Flags.
+      uint8_t
+      flags(void) const;
+
+      //! Last Error -- Description.
+      DataView
+      last_error(void) const;
+
+      //! Last Error -- Time.
+      fp64_t
+      last_error_time(void) const;
+    };
+
+    //! Read-only view of Vehicle Command.
+    class VehicleCommandView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VehicleCommandView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VehicleCommandView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VehicleCommandView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 501;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VehicleCommand*
+      toMessage(void) const
+      {
+        return static_cast<VehicleCommand*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Request ID.
+      uint16_t
+      request_id(void) const
+      {
+        return read<uint16_t>(getPayload() + 1);
+      }
+
+      //! Command.
+      uint8_t
+      command(void) const
+      {
+        return read<uint8_t>(getPayload() + 3);
+      }
+
+      //! Maneuver.
+      MessageView
+      maneuver(void) const
+      {
+        return readInline(getPayload() + 4);
+      }
+
+      //! Calibration Time.
+      uint16_t
+      calib_time(void) const;
+
+      //! Info.
+      DataView
+      info(void) const;
+    };
+
+    //! Read-only view of Monitor Entity State.
+    class MonitorEntityStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      MonitorEntityStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      MonitorEntityStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      MonitorEntityStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 502;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      MonitorEntityState*
+      toMessage(void) const
+      {
+        return static_cast<MonitorEntityState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Command.
+      uint8_t
+      command(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Entity Names.
+      DataView
+      entities(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Entity Monitoring State.
+    class EntityMonitoringStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EntityMonitoringStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EntityMonitoringStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EntityMonitoringStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 503;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EntityMonitoringState*
+      toMessage(void) const
+      {
+        return static_cast<EntityMonitoringState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entities monitored - Count.
+      uint8_t
+      mcount(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Entities monitored - Names.
+      DataView
+      mnames(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Entities with errors - Count.
+      uint8_t
+      ecount(void) const;
+
+      //! Entities with errors - Names.
+      DataView
+      enames(void) const;
+
+      //! Entities with critical errors - Count.
+      uint8_t
+      ccount(void) const;
+
+      //! Entities with critical errors - Names.
+      DataView
+      cnames(void) const;
+
+      //! Last Error -- Description.
+      DataView
+      last_error(void) const;
+
+      //! Last Error -- Time.
+      fp64_t
+      last_error_time(void) const;
+    };
+
+    //! Read-only view of Operational Limits.
+    class OperationalLimitsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      OperationalLimitsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      OperationalLimitsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      OperationalLimitsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 504;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      OperationalLimits*
+      toMessage(void) const
+      {
+        return static_cast<OperationalLimits*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Field Indicator Mask.
+      uint8_t
+      mask(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Maximum Depth.
+      fp32_t
+      max_depth(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+
+      //! Minimum Altitude.
+      fp32_t
+      min_altitude(void) const
+      {
+        return read<fp32_t>(getPayload() + 5);
+      }
+
+      //! Maximum Altitude.
+      fp32_t
+      max_altitude(void) const
+      {
+        return read<fp32_t>(getPayload() + 9);
+      }
+
+      //! Minimum Speed.
+      fp32_t
+      min_speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 13);
+      }
+
+      //! Maximum Speed.
+      fp32_t
+      max_speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 17);
+      }
+
+      //! Maximum Vertical Rate.
+      fp32_t
+      max_vrate(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Area -- WGS-84 Latitude.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 25);
+      }
+
+      //! Area -- WGS-84 Longitude.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 33);
+      }
+
+      //! Area -- Orientation.
+      fp32_t
+      orientation(void) const
+      {
+        return read<fp32_t>(getPayload() + 41);
+      }
+
+      //! Area -- Width.
+      fp32_t
+      width(void) const
+      {
+        return read<fp32_t>(getPayload() + 45);
+      }
+
+      //! Area -- Length.
+      fp32_t
+      length(void) const
+      {
+        return read<fp32_t>(getPayload() + 49);
+      }
+    };
+
+    //! Read-only view of Get Operational Limits.
+    class GetOperationalLimitsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GetOperationalLimitsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GetOperationalLimitsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GetOperationalLimitsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 505;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GetOperationalLimits*
+      toMessage(void) const
+      {
+        return static_cast<GetOperationalLimits*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Calibration.
+    class CalibrationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CalibrationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CalibrationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CalibrationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 506;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Calibration*
+      toMessage(void) const
+      {
+        return static_cast<Calibration*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Duration.
+      uint16_t
+      duration(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Control Loops.
+    class ControlLoopsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ControlLoopsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ControlLoopsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ControlLoopsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 507;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ControlLoops*
+      toMessage(void) const
+      {
+        return static_cast<ControlLoops*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Enable.
+      uint8_t
+      enable(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Control Loop Mask.
+      uint32_t
+      mask(void) const
+      {
+        return read<uint32_t>(getPayload() + 1);
+      }
+
+      //! Scope Time Reference.
+      uint32_t
+      scope_ref(void) const
+      {
+        return read<uint32_t>(getPayload() + 5);
+      }
+    };
+
+    //! Read-only view of Vehicle Medium.
+    class VehicleMediumView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VehicleMediumView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VehicleMediumView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VehicleMediumView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 508;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VehicleMedium*
+      toMessage(void) const
+      {
+        return static_cast<VehicleMedium*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Medium.
+      uint8_t
+      medium(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Collision.
+    class CollisionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CollisionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CollisionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CollisionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 509;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Collision*
+      toMessage(void) const
+      {
+        return static_cast<Collision*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Collision value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Formation Tracking State.
+    class FormStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 510;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormState*
+      toMessage(void) const
+      {
+        return static_cast<FormState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Position Mismatch.
+      fp32_t
+      possimerr(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Convergence.
+      fp32_t
+      converg(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Stream Turbulence.
+      fp32_t
+      turbulence(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+
+      //! Position Mismatch Monitor.
+      uint8_t
+      possimmon(void) const
+      {
+        return read<uint8_t>(getPayload() + 12);
+      }
+
+      //! Communications Monitor.
+      uint8_t
+      commmon(void) const
+      {
+        return read<uint8_t>(getPayload() + 13);
+      }
+
+      //! Convergence.
+      uint8_t
+      convergmon(void) const
+      {
+        return read<uint8_t>(getPayload() + 14);
+      }
+    };
+
+    //! Read-only view of Autopilot Mode.
+    class AutopilotModeView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AutopilotModeView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AutopilotModeView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AutopilotModeView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 511;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      AutopilotMode*
+      toMessage(void) const
+      {
+        return static_cast<AutopilotMode*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Autonomy Level.
+      uint8_t
+      autonomy(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Mode.
+      DataView
+      mode(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Formation Tracking State.
+    class FormationStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormationStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormationStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormationStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 512;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormationState*
+      toMessage(void) const
+      {
+        return static_cast<FormationState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Position Mismatch.
+      fp32_t
+      possimerr(void) const
+      {
+        return read<fp32_t>(getPayload() + 2);
+      }
+
+      //! Convergence.
+      fp32_t
+      converg(void) const
+      {
+        return read<fp32_t>(getPayload() + 6);
+      }
+
+      //! Stream Turbulence.
+      fp32_t
+      turbulence(void) const
+      {
+        return read<fp32_t>(getPayload() + 10);
+      }
+
+      //! Position Mismatch Monitor.
+      uint8_t
+      possimmon(void) const
+      {
+        return read<uint8_t>(getPayload() + 14);
+      }
+
+      //! Communications Monitor.
+      uint8_t
+      commmon(void) const
+      {
+        return read<uint8_t>(getPayload() + 15);
+      }
+
+      //! Convergence.
+      uint8_t
+      convergmon(void) const
+      {
+        return read<uint8_t>(getPayload() + 16);
+      }
+    };
+
+    //! Read-only view of Report Control.
+    class ReportControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ReportControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ReportControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ReportControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 513;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ReportControl*
+      toMessage(void) const
+      {
+        return static_cast<ReportControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Communication Interface.
+      uint8_t
+      comm_interface(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Period.
+      uint16_t
+      period(void) const
+      {
+        return read<uint16_t>(getPayload() + 2);
+      }
+
+      //! Destination System.
+      DataView
+      sys_dst(void) const
+      {
+        return readData(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Abort.
+    class AbortView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AbortView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AbortView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AbortView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 550;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Abort*
+      toMessage(void) const
+      {
+        return static_cast<Abort*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Plan Variable.
+    class PlanVariableView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanVariableView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanVariableView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanVariableView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 561;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanVariable*
+      toMessage(void) const
+      {
+        return static_cast<PlanVariable*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Value.
+      DataView
+      value(void) const;
+
+      //! Type.
+      uint8_t
+      type(void) const;
+
+      //! Access Type.
+      uint8_t
+      access(void) const;
+    };
+
+    //! Read-only view of Plan Maneuver.
+    class PlanManeuverView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanManeuverView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanManeuverView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanManeuverView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 552;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanManeuver*
+      toMessage(void) const
+      {
+        return static_cast<PlanManeuver*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Maneuver ID.
+      DataView
+      maneuver_id(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Maneuver Specification.
+      MessageView
+      data(void) const;
+
+      //! Start Actions.
+      MessageListView
+      start_actions(void) const;
+
+      //! End Actions.
+      MessageListView
+      end_actions(void) const;
+    };
+
+    //! Read-only view of Plan Transition.
+    class PlanTransitionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanTransitionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanTransitionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanTransitionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 553;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanTransition*
+      toMessage(void) const
+      {
+        return static_cast<PlanTransition*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Source.
+      DataView
+      source_man(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Destination Maneuver Name.
+      DataView
+      dest_man(void) const;
+
+      //! Transition conditions.
+      DataView
+      conditions(void) const;
+
+      //! Transition actions.
+      MessageListView
+      actions(void) const;
+    };
+
+    //! Read-only view of Plan Specification.
+    class PlanSpecificationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanSpecificationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanSpecificationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanSpecificationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 551;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanSpecification*
+      toMessage(void) const
+      {
+        return static_cast<PlanSpecification*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Plan ID.
+      DataView
+      plan_id(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Plan Description.
+      DataView
+      description(void) const;
+
+      //! Namespace.
+      DataView
+      vnamespace(void) const;
+
+      //! Plan Variables.
+      MessageListView
+      variables(void) const;
+
+      //! Starting maneuver.
+      DataView
+      start_man_id(void) const;
+
+      //! Maneuvers.
+      MessageListView
+      maneuvers(void) const;
+
+      //! Transitions.
+      MessageListView
+      transitions(void) const;
+
+      //! Start Actions.
+      MessageListView
+      start_actions(void) const;
+
+      //! End Actions.
+      MessageListView
+      end_actions(void) const;
+    };
+
+    //! Read-only view of Emergency Control.
+    class EmergencyControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EmergencyControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EmergencyControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EmergencyControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 554;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EmergencyControl*
+      toMessage(void) const
+      {
+        return static_cast<EmergencyControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Command.
+      uint8_t
+      command(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Plan Specification.
+      PlanSpecificationView
+      plan(void) const;
+    };
+
+    //! Read-only view of Emergency Control State.
+    class EmergencyControlStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EmergencyControlStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EmergencyControlStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EmergencyControlStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 555;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EmergencyControlState*
+      toMessage(void) const
+      {
+        return static_cast<EmergencyControlState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! State.
+      uint8_t
+      state(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Plan Id.
+      DataView
+      plan_id(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Communications Level.
+      uint8_t
+      comm_level(void) const;
+    };
+
+    //! Read-only view of Plan DB.
+    class PlanDBView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanDBView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanDBView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanDBView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 556;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanDB*
+      toMessage(void) const
+      {
+        return static_cast<PlanDB*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Request ID.
+      uint16_t
+      request_id(void) const
+      {
+        return read<uint16_t>(getPayload() + 2);
+      }
+
+      //! Plan ID.
+      DataView
+      plan_id(void) const
+      {
+        return readData(getPayload() + 4);
+      }
+
+      //! Argument.
+      MessageView
+      arg(void) const;
+
+      //! Complementary Information.
+      DataView
+      info(void) const;
+    };
+
+    //! Read-only view of Plan DB Information.
+    class PlanDBInformationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanDBInformationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanDBInformationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanDBInformationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 558;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanDBInformation*
+      toMessage(void) const
+      {
+        return static_cast<PlanDBInformation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Plan ID.
+      DataView
+      plan_id(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Plan Size.
+      uint16_t
+      plan_size(void) const;
+
+      //! Last Changed -- Time.
+      fp64_t
+      change_time(void) const;
+
+      //! Last Change -- Source Address.
+      uint16_t
+      change_sid(void) const;
+
+      //! Last Change -- Source Name.
+      DataView
+      change_sname(void) const;
+
+      //! MD5.
+      DataView
+      md5(void) const;
+    };
+
+    //! Read-only view of Plan DB State.
+    class PlanDBStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanDBStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanDBStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanDBStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 557;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanDBState*
+      toMessage(void) const
+      {
+        return static_cast<PlanDBState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Plan -- Count.
+      uint16_t
+      plan_count(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Plan -- Size of all plans.
+      uint32_t
+      plan_size(void) const
+      {
+        return read<uint32_t>(getPayload() + 2);
+      }
+
+      //! Last Change -- Time.
+      fp64_t
+      change_time(void) const
+      {
+        return read<fp64_t>(getPayload() + 6);
+      }
+
+      //! Last Change -- Source Address.
+      uint16_t
+      change_sid(void) const
+      {
+        return read<uint16_t>(getPayload() + 14);
+      }
+
+      //! Last Change -- Source Name.
+      DataView
+      change_sname(void) const
+      {
+        return readData(getPayload() + 16);
+      }
+
+      //! MD5.
+      DataView
+      md5(void) const;
+
+      //! Plan info.
+      MessageListView
+      plans_info(void) const;
+    };
+
+    //! Read-only view of Plan Control.
+    class PlanControlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanControlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanControlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanControlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 559;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanControl*
+      toMessage(void) const
+      {
+        return static_cast<PlanControl*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Request ID.
+      uint16_t
+      request_id(void) const
+      {
+        return read<uint16_t>(getPayload() + 2);
+      }
+
+      //! Plan Identifier.
+      DataView
+      plan_id(void) const
+      {
+        return readData(getPayload() + 4);
+      }
+
+      //! Flags.
+      uint16_t
+      flags(void) const;
+
+      //! Request/Reply Argument.
+      MessageView
+      arg(void) const;
+
+      //! Complementary Info.
+      DataView
+      info(void) const;
+    };
+
+    //! Read-only view of Plan Control State.
+    class PlanControlStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanControlStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanControlStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanControlStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 560;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanControlState*
+      toMessage(void) const
+      {
+        return static_cast<PlanControlState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! State.
+      uint8_t
+      state(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Plan -- ID.
+      DataView
+      plan_id(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Plan -- ETA.
+      int32_t
+      plan_eta(void) const;
+
+      //! Plan -- Progress.
+      fp32_t
+      plan_progress(void) const;
+
+      //! Maneuver -- ID.
+      DataView
+      man_id(void) const;
+
+      //! Maneuver -- Type.
+      uint16_t
+      man_type(void) const;
+
+      //! Maneuver -- ETA.
+      int32_t
+      man_eta(void) const;
+
+      //! Last Plan Outcome.
+      uint8_t
+      last_outcome(void) const;
+    };
+
+    //! Read-only view of Plan Generation.
+    class PlanGenerationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanGenerationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanGenerationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanGenerationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 562;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanGeneration*
+      toMessage(void) const
+      {
+        return static_cast<PlanGeneration*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Command.
+      uint8_t
+      cmd(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Plan Identifier.
+      DataView
+      plan_id(void) const
+      {
+        return readData(getPayload() + 2);
+      }
+
+      //! Parameters.
+      DataView
+      params(void) const;
+    };
+
+    //! Read-only view of Leader State.
+    class LeaderStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      LeaderStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      LeaderStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      LeaderStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 563;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      LeaderState*
+      toMessage(void) const
+      {
+        return static_cast<LeaderState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Group Name.
+      DataView
+      group_name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Action on the leader state.
+      uint8_t
+      op(void) const;
+
+      //! Latitude (WGS-84).
+      fp64_t
+      lat(void) const;
+
+      //! Longitude (WGS-84).
+      fp64_t
+      lon(void) const;
+
+      //! Height (WGS-84).
+      fp32_t
+      height(void) const;
+
+      //! Offset north.
+      fp32_t
+      x(void) const;
+
+      //! Offset east.
+      fp32_t
+      y(void) const;
+
+      //! Offset down.
+      fp32_t
+      z(void) const;
+
+      //! Rotation over x axis.
+      fp32_t
+      phi(void) const;
+
+      //! Rotation over y axis.
+      fp32_t
+      theta(void) const;
+
+      //! Rotation over z axis.
+      fp32_t
+      psi(void) const;
+
+      //! Ground Velocity X (North).
+      fp32_t
+      vx(void) const;
+
+      //! Ground Velocity Y (East).
+      fp32_t
+      vy(void) const;
+
+      //! Ground Velocity Z (Down).
+      fp32_t
+      vz(void) const;
+
+      //! Angular Velocity in x.
+      fp32_t
+      p(void) const;
+
+      //! Angular Velocity in y.
+      fp32_t
+      q(void) const;
+
+      //! Angular Velocity in z.
+      fp32_t
+      r(void) const;
+
+      //! Stream Velocity X (North).
+      fp32_t
+      svx(void) const;
+
+      //! Stream Velocity Y (East).
+      fp32_t
+      svy(void) const;
+
+      //! Stream Velocity Z (Down).
+      fp32_t
+      svz(void) const;
+    };
+
+    //! Read-only view of Plan Statistics.
+    class PlanStatisticsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PlanStatisticsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PlanStatisticsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PlanStatisticsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 564;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PlanStatistics*
+      toMessage(void) const
+      {
+        return static_cast<PlanStatistics*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Plan Identifier.
+      DataView
+      plan_id(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Type.
+      uint8_t
+      type(void) const;
+
+      //! Properties.
+      uint8_t
+      properties(void) const;
+
+      //! Durations.
+      DataView
+      durations(void) const;
+
+      //! Distances.
+      DataView
+      distances(void) const;
+
+      //! Actions.
+      DataView
+      actions(void) const;
+
+      //! Fuel.
+      DataView
+      fuel(void) const;
+    };
+
+    //! Read-only view of Reported State.
+    class ReportedStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ReportedStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ReportedStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ReportedStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 600;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ReportedState*
+      toMessage(void) const
+      {
+        return static_cast<ReportedState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Depth.
+      fp64_t
+      depth(void) const
+      {
+        return read<fp64_t>(getPayload() + 16);
+      }
+
+      //! Roll.
+      fp64_t
+      roll(void) const
+      {
+        return read<fp64_t>(getPayload() + 24);
+      }
+
+      //! Pitch.
+      fp64_t
+      pitch(void) const
+      {
+        return read<fp64_t>(getPayload() + 32);
+      }
+
+      //! Yaw.
+      fp64_t
+      yaw(void) const
+      {
+        return read<fp64_t>(getPayload() + 40);
+      }
+
+      //! Reception Time.
+      fp64_t
+      rcp_time(void) const
+      {
+        return read<fp64_t>(getPayload() + 48);
+      }
+
+      //! System Identifier.
+      DataView
+      sid(void) const
+      {
+        return readData(getPayload() + 56);
+      }
+
+      //! Source Type.
+      uint8_t
+      s_type(void) const;
+    };
+
+    //! Read-only view of Remote Sensor Info.
+    class RemoteSensorInfoView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RemoteSensorInfoView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RemoteSensorInfoView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RemoteSensorInfoView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 601;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RemoteSensorInfo*
+      toMessage(void) const
+      {
+        return static_cast<RemoteSensorInfo*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Id.
+      DataView
+      id(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Class.
+      DataView
+      sensor_class(void) const;
+
+      //! Latitude.
+      fp64_t
+      lat(void) const;
+
+      //! Longitude.
+      fp64_t
+      lon(void) const;
+
+      //! Altitude.
+      fp32_t
+      alt(void) const;
+
+      //! Heading.
+      fp32_t
+      heading(void) const;
+
+      //! Custom Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of MapPoint.
+    class MapPointView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      MapPointView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      MapPointView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      MapPointView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 604;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      MapPoint*
+      toMessage(void) const
+      {
+        return static_cast<MapPoint*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload());
+      }
+
+      //! Longitude.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 8);
+      }
+
+      //! Altitude.
+      fp32_t
+      alt(void) const
+      {
+        return read<fp32_t>(getPayload() + 16);
+      }
+    };
+
+    //! Read-only view of Map Feature.
+    class MapFeatureView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      MapFeatureView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      MapFeatureView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      MapFeatureView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 603;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      MapFeature*
+      toMessage(void) const
+      {
+        return static_cast<MapFeature*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Identifier.
+      DataView
+      id(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! FeatureType.
+      uint8_t
+      feature_type(void) const;
+
+      //! RedComponent.
+      uint8_t
+      rgb_red(void) const;
+
+      //! GreenComponent.
+      uint8_t
+      rgb_green(void) const;
+
+      //! BlueComponent.
+      uint8_t
+      rgb_blue(void) const;
+
+      //! Feature.
+      MessageListView
+      feature(void) const;
+    };
+
+    //! Read-only view of Map.
+    class MapView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      MapView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      MapView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      MapView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 602;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Map*
+      toMessage(void) const
+      {
+        return static_cast<Map*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Identifier.
+      DataView
+      id(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Features.
+      MessageListView
+      features(void) const;
+    };
+
+    //! Read-only view of CCU Event.
+    class CcuEventView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CcuEventView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CcuEventView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CcuEventView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 606;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CcuEvent*
+      toMessage(void) const
+      {
+        return static_cast<CcuEvent*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Event Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Identifier.
+      DataView
+      id(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Additional Data.
+      MessageView
+      arg(void) const;
+    };
+
+    //! Read-only view of Vehicle Links.
+    class VehicleLinksView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      VehicleLinksView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      VehicleLinksView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      VehicleLinksView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 650;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      VehicleLinks*
+      toMessage(void) const
+      {
+        return static_cast<VehicleLinks*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Local Name.
+      DataView
+      localname(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Active Links.
+      MessageListView
+      links(void) const;
+    };
+
+    //! Read-only view of TREX Observation.
+    class TrexObservationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TrexObservationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TrexObservationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TrexObservationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 651;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TrexObservation*
+      toMessage(void) const
+      {
+        return static_cast<TrexObservation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeline.
+      DataView
+      timeline(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Predicate.
+      DataView
+      predicate(void) const;
+
+      //! Attributes.
+      DataView
+      attributes(void) const;
+    };
+
+    //! Read-only view of TREX Command.
+    class TrexCommandView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TrexCommandView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TrexCommandView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TrexCommandView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 652;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TrexCommand*
+      toMessage(void) const
+      {
+        return static_cast<TrexCommand*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Command.
+      uint8_t
+      command(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Goal Id.
+      DataView
+      goal_id(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Goal XML.
+      DataView
+      goal_xml(void) const;
+    };
+
+    //! Read-only view of TREX Attribute.
+    class TrexAttributeView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TrexAttributeView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TrexAttributeView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TrexAttributeView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 656;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TrexAttribute*
+      toMessage(void) const
+      {
+        return static_cast<TrexAttribute*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Attribute Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Attribute type.
+      uint8_t
+      attr_type(void) const;
+
+      //! Minimum.
+      DataView
+      min(void) const;
+
+      //! Maximum.
+      DataView
+      max(void) const;
+    };
+
+    //! Read-only view of TREX Token.
+    class TrexTokenView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TrexTokenView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TrexTokenView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TrexTokenView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 657;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TrexToken*
+      toMessage(void) const
+      {
+        return static_cast<TrexToken*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Timeline.
+      DataView
+      timeline(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Predicate.
+      DataView
+      predicate(void) const;
+
+      //! Attributes.
+      MessageListView
+      attributes(void) const;
+    };
+
+    //! Read-only view of TREX Operation.
+    class TrexOperationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TrexOperationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TrexOperationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TrexOperationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 655;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TrexOperation*
+      toMessage(void) const
+      {
+        return static_cast<TrexOperation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Goal Id.
+      DataView
+      goal_id(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+
+      //! Token.
+      TrexTokenView
+      token(void) const;
+    };
+
+    //! Read-only view of TREX Plan.
+    class TrexPlanView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TrexPlanView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TrexPlanView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TrexPlanView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 658;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      TrexPlan*
+      toMessage(void) const
+      {
+        return static_cast<TrexPlan*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Reactor name.
+      DataView
+      reactor(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Tokens.
+      MessageListView
+      tokens(void) const;
+    };
+
+    //! Read-only view of Event.
+    class EventView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EventView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EventView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EventView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 660;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Event*
+      toMessage(void) const
+      {
+        return static_cast<Event*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Topic.
+      DataView
+      topic(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of Compressed Image.
+    class CompressedImageView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CompressedImageView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CompressedImageView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CompressedImageView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 702;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CompressedImage*
+      toMessage(void) const
+      {
+        return static_cast<CompressedImage*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Frame Id.
+      uint8_t
+      frameid(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Data.
+      DataView
+      data(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Image Transmission Settings.
+    class ImageTxSettingsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ImageTxSettingsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ImageTxSettingsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ImageTxSettingsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 703;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ImageTxSettings*
+      toMessage(void) const
+      {
+        return static_cast<ImageTxSettings*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Frames Per Second.
+      uint8_t
+      fps(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Quality.
+      uint8_t
+      quality(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Repetitions.
+      uint8_t
+      reps(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! Target Size.
+      uint8_t
+      tsize(void) const
+      {
+        return read<uint8_t>(getPayload() + 3);
+      }
+    };
+
+    //! Read-only view of Remote State.
+    class RemoteStateView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      RemoteStateView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      RemoteStateView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      RemoteStateView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 750;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      RemoteState*
+      toMessage(void) const
+      {
+        return static_cast<RemoteState*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Latitude WGS-84.
+      fp32_t
+      lat(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Longitude WGS-84.
+      fp32_t
+      lon(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Depth.
+      uint8_t
+      depth(void) const
+      {
+        return read<uint8_t>(getPayload() + 8);
+      }
+
+      //! Speed.
+      fp32_t
+      speed(void) const
+      {
+        return read<fp32_t>(getPayload() + 9);
+      }
+
+      //! Heading.
+      fp32_t
+      psi(void) const
+      {
+        return read<fp32_t>(getPayload() + 13);
+      }
+    };
+
+    //! Read-only view of Target.
+    class TargetView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      TargetView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      TargetView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      TargetView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 800;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Target*
+      toMessage(void) const
+      {
+        return static_cast<Target*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Label.
+      DataView
+      label(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const;
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const;
+
+      //! Z Reference.
+      fp32_t
+      z(void) const;
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const;
+
+      //! Course Over Ground.
+      fp32_t
+      cog(void) const;
+
+      //! Speed Over Ground.
+      fp32_t
+      sog(void) const;
+    };
+
+    //! Read-only view of EntityParameter.
+    class EntityParameterView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EntityParameterView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EntityParameterView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EntityParameterView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 801;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EntityParameter*
+      toMessage(void) const
+      {
+        return static_cast<EntityParameter*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Value.
+      DataView
+      value(void) const;
+    };
+
+    //! Read-only view of EntityParameters.
+    class EntityParametersView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      EntityParametersView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      EntityParametersView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      EntityParametersView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 802;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      EntityParameters*
+      toMessage(void) const
+      {
+        return static_cast<EntityParameters*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entity Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Parameters.
+      MessageListView
+      params(void) const;
+    };
+
+    //! Read-only view of QueryEntityParameters.
+    class QueryEntityParametersView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      QueryEntityParametersView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      QueryEntityParametersView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      QueryEntityParametersView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 803;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      QueryEntityParameters*
+      toMessage(void) const
+      {
+        return static_cast<QueryEntityParameters*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entity Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Visibility.
+      DataView
+      visibility(void) const;
+
+      //! Scope.
+      DataView
+      scope(void) const;
+    };
+
+    //! Read-only view of SetEntityParameters.
+    class SetEntityParametersView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SetEntityParametersView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SetEntityParametersView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SetEntityParametersView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 804;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SetEntityParameters*
+      toMessage(void) const
+      {
+        return static_cast<SetEntityParameters*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entity Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Parameters.
+      MessageListView
+      params(void) const;
+    };
+
+    //! Read-only view of SaveEntityParameters.
+    class SaveEntityParametersView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SaveEntityParametersView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SaveEntityParametersView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SaveEntityParametersView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 805;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SaveEntityParameters*
+      toMessage(void) const
+      {
+        return static_cast<SaveEntityParameters*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entity Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of Create Session.
+    class CreateSessionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CreateSessionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CreateSessionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CreateSessionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 806;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CreateSession*
+      toMessage(void) const
+      {
+        return static_cast<CreateSession*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Session Timeout.
+      uint32_t
+      timeout(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Close Session.
+    class CloseSessionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      CloseSessionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      CloseSessionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      CloseSessionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 807;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      CloseSession*
+      toMessage(void) const
+      {
+        return static_cast<CloseSession*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Session Identifier.
+      uint32_t
+      sessid(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Session Subscription.
+    class SessionSubscriptionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SessionSubscriptionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SessionSubscriptionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SessionSubscriptionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 808;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SessionSubscription*
+      toMessage(void) const
+      {
+        return static_cast<SessionSubscription*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Session Identifier.
+      uint32_t
+      sessid(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+
+      //! Messages to subscribe.
+      DataView
+      messages(void) const
+      {
+        return readData(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Session Keep-Alive.
+    class SessionKeepAliveView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SessionKeepAliveView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SessionKeepAliveView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SessionKeepAliveView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 809;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SessionKeepAlive*
+      toMessage(void) const
+      {
+        return static_cast<SessionKeepAlive*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Session Identifier.
+      uint32_t
+      sessid(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+    };
+
+    //! Read-only view of Session Status.
+    class SessionStatusView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SessionStatusView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SessionStatusView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SessionStatusView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 810;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SessionStatus*
+      toMessage(void) const
+      {
+        return static_cast<SessionStatus*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Session Identifier.
+      uint32_t
+      sessid(void) const
+      {
+        return read<uint32_t>(getPayload());
+      }
+
+      //! Status.
+      uint8_t
+      status(void) const
+      {
+        return read<uint8_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Push Entity Parameters.
+    class PushEntityParametersView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PushEntityParametersView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PushEntityParametersView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PushEntityParametersView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 811;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PushEntityParameters*
+      toMessage(void) const
+      {
+        return static_cast<PushEntityParameters*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entity Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of Pop Entity Parameters.
+    class PopEntityParametersView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      PopEntityParametersView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      PopEntityParametersView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      PopEntityParametersView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 812;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      PopEntityParameters*
+      toMessage(void) const
+      {
+        return static_cast<PopEntityParameters*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Entity Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+    };
+
+    //! Read-only view of I/O Event.
+    class IoEventView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      IoEventView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      IoEventView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      IoEventView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 813;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      IoEvent*
+      toMessage(void) const
+      {
+        return static_cast<IoEvent*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Error Message.
+      DataView
+      error(void) const
+      {
+        return readData(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of UamTxFrame.
+    class UamTxFrameView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UamTxFrameView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UamTxFrameView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UamTxFrameView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 814;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UamTxFrame*
+      toMessage(void) const
+      {
+        return static_cast<UamTxFrame*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Sequence Id.
+      uint16_t
+      seq(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Destination System.
+      DataView
+      sys_dst(void) const
+      {
+        return readData(getPayload() + 2);
+      }
+
+      //! Flags.
+      uint8_t
+      flags(void) const;
+
+      //! Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of UamRxFrame.
+    class UamRxFrameView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UamRxFrameView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UamRxFrameView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UamRxFrameView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 815;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UamRxFrame*
+      toMessage(void) const
+      {
+        return static_cast<UamRxFrame*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Source System.
+      DataView
+      sys_src(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Destination System.
+      DataView
+      sys_dst(void) const;
+
+      //! Flags.
+      uint8_t
+      flags(void) const;
+
+      //! Data.
+      DataView
+      data(void) const;
+    };
+
+    //! Read-only view of UamTxStatus.
+    class UamTxStatusView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UamTxStatusView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UamTxStatusView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UamTxStatusView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 816;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UamTxStatus*
+      toMessage(void) const
+      {
+        return static_cast<UamTxStatus*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Sequence Id.
+      uint16_t
+      seq(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Value.
+      uint8_t
+      value(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! Error Message.
+      DataView
+      error(void) const
+      {
+        return readData(getPayload() + 3);
+      }
+    };
+
+    //! Read-only view of UamRxRange.
+    class UamRxRangeView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UamRxRangeView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UamRxRangeView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UamRxRangeView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 817;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UamRxRange*
+      toMessage(void) const
+      {
+        return static_cast<UamRxRange*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Sequence Id.
+      uint16_t
+      seq(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! System.
+      DataView
+      sys(void) const
+      {
+        return readData(getPayload() + 2);
+      }
+
+      //! Value.
+      fp32_t
+      value(void) const;
+    };
+
+    //! Read-only view of Formation Control Parameters.
+    class FormCtrlParamView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormCtrlParamView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormCtrlParamView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormCtrlParamView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 820;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormCtrlParam*
+      toMessage(void) const
+      {
+        return static_cast<FormCtrlParam*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Action.
+      uint8_t
+      action(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Longitudinal Gain.
+      fp32_t
+      longain(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+
+      //! Lateral Gain.
+      fp32_t
+      latgain(void) const
+      {
+        return read<fp32_t>(getPayload() + 5);
+      }
+
+      //! Boundary Layer Thickness.
+      uint32_t
+      bondthick(void) const
+      {
+        return read<uint32_t>(getPayload() + 9);
+      }
+
+      //! Leader Gain.
+      fp32_t
+      leadgain(void) const
+      {
+        return read<fp32_t>(getPayload() + 13);
+      }
+
+      //! Deconfliction Gain.
+      fp32_t
+      deconflgain(void) const
+      {
+        return read<fp32_t>(getPayload() + 17);
+      }
+    };
+
+    //! Read-only view of Formation Evaluation Data.
+    class FormationEvalView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormationEvalView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormationEvalView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormationEvalView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 821;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormationEval*
+      toMessage(void) const
+      {
+        return static_cast<FormationEval*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Mean position error.
+      fp32_t
+      err_mean(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Absolute minimum distance.
+      fp32_t
+      dist_min_abs(void) const
+      {
+        return read<fp32_t>(getPayload() + 4);
+      }
+
+      //! Mean minimum distance.
+      fp32_t
+      dist_min_mean(void) const
+      {
+        return read<fp32_t>(getPayload() + 8);
+      }
+    };
+
+    //! Read-only view of Formation Control Parameters.
+    class FormationControlParamsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormationControlParamsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormationControlParamsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormationControlParamsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 822;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormationControlParams*
+      toMessage(void) const
+      {
+        return static_cast<FormationControlParams*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Action.
+      uint8_t
+      action(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Longitudinal Gain.
+      fp32_t
+      lon_gain(void) const
+      {
+        return read<fp32_t>(getPayload() + 1);
+      }
+
+      //! Lateral Gain.
+      fp32_t
+      lat_gain(void) const
+      {
+        return read<fp32_t>(getPayload() + 5);
+      }
+
+      //! Boundary Layer Thickness.
+      fp32_t
+      bond_thick(void) const
+      {
+        return read<fp32_t>(getPayload() + 9);
+      }
+
+      //! Leader Gain.
+      fp32_t
+      lead_gain(void) const
+      {
+        return read<fp32_t>(getPayload() + 13);
+      }
+
+      //! Deconfliction Gain.
+      fp32_t
+      deconfl_gain(void) const
+      {
+        return read<fp32_t>(getPayload() + 17);
+      }
+
+      //! Acceleration Switch Gain.
+      fp32_t
+      accel_switch_gain(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Safety Distance.
+      fp32_t
+      safe_dist(void) const
+      {
+        return read<fp32_t>(getPayload() + 25);
+      }
+
+      //! Deconfliction Offset.
+      fp32_t
+      deconflict_offset(void) const
+      {
+        return read<fp32_t>(getPayload() + 29);
+      }
+
+      //! Acceleration Safety Margin.
+      fp32_t
+      accel_safe_margin(void) const
+      {
+        return read<fp32_t>(getPayload() + 33);
+      }
+
+      //! Maximum Longitudinal Acceleration.
+      fp32_t
+      accel_lim_x(void) const
+      {
+        return read<fp32_t>(getPayload() + 37);
+      }
+    };
+
+    //! Read-only view of Formation Evaluation Data.
+    class FormationEvaluationView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      FormationEvaluationView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      FormationEvaluationView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      FormationEvaluationView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 823;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      FormationEvaluation*
+      toMessage(void) const
+      {
+        return static_cast<FormationEvaluation*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Type.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Mean Position Error.
+      fp32_t
+      err_mean(void) const
+      {
+        return read<fp32_t>(getPayload() + 2);
+      }
+
+      //! Absolute Minimum Distance.
+      fp32_t
+      dist_min_abs(void) const
+      {
+        return read<fp32_t>(getPayload() + 6);
+      }
+
+      //! Mean Minimum Distance.
+      fp32_t
+      dist_min_mean(void) const
+      {
+        return read<fp32_t>(getPayload() + 10);
+      }
+
+      //! Mean Roll Rate.
+      fp32_t
+      roll_rate_mean(void) const
+      {
+        return read<fp32_t>(getPayload() + 14);
+      }
+
+      //! Evaluation Time.
+      fp32_t
+      time(void) const
+      {
+        return read<fp32_t>(getPayload() + 18);
+      }
+
+      //! Formation Control Parameters.
+      FormationControlParamsView
+      controlparams(void) const;
+    };
+
+    //! Read-only view of Message Fragment.
+    class MessagePartView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      MessagePartView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      MessagePartView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      MessagePartView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 877;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      MessagePart*
+      toMessage(void) const
+      {
+        return static_cast<MessagePart*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Transmission Unique Id.
+      uint8_t
+      uid(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Fragment Number.
+      uint8_t
+      frag_number(void) const
+      {
+        return read<uint8_t>(getPayload() + 1);
+      }
+
+      //! Total Number of fragments.
+      uint8_t
+      num_frags(void) const
+      {
+        return read<uint8_t>(getPayload() + 2);
+      }
+
+      //! Fragment Data.
+      DataView
+      data(void) const
+      {
+        return readData(getPayload() + 3);
+      }
+    };
+
+    //! Read-only view of Neptus Blob.
+    class NeptusBlobView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      NeptusBlobView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      NeptusBlobView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      NeptusBlobView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 888;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      NeptusBlob*
+      toMessage(void) const
+      {
+        return static_cast<NeptusBlob*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! ContentType.
+      DataView
+      content_type(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Content.
+      DataView
+      content(void) const;
+    };
+
+    //! Read-only view of Aborted.
+    class AbortedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      AbortedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      AbortedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      AbortedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 889;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      Aborted*
+      toMessage(void) const
+      {
+        return static_cast<Aborted*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of USBL Angles.
+    class UsblAnglesView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UsblAnglesView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UsblAnglesView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UsblAnglesView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 890;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UsblAngles*
+      toMessage(void) const
+      {
+        return static_cast<UsblAngles*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Target.
+      uint16_t
+      target(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Bearing.
+      fp32_t
+      bearing(void) const
+      {
+        return read<fp32_t>(getPayload() + 2);
+      }
+
+      //! Elevation.
+      fp32_t
+      elevation(void) const
+      {
+        return read<fp32_t>(getPayload() + 6);
+      }
+    };
+
+    //! Read-only view of USBL Position.
+    class UsblPositionView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UsblPositionView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UsblPositionView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UsblPositionView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 891;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UsblPosition*
+      toMessage(void) const
+      {
+        return static_cast<UsblPosition*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Target.
+      uint16_t
+      target(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! X.
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload() + 2);
+      }
+
+      //! Y.
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 6);
+      }
+
+      //! Z.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 10);
+      }
+    };
+
+    //! Read-only view of USBL Fix.
+    class UsblFixView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UsblFixView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UsblFixView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UsblFixView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 892;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UsblFix*
+      toMessage(void) const
+      {
+        return static_cast<UsblFix*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Target.
+      uint16_t
+      target(void) const
+      {
+        return read<uint16_t>(getPayload());
+      }
+
+      //! Latitude (WGS-84).
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 2);
+      }
+
+      //! Longitude (WGS-84).
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 10);
+      }
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const
+      {
+        return read<uint8_t>(getPayload() + 18);
+      }
+
+      //! Z Reference.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 19);
+      }
+    };
+
+    //! Read-only view of Parameters XML.
+    class ParametersXmlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      ParametersXmlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      ParametersXmlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      ParametersXmlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 893;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      ParametersXml*
+      toMessage(void) const
+      {
+        return static_cast<ParametersXml*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Locale.
+      DataView
+      locale(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Configuration Data.
+      DataView
+      config(void) const;
+    };
+
+    //! Read-only view of Get Parameters XML.
+    class GetParametersXmlView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GetParametersXmlView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GetParametersXmlView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GetParametersXmlView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 894;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GetParametersXml*
+      toMessage(void) const
+      {
+        return static_cast<GetParametersXml*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+    };
+
+    //! Read-only view of Set Image Coordinates.
+    class SetImageCoordsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      SetImageCoordsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      SetImageCoordsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      SetImageCoordsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 895;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      SetImageCoords*
+      toMessage(void) const
+      {
+        return static_cast<SetImageCoords*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Camera Identifier.
+      uint8_t
+      camid(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! X.
+      uint16_t
+      x(void) const
+      {
+        return read<uint16_t>(getPayload() + 1);
+      }
+
+      //! Y.
+      uint16_t
+      y(void) const
+      {
+        return read<uint16_t>(getPayload() + 3);
+      }
+    };
+
+    //! Read-only view of Get Image Coordinates.
+    class GetImageCoordsView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GetImageCoordsView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GetImageCoordsView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GetImageCoordsView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 896;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GetImageCoords*
+      toMessage(void) const
+      {
+        return static_cast<GetImageCoords*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Camera Identifier.
+      uint8_t
+      camid(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! X.
+      uint16_t
+      x(void) const
+      {
+        return read<uint16_t>(getPayload() + 1);
+      }
+
+      //! Y.
+      uint16_t
+      y(void) const
+      {
+        return read<uint16_t>(getPayload() + 3);
+      }
+    };
+
+    //! Read-only view of Get World Coordinates.
+    class GetWorldCoordinatesView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      GetWorldCoordinatesView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      GetWorldCoordinatesView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      GetWorldCoordinatesView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 897;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      GetWorldCoordinates*
+      toMessage(void) const
+      {
+        return static_cast<GetWorldCoordinates*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Tracking.
+      uint8_t
+      tracking(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Latitude.
+      fp64_t
+      lat(void) const
+      {
+        return read<fp64_t>(getPayload() + 1);
+      }
+
+      //! Longitude.
+      fp64_t
+      lon(void) const
+      {
+        return read<fp64_t>(getPayload() + 9);
+      }
+
+      //! X.
+      fp32_t
+      x(void) const
+      {
+        return read<fp32_t>(getPayload() + 17);
+      }
+
+      //! Y.
+      fp32_t
+      y(void) const
+      {
+        return read<fp32_t>(getPayload() + 21);
+      }
+
+      //! Z.
+      fp32_t
+      z(void) const
+      {
+        return read<fp32_t>(getPayload() + 25);
+      }
+    };
+
+    //! Read-only view of USBL Angles Extended.
+    class UsblAnglesExtendedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UsblAnglesExtendedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UsblAnglesExtendedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UsblAnglesExtendedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 898;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UsblAnglesExtended*
+      toMessage(void) const
+      {
+        return static_cast<UsblAnglesExtended*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Target.
+      DataView
+      target(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Local Bearing.
+      fp32_t
+      lbearing(void) const;
+
+      //! Local Elevation.
+      fp32_t
+      lelevation(void) const;
+
+      //! Bearing.
+      fp32_t
+      bearing(void) const;
+
+      //! Elevation.
+      fp32_t
+      elevation(void) const;
+
+      //! Roll Angle.
+      fp32_t
+      phi(void) const;
+
+      //! Pitch Angle.
+      fp32_t
+      theta(void) const;
+
+      //! Yaw Angle.
+      fp32_t
+      psi(void) const;
+
+      //! Accuracy.
+      fp32_t
+      accuracy(void) const;
+    };
+
+    //! Read-only view of USBL Position Extended.
+    class UsblPositionExtendedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UsblPositionExtendedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UsblPositionExtendedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UsblPositionExtendedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 899;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UsblPositionExtended*
+      toMessage(void) const
+      {
+        return static_cast<UsblPositionExtended*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Target.
+      DataView
+      target(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! X.
+      fp32_t
+      x(void) const;
+
+      //! Y.
+      fp32_t
+      y(void) const;
+
+      //! Z.
+      fp32_t
+      z(void) const;
+
+      //! N.
+      fp32_t
+      n(void) const;
+
+      //! E.
+      fp32_t
+      e(void) const;
+
+      //! D.
+      fp32_t
+      d(void) const;
+
+      //! Roll Angle.
+      fp32_t
+      phi(void) const;
+
+      //! Pitch Angle.
+      fp32_t
+      theta(void) const;
+
+      //! Yaw Angle.
+      fp32_t
+      psi(void) const;
+
+      //! Accuracy.
+      fp32_t
+      accuracy(void) const;
+    };
+
+    //! Read-only view of USBL Fix Extended.
+    class UsblFixExtendedView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UsblFixExtendedView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UsblFixExtendedView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UsblFixExtendedView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 900;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UsblFixExtended*
+      toMessage(void) const
+      {
+        return static_cast<UsblFixExtended*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Target.
+      DataView
+      target(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Latitude (WGS-84).
+      fp64_t
+      lat(void) const;
+
+      //! Longitude (WGS-84).
+      fp64_t
+      lon(void) const;
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const;
+
+      //! Z Reference.
+      fp32_t
+      z(void) const;
+
+      //! Accuracy.
+      fp32_t
+      accuracy(void) const;
+    };
+
+    //! Read-only view of USBL Modem Configuration.
+    class UsblModemView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UsblModemView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UsblModemView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UsblModemView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 901;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UsblModem*
+      toMessage(void) const
+      {
+        return static_cast<UsblModem*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Modem Name.
+      DataView
+      name(void) const
+      {
+        return readData(getPayload());
+      }
+
+      //! Latitude WGS-84.
+      fp64_t
+      lat(void) const;
+
+      //! Longitude WGS-84.
+      fp64_t
+      lon(void) const;
+
+      //! Z Reference.
+      fp32_t
+      z(void) const;
+
+      //! Z Units.
+      uint8_t
+      z_units(void) const;
+    };
+
+    //! Read-only view of USBL Configuration.
+    class UsblConfigView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      UsblConfigView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      UsblConfigView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      UsblConfigView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 902;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      UsblConfig*
+      toMessage(void) const
+      {
+        return static_cast<UsblConfig*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Operation.
+      uint8_t
+      op(void) const
+      {
+        return read<uint8_t>(getPayload());
+      }
+
+      //! Modems.
+      MessageListView
+      modems(void) const
+      {
+        return readList(getPayload() + 1);
+      }
+    };
+
+    //! Read-only view of Dissolved Organic Matter.
+    class DissolvedOrganicMatterView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      DissolvedOrganicMatterView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      DissolvedOrganicMatterView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      DissolvedOrganicMatterView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 903;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      DissolvedOrganicMatter*
+      toMessage(void) const
+      {
+        return static_cast<DissolvedOrganicMatter*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+
+      //! Type of measurement.
+      uint8_t
+      type(void) const
+      {
+        return read<uint8_t>(getPayload() + 4);
+      }
+    };
+
+    //! Read-only view of Optical Backscattering Coefficient.
+    class OpticalBackscatterView: public MessageView
+    {
+    public:
+      //! Create a null view.
+      OpticalBackscatterView(void)
+      { }
+
+      //! Wrap a serialized packet.
+      OpticalBackscatterView(const uint8_t* bfr__, unsigned size__): MessageView(bfr__, size__)
+      {
+        checkId(getIdStatic());
+      }
+
+      //! Narrow a generic view.
+      explicit
+      OpticalBackscatterView(const MessageView& view__): MessageView(view__)
+      {
+        checkId(getIdStatic());
+      }
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 904;
+      }
+
+      static uint16_t
+      measure(const uint8_t* bfr__, unsigned size__, bool reversed__);
+
+      uint16_t
+      getSubId(void) const
+      {
+        return 0;
+      }
+
+      OpticalBackscatter*
+      toMessage(void) const
+      {
+        return static_cast<OpticalBackscatter*>(MessageView::toMessage());
+      }
+
+      static const MessageView::Field*
+      getFieldsStatic(void);
+
+      //! Value.
+      fp32_t
+      value(void) const
+      {
+        return read<fp32_t>(getPayload());
+      }
+    };
+  }
+}
+
+#endif
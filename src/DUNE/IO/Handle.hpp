@@ -34,6 +34,7 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Time/Clock.hpp>
 
 namespace DUNE
 {
@@ -102,6 +103,34 @@ namespace DUNE
         return read(reinterpret_cast<uint8_t*>(data), length);
       }
 
+      //! Read binary data from I/O handle and retrieve the time at
+      //! which it arrived. Handles that can obtain a receive time
+      //! from the operating system report it, all others report the
+      //! time at which the read returned.
+      //! @param[in] data data buffer.
+      //! @param[in] length number of bytes to read.
+      //! @param[out] timestamp arrival time (seconds since the
+      //! UNIX Epoch).
+      //! @return number of bytes read.
+      size_t
+      read(uint8_t* data, size_t length, double& timestamp)
+      {
+        return doReadTimestamped(data, length, timestamp);
+      }
+
+      //! Read binary data from I/O handle and retrieve the time at
+      //! which it arrived.
+      //! @param[in] data data buffer.
+      //! @param[in] length number of bytes to read.
+      //! @param[out] timestamp arrival time (seconds since the
+      //! UNIX Epoch).
+      //! @return number of bytes read.
+      size_t
+      read(char* data, size_t length, double& timestamp)
+      {
+        return read(reinterpret_cast<uint8_t*>(data), length, timestamp);
+      }
+
       //! Read C-style string from I/O handle.
       //! @param[in] bfr data buffer.
       //! @param[in] length capacity of the data buffer.
@@ -153,6 +182,14 @@ namespace DUNE
       virtual size_t
       doRead(uint8_t* data, size_t data_size) = 0;
 
+      virtual size_t
+      doReadTimestamped(uint8_t* data, size_t data_size, double& timestamp)
+      {
+        size_t rv = doRead(data, data_size);
+        timestamp = Time::Clock::getSinceEpoch();
+        return rv;
+      }
+
       virtual void
       doFlushInput(void)
       { }
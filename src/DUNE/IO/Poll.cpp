@@ -34,6 +34,7 @@
 #include <DUNE/System/Error.hpp>
 #include <DUNE/Time/Constants.hpp>
 #include <DUNE/Time/Utils.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/IO/Poll.hpp>
 
 namespace DUNE
@@ -80,6 +81,9 @@ namespace DUNE
     bool
     Poll::poll(double timeout)
     {
+      if (timeout > 0.0)
+        timeout = Time::Clock::toSystem(timeout);
+
 #if defined(DUNE_OS_WINDOWS)
       DWORD count = m_handles.size();
       m_rv = WaitForMultipleObjects(count, &m_handles[0], FALSE, timeout * 1000);
@@ -137,6 +141,9 @@ namespace DUNE
     bool
     Poll::poll(const NativeHandle& handle, double timeout)
     {
+      if (timeout > 0.0)
+        timeout = Time::Clock::toSystem(timeout);
+
 #if defined(DUNE_OS_WINDOWS)
       DWORD rv = WaitForSingleObjectEx(handle, timeout * 1000, FALSE);
       return rv == WAIT_OBJECT_0;
@@ -38,6 +38,8 @@ namespace DUNE
 #include <DUNE/Media/VideoCapture.hpp>
 #include <DUNE/Media/VideoIIDC1394.hpp>
 #include <DUNE/Media/BayerDecoder.hpp>
+#include <DUNE/Media/FramePool.hpp>
+#include <DUNE/Media/FrameDescriptor.hpp>
 #include <DUNE/Media/MJPG/Encoder.hpp>
 
 #endif
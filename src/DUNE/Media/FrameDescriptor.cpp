@@ -0,0 +1,152 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Media/FrameDescriptor.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/JSON.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/Serialization.hpp>
+#include <DUNE/Algorithms/CRC16.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    FrameDescriptor::FrameDescriptor(void):
+      m_carrier(NULL),
+      m_frame(NULL)
+    { }
+
+    FrameDescriptor::FrameDescriptor(const IMC::Message& carrier, Frame* frame):
+      m_carrier(carrier.clone()),
+      m_frame(frame)
+    {
+      if (m_frame != NULL)
+        m_frame->addRef();
+    }
+
+    FrameDescriptor::FrameDescriptor(const FrameDescriptor& other):
+      IMC::Message(other),
+      m_carrier(NULL),
+      m_frame(other.m_frame)
+    {
+      if (other.m_carrier != NULL)
+        m_carrier = other.m_carrier->clone();
+
+      if (m_frame != NULL)
+        m_frame->addRef();
+    }
+
+    FrameDescriptor::~FrameDescriptor(void)
+    {
+      clear();
+    }
+
+    void
+    FrameDescriptor::clear(void)
+    {
+      if (m_frame != NULL)
+      {
+        m_frame->release();
+        m_frame = NULL;
+      }
+
+      if (m_carrier != NULL)
+      {
+        delete m_carrier;
+        m_carrier = NULL;
+      }
+    }
+
+    uint16_t
+    FrameDescriptor::serializeCarrier(Utils::ByteBuffer& bfr) const
+    {
+      if (m_carrier == NULL || m_frame == NULL)
+        throw std::runtime_error("frame descriptor is empty");
+
+      m_carrier->setTimeStamp(getTimeStamp());
+      m_carrier->setSource(getSource());
+      m_carrier->setSourceEntity(getSourceEntity());
+      m_carrier->setDestination(getDestination());
+      m_carrier->setDestinationEntity(getDestinationEntity());
+
+      unsigned base = m_carrier->getSerializationSize();
+      unsigned total = base + m_frame->getSize();
+      if (total > DUNE_IMC_CONST_MAX_SIZE)
+        throw IMC::InvalidMessageSize(total);
+
+      bfr.setSize(total);
+      uint8_t* ptr = bfr.getBuffer();
+      IMC::Packet::serialize(m_carrier, ptr, base);
+
+      // Length of the last field, which must be empty.
+      uint8_t* field = ptr + base - DUNE_IMC_CONST_FOOTER_SIZE - sizeof(uint16_t);
+      uint16_t length = 0;
+      std::memcpy(&length, field, sizeof(length));
+      if (length != 0)
+        throw std::runtime_error("last field of frame carrier is not empty");
+
+      field += IMC::serialize((uint16_t)m_frame->getSize(), field);
+      std::memcpy(field, m_frame->getData(), m_frame->getSize());
+
+      // Update payload size and CRC.
+      uint16_t size = total - DUNE_IMC_CONST_HEADER_SIZE - DUNE_IMC_CONST_FOOTER_SIZE;
+      IMC::serialize(size, ptr + 4);
+      uint16_t crc = Algorithms::CRC16::compute(ptr, total - DUNE_IMC_CONST_FOOTER_SIZE);
+      IMC::serialize(crc, ptr + total - DUNE_IMC_CONST_FOOTER_SIZE);
+
+      return total;
+    }
+
+    IMC::Message*
+    FrameDescriptor::expand(void) const
+    {
+      Utils::ByteBuffer bfr;
+      uint16_t size = serializeCarrier(bfr);
+      return IMC::Packet::deserialize(bfr.getBuffer(), size);
+    }
+
+    void
+    FrameDescriptor::fieldsToJSON(std::ostream& os, unsigned indent_level) const
+    {
+      IMC::toJSON(os, "carrier", std::string(m_carrier ? m_carrier->getName() : ""), indent_level);
+      IMC::toJSON(os, "size", m_frame ? m_frame->getSize() : 0u, indent_level);
+    }
+
+    bool
+    FrameDescriptor::fieldsEqual(const IMC::Message& other) const
+    {
+      const FrameDescriptor& desc = static_cast<const FrameDescriptor&>(other);
+      return m_frame == desc.m_frame;
+    }
+  }
+}
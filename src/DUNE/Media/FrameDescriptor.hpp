@@ -0,0 +1,177 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_MEDIA_FRAME_DESCRIPTOR_HPP_INCLUDED_
+#define DUNE_MEDIA_FRAME_DESCRIPTOR_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/Media/FramePool.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM FrameDescriptor;
+
+    //! Message that carries a reference to a frame through the message
+    //! bus instead of a copy of its contents. Copies of the descriptor
+    //! share the same frame, which is returned to its pool when the
+    //! last copy is destroyed.
+    //!
+    //! The descriptor wraps a carrier message, whose last field must
+    //! be an empty variable length field (e.g., SonarData::data). The
+    //! frame contents take the place of that field when the carrier is
+    //! serialized, producing the same packet the producer would have
+    //! dispatched without frames.
+    //!
+    //! Descriptors never leave the process: they have no payload and
+    //! use an identification number that is not assigned by IMC.
+    class FrameDescriptor: public IMC::Message
+    {
+    public:
+      //! Create an empty descriptor.
+      FrameDescriptor(void);
+
+      //! Create a descriptor holding a new reference to a frame.
+      //! @param[in] carrier carrier message.
+      //! @param[in] frame frame.
+      FrameDescriptor(const IMC::Message& carrier, Frame* frame);
+
+      //! Copy constructor.
+      //! @param[in] other descriptor.
+      FrameDescriptor(const FrameDescriptor& other);
+
+      ~FrameDescriptor(void);
+
+      static uint16_t
+      getIdStatic(void)
+      {
+        return 65534;
+      }
+
+      IMC::Message*
+      clone(void) const
+      {
+        return new FrameDescriptor(*this);
+      }
+
+      void
+      clear(void);
+
+      int
+      validate(void) const
+      {
+        return true;
+      }
+
+      const char*
+      getName(void) const
+      {
+        return "FrameDescriptor";
+      }
+
+      uint16_t
+      getId(void) const
+      {
+        return getIdStatic();
+      }
+
+      //! Get frame.
+      //! @return frame or NULL.
+      const Frame*
+      getFrame(void) const
+      {
+        return m_frame;
+      }
+
+      //! Get carrier message.
+      //! @return carrier message or NULL.
+      const IMC::Message*
+      getCarrier(void) const
+      {
+        return m_carrier;
+      }
+
+      //! Serialize the carrier message with the frame contents, using
+      //! the header of this descriptor.
+      //! @param[out] bfr destination buffer.
+      //! @return packet size.
+      uint16_t
+      serializeCarrier(Utils::ByteBuffer& bfr) const;
+
+      //! Create a copy of the carrier message holding the frame
+      //! contents.
+      //! @return new message, owned by the caller.
+      IMC::Message*
+      expand(void) const;
+
+      uint8_t*
+      serializeFields(uint8_t* bfr) const
+      {
+        return bfr;
+      }
+
+      uint16_t
+      deserializeFields(const uint8_t* bfr, uint16_t size)
+      {
+        (void)bfr;
+        (void)size;
+        return 0;
+      }
+
+      uint16_t
+      reverseDeserializeFields(const uint8_t* bfr, uint16_t size)
+      {
+        (void)bfr;
+        (void)size;
+        return 0;
+      }
+
+      void
+      fieldsToJSON(std::ostream& os, unsigned indent_level) const;
+
+    protected:
+      bool
+      fieldsEqual(const IMC::Message& other) const;
+
+    private:
+      //! Carrier message.
+      IMC::Message* m_carrier;
+      //! Frame.
+      Frame* m_frame;
+
+      FrameDescriptor&
+      operator=(const FrameDescriptor&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,154 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Media/FramePool.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    Frame::Frame(FramePool& pool, uint8_t* data, unsigned capacity):
+      m_pool(pool),
+      m_data(data),
+      m_size(0),
+      m_capacity(capacity)
+    { }
+
+    void
+    Frame::setSize(unsigned size)
+    {
+      if (size > m_capacity)
+        throw std::runtime_error("frame size exceeds capacity");
+
+      m_size = size;
+    }
+
+    void
+    Frame::release(void)
+    {
+      if (m_refs.sub(1) == 0)
+        m_pool.put(this);
+    }
+
+    FramePool::FramePool(unsigned count, unsigned capacity):
+      m_peak(0),
+      m_drops(0),
+      m_closed(false)
+    {
+      m_storage = new uint8_t[count * capacity];
+
+      m_frames.resize(count);
+      m_free.reserve(count);
+      for (unsigned i = 0; i < count; ++i)
+      {
+        m_frames[i] = new Frame(*this, m_storage + i * capacity, capacity);
+        m_free.push_back(m_frames[i]);
+      }
+    }
+
+    FramePool::~FramePool(void)
+    {
+      for (unsigned i = 0; i < m_frames.size(); ++i)
+        delete m_frames[i];
+
+      delete [] m_storage;
+    }
+
+    Frame*
+    FramePool::acquire(void)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+
+      if (m_free.empty())
+      {
+        ++m_drops;
+        return NULL;
+      }
+
+      Frame* frame = m_free.back();
+      m_free.pop_back();
+      frame->m_size = 0;
+      frame->m_refs.add(1);
+
+      unsigned used = m_frames.size() - m_free.size();
+      if (used > m_peak)
+        m_peak = used;
+
+      return frame;
+    }
+
+    void
+    FramePool::close(void)
+    {
+      m_mutex.lock();
+      m_closed = true;
+      bool idle = (m_free.size() == m_frames.size());
+      m_mutex.unlock();
+
+      if (idle)
+        delete this;
+    }
+
+    unsigned
+    FramePool::getUsed(void)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      return m_frames.size() - m_free.size();
+    }
+
+    unsigned
+    FramePool::getPeakUsed(void)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      return m_peak;
+    }
+
+    unsigned
+    FramePool::getDrops(void)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      return m_drops;
+    }
+
+    void
+    FramePool::put(Frame* frame)
+    {
+      m_mutex.lock();
+      m_free.push_back(frame);
+      bool idle = m_closed && (m_free.size() == m_frames.size());
+      m_mutex.unlock();
+
+      if (idle)
+        delete this;
+    }
+  }
+}
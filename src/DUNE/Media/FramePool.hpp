@@ -0,0 +1,201 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_MEDIA_FRAME_POOL_HPP_INCLUDED_
+#define DUNE_MEDIA_FRAME_POOL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace Media
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Frame;
+    class DUNE_DLL_SYM FramePool;
+
+    //! Reference counted buffer owned by a FramePool. Frames are
+    //! returned to their pool when the last reference is released.
+    class Frame
+    {
+    public:
+      //! Get frame data.
+      //! @return pointer to frame data.
+      uint8_t*
+      getData(void)
+      {
+        return m_data;
+      }
+
+      //! Get frame data.
+      //! @return pointer to frame data.
+      const uint8_t*
+      getData(void) const
+      {
+        return m_data;
+      }
+
+      //! Get the number of used bytes.
+      //! @return frame size.
+      unsigned
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Set the number of used bytes.
+      //! @param[in] size frame size.
+      void
+      setSize(unsigned size);
+
+      //! Get the maximum number of bytes the frame can hold.
+      //! @return frame capacity.
+      unsigned
+      getCapacity(void) const
+      {
+        return m_capacity;
+      }
+
+      //! Acquire a reference to this frame.
+      void
+      addRef(void)
+      {
+        m_refs.add(1);
+      }
+
+      //! Release a reference to this frame.
+      void
+      release(void);
+
+    private:
+      //! Parent pool.
+      FramePool& m_pool;
+      //! Frame data.
+      uint8_t* m_data;
+      //! Number of used bytes.
+      unsigned m_size;
+      //! Frame capacity.
+      unsigned m_capacity;
+      //! Reference count.
+      Concurrency::AtomicCounter m_refs;
+
+      Frame(FramePool& pool, uint8_t* data, unsigned capacity);
+
+      friend class FramePool;
+    };
+
+    //! Fixed set of preallocated frames. A producer acquires a frame,
+    //! fills it and hands references to consumers. When all frames are
+    //! referenced, acquire() fails instead of allocating more memory,
+    //! so a slow consumer causes the producer to drop data.
+    //!
+    //! Pools are released with close() and destroyed only after all
+    //! frames have been returned.
+    class FramePool
+    {
+    public:
+      //! Create pool.
+      //! @param[in] count number of frames.
+      //! @param[in] capacity size of each frame in bytes.
+      FramePool(unsigned count, unsigned capacity);
+
+      //! Acquire a free frame. The caller owns one reference to the
+      //! returned frame.
+      //! @return frame or NULL if all frames are in use.
+      Frame*
+      acquire(void);
+
+      //! Release the pool. The pool is destroyed when all frames are
+      //! released.
+      void
+      close(void);
+
+      //! Get number of frames.
+      //! @return number of frames.
+      unsigned
+      getCount(void) const
+      {
+        return m_frames.size();
+      }
+
+      //! Get number of frames in use.
+      //! @return number of frames.
+      unsigned
+      getUsed(void);
+
+      //! Get maximum number of frames that were in use at the same
+      //! time.
+      //! @return number of frames.
+      unsigned
+      getPeakUsed(void);
+
+      //! Get number of failed acquisitions.
+      //! @return number of failed acquisitions.
+      unsigned
+      getDrops(void);
+
+    private:
+      //! Frames.
+      std::vector<Frame*> m_frames;
+      //! Free frames.
+      std::vector<Frame*> m_free;
+      //! Frame storage.
+      uint8_t* m_storage;
+      //! Maximum number of frames in use.
+      unsigned m_peak;
+      //! Number of failed acquisitions.
+      unsigned m_drops;
+      //! True if the pool was closed.
+      bool m_closed;
+      //! Lock.
+      Concurrency::Mutex m_mutex;
+
+      ~FramePool(void);
+
+      //! Return a frame to the pool.
+      //! @param[in] frame frame.
+      void
+      put(Frame* frame);
+
+      // Non-copyable.
+      FramePool(const FramePool&);
+
+      FramePool&
+      operator=(const FramePool&);
+
+      friend class Frame;
+    };
+  }
+}
+
+#endif
@@ -40,6 +40,7 @@ namespace DUNE
 #include <DUNE/Navigation/CompassCalibration.hpp>
 #include <DUNE/Navigation/KalmanFilter.hpp>
 #include <DUNE/Navigation/Ranging.hpp>
+#include <DUNE/Navigation/StateHistory.hpp>
 #include <DUNE/Navigation/StreamEstimator.hpp>
 #include <DUNE/Navigation/UsblTools.hpp>
 
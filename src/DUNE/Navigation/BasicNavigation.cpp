@@ -34,6 +34,7 @@ namespace DUNE
   namespace Navigation
   {
     using Tasks::DF_KEEP_TIME;
+    using Tasks::DF_KEEP_TRACE;
 
     static std::string
     getUncertaintyMessage(double hpos_var)
@@ -113,6 +114,13 @@ namespace DUNE
       .defaultValue("true")
       .description("This variable signals that a depth sensor device is installed on system");
 
+      param("Sequential Measurement Updates", m_sequential_update)
+      .defaultValue("false")
+      .description("Process filter outputs one at a time without matrix inversion");
+
+      // Resume navigation after a restart without waiting for a GPS fix.
+      paramCheckpoint(1.0, 60.0);
+
       param("DVL sanity timeout", m_dvl_sanity_timeout)
       .units(Units::Second)
       .defaultValue("10.0")
@@ -262,6 +270,8 @@ namespace DUNE
       m_time_without_euler.setTop(m_without_euler_timeout);
       m_dvl_sanity_timer.setTop(m_dvl_sanity_timeout);
 
+      m_kal.setUpdateMode(m_sequential_update ? KalmanFilter::UPDATE_SEQUENTIAL : KalmanFilter::UPDATE_BATCH);
+
       // Distance DVL to vehicle Center of Gravity is 0 in Simulation.
       if (m_ctx.profiles.isSelected("Simulation"))
       {
@@ -332,6 +342,63 @@ namespace DUNE
       Memory::clear(m_avg_gps);
     }
 
+    bool
+    BasicNavigation::onCheckpointSave(Tasks::Checkpoint& ckp)
+    {
+      if (!m_active || m_origin == NULL)
+        return false;
+
+      ckp.put(*m_origin);
+      ckp.put(m_kal.getState());
+      ckp.put(m_kal.getCovariance());
+      ckp.put(m_last_lat);
+      ckp.put(m_last_lon);
+      ckp.put(m_last_hae);
+      ckp.put(m_last_z);
+      ckp.put(m_heading);
+      return true;
+    }
+
+    void
+    BasicNavigation::onCheckpointRestore(Tasks::Checkpoint& ckp, double age)
+    {
+      IMC::GpsFix origin;
+      Math::Matrix x;
+      Math::Matrix p;
+      ckp.get(origin);
+      ckp.get(x);
+      ckp.get(p);
+
+      if (x.size() != (int)m_kal.getState().size() || p.size() != (int)m_kal.getCovariance().size())
+        throw std::runtime_error(DTR("filter size does not match checkpoint"));
+
+      Memory::replace(m_origin, new IMC::GpsFix(origin));
+      m_active = setup();
+
+      for (int i = 0; i < x.rows(); ++i)
+        m_kal.setState(i, x(i));
+
+      // The vehicle may have moved while the task was down, so grow
+      // the covariance by the process noise of the missed predictions.
+      Math::Matrix q = m_kal.getProcessNoise();
+      double steps = age * getFrequency();
+      for (int i = 0; i < p.rows(); ++i)
+      {
+        for (int j = 0; j < p.columns(); ++j)
+          m_kal.setCovariance(i, j, p(i, j) + q(i, j) * steps);
+      }
+
+      ckp.get(m_last_lat);
+      ckp.get(m_last_lon);
+      ckp.get(m_last_hae);
+      ckp.get(m_last_z);
+      ckp.get(m_heading);
+
+      m_navstate = SM_STATE_BOOT;
+      setEntityState(IMC::EntityState::ESTA_BOOT, Status::CODE_WAIT_CONVERGE);
+      debug("resuming navigation from state of %.1f s ago", age);
+    }
+
     void
     BasicNavigation::consume(const IMC::Acceleration* msg)
     {
@@ -469,6 +536,9 @@ namespace DUNE
       if (m_declination_defined && m_use_declination)
         m_euler_bfr[AXIS_Z] += m_declination;
 
+      // Estimated state is traced back to the latest attitude sample.
+      m_estate.setTrace(*msg);
+
       m_time_without_euler.reset();
     }
 
@@ -1027,7 +1097,7 @@ namespace DUNE
       m_uncertainty.setTimeStamp(tstamp);
       m_navdata.setTimeStamp(tstamp);
 
-      dispatch(m_estate, DF_KEEP_TIME);
+      dispatch(m_estate, DF_KEEP_TIME | DF_KEEP_TRACE);
       dispatch(m_uncertainty, DF_KEEP_TIME);
       dispatch(m_navdata, DF_KEEP_TIME);
     }
@@ -142,6 +142,18 @@ namespace DUNE
       virtual void
       onResourceRelease(void);
 
+      //! Store navigation origin and filter state.
+      //! @param[in] ckp checkpoint.
+      //! @return true if navigation is active, false otherwise.
+      virtual bool
+      onCheckpointSave(Tasks::Checkpoint& ckp);
+
+      //! Resume navigation from a stored origin and filter state.
+      //! @param[in] ckp checkpoint.
+      //! @param[in] age checkpoint age.
+      virtual void
+      onCheckpointRestore(Tasks::Checkpoint& ckp, double age);
+
       void
       consume(const IMC::Acceleration* msg);
 
@@ -630,6 +642,8 @@ namespace DUNE
       bool m_reject_all_lbl;
       //! Use a Depth sensor.
       bool m_depth_sensor;
+      //! Process filter outputs one at a time.
+      bool m_sequential_update;
       //! LBL rejection constants.
       std::vector<float> m_lbl_reject_constants;
       //! Displacement between DVL and vehicle center of gravity.
@@ -33,15 +33,36 @@ namespace DUNE
 {
   namespace Navigation
   {
-    KalmanFilter::KalmanFilter(void)
+    //! Check if a matrix is diagonal.
+    //! @param[in] m matrix.
+    //! @return true if all elements outside the diagonal are zero.
+    static bool
+    isDiagonal(const Math::Matrix& m)
+    {
+      for (int i = 0; i < m.rows(); ++i)
+      {
+        for (int j = 0; j < m.columns(); ++j)
+        {
+          if (i != j && m.element(i, j) != 0.0)
+            return false;
+        }
+      }
+
+      return true;
+    }
+
+    KalmanFilter::KalmanFilter(void):
+      m_mode(UPDATE_BATCH)
     {
       m_state_count = 1;
       Math::Matrix I(1);
       I(0) = 0;
       m_x = m_y = m_ax = m_ap = m_c = m_p = m_q = m_r = m_innov = I;
+      indexCovarianceTransition();
     }
 
-    KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q)
+    KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q):
+      m_mode(UPDATE_BATCH)
     {
       m_ax = A;
       m_ap = A;
@@ -50,6 +71,7 @@ namespace DUNE
       m_q = Q;
       m_state_count = m_ax.rows();
       m_x.resizeAndFill(m_state_count, 1, 0.0);
+      indexCovarianceTransition();
     }
 
     void
@@ -68,6 +90,7 @@ namespace DUNE
 
       m_ax.identity();
       m_ap.identity();
+      indexCovarianceTransition();
     }
 
     bool
@@ -112,14 +135,14 @@ namespace DUNE
         throw std::runtime_error(DTR("invalid dimensions"));
 
       m_x = m_ax * m_x + b * u;
-      m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      predictCovariance();
     }
 
     void
     KalmanFilter::predict(void)
     {
       m_x = m_ax * m_x;
-      m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      predictCovariance();
     }
 
     int
@@ -137,6 +160,9 @@ namespace DUNE
       if (m_r.rows() != m_r.columns() || m_r.rows() != m_innov.rows())
         throw std::runtime_error(DTR("invalid dimensions"));
 
+      if (m_mode == UPDATE_SEQUENTIAL && isDiagonal(m_r))
+        return updateSequential(threshold);
+
       // Measurement prediction covariance.
       Math::Matrix S = (m_c * m_p * transpose(m_c)) + m_r;
       Math::Matrix S_1;
@@ -173,6 +199,178 @@ namespace DUNE
       return 0;
     }
 
+    void
+    KalmanFilter::indexCovarianceTransition(void)
+    {
+      size_t n = m_ap.rows();
+
+      // Storage is kept between calls since the transition matrix is
+      // usually set at every prediction.
+      m_ap_cols.clear();
+      m_ap_rows.clear();
+      for (size_t i = 0; i < n; ++i)
+      {
+        m_ap_rows.push_back(m_ap_cols.size());
+        for (size_t j = 0; j < n; ++j)
+        {
+          if (m_ap.element(i, j) != 0.0)
+            m_ap_cols.push_back(j);
+        }
+      }
+      m_ap_rows.push_back(m_ap_cols.size());
+
+      // Dense products are faster when most elements are non-zero.
+      m_ap_sparse = m_ap_cols.size() * 2 <= n * n;
+    }
+
+    void
+    KalmanFilter::predictCovariance(void)
+    {
+      if (!m_ap_sparse)
+      {
+        m_p = m_ap * m_p * transpose(m_ap) + m_q;
+        return;
+      }
+
+      size_t n = m_state_count;
+      const double* a = &m_ap(0, 0);
+      const double* q = &m_q(0, 0);
+      double* p = &m_p(0, 0);
+      const size_t* cols = m_ap_cols.empty() ? NULL : &m_ap_cols[0];
+      const size_t* rows = &m_ap_rows[0];
+
+      // AP = A * P.
+      m_ap_work.resize(n * n);
+      double* ap = &m_ap_work[0];
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = 0; j < n; ++j)
+        {
+          double v = 0.0;
+          for (size_t k = rows[i]; k < rows[i + 1]; ++k)
+            v += a[i * n + cols[k]] * p[cols[k] * n + j];
+          ap[i * n + j] = v;
+        }
+      }
+
+      // P = AP * A' + Q.
+      for (size_t i = 0; i < n; ++i)
+      {
+        for (size_t j = 0; j < n; ++j)
+        {
+          double v = q[i * n + j];
+          for (size_t k = rows[j]; k < rows[j + 1]; ++k)
+            v += ap[i * n + cols[k]] * a[j * n + cols[k]];
+          p[i * n + j] = v;
+        }
+      }
+    }
+
+    int
+    KalmanFilter::updateSequential(float threshold)
+    {
+      size_t n = m_state_count;
+      size_t m = m_innov.rows();
+
+      // Keep the prior estimate in case the update is rejected.
+      Math::Matrix x0 = m_x;
+      Math::Matrix p0 = m_p;
+
+      // Matrices are shared until written, take pointers afterwards.
+      double* x = &m_x(0);
+      double* p = &m_p(0, 0);
+      const double* c = &m_c(0, 0);
+
+      std::vector<double> ph(n);
+      std::vector<double> k(n);
+      std::vector<double> dx(n, 0.0);
+      std::vector<size_t> nz;
+      double level = 0.0;
+
+      for (size_t i = 0; i < m; ++i)
+      {
+        const double* h = c + i * n;
+
+        nz.clear();
+        for (size_t j = 0; j < n; ++j)
+        {
+          if (h[j] != 0.0)
+            nz.push_back(j);
+        }
+
+        // Outputs without observations do not change the estimate,
+        // but their innovations count towards the test statistic.
+        if (nz.empty())
+        {
+          if (threshold != 0)
+          {
+            double r = m_r.element(i, i);
+            if (r <= 0.0)
+              throw std::runtime_error(DTR("invalid measurement prediction variance"));
+
+            level += m_innov.element(i, 0) * m_innov.element(i, 0) / r;
+          }
+
+          continue;
+        }
+
+        // PH = P * h'.
+        for (size_t r = 0; r < n; ++r)
+        {
+          ph[r] = 0.0;
+          for (size_t l = 0; l < nz.size(); ++l)
+            ph[r] += p[r * n + nz[l]] * h[nz[l]];
+        }
+
+        // Measurement prediction variance and innovation with respect
+        // to the current estimate.
+        double s = m_r.element(i, i);
+        double innov = m_innov.element(i, 0);
+        for (size_t l = 0; l < nz.size(); ++l)
+        {
+          s += h[nz[l]] * ph[nz[l]];
+          innov -= h[nz[l]] * dx[nz[l]];
+        }
+
+        if (s <= 0.0)
+          throw std::runtime_error(DTR("invalid measurement prediction variance"));
+
+        // For a diagonal measurement noise covariance, the sum of the
+        // normalized innovations is the batch test statistic.
+        level += innov * innov / s;
+
+        // Kalman gain and state update.
+        for (size_t r = 0; r < n; ++r)
+        {
+          k[r] = ph[r] / s;
+          dx[r] += k[r] * innov;
+          x[r] += k[r] * innov;
+        }
+
+        // Joseph form: P = (I - k h) P (I - k h)' + k r k'.
+        for (size_t r = 0; r < n; ++r)
+        {
+          for (size_t j = r; j < n; ++j)
+          {
+            double v = p[r * n + j] - k[r] * ph[j] - ph[r] * k[j] + s * k[r] * k[j];
+            p[r * n + j] = v;
+            p[j * n + r] = v;
+          }
+        }
+      }
+
+      // Check if innovation is above a threshold value.
+      // Set threshold to 0 to accept everything.
+      if (threshold != 0 && level >= threshold)
+      {
+        m_x = x0;
+        m_p = p0;
+        return -1;
+      }
+
+      return 0;
+    }
+
     void
     KalmanFilter::setState(short pos, double value)
     {
@@ -225,6 +423,7 @@ namespace DUNE
         throw std::runtime_error(DTR("invalid dimensions"));
 
       m_ap = a;
+      indexCovarianceTransition();
     }
 
     void
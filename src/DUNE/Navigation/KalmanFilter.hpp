@@ -43,6 +43,7 @@
 // ISO C++ 98 headers.
 #include <stdexcept>
 #include <string>
+#include <vector>
 #include <cmath>
 
 // DUNE headers.
@@ -59,6 +60,20 @@ namespace DUNE
     class KalmanFilter
     {
     public:
+      //! Measurement update methods.
+      enum UpdateMode
+      {
+        //! All outputs are processed together. Requires the inverse
+        //! of the measurement prediction covariance.
+        UPDATE_BATCH,
+        //! Outputs are processed one at a time, skipping outputs
+        //! without observations. No matrix inverse is required and
+        //! the state covariance is updated in Joseph form. Requires
+        //! a diagonal measurement noise covariance matrix, otherwise
+        //! the batch update is used.
+        UPDATE_SEQUENTIAL
+      };
+
       //! Constructor.
       KalmanFilter(void);
 
@@ -107,6 +122,22 @@ namespace DUNE
       int
       update(float threshold);
 
+      //! Set the measurement update method.
+      //! @param[in] mode update method.
+      void
+      setUpdateMode(UpdateMode mode)
+      {
+        m_mode = mode;
+      }
+
+      //! Get the measurement update method.
+      //! @return update method.
+      UpdateMode
+      getUpdateMode(void) const
+      {
+        return m_mode;
+      }
+
       //! Get filter state value.
       //! @param pos matrix index.
       //! @return state matrix value.
@@ -320,6 +351,14 @@ namespace DUNE
       void
       setProcessNoise(double value);
 
+      //! Get process noise covariance matrix.
+      //! @return process noise covariance matrix.
+      inline Math::Matrix
+      getProcessNoise(void) const
+      {
+        return m_q;
+      }
+
       //! Set measurement noise covariance matrix value.
       //! @param ln row index.
       //! @param cl column index.
@@ -339,6 +378,8 @@ namespace DUNE
       setMeasurementNoise(double value);
 
     private:
+      //! Measurement update method.
+      UpdateMode m_mode;
       //! Kalman filter state count.
       size_t m_state_count;
       //! State vector.
@@ -359,6 +400,31 @@ namespace DUNE
       Math::Matrix m_r;
       //! Innovation vector.
       Math::Matrix m_innov;
+      //! Columns of the non-zero elements of the state covariance
+      //! transition matrix, row after row.
+      std::vector<size_t> m_ap_cols;
+      //! Offset in m_ap_cols of the first non-zero element of each
+      //! row, followed by the total number of non-zero elements.
+      std::vector<size_t> m_ap_rows;
+      //! Scratch storage of the covariance prediction.
+      std::vector<double> m_ap_work;
+      //! True if the state covariance transition matrix is sparse.
+      bool m_ap_sparse;
+
+      //! Find the non-zero elements of the state covariance
+      //! transition matrix.
+      void
+      indexCovarianceTransition(void);
+
+      //! Propagate the state covariance matrix.
+      void
+      predictCovariance(void);
+
+      //! Process outputs one at a time.
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if update is successful, -1 otherwise.
+      int
+      updateSequential(float threshold);
     };
   }
 }
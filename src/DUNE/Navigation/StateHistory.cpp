@@ -0,0 +1,391 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Navigation/StateHistory.hpp>
+#include <DUNE/Coordinates/General.hpp>
+#include <DUNE/Math/Angles.hpp>
+
+namespace DUNE
+{
+  namespace Navigation
+  {
+    struct StateHistory::Sample
+    {
+      //! Odd while the sample is being written.
+      volatile uint32_t seq;
+      //! Sequence number of the sample.
+      uint32_t index;
+      //! Time (s).
+      double time;
+      //! Absolute WGS-84 position.
+      double lat;
+      double lon;
+      float height;
+      //! Remaining fields of EstimatedState.
+      float phi;
+      float theta;
+      float psi;
+      float u;
+      float v;
+      float w;
+      float vx;
+      float vy;
+      float vz;
+      float p;
+      float q;
+      float r;
+      float depth;
+      float alt;
+    };
+
+    //! Interpolate two values.
+    static inline double
+    lerp(double a, double b, double f)
+    {
+      return a + (b - a) * f;
+    }
+
+    //! Interpolate two angles along the shortest arc.
+    static inline double
+    lerpAngle(double a, double b, double f)
+    {
+      return Math::Angles::normalizeRadian(a + Math::Angles::normalizeRadian(b - a) * f);
+    }
+
+    //! Convert Euler angles to a unit quaternion.
+    static void
+    toQuaternion(double phi, double theta, double psi, double q[4])
+    {
+      double cr = std::cos(phi / 2), sr = std::sin(phi / 2);
+      double cp = std::cos(theta / 2), sp = std::sin(theta / 2);
+      double cy = std::cos(psi / 2), sy = std::sin(psi / 2);
+
+      q[0] = cr * cp * cy + sr * sp * sy;
+      q[1] = sr * cp * cy - cr * sp * sy;
+      q[2] = cr * sp * cy + sr * cp * sy;
+      q[3] = cr * cp * sy - sr * sp * cy;
+    }
+
+    //! Spherical linear interpolation of two attitudes.
+    static void
+    slerp(const double a[3], const double b[3], double f, double out[3])
+    {
+      double qa[4];
+      double qb[4];
+      toQuaternion(a[0], a[1], a[2], qa);
+      toQuaternion(b[0], b[1], b[2], qb);
+
+      double dot = qa[0] * qb[0] + qa[1] * qb[1] + qa[2] * qb[2] + qa[3] * qb[3];
+
+      // Take the shortest path.
+      if (dot < 0)
+      {
+        for (unsigned i = 0; i < 4; ++i)
+          qb[i] = -qb[i];
+        dot = -dot;
+      }
+
+      double wa = 1.0 - f;
+      double wb = f;
+
+      // Fall back to linear interpolation for close attitudes.
+      if (dot < 0.9995)
+      {
+        double omega = std::acos(dot);
+        double so = std::sin(omega);
+        wa = std::sin((1.0 - f) * omega) / so;
+        wb = std::sin(f * omega) / so;
+      }
+
+      double q[4];
+      double norm = 0;
+      for (unsigned i = 0; i < 4; ++i)
+      {
+        q[i] = wa * qa[i] + wb * qb[i];
+        norm += q[i] * q[i];
+      }
+
+      norm = std::sqrt(norm);
+      for (unsigned i = 0; i < 4; ++i)
+        q[i] /= norm;
+
+      double sp = 2.0 * (q[0] * q[2] - q[3] * q[1]);
+      if (sp > 1.0)
+        sp = 1.0;
+      else if (sp < -1.0)
+        sp = -1.0;
+
+      out[0] = std::atan2(2.0 * (q[0] * q[1] + q[2] * q[3]), 1.0 - 2.0 * (q[1] * q[1] + q[2] * q[2]));
+      out[1] = std::asin(sp);
+      out[2] = std::atan2(2.0 * (q[0] * q[3] + q[1] * q[2]), 1.0 - 2.0 * (q[2] * q[2] + q[3] * q[3]));
+    }
+
+    StateHistory::StateHistory(unsigned capacity, Interpolation interp):
+      m_capacity(capacity),
+      m_interp(interp),
+      m_tolerance(std::numeric_limits<double>::max()),
+      m_first(0),
+      m_next(0)
+    {
+      m_samples = new Sample[m_capacity];
+      std::memset(m_samples, 0, sizeof(Sample) * m_capacity);
+    }
+
+    StateHistory::~StateHistory(void)
+    {
+      delete [] m_samples;
+    }
+
+    void
+    StateHistory::barrier(void) const
+    {
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH)
+      __sync_synchronize();
+#else
+      m_barrier.lock();
+      m_barrier.unlock();
+#endif
+    }
+
+    bool
+    StateHistory::push(const IMC::EstimatedState& state)
+    {
+      double time = state.getTimeStamp();
+
+      if (m_next != m_first && time <= m_samples[(m_next - 1) % m_capacity].time)
+        return false;
+
+      Sample& s = m_samples[m_next % m_capacity];
+
+      s.seq = s.seq + 1;
+      barrier();
+
+      s.index = m_next;
+      s.time = time;
+      Coordinates::toWGS84(state, s.lat, s.lon, s.height);
+      s.phi = state.phi;
+      s.theta = state.theta;
+      s.psi = state.psi;
+      s.u = state.u;
+      s.v = state.v;
+      s.w = state.w;
+      s.vx = state.vx;
+      s.vy = state.vy;
+      s.vz = state.vz;
+      s.p = state.p;
+      s.q = state.q;
+      s.r = state.r;
+      s.depth = state.depth;
+      s.alt = state.alt;
+
+      barrier();
+      s.seq = s.seq + 1;
+      barrier();
+
+      m_next = m_next + 1;
+      if (m_next - m_first > m_capacity)
+        m_first = m_next - m_capacity;
+
+      return true;
+    }
+
+    void
+    StateHistory::clear(void)
+    {
+      m_first = m_next;
+    }
+
+    bool
+    StateHistory::read(uint32_t index, Sample& sample) const
+    {
+      const Sample& s = m_samples[index % m_capacity];
+
+      while (true)
+      {
+        uint32_t seq = s.seq;
+        if (seq & 1)
+          continue;
+
+        barrier();
+        std::memcpy(&sample, (const void*)&s, sizeof(Sample));
+        barrier();
+
+        if (s.seq == seq)
+          break;
+      }
+
+      return sample.index == index;
+    }
+
+    bool
+    StateHistory::get(double time, IMC::EstimatedState& state, double* delta) const
+    {
+      Sample a;
+      Sample b;
+
+      while (true)
+      {
+        uint32_t first = m_first;
+        uint32_t next = m_next;
+        barrier();
+
+        uint32_t count = next - first;
+        if (count == 0)
+          return false;
+
+        // Find the number of samples not newer than the requested time.
+        uint32_t lo = 0;
+        uint32_t hi = count;
+        bool valid = true;
+        while (lo < hi)
+        {
+          uint32_t mid = lo + (hi - lo) / 2;
+          if (!read(first + mid, a))
+          {
+            valid = false;
+            break;
+          }
+
+          if (a.time <= time)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+
+        if (!valid)
+          continue;
+
+        if (lo == 0)
+        {
+          if (!read(first, a))
+            continue;
+          b = a;
+        }
+        else if (lo == count)
+        {
+          if (!read(next - 1, a))
+            continue;
+          b = a;
+        }
+        else
+        {
+          if (!read(first + lo - 1, a) || !read(first + lo, b))
+            continue;
+        }
+
+        break;
+      }
+
+      double da = std::fabs(time - a.time);
+      double db = std::fabs(b.time - time);
+      const Sample& n = (da <= db) ? a : b;
+      double dn = (da <= db) ? da : db;
+
+      if (delta != NULL)
+        *delta = dn;
+
+      if (dn > m_tolerance)
+        return false;
+
+      state.clear();
+      state.setTimeStamp(time);
+      state.x = 0;
+      state.y = 0;
+      state.z = 0;
+
+      if (m_interp == INTERP_NEAREST || a.index == b.index)
+      {
+        state.lat = n.lat;
+        state.lon = n.lon;
+        state.height = n.height;
+        state.phi = n.phi;
+        state.theta = n.theta;
+        state.psi = n.psi;
+        state.u = n.u;
+        state.v = n.v;
+        state.w = n.w;
+        state.vx = n.vx;
+        state.vy = n.vy;
+        state.vz = n.vz;
+        state.p = n.p;
+        state.q = n.q;
+        state.r = n.r;
+        state.depth = n.depth;
+        state.alt = n.alt;
+        return true;
+      }
+
+      double f = (time - a.time) / (b.time - a.time);
+
+      state.lat = lerp(a.lat, b.lat, f);
+      state.lon = lerp(a.lon, b.lon, f);
+      state.height = lerp(a.height, b.height, f);
+      state.u = lerp(a.u, b.u, f);
+      state.v = lerp(a.v, b.v, f);
+      state.w = lerp(a.w, b.w, f);
+      state.vx = lerp(a.vx, b.vx, f);
+      state.vy = lerp(a.vy, b.vy, f);
+      state.vz = lerp(a.vz, b.vz, f);
+      state.p = lerp(a.p, b.p, f);
+      state.q = lerp(a.q, b.q, f);
+      state.r = lerp(a.r, b.r, f);
+      state.depth = lerp(a.depth, b.depth, f);
+
+      // Negative altitude means invalid.
+      if (a.alt < 0 || b.alt < 0)
+        state.alt = n.alt;
+      else
+        state.alt = lerp(a.alt, b.alt, f);
+
+      if (m_interp == INTERP_SLERP)
+      {
+        double aa[3] = {a.phi, a.theta, a.psi};
+        double ab[3] = {b.phi, b.theta, b.psi};
+        double att[3];
+        slerp(aa, ab, f, att);
+        state.phi = att[0];
+        state.theta = att[1];
+        state.psi = att[2];
+      }
+      else
+      {
+        state.phi = lerpAngle(a.phi, b.phi, f);
+        state.theta = lerpAngle(a.theta, b.theta, f);
+        state.psi = lerpAngle(a.psi, b.psi, f);
+      }
+
+      return true;
+    }
+  }
+}
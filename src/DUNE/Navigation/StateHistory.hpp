@@ -0,0 +1,158 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_NAVIGATION_STATE_HISTORY_HPP_INCLUDED_
+#define DUNE_NAVIGATION_STATE_HISTORY_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace Navigation
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM StateHistory;
+
+    //! %StateHistory keeps the most recent navigation states in a
+    //! fixed capacity ring indexed by time, allowing payload drivers
+    //! to find the vehicle state at the time a sample was acquired.
+    //!
+    //! States are added by a single thread (usually the consumer of
+    //! EstimatedState) and may be looked up concurrently by any number
+    //! of threads without locking. Lookups take logarithmic time.
+    //!
+    //! Positions are stored as absolute WGS-84 coordinates, so the
+    //! states returned by get() have null displacements.
+    class StateHistory
+    {
+    public:
+      //! Interpolation method.
+      enum Interpolation
+      {
+        //! Closest state.
+        INTERP_NEAREST,
+        //! Linear interpolation of all fields.
+        INTERP_LINEAR,
+        //! Linear interpolation with spherical interpolation of
+        //! attitude.
+        INTERP_SLERP
+      };
+
+      //! Constructor.
+      //! @param[in] capacity maximum number of states.
+      //! @param[in] interp interpolation method.
+      StateHistory(unsigned capacity = 1024, Interpolation interp = INTERP_LINEAR);
+
+      //! Destructor.
+      ~StateHistory(void);
+
+      //! Set interpolation method.
+      //! @param[in] interp interpolation method.
+      void
+      setInterpolation(Interpolation interp)
+      {
+        m_interp = interp;
+      }
+
+      //! Set the maximum time between a requested time and the closest
+      //! state in the history.
+      //! @param[in] tolerance maximum time difference (s).
+      void
+      setTolerance(double tolerance)
+      {
+        m_tolerance = tolerance;
+      }
+
+      //! Add a state. States older than the last one are ignored.
+      //! @param[in] state estimated state.
+      //! @return true if state was added, false otherwise.
+      bool
+      push(const IMC::EstimatedState& state);
+
+      //! Remove all states.
+      void
+      clear(void);
+
+      //! Get number of states.
+      //! @return number of states.
+      unsigned
+      size(void) const
+      {
+        return m_next - m_first;
+      }
+
+      //! Get the state of the vehicle at a given time.
+      //! @param[in] time time in seconds since Unix Epoch.
+      //! @param[out] state estimated state.
+      //! @param[out] delta time difference to the closest state (s).
+      //! @return true if a state was found, false otherwise.
+      bool
+      get(double time, IMC::EstimatedState& state, double* delta = NULL) const;
+
+    private:
+      struct Sample;
+
+      //! Ring of samples.
+      Sample* m_samples;
+      //! Ring capacity.
+      unsigned m_capacity;
+      //! Interpolation method.
+      Interpolation m_interp;
+      //! Maximum time difference to the closest sample.
+      double m_tolerance;
+      //! Sequence number of the oldest sample.
+      volatile uint32_t m_first;
+      //! Sequence number of the next sample.
+      volatile uint32_t m_next;
+      //! Lock used as memory barrier if atomic builtins are not
+      //! available.
+      mutable Concurrency::Mutex m_barrier;
+
+      //! Read a sample.
+      //! @param[in] index sequence number.
+      //! @param[out] sample sample.
+      //! @return true if sample is still in the ring, false otherwise.
+      bool
+      read(uint32_t index, Sample& sample) const;
+
+      //! Issue a full memory barrier.
+      void
+      barrier(void) const;
+
+      // Non-copyable.
+      StateHistory(const StateHistory&);
+
+      StateHistory&
+      operator=(const StateHistory&);
+    };
+  }
+}
+
+#endif
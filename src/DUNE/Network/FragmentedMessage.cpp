@@ -25,8 +25,15 @@
 // Author: Jose Pinto                                                       *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
 // DUNE headers.
+#include <DUNE/Algorithms/ReedSolomon.hpp>
 #include <DUNE/Network/FragmentedMessage.hpp>
+#include <DUNE/Network/Fragments.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
 
 namespace DUNE
 {
@@ -56,35 +63,27 @@ namespace DUNE
         m_creation_time = Time::Clock::get();
       }
 
+      // Fragments past num_frags are parity fragments.
+      bool parity = part->frag_number >= m_num_frags;
+
       // Check if this is a valid fragment
       if (part->uid != m_uid || part->getSource() != m_src ||
-          part->frag_number >= m_num_frags)
+          (parity && part->data.size() <= c_parity_header_size))
       {
-        if (m_parent == NULL)
-          DUNE_ERR("FragmentedMessage", "Invalid fragment received and it won't be processed.");
-        else
-          m_parent->err(DTR("Invalid fragment received and it won't be processed."));
-
+        error(DTR("Invalid fragment received and it won't be processed."));
         return NULL;
       }
 
       m_fragments[part->frag_number] = *part;
 
       // Message is complete. Let's reassemble and return it.
-      if (getFragmentsMissing() == 0)
+      if (getFragmentsMissing() <= 0)
       {
-        int i;
-        int total_length = 0;
-        // concatenate all parts into a single array
-        std::vector<char> data;
-        for (i = 0; i < m_num_frags; i++)
-        {
-          total_length += m_fragments[i].data.size();
-          data.insert(data.end(), m_fragments[i].data.begin(),
-                      m_fragments[i].data.end());
-        }
+        // Data fragments are first in the map.
+        if (m_fragments.rbegin()->first < (unsigned)m_num_frags)
+          return reassemble();
 
-        return IMC::Packet::deserialize((uint8_t*)&data[0], total_length);
+        return recover();
       }
       else
       {
@@ -92,6 +91,85 @@ namespace DUNE
       }
     }
 
+    IMC::Message*
+    FragmentedMessage::reassemble(void)
+    {
+      int i;
+      int total_length = 0;
+      // concatenate all parts into a single array
+      std::vector<char> data;
+      for (i = 0; i < m_num_frags; i++)
+      {
+        total_length += m_fragments[i].data.size();
+        data.insert(data.end(), m_fragments[i].data.begin(),
+                    m_fragments[i].data.end());
+      }
+
+      return IMC::Packet::deserialize((uint8_t*)&data[0], total_length);
+    }
+
+    IMC::Message*
+    FragmentedMessage::recover(void)
+    {
+      const std::vector<char>& first = m_fragments.rbegin()->second.data;
+      unsigned frag_size = first.size() - c_parity_header_size;
+      uint16_t size = 0;
+      Utils::ByteCopy::fromLE(size, (const uint8_t*)&first[0]);
+
+      if (size > m_num_frags * frag_size || size <= (m_num_frags - 1) * frag_size)
+      {
+        error(DTR("Inconsistent parity fragments, message discarded."));
+        return NULL;
+      }
+
+      unsigned count = m_fragments.rbegin()->first + 1;
+      std::vector<const uint8_t*> blocks(count, (const uint8_t*)NULL);
+      std::vector<uint8_t*> outputs(m_num_frags);
+      std::vector<uint8_t> data(m_num_frags * frag_size, 0);
+
+      for (int i = 0; i < m_num_frags; ++i)
+        outputs[i] = &data[i * frag_size];
+
+      std::map<unsigned int, IMC::MessagePart>::const_iterator itr = m_fragments.begin();
+      for (; itr != m_fragments.end(); ++itr)
+      {
+        const std::vector<char>& frag = itr->second.data;
+
+        if (itr->first < (unsigned)m_num_frags)
+        {
+          // Data fragments are copied into the packet buffer.
+          if (frag.size() > frag_size)
+            continue;
+
+          std::memcpy(outputs[itr->first], &frag[0], frag.size());
+          blocks[itr->first] = outputs[itr->first];
+        }
+        else if (frag.size() == first.size())
+        {
+          // Parity fragments are used without copying.
+          blocks[itr->first] = (const uint8_t*)&frag[c_parity_header_size];
+        }
+      }
+
+      Algorithms::ReedSolomon rs(m_num_frags, count - m_num_frags);
+      if (!rs.decode(&blocks[0], &outputs[0], frag_size))
+      {
+        error(DTR("Inconsistent parity fragments, message discarded."));
+        return NULL;
+      }
+
+      return IMC::Packet::deserialize(&data[0], size);
+    }
+
+    void
+    FragmentedMessage::error(const char* msg)
+    {
+      if (m_parent == NULL)
+        DUNE_ERR("FragmentedMessage", msg);
+      else
+        m_parent->err("%s", msg);
+    }
+
     double
     FragmentedMessage::getAge(void)
     {
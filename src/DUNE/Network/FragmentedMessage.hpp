@@ -51,12 +51,45 @@ namespace DUNE
       IMC::Message*
       setFragment(const IMC::MessagePart* part);
 
+      //! Get the number of data fragments of the message.
+      //! @return number of data fragments or -1 if unknown.
+      int
+      getFragmentCount(void) const
+      {
+        return m_num_frags;
+      }
+
+      //! Test if a fragment was received.
+      //! @param[in] frag_number fragment number.
+      //! @return true if the fragment was received, false otherwise.
+      bool
+      hasFragment(unsigned frag_number) const
+      {
+        return m_fragments.find(frag_number) != m_fragments.end();
+      }
+
       void
       setParentTask(Tasks::Task* parent);
 
       ~FragmentedMessage(void);
 
     private:
+      //! Reassemble the message from the data fragments.
+      //! @return message.
+      IMC::Message*
+      reassemble(void);
+
+      //! Recover missing data fragments from parity fragments and
+      //! reassemble the message.
+      //! @return message or NULL if the fragments are inconsistent.
+      IMC::Message*
+      recover(void);
+
+      //! Report an error.
+      //! @param[in] msg error message.
+      void
+      error(const char* msg);
+
       int m_src;
       int m_uid;
       int m_num_frags;
@@ -25,8 +25,14 @@
 // Author: Jose Pinto                                                       *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+
 // DUNE headers.
+#include <DUNE/Algorithms/ReedSolomon.hpp>
 #include <DUNE/Network/Fragments.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
 
 namespace DUNE
 {
@@ -34,11 +40,20 @@ namespace DUNE
   {
     int Fragments::s_uid = 0;
 
-    Fragments::Fragments(IMC::Message* msg, int mtu)
+    Fragments::Fragments(IMC::Message* msg, int mtu, float redundancy)
     {
       m_uid = s_uid++;
       m_num_frags = 0;
+      m_num_parity = 0;
+      m_frag_size = 0;
+      m_size = 0;
+
       int frag_size = mtu - sizeof(IMC::Header) - 5;
+
+      // Parity fragments also carry the packet size.
+      if (redundancy > 0.0f)
+        frag_size -= c_parity_header_size;
+
       if (frag_size <= 0)
       {
         DUNE_ERR("Fragments", "MTU is too small");
@@ -46,40 +61,92 @@ namespace DUNE
       }
 
       Utils::ByteBuffer buff;
-      int size = IMC::Packet::serialize(msg, buff);
-      uint8_t* buffer = buff.getBuffer();
+      m_size = IMC::Packet::serialize(msg, buff);
+      m_frag_size = frag_size;
 
-      int part = 0, pos = 0;
-      m_num_frags = (int)std::ceil((float)size / (float)mtu);
+      int num_frags = (m_size + m_frag_size - 1) / m_frag_size;
+      if (num_frags > 255)
+      {
+        DUNE_ERR("Fragments", "message is too large for the MTU");
+        return;
+      }
 
-      while (pos < size)
+      m_num_frags = num_frags;
+
+      if (redundancy > 0.0f)
       {
-        int remaining = size - pos;
-        int cur_size = std::min(remaining, mtu);
-        IMC::MessagePart* mpart = new IMC::MessagePart();
-        mpart->frag_number = part++;
-        mpart->num_frags = m_num_frags;
-        mpart->uid = m_uid;
-        mpart->data.assign(buffer + pos, buffer + pos + cur_size);
-        pos += cur_size;
-        m_fragments.push_back(mpart);
+        m_num_parity = (int)std::ceil(m_num_frags * redundancy);
+        m_num_parity = std::min(m_num_parity, 256 - m_num_frags);
+      }
+
+      unsigned data_size = m_num_frags * m_frag_size;
+      m_data.resize(data_size + m_num_parity * (c_parity_header_size + m_frag_size), 0);
+      std::memcpy(&m_data[0], buff.getBuffer(), m_size);
+
+      if (m_num_parity == 0)
+        return;
+
+      std::vector<const uint8_t*> blocks(m_num_frags);
+      for (int i = 0; i < m_num_frags; ++i)
+        blocks[i] = &m_data[i * m_frag_size];
+
+      Algorithms::ReedSolomon rs(m_num_frags, m_num_parity);
+
+      for (int i = 0; i < m_num_parity; ++i)
+      {
+        uint8_t* parity = &m_data[data_size + i * (c_parity_header_size + m_frag_size)];
+        Utils::ByteCopy::toLE((uint16_t)m_size, parity);
+        rs.encode(&blocks[0], i, parity + c_parity_header_size, m_frag_size);
       }
     }
 
     IMC::MessagePart*
     Fragments::getFragment(int frag_number)
     {
+      if (m_fragments.empty())
+        m_fragments.resize(getNumberOfFragments(), NULL);
+
+      if (m_fragments[frag_number] == NULL)
+      {
+        unsigned size = 0;
+        const uint8_t* data = getFragmentData(frag_number, size);
+
+        IMC::MessagePart* mpart = new IMC::MessagePart();
+        mpart->frag_number = frag_number;
+        mpart->num_frags = m_num_frags;
+        mpart->uid = m_uid;
+        mpart->data.assign(data, data + size);
+        m_fragments[frag_number] = mpart;
+      }
+
       return m_fragments[frag_number];
     }
 
+    const uint8_t*
+    Fragments::getFragmentData(int frag_number, unsigned& size) const
+    {
+      if (frag_number < m_num_frags)
+      {
+        unsigned pos = frag_number * m_frag_size;
+        size = std::min(m_frag_size, m_size - pos);
+        return &m_data[pos];
+      }
+
+      size = c_parity_header_size + m_frag_size;
+      return &m_data[m_num_frags * m_frag_size + (frag_number - m_num_frags) * size];
+    }
+
     int
     Fragments::getNumberOfFragments(void)
     {
-      return m_num_frags;
+      return m_num_frags + m_num_parity;
     }
 
     Fragments::~Fragments(void)
     {
+      for (size_t i = 0; i < m_fragments.size(); ++i)
+        delete m_fragments[i];
+
       m_fragments.clear();
     }
 
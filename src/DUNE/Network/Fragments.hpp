@@ -28,6 +28,9 @@
 #ifndef DUNE_NETWORK_FRAGMENTS_HPP_INCLUDED_
 #define DUNE_NETWORK_FRAGMENTS_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/IMC.hpp>
 #include <DUNE/Tasks.hpp>
@@ -36,23 +39,72 @@ namespace DUNE
 {
   namespace Network
   {
+    //! Size of the header of parity fragments (serialized packet size,
+    //! little endian).
+    static const unsigned c_parity_header_size = 2;
+
+    //! Splits a message in MessagePart fragments. Fragments are views
+    //! into a single serialization of the message and are only turned
+    //! into MessagePart messages when requested.
+    //!
+    //! Optionally, data fragments are followed by parity fragments of
+    //! a systematic Reed-Solomon erasure code, so the message can be
+    //! reassembled from any num_frags fragments. Parity fragments have
+    //! frag_number >= num_frags, so receivers without erasure coding
+    //! discard them and still reassemble the data fragments.
     class Fragments
     {
     public:
-      Fragments(IMC::Message* message, int mtu);
+      //! Constructor.
+      //! @param[in] message message to fragment.
+      //! @param[in] mtu maximum serialized size of each fragment.
+      //! @param[in] redundancy number of parity fragments per data
+      //! fragment, zero to disable erasure coding.
+      Fragments(IMC::Message* message, int mtu, float redundancy = 0.0f);
 
+      //! Get a fragment, which remains owned by this object.
+      //! @param[in] frag_number fragment number.
+      //! @return fragment.
       IMC::MessagePart*
       getFragment(int frag_number);
 
+      //! Get the payload of a fragment without creating it.
+      //! @param[in] frag_number fragment number.
+      //! @param[out] size payload size.
+      //! @return pointer to the payload.
+      const uint8_t*
+      getFragmentData(int frag_number, unsigned& size) const;
+
+      //! Get the total number of fragments, data and parity.
+      //! @return number of fragments.
       int
       getNumberOfFragments(void);
 
+      //! Get the number of data fragments.
+      //! @return number of data fragments.
+      int
+      getNumberOfDataFragments(void) const
+      {
+        return m_num_frags;
+      }
+
       ~Fragments(void);
 
     private:
       static int s_uid;
       int m_uid;
+      //! Number of data fragments.
       int m_num_frags;
+      //! Number of parity fragments.
+      int m_num_parity;
+      //! Size of data fragments (the last may be shorter).
+      unsigned m_frag_size;
+      //! Serialized packet size.
+      unsigned m_size;
+      //! Serialized packet, padded to whole fragments, followed by
+      //! the parity fragments.
+      std::vector<uint8_t> m_data;
+      //! Fragments created so far.
       std::vector<IMC::MessagePart*> m_fragments;
     };
 
@@ -38,6 +38,7 @@
 #include <DUNE/Network/TCPSocket.hpp>
 #include <DUNE/Network/Exceptions.hpp>
 #include <DUNE/Time/Utils.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Concurrency/Scheduler.hpp>
 #include <DUNE/IO/Poll.hpp>
 
@@ -115,12 +116,33 @@ getLastErrorMessage(void)
 #endif
 }
 
+//! Check the value returned by a receive call.
+//! @param[in] rv value returned by the receive call.
+//! @return number of bytes received.
+static inline size_t
+checkReceive(ssize_t rv)
+{
+  if (rv == 0)
+  {
+    throw DUNE::Network::ConnectionClosed();
+  }
+  else if (rv < 0)
+  {
+    if (errno == ECONNRESET)
+      throw DUNE::Network::ConnectionClosed();
+    throw DUNE::Network::NetworkError(DTR("error receiving data"), getLastErrorMessage());
+  }
+
+  return static_cast<size_t>(rv);
+}
+
 namespace DUNE
 {
   namespace Network
   {
     TCPSocket::TCPSocket(bool create):
-      m_handle(INVALID_SOCKET)
+      m_handle(INVALID_SOCKET),
+      m_timestamps(false)
     {
       if (create)
       {
@@ -214,19 +236,56 @@ namespace DUNE
     size_t
     TCPSocket::doRead(uint8_t* bfr, size_t size)
     {
-      ssize_t rv = ::recv(m_handle, (char*)bfr, size, 0);
-      if (rv == 0)
-      {
-        throw ConnectionClosed();
-      }
-      else if (rv < 0)
+      return checkReceive(::recv(m_handle, (char*)bfr, size, 0));
+    }
+
+    size_t
+    TCPSocket::doReadTimestamped(uint8_t* bfr, size_t size, double& timestamp)
+    {
+#if defined(DUNE_SYS_HAS_RECVMSG) && defined(SO_TIMESTAMPNS)
+      if (m_timestamps)
       {
-        if (errno == ECONNRESET)
-          throw ConnectionClosed();
-        throw NetworkError(DTR("error receiving data"), getLastErrorMessage());
+        iovec iov;
+        iov.iov_base = bfr;
+        iov.iov_len = size;
+
+        // Ancillary data buffer, aligned for cmsghdr.
+        union
+        {
+          cmsghdr align;
+          char data[CMSG_SPACE(sizeof(timespec))];
+        } control;
+
+        msghdr msg;
+        std::memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.data;
+        msg.msg_controllen = sizeof(control.data);
+
+        size_t rv = checkReceive(::recvmsg(m_handle, &msg, 0));
+        timestamp = Time::Clock::getSinceEpoch();
+
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+          if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+          {
+            timespec ts;
+            std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+            // Kernel times are not affected by the time scale.
+            uint64_t nsec = (uint64_t)ts.tv_sec * Time::c_nsec_per_sec + ts.tv_nsec;
+            timestamp = Time::Clock::fromSystemSinceEpochNsec(nsec) / Time::c_nsec_per_sec_fp;
+            break;
+          }
+        }
+
+        return rv;
       }
+#endif
 
-      return static_cast<size_t>(rv);
+      size_t rv = doRead(bfr, size);
+      timestamp = Time::Clock::getSinceEpoch();
+      return rv;
     }
 
     size_t
@@ -338,6 +397,20 @@ namespace DUNE
       setsockopt(m_handle, IPPROTO_TCP, TCP_NODELAY, (char*)&set, sizeof(set));
     }
 
+    void
+    TCPSocket::enableTimestamps(bool enabled)
+    {
+#if defined(DUNE_SYS_HAS_RECVMSG) && defined(SO_TIMESTAMPNS)
+      int set = enabled ? 1 : 0;
+      if (setsockopt(m_handle, SOL_SOCKET, SO_TIMESTAMPNS, (char*)&set, sizeof(set)) < 0)
+        throw NetworkError(DTR("unable to enable timestamps"), getLastErrorMessage());
+
+      m_timestamps = enabled;
+#else
+      (void)enabled;
+#endif
+    }
+
     void
     TCPSocket::setReceiveTimeout(double timeout)
     {
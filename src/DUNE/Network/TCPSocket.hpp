@@ -88,6 +88,14 @@ namespace DUNE
       void
       setNoDelay(bool enabled);
 
+      //! Enable/disable kernel receive timestamps. When enabled, and
+      //! supported by the operating system, timestamped reads report
+      //! the time at which the most recent segment was received by
+      //! the network stack instead of the time at which it was read.
+      //! @param[in] enabled true to enable, false to disable.
+      void
+      enableTimestamps(bool enabled);
+
       //! Set the timeout value that specifies the maximum amount of
       //! time an input function waits until it completes.
       //! @param[in] timeout timeout value in second.
@@ -115,6 +123,8 @@ namespace DUNE
 #else
       int m_handle;
 #endif
+      //! True if kernel receive timestamps are enabled.
+      bool m_timestamps;
 
       IO::NativeHandle
       doGetNative(void) const;
@@ -122,6 +132,9 @@ namespace DUNE
       size_t
       doRead(uint8_t* buffer, size_t size);
 
+      size_t
+      doReadTimestamped(uint8_t* buffer, size_t size, double& timestamp);
+
       size_t
       doWrite(const uint8_t* bfr, size_t size);
 
@@ -27,6 +27,7 @@
 
 // ISO C++ 98 headers.
 #include <cerrno>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -34,6 +35,7 @@
 #include <DUNE/Network/UDPSocket.hpp>
 #include <DUNE/Network/Exceptions.hpp>
 #include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/Time/Clock.hpp>
 
 // Win32 headers.
 #if defined(DUNE_SYS_HAS_WINSOCK2_H)
@@ -92,7 +94,8 @@ namespace DUNE
   namespace Network
   {
     UDPSocket::UDPSocket(void):
-      m_con_port(0)
+      m_con_port(0),
+      m_timestamps(false)
     {
       //  POSIX / Win32
 #if defined(DUNE_SYS_HAS_SOCKET)
@@ -141,6 +144,20 @@ namespace DUNE
       setsockopt(m_handle, SOL_SOCKET, SO_BROADCAST, (char*)&on, sizeof(int));
     }
 
+    void
+    UDPSocket::enableTimestamps(bool value)
+    {
+#if defined(DUNE_SYS_HAS_RECVMSG) && defined(SO_TIMESTAMPNS)
+      int on = value ? 1 : 0;
+      if (setsockopt(m_handle, SOL_SOCKET, SO_TIMESTAMPNS, (char*)&on, sizeof(int)) < 0)
+        throw NetworkError(DTR("unable to enable timestamps"), DUNE_SOCKET_ERROR);
+
+      m_timestamps = value;
+#else
+      (void)value;
+#endif
+    }
+
     void
     UDPSocket::setMulticastTTL(uint8_t value)
     {
@@ -205,6 +222,70 @@ namespace DUNE
       return rv;
     }
 
+    size_t
+    UDPSocket::read(uint8_t* buffer, size_t size, double& timestamp, Address* addr, uint16_t* port)
+    {
+#if defined(DUNE_SYS_HAS_RECVMSG) && defined(SO_TIMESTAMPNS)
+      if (m_timestamps)
+      {
+        sockaddr_in host;
+        std::memset(&host, 0, sizeof(host));
+
+        iovec iov;
+        iov.iov_base = buffer;
+        iov.iov_len = size;
+
+        // Ancillary data buffer, aligned for cmsghdr.
+        union
+        {
+          cmsghdr align;
+          char data[CMSG_SPACE(sizeof(timespec))];
+        } control;
+
+        msghdr msg;
+        std::memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &host;
+        msg.msg_namelen = sizeof(host);
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.data;
+        msg.msg_controllen = sizeof(control.data);
+
+        ssize_t rv = recvmsg(m_handle, &msg, 0);
+
+        if (rv <= 0)
+          throw NetworkError(DTR("error receiving data"), DUNE_SOCKET_ERROR);
+
+        timestamp = Time::Clock::getSinceEpoch();
+
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+          if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+          {
+            timespec ts;
+            std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+            // Kernel times are not affected by the time scale.
+            uint64_t nsec = (uint64_t)ts.tv_sec * Time::c_nsec_per_sec + ts.tv_nsec;
+            timestamp = Time::Clock::fromSystemSinceEpochNsec(nsec) / Time::c_nsec_per_sec_fp;
+            break;
+          }
+        }
+
+        if (addr != NULL)
+          *addr = (::sockaddr*)&host;
+
+        if (port != NULL)
+          *port = Utils::ByteCopy::fromBE(host.sin_port);
+
+        return rv;
+      }
+#endif
+
+      size_t rv = read(buffer, size, addr, port);
+      timestamp = Time::Clock::getSinceEpoch();
+      return rv;
+    }
+
     size_t
     UDPSocket::write(const uint8_t* buffer, size_t size, const Address& host, uint16_t port)
     {
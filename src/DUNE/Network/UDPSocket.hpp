@@ -58,6 +58,14 @@ namespace DUNE
       void
       enableBroadcast(bool value);
 
+      //! Enable/disable kernel receive timestamps. When enabled, and
+      //! supported by the operating system, timestamped reads report
+      //! the time at which each datagram was received by the network
+      //! stack instead of the time at which it was read.
+      //! @param[in] value true to enable, false to disable.
+      void
+      enableTimestamps(bool value);
+
       void
       setMulticastTTL(uint8_t ttl = 1);
 
@@ -95,6 +103,16 @@ namespace DUNE
       size_t
       read(uint8_t* buffer, size_t size, Address* addr = NULL, uint16_t* port = NULL);
 
+      //! Receive an UDP datagram, retrieving the time at which it
+      //! arrived and the address of the source host.
+      //! @param buffer destination buffer.
+      //! @param size destination buffer length.
+      //! @param timestamp arrival time (seconds since the UNIX Epoch).
+      //! @param addr system specific host address.
+      //! @param port system specific host port.
+      size_t
+      read(uint8_t* buffer, size_t size, double& timestamp, Address* addr = NULL, uint16_t* port = NULL);
+
     private:
       //! Platform specific handle.
 #if defined(DUNE_OS_WINDOWS)
@@ -108,6 +126,8 @@ namespace DUNE
       Address m_con_addr;
       //! Connected port.
       unsigned m_con_port;
+      //! True if kernel receive timestamps are enabled.
+      bool m_timestamps;
 
       IO::NativeHandle
       doGetNative(void) const
@@ -131,6 +151,12 @@ namespace DUNE
         return read(data, data_size, NULL, NULL);
       }
 
+      size_t
+      doReadTimestamped(uint8_t* data, size_t data_size, double& timestamp)
+      {
+        return read(data, data_size, timestamp, NULL, NULL);
+      }
+
       void
       createEventHandle(void);
 
@@ -32,6 +32,20 @@ namespace DUNE
 {
   namespace Plans
   {
+    //! Get the position of a maneuver.
+    //! @param[in] maneuver maneuver message
+    //! @param[out] lat latitude
+    //! @param[out] lon longitude
+    //! @return true.
+    template <typename Type>
+    static bool
+    getPosition(const IMC::Message* maneuver, double& lat, double& lon)
+    {
+      lat = static_cast<const Type*>(maneuver)->lat;
+      lon = static_cast<const Type*>(maneuver)->lon;
+      return true;
+    }
+
     float
     TimeProfile::distance2D(const Position& new_pos, const Position& last_pos)
     {
@@ -552,5 +566,98 @@ namespace DUNE
       m_finite_duration = true;
       return;
     }
+
+    bool
+    TimeProfile::parse(const std::vector<IMC::PlanManeuver*>& nodes,
+                       const IMC::EstimatedState* state,
+                       const TimeProfile& reference)
+    {
+      double lat;
+      double lon;
+
+      if (nodes.empty() || nodes.front()->data.isNull())
+        return false;
+
+      if (!getAnchor(nodes.front()->data.get(), lat, lon))
+        return false;
+
+      const std::string& first = nodes.front()->maneuver_id;
+      const_iterator ref = reference.find(first);
+      if (ref == reference.end() || ref->second.durations.empty())
+        return false;
+
+      clear();
+      parse(std::vector<IMC::PlanManeuver*>(1, nodes.front()), state);
+
+      const_iterator itr = find(first);
+      if (itr == end() || itr->second.durations.empty())
+      {
+        clear();
+        return false;
+      }
+
+      // Maneuvers after an anchor take the same time wherever the plan starts.
+      float shift = itr->second.durations.back() - ref->second.durations.back();
+
+      for (ref = reference.begin(); ref != reference.end(); ++ref)
+      {
+        if (ref->first == first)
+          continue;
+
+        Profile prof = ref->second;
+        for (size_t i = 0; i < prof.durations.size(); ++i)
+          prof.durations[i] += shift;
+
+        m_profiles.insert(std::pair<std::string, Profile>(ref->first, prof));
+      }
+
+      m_last_valid = reference.m_last_valid;
+      m_finite_duration = reference.m_finite_duration;
+      return true;
+    }
+
+    bool
+    TimeProfile::getAnchor(const IMC::Message* maneuver, double& lat, double& lon)
+    {
+      switch (maneuver->getId())
+      {
+        case DUNE_IMC_GOTO:
+          return getPosition<IMC::Goto>(maneuver, lat, lon);
+
+        case DUNE_IMC_STATIONKEEPING:
+          return getPosition<IMC::StationKeeping>(maneuver, lat, lon);
+
+        case DUNE_IMC_LOITER:
+          return getPosition<IMC::Loiter>(maneuver, lat, lon);
+
+        case DUNE_IMC_ROWS:
+          return getPosition<IMC::Rows>(maneuver, lat, lon);
+
+        case DUNE_IMC_ROWSCOVERAGE:
+          return getPosition<IMC::RowsCoverage>(maneuver, lat, lon);
+
+        case DUNE_IMC_YOYO:
+          return getPosition<IMC::YoYo>(maneuver, lat, lon);
+
+        case DUNE_IMC_COMPASSCALIBRATION:
+          return getPosition<IMC::CompassCalibration>(maneuver, lat, lon);
+
+        case DUNE_IMC_FOLLOWPATH:
+          // Without points the vehicle stays where it was.
+          if (!static_cast<const IMC::FollowPath*>(maneuver)->points.size())
+            return false;
+          return getPosition<IMC::FollowPath>(maneuver, lat, lon);
+
+        case DUNE_IMC_POPUP:
+          // Only travels to its position if requested to.
+          if ((static_cast<const IMC::PopUp*>(maneuver)->flags & IMC::PopUp::FLG_CURR_POS) == 0)
+            return false;
+          return getPosition<IMC::PopUp>(maneuver, lat, lon);
+
+        default:
+          // Elevator and unknown maneuvers keep the previous position.
+          return false;
+      }
+    }
   }
 }
@@ -126,12 +126,35 @@ namespace DUNE
       void
       parse(const std::vector<IMC::PlanManeuver*>& nodes, const IMC::EstimatedState* state);
 
+      //! Parse plan duration and speeds reusing the profiles computed
+      //! for the same nodes from another start position. Only the first
+      //! maneuver is parsed, the remaining durations are shifted.
+      //! @param[in] nodes vector of plan maneuver nodes
+      //! @param[in] state current estimated state
+      //! @param[in] reference profiles previously parsed for nodes
+      //! @return true if the reference was used, false otherwise
+      bool
+      parse(const std::vector<IMC::PlanManeuver*>& nodes, const IMC::EstimatedState* state,
+            const TimeProfile& reference);
+
+      //! Get a position from which the given maneuver can be parsed
+      //! when the path after it does not depend on the previous position.
+      //! @param[in] maneuver maneuver message
+      //! @param[out] lat latitude in radians
+      //! @param[out] lon longitude in radians
+      //! @return true if the maneuver has such a position, false otherwise
+      static bool
+      getAnchor(const IMC::Message* maneuver, double& lat, double& lon);
+
       //! Clear the vector
       inline void
       clear(void)
       {
         m_profiles.clear();
         m_last_valid.clear();
+        m_finite_duration = false;
+        Memory::clear(m_accum_dur);
+        Memory::clear(m_speed_vec);
       }
 
       //! First position of the vector
@@ -0,0 +1,275 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
+#include <DUNE/Simulation/Bathymetry.hpp>
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    //! File signature.
+    static const char c_magic[] = {'D', 'B', 'G', 'R'};
+    //! File format version.
+    static const uint16_t c_version = 1;
+    //! Header size.
+    static const size_t c_header_size = 64;
+    //! Number of bisection steps used to refine ray hits.
+    static const unsigned c_ray_refine = 10;
+
+    //! Compute number of tiles needed to cover a number of cells.
+    static unsigned
+    tileCount(unsigned cells, unsigned tile)
+    {
+      return (cells + tile - 1) / tile;
+    }
+
+    void
+    Bathymetry::write(const FileSystem::Path& path, const Layout& layout, const std::vector<float>& depths)
+    {
+      if (layout.rows == 0 || layout.cols == 0 || layout.tile == 0 || layout.cell <= 0)
+        throw Error(path.str(), "invalid layout");
+
+      if (depths.size() != (size_t)layout.rows * layout.cols)
+        throw Error(path.str(), "number of depths does not match layout");
+
+      std::ofstream ofs(path.c_str(), std::ios::binary | std::ios::trunc);
+      if (!ofs.is_open())
+        throw Error(path.str(), std::strerror(errno));
+
+      uint8_t hdr[c_header_size] = {0};
+      std::memcpy(hdr, c_magic, sizeof(c_magic));
+      Utils::ByteCopy::toLE(c_version, hdr + 4);
+      Utils::ByteCopy::toLE((uint16_t)layout.tile, hdr + 6);
+      Utils::ByteCopy::toLE((uint32_t)layout.rows, hdr + 8);
+      Utils::ByteCopy::toLE((uint32_t)layout.cols, hdr + 12);
+      Utils::ByteCopy::toLE(layout.lat, hdr + 16);
+      Utils::ByteCopy::toLE(layout.lon, hdr + 24);
+      Utils::ByteCopy::toLE(layout.north, hdr + 32);
+      Utils::ByteCopy::toLE(layout.east, hdr + 40);
+      Utils::ByteCopy::toLE(layout.cell, hdr + 48);
+      ofs.write((const char*)hdr, sizeof(hdr));
+
+      unsigned tile_rows = tileCount(layout.rows, layout.tile);
+      unsigned tile_cols = tileCount(layout.cols, layout.tile);
+      std::vector<uint8_t> tile(layout.tile * layout.tile * 4);
+      float nan = std::numeric_limits<float>::quiet_NaN();
+
+      for (unsigned tr = 0; tr < tile_rows; ++tr)
+      {
+        for (unsigned tc = 0; tc < tile_cols; ++tc)
+        {
+          uint8_t* ptr = &tile[0];
+
+          for (unsigned r = 0; r < layout.tile; ++r)
+          {
+            for (unsigned c = 0; c < layout.tile; ++c, ptr += 4)
+            {
+              unsigned row = tr * layout.tile + r;
+              unsigned col = tc * layout.tile + c;
+
+              if (row < layout.rows && col < layout.cols)
+                Utils::ByteCopy::toLE(depths[(size_t)row * layout.cols + col], ptr);
+              else
+                Utils::ByteCopy::toLE(nan, ptr);
+            }
+          }
+
+          ofs.write((const char*)&tile[0], tile.size());
+        }
+      }
+
+      if (!ofs.good())
+        throw Error(path.str(), "failed to write");
+    }
+
+    Bathymetry::Bathymetry(const FileSystem::Path& path):
+      m_data(NULL)
+    {
+      try
+      {
+        m_file.open(path);
+      }
+      catch (FileSystem::FileReadError& e)
+      {
+        throw Error(path.str(), e.what());
+      }
+
+      const uint8_t* base = m_file.getData();
+      size_t size = m_file.getSize();
+
+      uint16_t version = 0;
+      uint16_t tile = 0;
+      uint32_t rows = 0;
+      uint32_t cols = 0;
+
+      if (size < c_header_size || std::memcmp(base, c_magic, sizeof(c_magic)) != 0)
+        throw Error(path.str(), "invalid signature");
+
+      Utils::ByteCopy::fromLE(version, base + 4);
+      if (version != c_version)
+        throw Error(path.str(), "unsupported version");
+
+      Utils::ByteCopy::fromLE(tile, base + 6);
+      Utils::ByteCopy::fromLE(rows, base + 8);
+      Utils::ByteCopy::fromLE(cols, base + 12);
+      Utils::ByteCopy::fromLE(m_layout.lat, base + 16);
+      Utils::ByteCopy::fromLE(m_layout.lon, base + 24);
+      Utils::ByteCopy::fromLE(m_layout.north, base + 32);
+      Utils::ByteCopy::fromLE(m_layout.east, base + 40);
+      Utils::ByteCopy::fromLE(m_layout.cell, base + 48);
+      m_layout.tile = tile;
+      m_layout.rows = rows;
+      m_layout.cols = cols;
+
+      if (tile == 0 || rows == 0 || cols == 0 || !(m_layout.cell > 0))
+        throw Error(path.str(), "invalid layout");
+
+      m_tile_cols = tileCount(cols, tile);
+      size_t cells = (size_t)tileCount(rows, tile) * m_tile_cols * tile * tile;
+      if (size < c_header_size + cells * 4)
+        throw Error(path.str(), "file is truncated");
+
+      m_data = base + c_header_size;
+    }
+
+    Bathymetry::~Bathymetry(void)
+    { }
+
+    float
+    Bathymetry::getCell(unsigned row, unsigned col) const
+    {
+      unsigned tile = m_layout.tile;
+      size_t index = ((size_t)(row / tile) * m_tile_cols + col / tile) * tile * tile
+      + (row % tile) * tile + col % tile;
+
+      float value;
+      Utils::ByteCopy::fromLE(value, m_data + index * 4);
+      return value;
+    }
+
+    bool
+    Bathymetry::getDepth(double north, double east, double& depth) const
+    {
+      double r = (north - m_layout.north) / m_layout.cell;
+      double c = (east - m_layout.east) / m_layout.cell;
+
+      if (!(r >= 0 && c >= 0 && r <= m_layout.rows - 1 && c <= m_layout.cols - 1))
+        return false;
+
+      unsigned r0 = (unsigned)r;
+      unsigned c0 = (unsigned)c;
+      unsigned r1 = std::min(r0 + 1, m_layout.rows - 1);
+      unsigned c1 = std::min(c0 + 1, m_layout.cols - 1);
+      double fr = r - r0;
+      double fc = c - c0;
+
+      float cells[4] = {getCell(r0, c0), getCell(r0, c1), getCell(r1, c0), getCell(r1, c1)};
+      double weights[4] = {(1 - fr) * (1 - fc), (1 - fr) * fc, fr * (1 - fc), fr * fc};
+
+      double sum = 0;
+      double total = 0;
+      for (unsigned i = 0; i < 4; ++i)
+      {
+        if (cells[i] != cells[i])
+          continue;
+
+        sum += cells[i] * weights[i];
+        total += weights[i];
+      }
+
+      if (total <= 0)
+        return false;
+
+      depth = sum / total;
+      return true;
+    }
+
+    bool
+    Bathymetry::castRay(const double origin[3], const double direction[3],
+                        double max_range, double& range) const
+    {
+      double norm = std::sqrt(direction[0] * direction[0]
+                              + direction[1] * direction[1]
+                              + direction[2] * direction[2]);
+      if (norm <= 0)
+        return false;
+
+      double d[3] = {direction[0] / norm, direction[1] / norm, direction[2] / norm};
+      double step = m_layout.cell / 2.0;
+      double prev = 0;
+      double t = 0;
+
+      while (true)
+      {
+        double depth;
+        if (getDepth(origin[0] + d[0] * t, origin[1] + d[1] * t, depth)
+            && origin[2] + d[2] * t >= depth)
+        {
+          if (t == 0)
+          {
+            range = 0;
+            return true;
+          }
+
+          // Refine the hit between the last two samples.
+          double lo = prev;
+          double hi = t;
+          for (unsigned i = 0; i < c_ray_refine; ++i)
+          {
+            double mid = (lo + hi) / 2.0;
+            if (getDepth(origin[0] + d[0] * mid, origin[1] + d[1] * mid, depth)
+                && origin[2] + d[2] * mid >= depth)
+              hi = mid;
+            else
+              lo = mid;
+          }
+
+          range = hi;
+          return true;
+        }
+
+        if (t >= max_range)
+          return false;
+
+        prev = t;
+        t = std::min(t + step, max_range);
+      }
+    }
+  }
+}
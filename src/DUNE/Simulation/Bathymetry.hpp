@@ -0,0 +1,157 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_SIMULATION_BATHYMETRY_HPP_INCLUDED_
+#define DUNE_SIMULATION_BATHYMETRY_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/MappedFile.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+
+namespace DUNE
+{
+  namespace Simulation
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Bathymetry;
+
+    //! Gridded bathymetry raster.
+    //!
+    //! Depths are stored in a binary file as single precision values
+    //! on a regular north/east grid, grouped in square tiles so that
+    //! nearby cells share memory pages. Files are memory mapped, so
+    //! loading time does not depend on the size of the surveyed area.
+    //! Cells without data hold NaN.
+    class Bathymetry
+    {
+    public:
+      //! Bathymetry error.
+      class Error: public std::runtime_error
+      {
+      public:
+        Error(const std::string& path, const std::string& msg):
+          std::runtime_error("bathymetry grid " + path + ": " + msg)
+        { }
+      };
+
+      //! Grid layout.
+      struct Layout
+      {
+        //! Reference latitude (rad).
+        double lat;
+        //! Reference longitude (rad).
+        double lon;
+        //! Northing of the first cell, relative to the reference (m).
+        double north;
+        //! Easting of the first cell, relative to the reference (m).
+        double east;
+        //! Cell size (m).
+        double cell;
+        //! Number of rows (north direction).
+        unsigned rows;
+        //! Number of columns (east direction).
+        unsigned cols;
+        //! Number of cells in each side of a tile.
+        unsigned tile;
+      };
+
+      //! Write a grid to a file.
+      //! @param[in] path output file.
+      //! @param[in] layout grid layout.
+      //! @param[in] depths depths in row-major order (NaN if unknown).
+      static void
+      write(const FileSystem::Path& path, const Layout& layout, const std::vector<float>& depths);
+
+      //! Load a grid.
+      //! @param[in] path grid file.
+      Bathymetry(const FileSystem::Path& path);
+
+      ~Bathymetry(void);
+
+      //! Get grid layout.
+      //! @return grid layout.
+      const Layout&
+      getLayout(void) const
+      {
+        return m_layout;
+      }
+
+      //! Get depth of a grid cell.
+      //! @param[in] row cell row.
+      //! @param[in] col cell column.
+      //! @return depth or NaN if unknown.
+      float
+      getCell(unsigned row, unsigned col) const;
+
+      //! Get depth by bilinear interpolation of the surrounding
+      //! cells. Unknown cells are ignored.
+      //! @param[in] north northing relative to the reference (m).
+      //! @param[in] east easting relative to the reference (m).
+      //! @param[out] depth depth (m).
+      //! @return true if depth is known, false otherwise.
+      bool
+      getDepth(double north, double east, double& depth) const;
+
+      //! Find the distance along a ray to the bottom.
+      //! @param[in] origin northing, easting and depth of the ray
+      //! origin (m).
+      //! @param[in] direction ray direction (north, east, down).
+      //! @param[in] max_range maximum range (m).
+      //! @param[out] range distance to the bottom (m).
+      //! @return true if the ray hits the bottom within the maximum
+      //! range, false otherwise.
+      bool
+      castRay(const double origin[3], const double direction[3],
+              double max_range, double& range) const;
+
+    private:
+      //! Grid layout.
+      Layout m_layout;
+      //! Number of tile columns.
+      unsigned m_tile_cols;
+      //! Cell data.
+      const uint8_t* m_data;
+      //! File contents.
+      FileSystem::MappedFile m_file;
+
+      // Non-copyable.
+      Bathymetry(const Bathymetry&);
+
+      Bathymetry&
+      operator=(const Bathymetry&);
+    };
+  }
+}
+
+#endif
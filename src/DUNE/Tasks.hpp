@@ -40,6 +40,7 @@ namespace DUNE
 #include <DUNE/Tasks/Consumer.hpp>
 #include <DUNE/Tasks/Periodic.hpp>
 #include <DUNE/Tasks/Profiles.hpp>
+#include <DUNE/Tasks/Checkpoint.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Manager.hpp>
@@ -48,6 +49,7 @@ namespace DUNE
 #include <DUNE/Tasks/AbstractCreator.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
 #include <DUNE/Tasks/SimpleTransport.hpp>
+#include <DUNE/Tasks/FilterTable.hpp>
 #include <DUNE/Tasks/MessageFilter.hpp>
 #include <DUNE/Tasks/SourceFilter.hpp>
 
@@ -0,0 +1,476 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Algorithms/CRC32.hpp>
+#include <DUNE/FileSystem/Exceptions.hpp>
+#include <DUNE/Math/General.hpp>
+#include <DUNE/Tasks/Checkpoint.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_MMAP)
+#  include <sys/types.h>
+#  include <sys/stat.h>
+#  include <sys/mman.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! File signature.
+    static const char c_magic[] = {'D', 'C', 'K', 'P'};
+    //! File format version.
+    static const uint16_t c_version = 1;
+    //! File header size.
+    static const size_t c_header_size = 16;
+    //! Slot header size.
+    static const size_t c_slot_header_size = 24;
+    //! Minimum slot capacity.
+    static const size_t c_min_capacity = 2048;
+
+    //! Slot header.
+    struct SlotHeader
+    {
+      //! Sequence number.
+      uint32_t sequence;
+      //! Snapshot size.
+      uint32_t size;
+      //! Snapshot time.
+      double time;
+      //! CRC-32 of the header (with this field set to zero) and data.
+      uint32_t crc;
+      //! Reserved.
+      uint32_t reserved;
+    };
+
+    //! Compute size of a checkpoint file.
+    //! @param[in] capacity slot capacity.
+    //! @return file size.
+    static size_t
+    getFileSize(size_t capacity)
+    {
+      return c_header_size + 2 * (c_slot_header_size + capacity);
+    }
+
+    //! Read slot capacity from a file header.
+    //! @param[in] base file contents.
+    //! @param[in] size file size.
+    //! @return slot capacity or zero if the header is not valid.
+    static size_t
+    parseCapacity(const uint8_t* base, size_t size)
+    {
+      if (base == NULL || size < c_header_size)
+        return 0;
+
+      if (std::memcmp(base, c_magic, sizeof(c_magic)) != 0)
+        return 0;
+
+      uint16_t version = 0;
+      std::memcpy(&version, base + 4, sizeof(version));
+      if (version != c_version)
+        return 0;
+
+      uint32_t capacity = 0;
+      std::memcpy(&capacity, base + 8, sizeof(capacity));
+      if (getFileSize(capacity) != size)
+        return 0;
+
+      return capacity;
+    }
+
+    //! Compute the CRC of a slot.
+    //! @param[in] hdr slot header.
+    //! @param[in] data slot data.
+    //! @return CRC-32.
+    static uint32_t
+    computeCRC(SlotHeader hdr, const uint8_t* data)
+    {
+      hdr.crc = 0;
+      uint32_t crc = Algorithms::CRC32::compute((const uint8_t*)&hdr, sizeof(hdr));
+      return Algorithms::CRC32::compute(data, hdr.size, crc);
+    }
+
+    Checkpoint::Checkpoint(const FileSystem::Path& path):
+      m_path(path),
+      m_offset(0),
+      m_base(NULL),
+      m_size(0),
+      m_fd(-1),
+      m_sequence(0),
+      m_slot(1)
+    {
+      map(0);
+
+      int latest = findLatest();
+      if (latest >= 0)
+      {
+        SlotHeader hdr;
+        std::memcpy(&hdr, getSlot(latest), sizeof(hdr));
+        m_sequence = hdr.sequence;
+        m_slot = latest;
+      }
+    }
+
+    Checkpoint::~Checkpoint(void)
+    {
+      unmap();
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (m_fd >= 0)
+        ::close(m_fd);
+#endif
+    }
+
+    void
+    Checkpoint::commit(double time)
+    {
+      if (m_data.size() > getCapacity())
+        map(Math::computeNextPowerOfTwo(m_data.size()));
+
+      // Overwrite the oldest slot.
+      unsigned slot = 1 - m_slot;
+      uint8_t* ptr = getSlot(slot);
+
+      SlotHeader hdr;
+      hdr.sequence = ++m_sequence;
+      hdr.size = m_data.size();
+      hdr.time = time;
+      hdr.reserved = 0;
+
+      if (!m_data.empty())
+        std::memcpy(ptr + c_slot_header_size, &m_data[0], m_data.size());
+
+      hdr.crc = computeCRC(hdr, ptr + c_slot_header_size);
+      std::memcpy(ptr, &hdr, sizeof(hdr));
+
+      sync();
+      m_slot = slot;
+    }
+
+    bool
+    Checkpoint::load(double& time)
+    {
+      clear();
+
+      int latest = findLatest();
+      if (latest < 0)
+        return false;
+
+      const uint8_t* ptr = getSlot(latest);
+      SlotHeader hdr;
+      std::memcpy(&hdr, ptr, sizeof(hdr));
+
+      m_data.assign(ptr + c_slot_header_size, ptr + c_slot_header_size + hdr.size);
+      time = hdr.time;
+      return true;
+    }
+
+    void
+    Checkpoint::invalidate(void)
+    {
+      for (unsigned i = 0; i < 2; ++i)
+        std::memset(getSlot(i), 0, c_slot_header_size);
+
+      sync();
+    }
+
+    void
+    Checkpoint::put(const std::string& value)
+    {
+      put((uint32_t)value.size());
+      putRaw(value.data(), value.size());
+    }
+
+    void
+    Checkpoint::put(const Math::Matrix& value)
+    {
+      put((uint32_t)value.rows());
+      put((uint32_t)value.columns());
+
+      for (int i = 0; i < value.rows(); ++i)
+      {
+        for (int j = 0; j < value.columns(); ++j)
+          put(value(i, j));
+      }
+    }
+
+    void
+    Checkpoint::put(const IMC::Message& msg)
+    {
+      uint32_t size = msg.getPayloadSerializationSize();
+      put((uint32_t)msg.getId());
+      put(size);
+
+      size_t offset = m_data.size();
+      m_data.resize(offset + size);
+      if (size > 0)
+        msg.serializeFields(&m_data[offset]);
+    }
+
+    void
+    Checkpoint::get(std::string& value)
+    {
+      uint32_t size = 0;
+      get(size);
+
+      if (size > m_data.size() - m_offset)
+        throw std::runtime_error("checkpoint data is truncated");
+
+      value.assign((const char*)&m_data[0] + m_offset, size);
+      m_offset += size;
+    }
+
+    void
+    Checkpoint::get(Math::Matrix& value)
+    {
+      uint32_t rows = 0;
+      uint32_t cols = 0;
+      get(rows);
+      get(cols);
+
+      if ((uint64_t)rows * cols * sizeof(double) > m_data.size() - m_offset)
+        throw std::runtime_error("checkpoint data is truncated");
+
+      if (rows * cols == 0)
+      {
+        value = Math::Matrix();
+        return;
+      }
+
+      std::vector<double> data(rows * cols);
+      for (size_t i = 0; i < data.size(); ++i)
+        get(data[i]);
+
+      value.fill(rows, cols, &data[0]);
+    }
+
+    void
+    Checkpoint::get(IMC::Message& msg)
+    {
+      uint32_t id = 0;
+      uint32_t size = 0;
+      get(id);
+      get(size);
+
+      if (id != msg.getId())
+        throw std::runtime_error("checkpoint message type mismatch");
+
+      if (size > m_data.size() - m_offset || size > 0xffff)
+        throw std::runtime_error("checkpoint data is truncated");
+
+      if (size > 0)
+        msg.deserializeFields(&m_data[m_offset], size);
+
+      m_offset += size;
+    }
+
+    void
+    Checkpoint::map(size_t capacity)
+    {
+      // Keep the last good snapshot when the file is resized, so
+      // that it can still be restored if the next commit fails.
+      std::vector<uint8_t> saved;
+      int saved_slot = (m_base == NULL) ? -1 : findLatest();
+      if (saved_slot >= 0)
+      {
+        const uint8_t* ptr = getSlot(saved_slot);
+        SlotHeader hdr;
+        std::memcpy(&hdr, ptr, sizeof(hdr));
+        saved.assign(ptr, ptr + c_slot_header_size + hdr.size);
+      }
+
+      unmap();
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      if (m_fd < 0)
+      {
+        m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (m_fd < 0)
+          throw FileSystem::FileWriteError(m_path.c_str());
+      }
+
+      struct stat st;
+      if (::fstat(m_fd, &st) != 0)
+        throw FileSystem::FileReadError(m_path.c_str());
+
+      uint8_t header[c_header_size];
+      size_t current = 0;
+      if ((size_t)st.st_size >= c_header_size
+          && ::pread(m_fd, header, c_header_size, 0) == (ssize_t)c_header_size)
+        current = parseCapacity(header, st.st_size);
+
+      bool init = (current == 0) || (current < capacity);
+      m_size = getFileSize(init ? std::max(capacity, c_min_capacity) : current);
+
+      if (init && ::ftruncate(m_fd, m_size) != 0)
+        throw FileSystem::FileWriteError(m_path.c_str());
+
+      void* ptr = ::mmap(NULL, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+      if (ptr == MAP_FAILED)
+      {
+        m_size = 0;
+        throw FileSystem::FileWriteError(m_path.c_str());
+      }
+
+      m_base = static_cast<uint8_t*>(ptr);
+#else
+      // Without memory mapping the file is read once and rewritten
+      // on each commit.
+      std::vector<uint8_t> contents;
+      std::ifstream ifs(m_path.c_str(), std::ios::binary);
+      if (ifs)
+        contents.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+
+      size_t current = contents.empty() ? 0 : parseCapacity(&contents[0], contents.size());
+      bool init = (current == 0) || (current < capacity);
+      m_size = getFileSize(init ? std::max(capacity, c_min_capacity) : current);
+      m_base = new uint8_t[m_size];
+
+      if (!init)
+        std::memcpy(m_base, &contents[0], m_size);
+#endif
+
+      if (init)
+      {
+        std::memset(m_base, 0, m_size);
+        std::memcpy(m_base, c_magic, sizeof(c_magic));
+        std::memcpy(m_base + 4, &c_version, sizeof(c_version));
+        uint32_t slot_capacity = getCapacityFromSize(m_size);
+        std::memcpy(m_base + 8, &slot_capacity, sizeof(slot_capacity));
+
+        if (saved_slot >= 0)
+          std::memcpy(getSlot(saved_slot), &saved[0], saved.size());
+
+        sync();
+      }
+    }
+
+    void
+    Checkpoint::unmap(void)
+    {
+      if (m_base == NULL)
+        return;
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      ::munmap(m_base, m_size);
+#else
+      delete [] m_base;
+#endif
+
+      m_base = NULL;
+      m_size = 0;
+    }
+
+    size_t
+    Checkpoint::getCapacity(void) const
+    {
+      return getCapacityFromSize(m_size);
+    }
+
+    size_t
+    Checkpoint::getCapacityFromSize(size_t size)
+    {
+      return (size - c_header_size) / 2 - c_slot_header_size;
+    }
+
+    uint8_t*
+    Checkpoint::getSlot(unsigned slot) const
+    {
+      return m_base + c_header_size + slot * (c_slot_header_size + getCapacity());
+    }
+
+    int
+    Checkpoint::findLatest(void) const
+    {
+      int latest = -1;
+      uint32_t sequence = 0;
+
+      for (unsigned i = 0; i < 2; ++i)
+      {
+        const uint8_t* ptr = getSlot(i);
+        SlotHeader hdr;
+        std::memcpy(&hdr, ptr, sizeof(hdr));
+
+        if (hdr.sequence == 0 || hdr.size > getCapacity())
+          continue;
+
+        if (computeCRC(hdr, ptr + c_slot_header_size) != hdr.crc)
+          continue;
+
+        // Compare sequence numbers allowing wrap around.
+        if (latest < 0 || (int32_t)(hdr.sequence - sequence) > 0)
+        {
+          latest = i;
+          sequence = hdr.sequence;
+        }
+      }
+
+      return latest;
+    }
+
+    void
+    Checkpoint::sync(void)
+    {
+#if defined(DUNE_SYS_HAS_MMAP)
+      ::msync(m_base, m_size, MS_ASYNC);
+#else
+      std::ofstream ofs(m_path.c_str(), std::ios::binary | std::ios::trunc);
+      ofs.write((const char*)m_base, m_size);
+      if (!ofs)
+        throw FileSystem::FileWriteError(m_path.c_str());
+#endif
+    }
+
+    void
+    Checkpoint::putRaw(const void* data, size_t size)
+    {
+      const uint8_t* ptr = static_cast<const uint8_t*>(data);
+      m_data.insert(m_data.end(), ptr, ptr + size);
+    }
+
+    void
+    Checkpoint::getRaw(void* data, size_t size)
+    {
+      if (size > m_data.size() - m_offset)
+        throw std::runtime_error("checkpoint data is truncated");
+
+      std::memcpy(data, &m_data[m_offset], size);
+      m_offset += size;
+    }
+  }
+}
@@ -0,0 +1,283 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_CHECKPOINT_HPP_INCLUDED_
+#define DUNE_TASKS_CHECKPOINT_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/FileSystem/Path.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/Math/Matrix.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Checkpoint;
+
+    //! Snapshot of task state stored in a memory mapped file. The file
+    //! holds two slots that are written alternately, each protected
+    //! by a CRC-32, so an interrupted write leaves the previous
+    //! snapshot intact. Data written to the mapping is kept by the
+    //! operating system if the process dies.
+    //!
+    //! State is staged with put() and stored with commit(). After
+    //! load() succeeds, state is read back with get() in the same
+    //! order. Values are stored in host byte order since checkpoints
+    //! are only meant to be read by the same system.
+    class Checkpoint
+    {
+    public:
+      //! Open or create a checkpoint file.
+      //! @param[in] path file path.
+      Checkpoint(const FileSystem::Path& path);
+
+      //! Destructor.
+      ~Checkpoint(void);
+
+      //! Get checkpoint file path.
+      //! @return file path.
+      const FileSystem::Path&
+      getPath(void) const
+      {
+        return m_path;
+      }
+
+      //! Discard staged data.
+      void
+      clear(void)
+      {
+        m_data.clear();
+        m_offset = 0;
+      }
+
+      //! Get size of staged data.
+      //! @return size in bytes.
+      size_t
+      getSize(void) const
+      {
+        return m_data.size();
+      }
+
+      //! Store staged data as the most recent snapshot.
+      //! @param[in] time snapshot time (seconds since epoch).
+      void
+      commit(double time);
+
+      //! Load the most recent valid snapshot into the staging buffer.
+      //! @param[out] time snapshot time (seconds since epoch).
+      //! @return true if a valid snapshot was found, false otherwise.
+      bool
+      load(double& time);
+
+      //! Invalidate all snapshots.
+      void
+      invalidate(void);
+
+      void
+      put(bool value)
+      {
+        putRaw(&value, sizeof(value));
+      }
+
+      void
+      put(int32_t value)
+      {
+        putRaw(&value, sizeof(value));
+      }
+
+      void
+      put(uint32_t value)
+      {
+        putRaw(&value, sizeof(value));
+      }
+
+      void
+      put(int64_t value)
+      {
+        putRaw(&value, sizeof(value));
+      }
+
+      void
+      put(uint64_t value)
+      {
+        putRaw(&value, sizeof(value));
+      }
+
+      void
+      put(float value)
+      {
+        putRaw(&value, sizeof(value));
+      }
+
+      void
+      put(double value)
+      {
+        putRaw(&value, sizeof(value));
+      }
+
+      void
+      put(const std::string& value);
+
+      void
+      put(const Math::Matrix& value);
+
+      //! Stage the fields of an IMC message.
+      //! @param[in] msg message.
+      void
+      put(const IMC::Message& msg);
+
+      void
+      get(bool& value)
+      {
+        getRaw(&value, sizeof(value));
+      }
+
+      void
+      get(int32_t& value)
+      {
+        getRaw(&value, sizeof(value));
+      }
+
+      void
+      get(uint32_t& value)
+      {
+        getRaw(&value, sizeof(value));
+      }
+
+      void
+      get(int64_t& value)
+      {
+        getRaw(&value, sizeof(value));
+      }
+
+      void
+      get(uint64_t& value)
+      {
+        getRaw(&value, sizeof(value));
+      }
+
+      void
+      get(float& value)
+      {
+        getRaw(&value, sizeof(value));
+      }
+
+      void
+      get(double& value)
+      {
+        getRaw(&value, sizeof(value));
+      }
+
+      void
+      get(std::string& value);
+
+      void
+      get(Math::Matrix& value);
+
+      //! Read the fields of an IMC message. The message must be of the
+      //! same type as the one that was staged.
+      //! @param[out] msg message.
+      void
+      get(IMC::Message& msg);
+
+    private:
+      //! File path.
+      FileSystem::Path m_path;
+      //! Staged data.
+      std::vector<uint8_t> m_data;
+      //! Read position in staged data.
+      size_t m_offset;
+      //! File contents.
+      uint8_t* m_base;
+      //! File size.
+      size_t m_size;
+      //! File descriptor.
+      int m_fd;
+      //! Sequence number of the last stored snapshot.
+      uint32_t m_sequence;
+      //! Slot of the last stored snapshot.
+      unsigned m_slot;
+
+      //! Map file with room for snapshots of a given size.
+      //! @param[in] capacity snapshot capacity in bytes.
+      void
+      map(size_t capacity);
+
+      //! Release file mapping.
+      void
+      unmap(void);
+
+      //! Get slot capacity of the current file.
+      //! @return capacity in bytes.
+      size_t
+      getCapacity(void) const;
+
+      //! Get slot capacity of a file.
+      //! @param[in] size file size.
+      //! @return capacity in bytes.
+      static size_t
+      getCapacityFromSize(size_t size);
+
+      //! Get pointer to a slot.
+      //! @param[in] slot slot index.
+      //! @return pointer to slot header.
+      uint8_t*
+      getSlot(unsigned slot) const;
+
+      //! Find the slot holding the most recent valid snapshot.
+      //! @return slot index or -1 if no slot is valid.
+      int
+      findLatest(void) const;
+
+      //! Flush file contents to storage.
+      void
+      sync(void);
+
+      void
+      putRaw(const void* data, size_t size);
+
+      void
+      getRaw(void* data, size_t size);
+
+      // Non-copyable.
+      Checkpoint(const Checkpoint&);
+
+      Checkpoint&
+      operator=(const Checkpoint&);
+    };
+  }
+}
+
+#endif
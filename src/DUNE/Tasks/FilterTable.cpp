@@ -0,0 +1,154 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Tasks/FilterTable.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    const uint32_t FilterTable::c_any;
+    const unsigned FilterTable::c_systems;
+    const unsigned FilterTable::c_entities;
+
+    FilterTable::FilterTable(void)
+    {
+      compile();
+    }
+
+    void
+    FilterTable::clear(void)
+    {
+      m_rules.clear();
+      m_messages.clear();
+      compile();
+    }
+
+    void
+    FilterTable::add(const std::set<uint32_t>& messages, const std::set<uint32_t>& systems,
+                     const std::set<uint32_t>& entities)
+    {
+      Rule rule;
+      rule.any_system = systems.find(c_any) != systems.end();
+      rule.any_entity = entities.find(c_any) != entities.end();
+
+      if (!rule.any_system)
+      {
+        rule.systems.assign(c_systems / 32, 0);
+        std::set<uint32_t>::const_iterator itr = systems.begin();
+        for (; itr != systems.end(); ++itr)
+        {
+          if (*itr < c_systems)
+            rule.systems[*itr >> 5] |= 1u << (*itr & 31);
+        }
+      }
+
+      std::memset(rule.entities, 0, sizeof(rule.entities));
+      if (!rule.any_entity)
+      {
+        std::set<uint32_t>::const_iterator itr = entities.begin();
+        for (; itr != entities.end(); ++itr)
+        {
+          if (*itr < c_entities)
+            rule.entities[*itr >> 5] |= 1u << (*itr & 31);
+        }
+      }
+
+      m_rules.push_back(rule);
+      m_messages.push_back(messages);
+      compile();
+    }
+
+    bool
+    FilterTable::match(uint32_t id, uint32_t system, uint32_t entity) const
+    {
+      unsigned first = getFirst(id);
+      unsigned last = getLast(id);
+
+      if (first == last)
+        return true;
+
+      for (unsigned i = first; i < last; ++i)
+      {
+        const Rule& rule = m_rules[m_index[i]];
+
+        if (!rule.any_system && (system >= c_systems || !test(&rule.systems[0], system)))
+          continue;
+
+        if (!rule.any_entity && (entity >= c_entities || !test(rule.entities, entity)))
+          continue;
+
+        return true;
+      }
+
+      return false;
+    }
+
+    void
+    FilterTable::compile(void)
+    {
+      // Size the table to the largest listed message identifier.
+      unsigned size = 0;
+      std::vector<unsigned> any;
+      for (unsigned r = 0; r < m_messages.size(); ++r)
+      {
+        if (m_messages[r].find(c_any) != m_messages[r].end())
+        {
+          any.push_back(r);
+          continue;
+        }
+
+        if (!m_messages[r].empty())
+          size = std::max(size, *m_messages[r].rbegin() + 1);
+      }
+
+      m_first.assign(size + 1, 0);
+      m_index.clear();
+
+      // Rules of each identifier keep the order they were added.
+      for (unsigned id = 0; id < size; ++id)
+      {
+        m_first[id] = m_index.size();
+        for (unsigned r = 0; r < m_messages.size(); ++r)
+        {
+          if (m_messages[r].find(id) != m_messages[r].end()
+              || m_messages[r].find(c_any) != m_messages[r].end())
+            m_index.push_back(r);
+        }
+      }
+
+      m_first[size] = m_index.size();
+      m_any_first = m_index.size();
+      m_index.insert(m_index.end(), any.begin(), any.end());
+    }
+  }
+}
@@ -0,0 +1,179 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_FILTER_TABLE_HPP_INCLUDED_
+#define DUNE_TASKS_FILTER_TABLE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <climits>
+#include <set>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM FilterTable;
+
+    //! Table of rules that select messages by identifier, source
+    //! system and source entity. Rules are compiled when added into a
+    //! flat table indexed by message identifier and bit sets of
+    //! systems and entities, so matching a message does not search
+    //! containers or allocate memory.
+    class FilterTable
+    {
+    public:
+      //! Identifier that matches any message, system or entity.
+      static const uint32_t c_any = UINT_MAX;
+
+      //! Constructor.
+      FilterTable(void);
+
+      //! Remove all rules.
+      void
+      clear(void);
+
+      //! Add a rule. A set containing c_any matches any identifier
+      //! and an empty set matches none.
+      //! @param[in] messages message identifiers.
+      //! @param[in] systems source system identifiers.
+      //! @param[in] entities source entity identifiers.
+      void
+      add(const std::set<uint32_t>& messages, const std::set<uint32_t>& systems,
+          const std::set<uint32_t>& entities);
+
+      //! Check if the table has rules.
+      //! @return true if there are no rules, false otherwise.
+      bool
+      empty(void) const
+      {
+        return m_rules.empty();
+      }
+
+      //! Check if any rule applies to a message identifier.
+      //! @param[in] id message identifier.
+      //! @return true if at least one rule applies, false otherwise.
+      bool
+      applies(uint32_t id) const
+      {
+        return getFirst(id) != getLast(id);
+      }
+
+      //! Check if a message is admitted by the rules that apply to its
+      //! identifier.
+      //! @param[in] id message identifier.
+      //! @param[in] system source system identifier.
+      //! @param[in] entity source entity identifier.
+      //! @return true if one of the rules admits the message or no
+      //! rule applies to it, false otherwise.
+      bool
+      match(uint32_t id, uint32_t system, uint32_t entity) const;
+
+      //! Check if a message is admitted by the rules that apply to its
+      //! identifier.
+      //! @param[in] msg message.
+      //! @return true if one of the rules admits the message or no
+      //! rule applies to it, false otherwise.
+      bool
+      match(const IMC::Message* msg) const
+      {
+        return match(msg->getId(), msg->getSource(), msg->getSourceEntity());
+      }
+
+    private:
+      //! Number of system identifiers.
+      static const unsigned c_systems = 65536;
+      //! Number of entity identifiers.
+      static const unsigned c_entities = 256;
+
+      //! Compiled rule.
+      struct Rule
+      {
+        //! True if the rule admits any system.
+        bool any_system;
+        //! True if the rule admits any entity.
+        bool any_entity;
+        //! Admitted systems.
+        std::vector<uint32_t> systems;
+        //! Admitted entities.
+        uint32_t entities[c_entities / 32];
+      };
+
+      //! Rules.
+      std::vector<Rule> m_rules;
+      //! Message identifiers of each rule.
+      std::vector<std::set<uint32_t> > m_messages;
+      //! Position in m_index of the first rule of each message
+      //! identifier. Identifiers past the end of the table use the
+      //! rules that apply to any message.
+      std::vector<unsigned> m_first;
+      //! Rules of each message identifier.
+      std::vector<unsigned> m_index;
+      //! Position in m_index of the rules that apply to any message.
+      unsigned m_any_first;
+
+      //! Rebuild the message identifier table.
+      void
+      compile(void);
+
+      //! Get position of the first rule of a message identifier.
+      //! @param[in] id message identifier.
+      //! @return position in m_index.
+      unsigned
+      getFirst(uint32_t id) const
+      {
+        return (id < m_first.size() - 1) ? m_first[id] : m_any_first;
+      }
+
+      //! Get position past the last rule of a message identifier.
+      //! @param[in] id message identifier.
+      //! @return position in m_index.
+      unsigned
+      getLast(uint32_t id) const
+      {
+        return (id < m_first.size() - 1) ? m_first[id + 1] : m_index.size();
+      }
+
+      //! Test a bit.
+      //! @param[in] bits bit set.
+      //! @param[in] bit bit index.
+      //! @return bit value.
+      static bool
+      test(const uint32_t* bits, uint32_t bit)
+      {
+        return (bits[bit >> 5] & (1u << (bit & 31))) != 0;
+      }
+    };
+  }
+}
+
+#endif
@@ -27,6 +27,9 @@
 // Author: José Braga                                                       *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <set>
+
 // DUNE headers.
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Time/Clock.hpp>
@@ -38,6 +41,8 @@ namespace DUNE
 {
   namespace Tasks
   {
+    const unsigned MessageFilter::c_entities;
+
     MessageFilter::MessageFilter(void)
     { }
 
@@ -53,61 +58,55 @@ namespace DUNE
       uint32_t mid = msg->getId();
 
       // Filter message by entity.
-      if (m_filtered[mid].size() > 0)
-      {
-        bool matched = false;
-        std::vector<uint32_t>::iterator itr = m_filtered[mid].begin();
-        for (; itr != m_filtered[mid].end(); ++itr)
-        {
-          if (*itr == msg->getSourceEntity())
-          {
-            matched = true;
-            break;
-          }
-        }
-
-        // This entity is not listed to be passed.
-        if (!matched)
-          return true;
-      }
+      if (!m_entities.match(msg))
+        return true;
 
       // Filter message by rate.
-      RateMap::iterator rmitr = m_rates.find(mid);
-
-      if (rmitr != m_rates.end())
+      if (mid < m_rates.size() && m_rates[mid] >= 0)
       {
-        double now = Time::Clock::get();
-        double& stime = m_stimes[MsgKey(mid, msg->getSourceEntity())];
-
-        if (stime + rmitr->second > now)
+        if (!m_buckets[m_rates[mid]][msg->getSourceEntity()].take(Time::Clock::get()))
           return true;
-
-        stime = now;
       }
 
       return false;
     }
 
-    //! Setup rate filters.
+    //! Setup rate filters. Each filter is specified as
+    //! <Message>:<Frequency>[:<Burst>], where burst is the number of
+    //! messages that may pass at once after an idle period.
     //! @param[in] spec String specification.
     void
     MessageFilter::setupRates(const std::vector<std::string>& spec)
     {
       m_rates.clear();
-      m_stimes.clear();
+      m_buckets.clear();
 
       for (unsigned int i = 0; i < spec.size(); ++i)
       {
         std::vector<std::string> parts;
         Utils::String::split(spec[i], ":", parts);
 
-        if (parts.size() == 2)
+        if (parts.size() == 2 || parts.size() == 3)
         {
           uint32_t id = IMC::Factory::getIdFromAbbrev(parts[0]);
           double rate = 0;
-          if (std::sscanf(parts[1].c_str(), "%lf", &rate) && rate > 0)
+          double burst = 1;
+          if (std::sscanf(parts[1].c_str(), "%lf", &rate) == 1 && rate > 0
+              && (parts.size() == 2 || (std::sscanf(parts[2].c_str(), "%lf", &burst) == 1 && burst >= 1)))
           {
-            m_rates[id] = 1.0 / rate;
+            if (id >= m_rates.size())
+              m_rates.resize(id + 1, -1);
+
+            if (m_rates[id] < 0)
+            {
+              m_rates[id] = m_buckets.size();
+              m_buckets.push_back(Buckets(c_entities));
+            }
+
+            Buckets& buckets = m_buckets[m_rates[id]];
+            for (unsigned j = 0; j < buckets.size(); ++j)
+              buckets[j].setRate(rate, burst);
+
             continue;
           }
         }
@@ -121,8 +120,11 @@ namespace DUNE
     void
     MessageFilter::setupEntities(const std::vector<std::string>& spec, Tasks::Task* task)
     {
+      std::set<uint32_t> any;
+      any.insert(FilterTable::c_any);
+
       // Process filtered entities.
-      m_filtered.clear();
+      m_entities.clear();
       for (unsigned int i = 0; i < spec.size(); ++i)
       {
         std::vector<std::string> parts;
@@ -131,24 +133,27 @@ namespace DUNE
           continue;
 
         // Split entities.
-        uint32_t id = IMC::Factory::getIdFromAbbrev(parts[0]);
+        std::set<uint32_t> messages;
+        messages.insert(IMC::Factory::getIdFromAbbrev(parts[0]));
         std::vector<std::string> entities;
         Utils::String::split(parts[1], "+", entities);
-        m_filtered[id].resize(entities.size());
+        if (entities.empty())
+          continue;
 
-        // Resolve entities id.
+        // Resolve entities id. Unknown entities do not match any
+        // message.
+        std::set<uint32_t> ids;
         for (unsigned j = 0; j < entities.size(); j++)
         {
-          // Resolve entities.
           try
           {
-            m_filtered[id][j] = task->resolveEntity(entities[j]);
+            ids.insert(task->resolveEntity(entities[j]));
           }
           catch (...)
-          {
-            m_filtered[id][j] = UINT_MAX;
-          }
+          { }
         }
+
+        m_entities.add(messages, any, ids);
       }
     }
   }
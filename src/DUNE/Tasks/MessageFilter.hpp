@@ -30,10 +30,12 @@
 
 // ISO C++ 98 headers.
 #include <vector>
-#include <map>
+#include <string>
 
 // DUNE headers.
 #include <DUNE/Tasks/Task.hpp>
+#include <DUNE/Tasks/FilterTable.hpp>
+#include <DUNE/Time/TokenBucket.hpp>
 #include <DUNE/IMC/Message.hpp>
 
 namespace DUNE
@@ -57,18 +59,18 @@ namespace DUNE
       filter(const IMC::Message* msg);
 
     private:
-      // Rate limiters.
-      typedef std::map<uint32_t, double> RateMap;
-      RateMap m_rates;
+      // Number of entity identifiers.
+      static const unsigned c_entities = 256;
 
-      // Send times.
-      typedef std::pair<uint32_t, unsigned int> MsgKey;
-      typedef std::map<MsgKey, double> STimesMap;
-      STimesMap m_stimes;
+      // Rate limiters, one per source entity.
+      typedef std::vector<Time::TokenBucket> Buckets;
+      std::vector<Buckets> m_buckets;
 
-      // List of entities to be passed by given message
-      typedef std::vector<uint32_t> Entities;
-      std::map<uint32_t, Entities> m_filtered;
+      // Index in m_buckets of each message identifier, -1 if not limited.
+      std::vector<int> m_rates;
+
+      // Entities allowed to pass each message.
+      FilterTable m_entities;
     };
   }
 }
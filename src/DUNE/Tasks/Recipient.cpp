@@ -29,6 +29,7 @@
 #include <cstddef>
 
 // DUNE headers.
+#include <DUNE/Concurrency/RawTLS.hpp>
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Tasks/Context.hpp>
@@ -38,6 +39,9 @@ namespace DUNE
 {
   namespace Tasks
   {
+    //! Message being consumed by the calling thread.
+    static Concurrency::RawTLS s_current;
+
     Recipient::Recipient(AbstractTask* task, Context& ctx):
       m_task(task),
       m_ctx(ctx)
@@ -105,11 +109,20 @@ namespace DUNE
         if (msg)
         {
           uint32_t id = msg->getId();
+          const void* prev = s_current.get();
+          s_current.set(msg);
           for (size_t j = 0; j < m_cbacks[id].size(); ++j)
             m_cbacks[id][j]->consume(msg);
+          s_current.set(prev);
           delete msg;
         }
       }
     }
+
+    const IMC::Message*
+    Recipient::getCurrentMessage(void)
+    {
+      return static_cast<const IMC::Message*>(s_current.get());
+    }
   }
 }
@@ -71,6 +71,13 @@ namespace DUNE
       void
       runCallBacks(void);
 
+      //! Get the message whose consumers are running in the calling
+      //! thread.
+      //! @return message or NULL if the calling thread is not running
+      //! consumers.
+      static const IMC::Message*
+      getCurrentMessage(void);
+
     private:
       //! Task.
       AbstractTask* m_task;
@@ -44,7 +44,7 @@ namespace DUNE
 
       param("Rate Limiters", m_gargs.rlim)
       .defaultValue("")
-      .description("List of <Message>:<Frequency>");
+      .description("List of <Message>:<Frequency>[:<Burst>]");
 
       param("Filtered Entities", m_gargs.entities_flt)
       .description("List of <Message>:<Entity>+<Entity> that define the source entities allowed to pass message of a specific message type.");
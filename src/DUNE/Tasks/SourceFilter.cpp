@@ -41,10 +41,13 @@ namespace DUNE
 
   namespace Tasks
   {
+    const unsigned SourceFilter::c_messages;
+
     SourceFilter::SourceFilter(Tasks::Task& task, const std::vector<std::string>& src):
       m_task(task)
     {
       defineMessageSystemEntityFilter(src);
+      compileRules();
       filterDefinition();
       printDefinitionWarnings();
     }
@@ -57,6 +60,7 @@ namespace DUNE
         defineMessageSystemFilter(src);
       else
         defineMessageEntityFilter(src);
+      compileRules();
       filterDefinition();
       printDefinitionWarnings();
     }
@@ -67,6 +71,7 @@ namespace DUNE
       m_msg_name(msg_name)
     {
       defineSystemEntityFilter(src);
+      compileRules();
       filterDefinition();
       printDefinitionWarnings();
     }
@@ -80,6 +85,7 @@ namespace DUNE
         defineSystemFilter(src);
       else
         defineEntityFilter(src);
+      compileRules();
       filterDefinition();
       printDefinitionWarnings();
     }
@@ -87,38 +93,21 @@ namespace DUNE
     bool
     SourceFilter::match(const IMC::Message* msg)
     {
-      bool matched;
-      if (m_filt_msg)
+      if (m_table.match(msg))
       {
-        if (m_filt_sys)
-        {
-          if (m_filt_ent)
-            matched = matchMessageSystemEntity(msg);
-          else
-            matched = matchMessageSystem(msg);
-        }
-        else
+        uint32_t id = msg->getId();
+        if (m_filt_msg && id < c_messages && !m_warned[id] && !m_table.applies(id))
         {
-          matched = matchMessageEntity(msg);
+          m_warned[id] = true;
+          m_task.war("No filter rules defined for message %s!", msg->getName());
         }
-      }
-      else if (m_filt_sys)
-      {
-        if (m_filt_ent)
-          matched = matchSystemEntity(msg);
-        else
-          matched = matchSystem(msg);
-      }
-      else
-      {
-        matched = matchEntity(msg);
+
+        return true;
       }
 
       // These system and entity are not listed to be passed.
-      if (!matched)
-        printRejected(msg);
-
-      return matched;
+      printRejected(msg);
+      return false;
     }
 
     std::set<uint32_t>
@@ -434,183 +423,21 @@ namespace DUNE
       m_filt_sys = true;
     }
 
-    bool
-    SourceFilter::matchSystem(const IMC::Message* msg)
-    {
-      bool matched = true;
-      if (m_filtered_sys.size() > 0)
-      {
-        matched = false;
-        for (FilterList::iterator itr_sys = m_filtered_sys.begin();
-             itr_sys != m_filtered_sys.end(); itr_sys++)
-        {
-          if ((*itr_sys).find(msg->getSource()) != (*itr_sys).end() ||
-              (*itr_sys).find((unsigned int)UINT_MAX) != (*itr_sys).end())
-            matched = true;
-        }
-      }
-      return matched;
-    }
-
-    bool
-    SourceFilter::matchEntity(const IMC::Message* msg)
-    {
-      bool matched = true;
-      if (m_filtered_ent.size() > 0)
-      {
-        matched = false;
-        for (FilterList::iterator itr_ent = m_filtered_ent.begin();
-             itr_ent != m_filtered_ent.end(); itr_ent++)
-        {
-          if ((*itr_ent).find(msg->getSourceEntity()) != (*itr_ent).end() ||
-              (*itr_ent).find((unsigned int)UINT_MAX) != (*itr_ent).end())
-            matched = true;
-        }
-      }
-      return matched;
-    }
-
-    bool
-    SourceFilter::matchSystemEntity(const IMC::Message* msg)
-    {
-      bool matched = true;
-      if (m_filtered_sys.size() > 0)
-      {
-        matched = false;
-        FilterList::iterator itr_ent = m_filtered_ent.begin();
-        for (FilterList::iterator itr_sys = m_filtered_sys.begin();
-             itr_sys != m_filtered_sys.end(); itr_sys++)
-        {
-          if (((*itr_sys).find(msg->getSource()) != (*itr_sys).end() ||
-               (*itr_sys).find((unsigned int)UINT_MAX) != (*itr_sys).end()) &&
-              ((*itr_ent).find(msg->getSourceEntity()) != (*itr_ent).end() ||
-               (*itr_ent).find((unsigned int)UINT_MAX) != (*itr_ent).end()))
-            matched = true;
-          itr_ent++;
-        }
-      }
-      return matched;
-    }
-
-    bool
-    SourceFilter::matchMessageSystem(const IMC::Message* msg)
-    {
-      bool matched = true;
-      bool msg_match = false;
-      if (m_filtered_sys.size() > 0)
-      {
-        matched = false;
-        FilterList::iterator itr_msg = m_filtered_msg.begin();
-        for (FilterList::iterator itr_sys = m_filtered_sys.begin();
-             itr_sys != m_filtered_sys.end(); itr_sys++)
-        {
-          if ((*itr_msg).find(msg->getId()) != (*itr_msg).end() ||
-              (*itr_msg).find((unsigned int)UINT_MAX) != (*itr_msg).end())
-          {
-            msg_match = true;
-            if ((*itr_sys).find(msg->getSource()) != (*itr_sys).end() ||
-                (*itr_sys).find((unsigned int)UINT_MAX) != (*itr_sys).end())
-              matched = true;
-          }
-          itr_msg++;
-        }
-      }
-
-      if (matched)
-      {
-        return true;
-      }
-      else if (!msg_match)
-      {
-        m_warnings.push_back("No filter rules defined for message " +
-                             std::string(msg->getName()) + "!");
-        return true;
-      }
-
-      return false;
-    }
-
-    bool
-    SourceFilter::matchMessageEntity(const IMC::Message* msg)
+    void
+    SourceFilter::compileRules(void)
     {
-      bool matched = true;
-      bool msg_match = false;
-      if (m_filtered_sys.size() > 0)
-      {
-        matched = false;
-        FilterList::iterator itr_msg = m_filtered_msg.begin();
-        for (FilterList::iterator itr_ent = m_filtered_ent.begin();
-             itr_ent != m_filtered_ent.end(); itr_ent++)
-        {
-          if ((*itr_msg).find(msg->getId()) != (*itr_msg).end() ||
-              (*itr_msg).find((unsigned int)UINT_MAX) != (*itr_msg).end())
-          {
-            msg_match = true;
-            if ((*itr_ent).find(msg->getSourceEntity()) != (*itr_ent).end() ||
-                (*itr_ent).find((unsigned int)UINT_MAX) != (*itr_ent).end())
-              matched = true;
-          }
-          itr_msg++;
-        }
-      }
+      std::set<uint32_t> any;
+      any.insert(FilterTable::c_any);
 
-      if (matched)
-      {
-        return true;
-      }
-      else if (!msg_match)
-      {
-        m_warnings.push_back("No filter rules defined for message " +
-                             std::string(msg->getName()) + "!");
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
+      m_table.clear();
+      m_warned.assign(c_messages, false);
 
-    bool
-    SourceFilter::matchMessageSystemEntity(const IMC::Message* msg)
-    {
-      bool matched = true;
-      bool msg_match = false;
-      if (m_filtered_sys.size() > 0)
-      {
-        matched = false;
-        FilterList::iterator itr_msg = m_filtered_msg.begin();
-        FilterList::iterator itr_ent = m_filtered_ent.begin();
-        for (FilterList::iterator itr_sys = m_filtered_sys.begin();
-             itr_sys != m_filtered_sys.end(); itr_sys++)
-        {
-          if ((*itr_msg).find(msg->getId()) != (*itr_msg).end() ||
-              (*itr_msg).find((unsigned int)UINT_MAX) != (*itr_msg).end())
-          {
-            msg_match = true;
-            if (((*itr_sys).find(msg->getSource()) != (*itr_sys).end() ||
-                 (*itr_sys).find((unsigned int)UINT_MAX) != (*itr_sys).end()) &&
-                ((*itr_ent).find(msg->getSourceEntity()) != (*itr_ent).end() ||
-                 (*itr_ent).find((unsigned int)UINT_MAX) != (*itr_ent).end()))
-              matched = true;
-          }
-          itr_msg++;
-          itr_ent++;
-        }
-      }
-
-      if (matched)
-      {
-        return true;
-      }
-      else if (!msg_match)
-      {
-        m_warnings.push_back("No filter rules defined for message " +
-                             std::string(msg->getName()) + "!");
-        return true;
-      }
-      else
+      size_t count = m_filt_sys ? m_filtered_sys.size() : m_filtered_ent.size();
+      for (size_t i = 0; i < count; ++i)
       {
-        return false;
+        m_table.add(m_filt_msg ? m_filtered_msg[i] : any,
+                    m_filt_sys ? m_filtered_sys[i] : any,
+                    m_filt_ent ? m_filtered_ent[i] : any);
       }
     }
 
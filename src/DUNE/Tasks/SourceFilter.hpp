@@ -34,6 +34,7 @@
 
 // DUNE headers.
 #include <DUNE/Tasks.hpp>
+#include <DUNE/Tasks/FilterTable.hpp>
 #include <DUNE/IMC.hpp>
 
 namespace DUNE
@@ -115,6 +116,9 @@ namespace DUNE
       match(const IMC::Message* msg);
 
     private:
+      //! Number of message identifiers.
+      static const unsigned c_messages = 65536;
+
       //! Filter lists
       typedef std::vector<std::set<uint32_t> > FilterList;
 
@@ -141,41 +145,9 @@ namespace DUNE
       void
       deleteList(FilterList& list);
 
-      //! Verification of a general message source system.
-      //! @param[in] msg input message.
-      //! @return true if the message is allowed to pass.
-      bool
-      matchSystem(const IMC::Message* msg);
-
-      //! Verification of a general message source entity.
-      //! @param[in] msg input message.
-      //! @return true if the message is allowed to pass.
-      bool
-      matchEntity(const IMC::Message* msg);
-
-      //! Verification of a general message source system and entity.
-      //! @param[in] msg input message.
-      //! @return true if the message is allowed to pass.
-      bool
-      matchSystemEntity(const IMC::Message* msg);
-
-      //! Verification of a specific message source system.
-      //! @param[in] msg input message.
-      //! @return true if the message is allowed to pass.
-      bool
-      matchMessageSystem(const IMC::Message* msg);
-
-      //! Verification of a specific message source entity.
-      //! @param[in] msg input message.
-      //! @return true if the message is allowed to pass.
-      bool
-      matchMessageEntity(const IMC::Message* msg);
-
-      //! Verification of a specific message source system and entity.
-      //! @param[in] msg input message.
-      //! @return true if the message is allowed to pass.
-      bool
-      matchMessageSystemEntity(const IMC::Message* msg);
+      //! Compile the filter lists into the rule table.
+      void
+      compileRules(void);
 
       //! Filter definition description for user information.
       void
@@ -243,6 +215,10 @@ namespace DUNE
       bool m_filt_ent;
       //! User information outputs
       std::vector<std::string> m_warnings;
+      //! Compiled filter lists.
+      FilterTable m_table;
+      //! Messages already reported as having no filter rules.
+      std::vector<bool> m_warned;
     };
   }
 }
@@ -32,6 +32,8 @@
 
 // DUNE headers.
 #include <DUNE/IMC/Constants.hpp>
+#include <DUNE/Memory.hpp>
+#include <DUNE/Units.hpp>
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/PeriodicDelay.hpp>
@@ -59,12 +61,16 @@ namespace DUNE
       m_name(n),
       m_entity(NULL),
       m_debug_level(DEBUG_LEVEL_NONE),
-      m_honours_active(false)
+      m_honours_active(false),
+      m_checkpoint(NULL),
+      m_checkpoint_time(0.0)
     {
       m_args.priority = 10;
       m_args.act_time = 0;
       m_args.deact_time = 0;
       m_args.active = false;
+      m_args.ckp_period = 0.0;
+      m_args.ckp_max_age = 0.0;
 
       param(DTR_RT("Entity Label"), m_args.elabel)
       .defaultValue("")
@@ -131,6 +137,24 @@ namespace DUNE
       onReportEntityState();
     }
 
+    void
+    Task::bind(unsigned int message_id, AbstractConsumer* consumer)
+    {
+      // In-process messages are not known to the IMC factory.
+      std::string name;
+      try
+      {
+        name = IMC::Factory::getAbbrevFromId(message_id);
+      }
+      catch (...)
+      {
+        name = Utils::String::str("%u", message_id);
+      }
+
+      spew("registering consumer for '%s'", name.c_str());
+      m_recipient->bind(message_id, consumer);
+    }
+
     void
     Task::consume(const IMC::QueryEntityState* msg)
     {
@@ -206,6 +230,91 @@ namespace DUNE
       .description(DTR("True to activate task, false otherwise"));
     }
 
+    void
+    Task::paramCheckpoint(double def_period, double def_max_age)
+    {
+      param(DTR_RT("Checkpoint Period"), m_args.ckp_period)
+      .units(Units::Second)
+      .minimumValue("0")
+      .defaultValue(uncastLexical(def_period))
+      .description(DTR("Period of state checkpoints. Set to zero to disable"
+                       " checkpoints"));
+
+      param(DTR_RT("Checkpoint Maximum Age"), m_args.ckp_max_age)
+      .units(Units::Second)
+      .minimumValue("0")
+      .defaultValue(uncastLexical(def_max_age))
+      .description(DTR("Maximum age of a checkpoint to be restored"));
+    }
+
+    void
+    Task::restoreCheckpoint(void)
+    {
+      if (m_args.ckp_period <= 0.0)
+      {
+        Memory::clear(m_checkpoint);
+        return;
+      }
+
+      try
+      {
+        if (m_checkpoint == NULL)
+        {
+          FileSystem::Path dir = m_ctx.dir_db / "Checkpoints";
+          dir.create();
+          m_checkpoint = new Checkpoint(dir / (getName() + std::string(".ckp")));
+        }
+
+        double time = 0.0;
+        m_checkpoint_time = Time::Clock::get();
+        if (!m_checkpoint->load(time))
+          return;
+
+        double age = Time::Clock::getSinceEpoch() - time;
+        if (age < 0.0 || age > m_args.ckp_max_age)
+        {
+          debug(DTR("discarding checkpoint from %.1f s ago"), age);
+          return;
+        }
+
+        onCheckpointRestore(*m_checkpoint, age);
+        inf(DTR("restored checkpoint from %.1f s ago"), age);
+      }
+      catch (std::exception& e)
+      {
+        war(DTR("failed to restore checkpoint: %s"), e.what());
+      }
+    }
+
+    void
+    Task::updateCheckpoint(void)
+    {
+      if (Time::Clock::get() - m_checkpoint_time < m_args.ckp_period)
+        return;
+
+      saveCheckpoint();
+    }
+
+    void
+    Task::saveCheckpoint(void)
+    {
+      if (m_checkpoint == NULL)
+        return;
+
+      m_checkpoint_time = Time::Clock::get();
+
+      try
+      {
+        m_checkpoint->clear();
+        if (onCheckpointSave(*m_checkpoint))
+          m_checkpoint->commit(Time::Clock::getSinceEpoch());
+      }
+      catch (std::exception& e)
+      {
+        err(DTR("failed to store checkpoint: %s"), e.what());
+      }
+    }
+
     void
     Task::updateParameters(bool act_deact)
     {
@@ -357,6 +466,7 @@ namespace DUNE
           releaseResources();
           acquireResources();
           initializeResources();
+          restoreCheckpoint();
 
           if (m_honours_active)
           {
@@ -424,6 +534,17 @@ namespace DUNE
           msg->setSourceEntity(getEntityId());
       }
 
+      // Messages dispatched by a consumer continue the chain of the
+      // consumed message, all others start a new one.
+      if ((flags & DF_KEEP_TRACE) == 0 || !msg->hasTrace())
+      {
+        const IMC::Message* cause = Recipient::getCurrentMessage();
+        if (cause != NULL && cause != msg)
+          msg->setTrace(*cause);
+        else
+          msg->setTrace(msg->getTimeStamp(), 0);
+      }
+
       if ((flags & DF_LOOP_BACK) == 0)
         m_ctx.mbus.dispatch(msg, this);
       else
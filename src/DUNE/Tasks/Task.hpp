@@ -51,6 +51,7 @@
 #include <DUNE/Tasks/AbstractTask.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/BasicParameterParser.hpp>
+#include <DUNE/Tasks/Checkpoint.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
 #include <DUNE/Entities/BasicEntity.hpp>
 #include <DUNE/Entities/StatefulEntity.hpp>
@@ -101,7 +102,10 @@ namespace DUNE
       DF_KEEP_SRC_EID = (1 << 1),
       //! Allow message to be delivered to the task that is
       //! dispatching it.
-      DF_LOOP_BACK = (1 << 2)
+      DF_LOOP_BACK = (1 << 2),
+      //! Do not change the trace metadata set with
+      //! IMC::Message::setTrace().
+      DF_KEEP_TRACE = (1 << 3)
     };
 
     //! Task.
@@ -123,6 +127,7 @@ namespace DUNE
           m_entities.pop_back();
         }
 
+        delete m_checkpoint;
         delete m_recipient;
       }
 
@@ -485,6 +490,9 @@ namespace DUNE
       waitForMessages(double timeout)
       {
         m_recipient->waitForMessages(timeout);
+
+        if (m_checkpoint != NULL)
+          updateCheckpoint();
       }
 
       //! Call the consumers of all messages currently in the
@@ -493,6 +501,9 @@ namespace DUNE
       consumeMessages(void)
       {
         m_recipient->runCallBacks();
+
+        if (m_checkpoint != NULL)
+          updateCheckpoint();
       }
 
       //! Declare a configuration parameter that can be parsed using
@@ -542,6 +553,20 @@ namespace DUNE
                   Parameter::Visibility def_visibility,
                   bool def_value = false);
 
+      //! Declare parameters 'Checkpoint Period' and 'Checkpoint
+      //! Maximum Age'. When the period is not zero, the state written
+      //! by onCheckpointSave() is stored periodically and passed to
+      //! onCheckpointRestore() when the task is (re)started, if it is
+      //! not older than the maximum age.
+      //! @param[in] def_period default checkpoint period (s).
+      //! @param[in] def_max_age default maximum checkpoint age (s).
+      void
+      paramCheckpoint(double def_period, double def_max_age);
+
+      //! Store a checkpoint now, regardless of the checkpoint period.
+      void
+      saveCheckpoint(void);
+
       //! Set the name of the parameter editor that should be used to
       //! interact with the parameters of the task.
       //! @param[in] name editor name (free-form string).
@@ -745,6 +770,31 @@ namespace DUNE
       virtual void
       onPopEntityParameters(const IMC::PopEntityParameters* msg);
 
+      //! Called when a checkpoint is being stored. Derived classes
+      //! that declare checkpoint parameters should write their state
+      //! to the checkpoint.
+      //! @param[in] ckp checkpoint.
+      //! @return true if state was written, false if there is no state
+      //! worth storing.
+      virtual bool
+      onCheckpointSave(Checkpoint& ckp)
+      {
+        (void)ckp;
+        return false;
+      }
+
+      //! Called after resource initialization with the state written
+      //! by onCheckpointSave(). Derived classes should read values in
+      //! the order they were written.
+      //! @param[in] ckp checkpoint.
+      //! @param[in] age checkpoint age (s).
+      virtual void
+      onCheckpointRestore(Checkpoint& ckp, double age)
+      {
+        (void)ckp;
+        (void)age;
+      }
+
       virtual void
       onMain(void) = 0;
 
@@ -765,6 +815,10 @@ namespace DUNE
         std::string active_scope;
         //! Visibility of 'Active' parameter.
         std::string active_visibility;
+        //! Checkpoint period.
+        double ckp_period;
+        //! Maximum checkpoint age.
+        double ckp_max_age;
       };
 
       //! Message recipient (queue).
@@ -787,6 +841,18 @@ namespace DUNE
       bool m_honours_active;
       //! Name of parameter section editor.
       std::string m_param_editor;
+      //! Checkpoint file.
+      Checkpoint* m_checkpoint;
+      //! Time of the last checkpoint.
+      double m_checkpoint_time;
+
+      //! Restore state from the checkpoint file, if enabled.
+      void
+      restoreCheckpoint(void);
+
+      //! Store a checkpoint if the checkpoint period has elapsed.
+      void
+      updateCheckpoint(void);
 
       //! Report current entity states by dispatching EntityState
       //! messages. This function will at least report the state of
@@ -804,12 +870,7 @@ namespace DUNE
       //! @param[in] message_id message identifier.
       //! @param[in] consumer consumer object.
       void
-      bind(unsigned int message_id, AbstractConsumer* consumer)
-      {
-        spew("registering consumer for '%s'",
-             IMC::Factory::getAbbrevFromId(message_id).c_str());
-        m_recipient->bind(message_id, consumer);
-      }
+      bind(unsigned int message_id, AbstractConsumer* consumer);
 
       //! Consume QueryEntityState messages and reply accordingly.
       //! @param[in] msg QueryEntityState message.
@@ -43,5 +43,7 @@ namespace DUNE
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/Time/Delta.hpp>
 #include <DUNE/Time/Counter.hpp>
+#include <DUNE/Time/LatencyHistogram.hpp>
+#include <DUNE/Time/TokenBucket.hpp>
 
 #endif
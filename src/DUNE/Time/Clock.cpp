@@ -36,6 +36,9 @@
 #include <DUNE/Time/Clock.hpp>
 #include <DUNE/System/Error.hpp>
 
+// ISO C++ 98 headers.
+#include <stdexcept>
+
 // Platform headers.
 #if defined(DUNE_SYS_HAS_SYS_TIME_H)
 #  include <sys/time.h>
@@ -53,8 +56,71 @@ namespace DUNE
 {
   namespace Time
   {
+    //! Time scale.
+    static double s_scale = 1.0;
+    //! True if the clock is scaled.
+    static bool s_scaled = false;
+    //! System monotonic time when the scale was last changed.
+    static uint64_t s_sys_base = 0;
+    //! Scaled monotonic time when the scale was last changed.
+    static uint64_t s_base = 0;
+    //! System time since epoch when the scale was last changed.
+    static uint64_t s_sys_epoch_base = 0;
+    //! Scaled time since epoch when the scale was last changed.
+    static uint64_t s_epoch_base = 0;
+
     uint64_t
     Clock::getNsec(void)
+    {
+      uint64_t now = getSystemNsec();
+      if (!s_scaled)
+        return now;
+
+      return s_base + (uint64_t)((now - s_sys_base) * s_scale);
+    }
+
+    uint64_t
+    Clock::getSinceEpochNsec(void)
+    {
+      return fromSystemSinceEpochNsec(getSystemSinceEpochNsec());
+    }
+
+    uint64_t
+    Clock::fromSystemSinceEpochNsec(uint64_t value)
+    {
+      if (!s_scaled)
+        return value;
+
+      // System times may precede the last change of scale.
+      int64_t elapsed = (int64_t)(value - s_sys_epoch_base);
+      return s_epoch_base + (int64_t)(elapsed * s_scale);
+    }
+
+    void
+    Clock::setScale(double scale)
+    {
+      if (scale <= 0)
+        throw std::runtime_error(DTR("invalid time scale"));
+
+      uint64_t base = getNsec();
+      uint64_t epoch_base = getSinceEpochNsec();
+
+      s_sys_base = getSystemNsec();
+      s_sys_epoch_base = getSystemSinceEpochNsec();
+      s_base = base;
+      s_epoch_base = epoch_base;
+      s_scale = scale;
+      s_scaled = s_scaled || (scale != 1.0);
+    }
+
+    double
+    Clock::getScale(void)
+    {
+      return s_scale;
+    }
+
+    uint64_t
+    Clock::getSystemNsec(void)
     {
       // POSIX RT.
 #if defined(DUNE_SYS_HAS_CLOCK_GETTIME)
@@ -71,14 +137,14 @@ namespace DUNE
         QueryPerformanceCounter(&li);
         return (uint64_t)(li.QuadPart * (1000000000L / (double)frequency.QuadPart));
       }
-      return getSinceEpochNsec();
+      return getSystemSinceEpochNsec();
 #else
-      return getSinceEpochNsec();
+      return getSystemSinceEpochNsec();
 #endif
     }
 
     uint64_t
-    Clock::getSinceEpochNsec(void)
+    Clock::getSystemSinceEpochNsec(void)
     {
       // POSIX RT.
 #if defined(DUNE_SYS_HAS_CLOCK_GETTIME)
@@ -107,7 +173,7 @@ namespace DUNE
 
       // Unsupported system.
 #else
-#  error Clock::getSinceEpochNsec() is not yet implemented in this system.
+#  error Clock::getSystemSinceEpochNsec() is not yet implemented in this system.
 
 #endif
     }
@@ -118,6 +118,54 @@ namespace DUNE
       //! @param value time in seconds.
       static void
       set(double value);
+
+      //! Set the rate at which this clock advances relative to the
+      //! system clock. A scale of 10 makes one second of system time
+      //! count as ten seconds, and delays and timeouts elapse ten
+      //! times faster. The clock remains continuous across calls.
+      //! This function must be called before any other threads are
+      //! started.
+      //! @param[in] scale time scale (must be greater than zero).
+      static void
+      setScale(double scale);
+
+      //! Get the rate at which this clock advances relative to the
+      //! system clock.
+      //! @return time scale.
+      static double
+      getScale(void);
+
+      //! Get the amount of time (in nanoseconds) since an unspecified
+      //! point in the past, as given by the system clock and
+      //! regardless of the current time scale.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getSystemNsec(void);
+
+      //! Get the amount of time (in nanoseconds) elapsed since the
+      //! UNIX Epoch, as given by the system clock and regardless of
+      //! the current time scale.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getSystemSinceEpochNsec(void);
+
+      //! Convert a time since the UNIX Epoch given by the system
+      //! clock (e.g., a kernel timestamp) to the time this clock
+      //! reported at that instant.
+      //! @param[in] value system time in nanoseconds.
+      //! @return time in nanoseconds.
+      static uint64_t
+      fromSystemSinceEpochNsec(uint64_t value);
+
+      //! Convert a duration measured with this clock to the
+      //! equivalent duration of the system clock.
+      //! @param[in] value duration in seconds.
+      //! @return duration in seconds.
+      static double
+      toSystem(double value)
+      {
+        return value / getScale();
+      }
     };
   }
 }
@@ -29,6 +29,7 @@
 #include <DUNE/Config.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/Constants.hpp>
+#include <DUNE/Time/Clock.hpp>
 
 // Platform headers.
 #if defined(DUNE_SYS_HAS_TIME_H)
@@ -46,6 +47,10 @@ namespace DUNE
     void
     Delay::waitNsec(uint64_t nsec)
     {
+      double scale = Clock::getScale();
+      if (scale != 1.0)
+        nsec = (uint64_t)(nsec / scale);
+
       // Microsoft Windows.
 #if defined(DUNE_SYS_HAS_CREATE_WAITABLE_TIMER)
       HANDLE t = CreateWaitableTimer(0, TRUE, 0);
@@ -0,0 +1,112 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// DUNE headers.
+#include <DUNE/Time/LatencyHistogram.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    //! Upper limits of finite buckets (s).
+    static const double c_limits[] =
+    {
+      100e-6, 200e-6, 500e-6,
+      1e-3, 2e-3, 5e-3,
+      10e-3, 20e-3, 50e-3,
+      100e-3, 200e-3, 500e-3,
+      1.0, 2.0, 5.0,
+      10.0
+    };
+
+    LatencyHistogram::LatencyHistogram(void)
+    {
+      reset();
+    }
+
+    void
+    LatencyHistogram::reset(void)
+    {
+      for (unsigned i = 0; i < c_buckets; ++i)
+        m_buckets[i] = 0;
+
+      m_count = 0;
+      m_sum = 0;
+      m_max = 0;
+    }
+
+    void
+    LatencyHistogram::add(double latency)
+    {
+      if (latency < 0)
+        latency = 0;
+
+      unsigned i = 0;
+      while (i < c_buckets - 1 && latency > c_limits[i])
+        ++i;
+
+      ++m_buckets[i];
+      ++m_count;
+      m_sum += latency;
+      if (latency > m_max)
+        m_max = latency;
+    }
+
+    double
+    LatencyHistogram::getPercentile(double p) const
+    {
+      if (m_count == 0)
+        return 0.0;
+
+      double rank = std::ceil(p / 100.0 * m_count);
+      unsigned total = 0;
+
+      for (unsigned i = 0; i < c_buckets - 1; ++i)
+      {
+        total += m_buckets[i];
+        if (total >= rank)
+          return std::min(c_limits[i], m_max);
+      }
+
+      return m_max;
+    }
+
+    double
+    LatencyHistogram::getBucketLimit(unsigned index)
+    {
+      if (index >= c_buckets - 1)
+        return std::numeric_limits<double>::infinity();
+
+      return c_limits[index];
+    }
+  }
+}
@@ -0,0 +1,122 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_TIME_LATENCY_HISTOGRAM_HPP_INCLUDED_
+#define DUNE_TIME_LATENCY_HISTOGRAM_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LatencyHistogram;
+
+    //! Histogram of latencies with buckets in a 1-2-5 series from
+    //! 100 us to 10 s. Latencies above the last bucket are counted
+    //! in an overflow bucket.
+    class LatencyHistogram
+    {
+    public:
+      //! Number of buckets, including the overflow bucket.
+      static const unsigned c_buckets = 17;
+
+      //! Constructor.
+      LatencyHistogram(void);
+
+      //! Remove all samples.
+      void
+      reset(void);
+
+      //! Add a sample.
+      //! @param[in] latency latency (s).
+      void
+      add(double latency);
+
+      //! Get number of samples.
+      //! @return number of samples.
+      unsigned
+      getCount(void) const
+      {
+        return m_count;
+      }
+
+      //! Get mean latency.
+      //! @return mean latency (s) or zero if there are no samples.
+      double
+      getMean(void) const
+      {
+        return m_count ? m_sum / m_count : 0.0;
+      }
+
+      //! Get maximum latency.
+      //! @return maximum latency (s) or zero if there are no samples.
+      double
+      getMaximum(void) const
+      {
+        return m_max;
+      }
+
+      //! Get an upper bound of a given percentile. The bound is the
+      //! upper limit of the bucket where the percentile falls, or the
+      //! maximum latency if it is lower.
+      //! @param[in] p percentile (0 to 100).
+      //! @return latency (s) or zero if there are no samples.
+      double
+      getPercentile(double p) const;
+
+      //! Get number of samples in a bucket.
+      //! @param[in] index bucket index.
+      //! @return number of samples.
+      unsigned
+      getBucketCount(unsigned index) const
+      {
+        return m_buckets[index];
+      }
+
+      //! Get upper limit of a bucket.
+      //! @param[in] index bucket index.
+      //! @return upper limit (s), infinity for the overflow bucket.
+      static double
+      getBucketLimit(unsigned index);
+
+    private:
+      //! Samples per bucket.
+      unsigned m_buckets[c_buckets];
+      //! Number of samples.
+      unsigned m_count;
+      //! Sum of latencies.
+      double m_sum;
+      //! Maximum latency.
+      double m_max;
+    };
+  }
+}
+
+#endif
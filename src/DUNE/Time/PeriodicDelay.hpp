@@ -38,6 +38,7 @@
 
 // DUNE headers.
 #include <DUNE/Time/Constants.hpp>
+#include <DUNE/Time/Clock.hpp>
 
 namespace DUNE
 {
@@ -68,6 +69,8 @@ namespace DUNE
 #  error PeriodicDelay::set() is not yet implemented in this system
 #endif
 
+        m_delay = (uint64_t)(m_delay / Clock::getScale());
+
         reset();
       }
 
@@ -87,7 +90,7 @@ namespace DUNE
         m_deadline = ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
 
 #elif defined(DUNE_SYS_HAS_NANOSLEEP)
-	m_deadline = Clock::getNsec();
+	m_deadline = Clock::getSystemNsec();
 
 #else
 #  error PeriodicDelay::reset() is not yet implemented in this system
@@ -115,7 +118,7 @@ namespace DUNE
 
         // POSIX nanosleep().
 #elif defined(DUNE_SYS_HAS_NANOSLEEP)
-	uint64_t now = Clock::getNsec();
+	uint64_t now = Clock::getSystemNsec();
 	if (now < m_deadline)
         {
 	  uint64_t delay = m_deadline - now;
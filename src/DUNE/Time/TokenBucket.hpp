@@ -0,0 +1,124 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef DUNE_TIME_TOKEN_BUCKET_HPP_INCLUDED_
+#define DUNE_TIME_TOKEN_BUCKET_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    //! Token bucket rate limiter. Tokens are added at a constant rate
+    //! up to the bucket capacity and each accepted event takes one
+    //! token. Events are accepted at the configured rate on average,
+    //! with bursts of up to capacity events after idle periods.
+    class TokenBucket
+    {
+    public:
+      //! Constructor.
+      //! @param[in] rate number of tokens added per second.
+      //! @param[in] burst bucket capacity.
+      TokenBucket(double rate = 1.0, double burst = 1.0)
+      {
+        setRate(rate, burst);
+      }
+
+      //! Set rate and capacity. The bucket starts full.
+      //! @param[in] rate number of tokens added per second.
+      //! @param[in] burst bucket capacity.
+      void
+      setRate(double rate, double burst = 1.0)
+      {
+        m_rate = rate;
+        m_burst = (burst < 1.0) ? 1.0 : burst;
+        m_tokens = m_burst;
+        m_time = -1.0;
+      }
+
+      //! Get the number of tokens added per second.
+      //! @return rate.
+      double
+      getRate(void) const
+      {
+        return m_rate;
+      }
+
+      //! Get the bucket capacity.
+      //! @return capacity.
+      double
+      getBurst(void) const
+      {
+        return m_burst;
+      }
+
+      //! Take one token.
+      //! @param[in] now current time (s).
+      //! @return true if a token was available, false otherwise.
+      bool
+      take(double now)
+      {
+        if (m_time >= 0.0 && now > m_time)
+        {
+          m_tokens += (now - m_time) * m_rate;
+          if (m_tokens > m_burst)
+            m_tokens = m_burst;
+        }
+
+        m_time = now;
+
+        if (m_tokens < 1.0)
+          return false;
+
+        m_tokens -= 1.0;
+        return true;
+      }
+
+      //! Take one token at the current time.
+      //! @return true if a token was available, false otherwise.
+      bool
+      take(void)
+      {
+        return take(Clock::get());
+      }
+
+    private:
+      //! Number of tokens added per second.
+      double m_rate;
+      //! Bucket capacity.
+      double m_burst;
+      //! Available tokens.
+      double m_tokens;
+      //! Time of the last update.
+      double m_time;
+    };
+  }
+}
+
+#endif
@@ -140,7 +140,7 @@ setDaemonSignalHandlers(void)
 }
 
 int
-runDaemon(DUNE::Daemon& daemon)
+runDaemons(const std::vector<DUNE::Daemon*>& daemons)
 {
   setDaemonSignalHandlers();
 
@@ -148,21 +148,30 @@ runDaemon(DUNE::Daemon& daemon)
 
   try
   {
-    daemon.start();
+    for (unsigned i = 0; i < daemons.size(); ++i)
+      daemons[i]->start();
 
-    while (!s_stop)
+    while (!s_stop && !call_abort)
     {
-      if (!daemon.isRunning())
+      for (unsigned i = 0; i < daemons.size(); ++i)
       {
-        call_abort = true;
-        break;
+        if (!daemons[i]->isRunning())
+        {
+          call_abort = true;
+          break;
+        }
       }
 
-      Delay::wait(1.0);
+      if (!call_abort)
+        Delay::wait(1.0);
     }
 
     DUNE_WRN("Daemon", DTR("stopping tasks"));
-    daemon.stopAndJoin();
+    for (unsigned i = 0; i < daemons.size(); ++i)
+      daemons[i]->stop();
+
+    for (unsigned i = 0; i < daemons.size(); ++i)
+      daemons[i]->stopAndJoin();
   }
   catch (std::exception& e)
   {
@@ -181,6 +190,155 @@ runDaemon(DUNE::Daemon& daemon)
   return 0;
 }
 
+int
+runDaemon(DUNE::Daemon& daemon)
+{
+  return runDaemons(std::vector<DUNE::Daemon*>(1, &daemon));
+}
+
+//! Load the configuration file selected in the command line.
+//! @param[in] options command line options.
+//! @param[in,out] context task context.
+//! @return true if the configuration was loaded, false otherwise.
+bool
+loadConfig(OptionParser& options, Tasks::Context& context)
+{
+  // If requested, set alternate configuration directory.
+  if (options.value("--config-dir") != "")
+  {
+    context.dir_cfg = options.value("--config-dir");
+  }
+
+  // If requested, set alternate HTTP server directory.
+  if (options.value("--www-dir") != "")
+  {
+    context.dir_www = options.value("--www-dir");
+  }
+
+  Path cfg_file = context.dir_cfg / options.value("--config-file") + ".ini";
+  try
+  {
+    context.config.parseFile(cfg_file.c_str());
+  }
+  catch (std::runtime_error& e)
+  {
+    try
+    {
+      cfg_file = context.dir_usr_cfg / options.value("--config-file") + ".ini";
+      context.config.parseFile(cfg_file.c_str());
+      context.dir_cfg = context.dir_usr_cfg;
+    }
+    catch (std::runtime_error& e2)
+    {
+      std::cerr << String::str("ERROR: %s\n", e.what()) << std::endl;
+      std::cerr << String::str("ERROR: %s\n", e2.what()) << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//! Move the listening ports of servers that cannot be shared by
+//! vehicles hosted in the same process.
+//! @param[in,out] config configuration.
+//! @param[in] offset port offset.
+void
+offsetServerPorts(Parsers::Config& config, unsigned offset)
+{
+  static const char* c_servers[] = {"Transports.HTTP", "Transports.TCP.Server"};
+  static const unsigned c_servers_count = sizeof(c_servers) / sizeof(c_servers[0]);
+
+  std::vector<std::string> sections = config.sections();
+  for (unsigned i = 0; i < sections.size(); ++i)
+  {
+    for (unsigned j = 0; j < c_servers_count; ++j)
+    {
+      if (!String::startsWith(sections[i], c_servers[j]))
+        continue;
+
+      std::map<std::string, std::string> options = config.getSection(sections[i]);
+      unsigned port = 0;
+      if (options.find("Port") == options.end() || !castLexical(options["Port"], port))
+        continue;
+
+      config.set(sections[i], "Port", String::str("%u", port + offset));
+    }
+  }
+}
+
+//! Disable the options of tasks that would write to process-wide
+//! state on behalf of a single vehicle.
+//! @param[in,out] config configuration.
+void
+disableSharedOutput(Parsers::Config& config)
+{
+  std::vector<std::string> sections = config.sections();
+  for (unsigned i = 0; i < sections.size(); ++i)
+  {
+    if (String::startsWith(sections[i], "Transports.Logging"))
+      config.set(sections[i], "Terminal Output", "false");
+  }
+}
+
+//! Run several vehicles in this process. Each vehicle has its own
+//! context, message bus and system name. Vehicles talk to each other
+//! through the same channels used by separate processes (e.g.,
+//! acoustic and radio simulators).
+//!
+//! The following state is shared by all vehicles of the process:
+//! - the clock and its time scale (Time::Clock);
+//! - the terminal (Streams::dune_term), so log tasks do not copy it
+//!   to Output.txt and messages of all vehicles are interleaved;
+//! - the language of translated messages (I18N);
+//! - the scheduling policy and signal handlers;
+//! - the task and message factories.
+//! @param[in] options command line options.
+//! @param[in] names vehicle names.
+//! @return exit code.
+int
+runHost(OptionParser& options, const std::vector<std::string>& names)
+{
+  std::vector<Tasks::Context*> contexts;
+  std::vector<DUNE::Daemon*> daemons;
+  int rv = 1;
+
+  try
+  {
+    for (unsigned i = 0; i < names.size(); ++i)
+    {
+      Tasks::Context* context = new Tasks::Context;
+      contexts.push_back(context);
+
+      if (!loadConfig(options, *context))
+        throw std::runtime_error(DTR("failed to load configuration"));
+
+      context->config.set("General", "Vehicle", names[i]);
+      offsetServerPorts(context->config, i);
+      disableSharedOutput(context->config);
+
+      daemons.push_back(new DUNE::Daemon(*context, options.value("--profiles")));
+    }
+
+    DUNE_MSG("Daemon", String::str(DTR("hosting %u vehicles with time scale %0.2f"),
+                                   (unsigned)daemons.size(), Clock::getScale()));
+
+    rv = runDaemons(daemons);
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "ERROR: " << e.what() << std::endl;
+  }
+
+  for (unsigned i = 0; i < daemons.size(); ++i)
+    delete daemons[i];
+
+  for (unsigned i = 0; i < contexts.size(); ++i)
+    delete contexts[i];
+
+  return rv;
+}
+
 int
 main(int argc, char** argv)
 {
@@ -208,6 +366,10 @@ main(int argc, char** argv)
        "Execution Profiles", "PROFILES")
   .add("-V", "--vehicle",
        "Vehicle name override", "VEHICLE")
+  .add("-H", "--host",
+       "Run the comma separated list of VEHICLES in this process", "VEHICLES")
+  .add("-T", "--time-scale",
+       "Advance time SCALE times faster than the system clock", "SCALE")
   .add("-X", "--dump-params-xml",
        "Dump parameters XML to folder DIR", "DIR");
 
@@ -230,16 +392,17 @@ main(int argc, char** argv)
 #endif
   }
 
-  // If requested, set alternate configuration directory.
-  if (options.value("--config-dir") != "")
+  // If requested, change the time scale.
+  if (!options.value("--time-scale").empty())
   {
-    context.dir_cfg = options.value("--config-dir");
-  }
+    double scale = 0.0;
+    if (!castLexical(options.value("--time-scale"), scale) || scale <= 0.0)
+    {
+      std::cerr << "ERROR: invalid time scale '" << options.value("--time-scale") << "'" << std::endl;
+      return 1;
+    }
 
-  // If requested, set alternate HTTP server directory.
-  if (options.value("--www-dir") != "")
-  {
-    context.dir_www = options.value("--www-dir");
+    Clock::setScale(scale);
   }
 
   DUNE::Tasks::Factory::registerDynamicTasks(context.dir_lib.c_str());
@@ -254,27 +417,17 @@ main(int argc, char** argv)
     return 1;
   }
 
-  Path cfg_file = context.dir_cfg / options.value("--config-file") + ".ini";
-  try
-  {
-    context.config.parseFile(cfg_file.c_str());
-  }
-  catch (std::runtime_error& e)
+  // Host several vehicles in this process.
+  if (!options.value("--host").empty())
   {
-    try
-    {
-      cfg_file = context.dir_usr_cfg / options.value("--config-file") + ".ini";
-      context.config.parseFile(cfg_file.c_str());
-      context.dir_cfg = context.dir_usr_cfg;
-    }
-    catch (std::runtime_error& e2)
-    {
-      std::cerr << String::str("ERROR: %s\n", e.what()) << std::endl;
-      std::cerr << String::str("ERROR: %s\n", e2.what()) << std::endl;
-      return 1;
-    }
+    std::vector<std::string> names;
+    String::split(options.value("--host"), ",", names);
+    return runHost(options, names);
   }
 
+  if (!loadConfig(options, context))
+    return 1;
+
   if (!options.value("--vehicle").empty())
     context.config.set("General", "Vehicle", options.value("--vehicle"));
 
@@ -391,6 +391,32 @@ namespace Monitors
         }
       }
 
+      //! Store the current estimate.
+      //! @param[in] ckp checkpoint.
+      //! @return true if there is an estimate, false otherwise.
+      bool
+      save(Tasks::Checkpoint& ckp) const
+      {
+        if (!m_has_initial_estimate)
+          return false;
+
+        ckp.put(m_initial_estimate);
+        ckp.put(m_energy_consumed);
+        ckp.put(m_cold_estimate);
+        return true;
+      }
+
+      //! Restore an estimate stored with save().
+      //! @param[in] ckp checkpoint.
+      void
+      restore(Tasks::Checkpoint& ckp)
+      {
+        ckp.get(m_initial_estimate);
+        ckp.get(m_energy_consumed);
+        ckp.get(m_cold_estimate);
+        m_has_initial_estimate = true;
+      }
+
     private:
       //! Compute deviation from model
       //! @param[in] model model to be used to compute deviation
@@ -188,6 +188,9 @@ namespace Monitors
         .units(Units::Watt)
         .description("List of estimated power consumed by the entities");
 
+        // Keep the estimate across restarts.
+        paramCheckpoint(10.0, 120.0);
+
         m_ctx.config.get("General", "Battery Capacity", "700.0", m_args.filter_args.full_capacity);
         m_ctx.config.get("General", "Battery Packs", "4", m_args.battery_packs);
 
@@ -268,6 +271,19 @@ namespace Monitors
         }
       }
 
+      bool
+      onCheckpointSave(Tasks::Checkpoint& ckp)
+      {
+        return m_fuel_filter->save(ckp);
+      }
+
+      void
+      onCheckpointRestore(Tasks::Checkpoint& ckp, double age)
+      {
+        m_fuel_filter->restore(ckp);
+        debug("restored estimate from %.1f s ago", age);
+      }
+
       void
       consume(const IMC::Voltage* msg)
       {
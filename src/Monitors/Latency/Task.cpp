@@ -0,0 +1,237 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Monitors
+{
+  //! This task measures the end-to-end latency of control pipelines.
+  //!
+  //! Messages dispatched by a task while it consumes another one
+  //! carry the trace of the consumed message, so every message can be
+  //! traced back to the sample that started its chain (see
+  //! IMC::Message::setTrace). For each configured pipeline output
+  //! (e.g., SetThrusterActuation) this task keeps a histogram of the
+  //! age of the originating sample and periodically reports it in an
+  //! EntityParameters message from a dedicated entity.
+  //!
+  //! @author agent
+  namespace Latency
+  {
+    using DUNE_NAMESPACES;
+
+    struct Arguments
+    {
+      //! Messages that terminate a pipeline.
+      std::vector<std::string> pipelines;
+      //! Report period.
+      double period;
+      //! Minimum number of hops.
+      unsigned min_hops;
+      //! Latency warning threshold.
+      double max_latency;
+    };
+
+    //! Pipeline statistics.
+    struct Pipeline
+    {
+      //! Pipeline name.
+      std::string name;
+      //! Reporting entity.
+      unsigned eid;
+      //! Latency histogram.
+      LatencyHistogram histogram;
+      //! Maximum number of hops seen.
+      unsigned hops;
+    };
+
+    struct Task: public DUNE::Tasks::Task
+    {
+      //! Pipelines by message identifier.
+      std::map<uint32_t, Pipeline> m_pipes;
+      //! Report timer.
+      Counter<double> m_report;
+      //! Task arguments.
+      Arguments m_args;
+
+      Task(const std::string& name, Tasks::Context& ctx):
+        Tasks::Task(name, ctx)
+      {
+        param("Pipelines", m_args.pipelines)
+        .defaultValue("SetThrusterActuation, SetServoPosition")
+        .description("Messages whose reception ends a pipeline");
+
+        param("Report Period", m_args.period)
+        .units(Units::Second)
+        .defaultValue("10")
+        .minimumValue("1")
+        .description("Period of latency reports");
+
+        param("Minimum Hops", m_args.min_hops)
+        .defaultValue("2")
+        .description("Ignore messages that went through fewer tasks");
+
+        param("Maximum Latency", m_args.max_latency)
+        .units(Units::Second)
+        .defaultValue("0")
+        .minimumValue("0")
+        .description("Warn when the 99th percentile latency exceeds this value, zero to disable");
+      }
+
+      void
+      onUpdateParameters(void)
+      {
+        m_report.setTop(m_args.period);
+      }
+
+      void
+      onEntityReservation(void)
+      {
+        std::vector<uint32_t> ids;
+
+        for (unsigned i = 0; i < m_args.pipelines.size(); ++i)
+        {
+          uint32_t id = IMC::Factory::getIdFromAbbrev(m_args.pipelines[i]);
+          if (m_pipes.find(id) != m_pipes.end())
+            continue;
+
+          Pipeline& pipe = m_pipes[id];
+          pipe.name = m_args.pipelines[i];
+          pipe.eid = reserveEntity(std::string(getEntityLabel()) + " - " + pipe.name);
+          pipe.hops = 0;
+          ids.push_back(id);
+        }
+
+        bind(this, ids);
+      }
+
+      void
+      consume(const IMC::Message* msg)
+      {
+        if (msg->getSource() != getSystemId())
+          return;
+
+        if (!msg->hasTrace() || msg->getTraceHops() < m_args.min_hops)
+          return;
+
+        std::map<uint32_t, Pipeline>::iterator itr = m_pipes.find(msg->getId());
+        if (itr == m_pipes.end())
+          return;
+
+        itr->second.histogram.add(Clock::getSinceEpoch() - msg->getTraceOrigin());
+        itr->second.hops = std::max(itr->second.hops, msg->getTraceHops());
+      }
+
+      //! Add a parameter to a report.
+      //! @param[in] ep report.
+      //! @param[in] name parameter name.
+      //! @param[in] value parameter value.
+      void
+      addParameter(IMC::EntityParameters& ep, const std::string& name, const std::string& value)
+      {
+        IMC::EntityParameter param;
+        param.name = name;
+        param.value = value;
+        ep.params.push_back(param);
+      }
+
+      //! Report statistics of a pipeline and start a new period.
+      //! @param[in] pipe pipeline.
+      void
+      report(Pipeline& pipe)
+      {
+        const LatencyHistogram& h = pipe.histogram;
+        if (h.getCount() == 0)
+          return;
+
+        IMC::EntityParameters ep;
+        ep.name = pipe.name;
+        ep.setSourceEntity(pipe.eid);
+
+        addParameter(ep, "Samples", String::str(h.getCount()));
+        addParameter(ep, "Hops", String::str(pipe.hops));
+        addParameter(ep, "Mean", String::str("%0.2f ms", h.getMean() * 1e3));
+        addParameter(ep, "Median", String::str("%0.2f ms", h.getPercentile(50) * 1e3));
+        addParameter(ep, "90th Percentile", String::str("%0.2f ms", h.getPercentile(90) * 1e3));
+        addParameter(ep, "99th Percentile", String::str("%0.2f ms", h.getPercentile(99) * 1e3));
+        addParameter(ep, "Maximum", String::str("%0.2f ms", h.getMaximum() * 1e3));
+
+        for (unsigned i = 0; i < LatencyHistogram::c_buckets; ++i)
+        {
+          if (h.getBucketCount(i) == 0)
+            continue;
+
+          double limit = LatencyHistogram::getBucketLimit(i);
+          std::string label;
+          if (i == LatencyHistogram::c_buckets - 1)
+            label = String::str("> %g ms", LatencyHistogram::getBucketLimit(i - 1) * 1e3);
+          else
+            label = String::str("<= %g ms", limit * 1e3);
+
+          addParameter(ep, label, String::str(h.getBucketCount(i)));
+        }
+
+        dispatch(ep);
+
+        debug("%s: %u samples, mean %0.2f ms, 99th percentile %0.2f ms",
+              pipe.name.c_str(), h.getCount(), h.getMean() * 1e3, h.getPercentile(99) * 1e3);
+
+        if (m_args.max_latency > 0 && h.getPercentile(99) > m_args.max_latency)
+          war(DTR("%s latency above limit: %0.1f ms"), pipe.name.c_str(), h.getPercentile(99) * 1e3);
+
+        pipe.histogram.reset();
+        pipe.hops = 0;
+      }
+
+      void
+      onMain(void)
+      {
+        while (!stopping())
+        {
+          waitForMessages(1.0);
+
+          if (!m_report.overflow())
+            continue;
+
+          m_report.reset();
+
+          std::map<uint32_t, Pipeline>::iterator itr = m_pipes.begin();
+          for (; itr != m_pipes.end(); ++itr)
+            report(itr->second);
+        }
+      }
+    };
+  }
+}
+
+DUNE_TASK
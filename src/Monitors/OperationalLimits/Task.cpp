@@ -102,6 +102,8 @@ namespace Monitors
       IMC::OperationalLimits m_ol;
       //! Last EstimatedState message
       IMC::EstimatedState m_estate;
+      //! Frame of the operational area.
+      LocalFrame m_area;
       //! Error mask.
       uint8_t m_emask;
       //! Cache control message.
@@ -378,9 +380,10 @@ namespace Monitors
 
         if ((m_ol.mask & IMC::OPL_AREA) && (Clock::get() >= m_atest_time))
         {
-          double x, y;
+          double x, y, z;
 
-          WGS84::displacement(m_ol.lat, m_ol.lon, 0, m_estate.lat, m_estate.lon, 0, &x, &y);
+          m_area.setReference(m_ol.lat, m_ol.lon);
+          m_area.toNED(m_estate.lat, m_estate.lon, 0, x, y, z);
 
           x += m_estate.x;
           y += m_estate.y;
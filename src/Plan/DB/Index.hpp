@@ -0,0 +1,223 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef PLAN_DB_INDEX_HPP_INCLUDED_
+#define PLAN_DB_INDEX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Plan
+{
+  namespace DB
+  {
+    using DUNE_NAMESPACES;
+
+    //! In-memory index of the metadata of all stored plans. It
+    //! answers information and state queries without touching the
+    //! storage backend and keeps the totals of the database up to
+    //! date as plans are added and removed. Changes are applied to
+    //! the working index right away, but the database state is only
+    //! updated by commit(), so that state queries issued while a
+    //! transaction is open never report uncommitted plans.
+    class Index
+    {
+    public:
+      //! Constructor.
+      Index(void):
+        m_size(0),
+        m_digest_valid(false)
+      { }
+
+      //! Remove all plans.
+      void
+      clear(void)
+      {
+        m_plans.clear();
+        m_size = 0;
+        m_digest_valid = false;
+      }
+
+      //! Add or replace the metadata of a plan.
+      //! @param[in] info plan metadata.
+      //! @return true if an existing plan was replaced, false otherwise.
+      bool
+      set(const IMC::PlanDBInformation& info)
+      {
+        bool replaced = remove(info.plan_id);
+        m_plans[info.plan_id] = info;
+        m_size += info.plan_size;
+        m_digest_valid = false;
+        return replaced;
+      }
+
+      //! Remove the metadata of a plan.
+      //! @param[in] plan_id plan identifier.
+      //! @return true if the plan existed, false otherwise.
+      bool
+      remove(const std::string& plan_id)
+      {
+        std::map<std::string, IMC::PlanDBInformation>::iterator itr = m_plans.find(plan_id);
+        if (itr == m_plans.end())
+          return false;
+
+        m_size -= itr->second.plan_size;
+        m_plans.erase(itr);
+        m_digest_valid = false;
+        return true;
+      }
+
+      //! Find the metadata of a plan.
+      //! @param[in] plan_id plan identifier.
+      //! @return plan metadata or NULL if the plan does not exist.
+      const IMC::PlanDBInformation*
+      find(const std::string& plan_id) const
+      {
+        std::map<std::string, IMC::PlanDBInformation>::const_iterator itr = m_plans.find(plan_id);
+        if (itr == m_plans.end())
+          return NULL;
+
+        return &itr->second;
+      }
+
+      //! Get the number of plans.
+      //! @return number of plans.
+      unsigned
+      getCount(void) const
+      {
+        return m_plans.size();
+      }
+
+      //! Get the combined size of all plans.
+      //! @return size in bytes.
+      unsigned
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Get the database digest: the MD5 of the MD5s of all plans,
+      //! ordered by plan identifier. The digest is recomputed from
+      //! memory only after the index changes.
+      //! @return 16 byte digest.
+      const std::vector<char>&
+      getDigest(void)
+      {
+        if (m_digest_valid)
+          return m_digest;
+
+        MD5 md5sum;
+        std::map<std::string, IMC::PlanDBInformation>::const_iterator itr = m_plans.begin();
+        for (; itr != m_plans.end(); ++itr)
+          md5sum.update((const uint8_t*)&itr->second.md5[0], 16);
+
+        m_digest.resize(16);
+        md5sum.finalize((uint8_t*)&m_digest[0]);
+        m_digest_valid = true;
+        return m_digest;
+      }
+
+      //! Record the last change to the database.
+      //! @param[in] time time of the change.
+      //! @param[in] sid system that made the change.
+      //! @param[in] sname name of the system that made the change.
+      void
+      setLastChange(double time, uint16_t sid, const std::string& sname)
+      {
+        m_change.change_time = time;
+        m_change.change_sid = sid;
+        m_change.change_sname = sname;
+      }
+
+      //! Make the working index the committed database state.
+      void
+      commit(void)
+      {
+        m_state.plan_count = getCount();
+        m_state.plan_size = getSize();
+        m_state.md5 = getDigest();
+        m_state.change_time = m_change.change_time;
+        m_state.change_sid = m_change.change_sid;
+        m_state.change_sname = m_change.change_sname;
+        m_state.plans_info.clear();
+
+        std::map<std::string, IMC::PlanDBInformation>::const_iterator itr = m_plans.begin();
+        for (; itr != m_plans.end(); ++itr)
+          m_state.plans_info.push_back(itr->second);
+      }
+
+      //! Discard all changes since the last commit().
+      void
+      rollback(void)
+      {
+        clear();
+
+        IMC::MessageList<IMC::PlanDBInformation>::const_iterator itr = m_state.plans_info.begin();
+        for (; itr != m_state.plans_info.end(); ++itr)
+          set(**itr);
+
+        setLastChange(m_state.change_time, m_state.change_sid, m_state.change_sname);
+      }
+
+      //! Fill a database state message with the committed metadata
+      //! of all plans and the last committed change.
+      //! @param[out] state database state message.
+      void
+      fill(IMC::PlanDBState& state) const
+      {
+        state.plan_count = m_state.plan_count;
+        state.plan_size = m_state.plan_size;
+        state.md5 = m_state.md5;
+        state.change_time = m_state.change_time;
+        state.change_sid = m_state.change_sid;
+        state.change_sname = m_state.change_sname;
+        state.plans_info = m_state.plans_info;
+      }
+
+    private:
+      //! Plan metadata by plan identifier.
+      std::map<std::string, IMC::PlanDBInformation> m_plans;
+      //! Combined size of all plans.
+      unsigned m_size;
+      //! Cached database digest.
+      std::vector<char> m_digest;
+      //! True if the cached digest is up to date.
+      bool m_digest_valid;
+      //! Last change to the working index.
+      IMC::PlanDBState m_change;
+      //! Database state as of the last commit.
+      IMC::PlanDBState m_state;
+    };
+  }
+}
+
+#endif
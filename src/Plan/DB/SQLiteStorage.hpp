@@ -0,0 +1,264 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef PLAN_DB_SQLITE_STORAGE_HPP_INCLUDED_
+#define PLAN_DB_SQLITE_STORAGE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Storage.hpp"
+
+namespace Plan
+{
+  namespace DB
+  {
+    using DUNE_NAMESPACES;
+
+    static const char* c_plan_table_stmt =
+    "create table if not exists Plan ( "
+    " plan_id varchar2 primary key,"
+    " change_time real not null,"
+    " change_sid integer not null,"
+    " change_sname varchar2 not null,"
+    " md5 blob not null,"
+    " data blob not null"
+    " )"
+    ;
+    static const char* c_insert_plan_stmt = "insert into Plan values(?,?,?,?,?,?)";
+    static const char* c_delete_plan_stmt = "delete from Plan where plan_id=?";
+    static const char* c_plan_iterator_stmt =
+    "select plan_id, change_time, change_sid, change_sname, md5, length(data)"
+    "from Plan order by plan_id";
+    static const char* c_get_plan_stmt = "select data from Plan where plan_id=?";
+    static const char* c_delete_all_plans_stmt = "delete from Plan";
+
+    static const char* c_lastchange_table_stmt =
+    "create table if not exists LastChange ("
+    " change_time real not null,"
+    " change_sid integer not null,"
+    " change_sname varchar2 not null )";
+
+    static const char* c_lastchange_update_stmt
+    = "update LastChange set change_time=?, change_sid=?, change_sname=?";
+
+    static const char* c_lastchange_query_stmt
+    = "select change_time, change_sid, change_sname from LastChange";
+
+    //! Write-ahead logging lets readers proceed during writes and
+    //! replaces one journal rewrite per transaction by appends, which
+    //! is much cheaper on SD cards.
+    static const char* c_journal_mode_stmt = "pragma journal_mode=WAL";
+    //! In WAL mode a transaction is durable once the log is synced at
+    //! checkpoints; a power loss may only lose the last transactions.
+    static const char* c_synchronous_stmt = "pragma synchronous=NORMAL";
+
+    //! SQLite storage backend.
+    class SQLiteStorage: public Storage
+    {
+    public:
+      //! Constructor.
+      //! @param[in] path path to the database file.
+      //! @param[in] sid system identifier used to initialize the last
+      //! change information of a new database.
+      //! @param[in] sname system name used to initialize the last
+      //! change information of a new database.
+      SQLiteStorage(const std::string& path, uint16_t sid, const std::string& sname):
+        m_db(new Database::Connection(path.c_str(), true))
+      {
+        m_db->execute(c_journal_mode_stmt);
+        m_db->execute(c_synchronous_stmt);
+
+        // Create Plan table and initialize associated statements
+        m_db->execute(c_plan_table_stmt);
+        m_insert_plan_stmt = new Database::Statement(c_insert_plan_stmt, *m_db);
+        m_delete_plan_stmt = new Database::Statement(c_delete_plan_stmt, *m_db);
+        m_plan_iterator_stmt = new Database::Statement(c_plan_iterator_stmt, *m_db);
+        m_get_plan_stmt = new Database::Statement(c_get_plan_stmt, *m_db);
+        m_delete_all_plans_stmt = new Database::Statement(c_delete_all_plans_stmt, *m_db);
+
+        // Create LastChange table and initialize associated statements
+        m_db->execute(c_lastchange_table_stmt);
+        m_lastchange_update_stmt = new Database::Statement(c_lastchange_update_stmt, *m_db);
+        m_lastchange_query_stmt = new Database::Statement(c_lastchange_query_stmt, *m_db);
+
+        if (!m_lastchange_query_stmt->execute())
+        {
+          Database::Statement initial_insert("insert into LastChange values(?,?,?)", *m_db);
+          double now = Clock::getSinceEpoch();
+          initial_insert << now << sid << sname;
+          initial_insert.execute();
+        }
+
+        m_lastchange_query_stmt->reset();
+      }
+
+      //! Destructor.
+      ~SQLiteStorage(void)
+      {
+        delete m_insert_plan_stmt;
+        delete m_delete_plan_stmt;
+        delete m_plan_iterator_stmt;
+        delete m_get_plan_stmt;
+        delete m_delete_all_plans_stmt;
+        delete m_lastchange_update_stmt;
+        delete m_lastchange_query_stmt;
+        delete m_db;
+      }
+
+      void
+      load(std::vector<IMC::PlanDBInformation>& plans)
+      {
+        plans.clear();
+
+        while (m_plan_iterator_stmt->execute())
+        {
+          plans.push_back(IMC::PlanDBInformation());
+          IMC::PlanDBInformation& info = plans.back();
+
+          *m_plan_iterator_stmt >> info.plan_id
+                                >> info.change_time
+                                >> info.change_sid
+                                >> info.change_sname
+                                >> info.md5
+                                >> info.plan_size;
+        }
+
+        m_plan_iterator_stmt->reset();
+      }
+
+      void
+      loadLastChange(IMC::PlanDBState& state)
+      {
+        m_lastchange_query_stmt->execute();
+        *m_lastchange_query_stmt >> state.change_time
+                                 >> state.change_sid
+                                 >> state.change_sname;
+        m_lastchange_query_stmt->reset();
+      }
+
+      void
+      begin(void)
+      {
+        m_db->beginTransaction();
+      }
+
+      void
+      commit(void)
+      {
+        m_db->commit();
+      }
+
+      void
+      rollback(void)
+      {
+        m_db->rollback();
+      }
+
+      void
+      store(const IMC::PlanDBInformation& info, const std::vector<char>& data)
+      {
+        remove(info.plan_id);
+
+        *m_insert_plan_stmt << info.plan_id
+                            << info.change_time
+                            << info.change_sid
+                            << info.change_sname
+                            << info.md5
+                            << data;
+        m_insert_plan_stmt->execute();
+      }
+
+      bool
+      remove(const std::string& plan_id)
+      {
+        int count = 0;
+        *m_delete_plan_stmt << plan_id;
+        m_delete_plan_stmt->execute(&count);
+        m_delete_plan_stmt->reset();
+        return count != 0;
+      }
+
+      void
+      clear(void)
+      {
+        m_delete_all_plans_stmt->execute();
+      }
+
+      bool
+      get(const std::string& plan_id, std::vector<char>& data)
+      {
+        *m_get_plan_stmt << plan_id;
+
+        bool found = m_get_plan_stmt->execute();
+        if (found)
+          *m_get_plan_stmt >> data;
+
+        m_get_plan_stmt->reset();
+        return found;
+      }
+
+      void
+      setLastChange(double time, uint16_t sid, const std::string& sname)
+      {
+        int count = 0;
+
+        *m_lastchange_update_stmt << time << sid << sname;
+        m_lastchange_update_stmt->execute(&count);
+
+        if (count != 1)
+          throw std::runtime_error(DTR("database is corrupt"));
+      }
+
+    private:
+      //! Database handle.
+      Database::Connection* m_db;
+      // Statements
+      Database::Statement* m_insert_plan_stmt;
+      Database::Statement* m_delete_plan_stmt;
+      Database::Statement* m_plan_iterator_stmt;
+      Database::Statement* m_get_plan_stmt;
+      Database::Statement* m_delete_all_plans_stmt;
+      Database::Statement* m_lastchange_update_stmt;
+      Database::Statement* m_lastchange_query_stmt;
+
+      //! Non-copyable.
+      SQLiteStorage(const SQLiteStorage&);
+
+      //! Non-assignable.
+      SQLiteStorage&
+      operator=(const SQLiteStorage&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,114 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef PLAN_DB_STORAGE_HPP_INCLUDED_
+#define PLAN_DB_STORAGE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Plan
+{
+  namespace DB
+  {
+    using DUNE_NAMESPACES;
+
+    //! Persistent storage of plans. Backends keep the serialized
+    //! plan specifications together with their metadata and the
+    //! information about the last change to the database. Modifying
+    //! operations are only issued between begin() and commit() or
+    //! rollback(). Backends report errors by throwing
+    //! std::runtime_error.
+    class Storage
+    {
+    public:
+      //! Destructor.
+      virtual
+      ~Storage(void)
+      { }
+
+      //! Retrieve the metadata of all stored plans.
+      //! @param[out] plans plan metadata.
+      virtual void
+      load(std::vector<IMC::PlanDBInformation>& plans) = 0;
+
+      //! Retrieve the information about the last change.
+      //! @param[out] state database state message whose change fields
+      //! are filled.
+      virtual void
+      loadLastChange(IMC::PlanDBState& state) = 0;
+
+      //! Start a transaction.
+      virtual void
+      begin(void) = 0;
+
+      //! Make all changes since begin() persistent.
+      virtual void
+      commit(void) = 0;
+
+      //! Discard all changes since begin().
+      virtual void
+      rollback(void) = 0;
+
+      //! Add or replace a plan.
+      //! @param[in] info plan metadata.
+      //! @param[in] data serialized plan specification fields.
+      virtual void
+      store(const IMC::PlanDBInformation& info, const std::vector<char>& data) = 0;
+
+      //! Remove a plan.
+      //! @param[in] plan_id plan identifier.
+      //! @return true if the plan existed, false otherwise.
+      virtual bool
+      remove(const std::string& plan_id) = 0;
+
+      //! Remove all plans.
+      virtual void
+      clear(void) = 0;
+
+      //! Retrieve a serialized plan specification.
+      //! @param[in] plan_id plan identifier.
+      //! @param[out] data serialized plan specification fields.
+      //! @return true if the plan exists, false otherwise.
+      virtual bool
+      get(const std::string& plan_id, std::vector<char>& data) = 0;
+
+      //! Record the last change to the database.
+      //! @param[in] time time of the change.
+      //! @param[in] sid system that made the change.
+      //! @param[in] sname name of the system that made the change.
+      virtual void
+      setLastChange(double time, uint16_t sid, const std::string& sname) = 0;
+    };
+  }
+}
+
+#endif
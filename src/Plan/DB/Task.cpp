@@ -27,49 +27,21 @@
 
 // ISO C++ 98 headers.
 #include <cstddef>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "Index.hpp"
+#include "SQLiteStorage.hpp"
+
 namespace Plan
 {
   namespace DB
   {
     using DUNE_NAMESPACES;
 
-    static const char* c_plan_table_stmt =
-    "create table if not exists Plan ( "
-    " plan_id varchar2 primary key,"
-    " change_time real not null,"
-    " change_sid integer not null,"
-    " change_sname varchar2 not null,"
-    " md5 blob not null,"
-    " data blob not null"
-    " )"
-    ;
-    static const char* c_insert_plan_stmt = "insert into Plan values(?,?,?,?,?,?)";
-    static const char* c_delete_plan_stmt = "delete from Plan where plan_id=?";
-    static const char* c_plan_iterator_stmt =
-    "select plan_id, change_time, change_sid, change_sname, md5, length(data)"
-    "from Plan order by plan_id";
-    static const char* c_query_plan_stmt =
-    "select change_time, change_sid, change_sname, md5, length(data)"
-    "from Plan where plan_id=?";
-    static const char* c_get_plan_stmt = "select data from Plan where plan_id=?";
-    static const char* c_delete_all_plans_stmt = "delete from Plan";
-
-    static const char* c_lastchange_table_stmt =
-    "create table if not exists LastChange ("
-    " change_time real not null,"
-    " change_sid integer not null,"
-    " change_sname varchar2 not null )";
-
-    static const char* c_lastchange_update_stmt
-    = "update LastChange set change_time=?, change_sid=?, change_sname=?";
-
-    static const char* c_lastchange_query_stmt
-    = "select change_time, change_sid, change_sname from LastChange";
-
     static const char* c_op_desc[] = {DTR_RT("set plan"), DTR_RT("delete plan"),
                                       DTR_RT("get plan"), DTR_RT("get plan info"),
                                       DTR_RT("clear database"), DTR_RT("database state"),
@@ -85,27 +57,25 @@ namespace Plan
     {
       // Task arguments
       Arguments m_args;
-      // Database handle.
-      Database::Connection* m_db;
+      // Storage backend.
+      Storage* m_storage;
+      // Metadata of all stored plans.
+      Index m_index;
+      // True if a transaction is open.
+      bool m_batch;
+      // Successful replies waiting for the transaction to be committed.
+      std::vector<IMC::PlanDB> m_pending;
       // In progress reply message.
       IMC::PlanDB m_reply;
       // In progress reply message.
       IMC::PlanDBInformation m_plan_info;
-      // Statements
-      Database::Statement* m_insert_plan_stmt;
-      Database::Statement* m_delete_plan_stmt;
-      Database::Statement* m_plan_iterator_stmt;
-      Database::Statement* m_query_plan_stmt;
-      Database::Statement* m_get_plan_stmt;
-      Database::Statement* m_delete_all_plans_stmt;
-      Database::Statement* m_lastchange_update_stmt;
-      Database::Statement* m_lastchange_query_stmt;
       // Local request counter
       uint16_t m_local_reqid;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
-        m_db(NULL),
+        m_storage(NULL),
+        m_batch(false),
         m_local_reqid(0)
       {
         param("DB Path", m_args.db_path)
@@ -120,7 +90,7 @@ namespace Plan
       void
       onResourceAcquisition(void)
       {
-        if (m_db != NULL)
+        if (m_storage != NULL)
           return;
 
         m_reply.clear();
@@ -138,54 +108,114 @@ namespace Plan
 
         inf(DTR("database file: '%s'"), db_file.c_str());
 
-        m_db = new Database::Connection(db_file.c_str(), true);
+        m_storage = new SQLiteStorage(db_file.c_str(), getSystemId(), getSystemName());
+        loadIndex();
+
+        debug("loaded %u plans (%u bytes)", m_index.getCount(), m_index.getSize());
+
+        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+
+        onSuccess(DTR("initialization complete"));
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        if (m_storage == NULL)
+          return;
+
+        commitBatch();
+        Memory::clear(m_storage);
+        m_index.clear();
+      }
+
+      //! Load the plan index and the last change information from
+      //! the storage backend.
+      void
+      loadIndex(void)
+      {
+        std::vector<IMC::PlanDBInformation> plans;
+        m_storage->load(plans);
+
+        IMC::PlanDBState last_change;
+        m_storage->loadLastChange(last_change);
+
+        m_index.clear();
+        for (size_t i = 0; i < plans.size(); ++i)
+          m_index.set(plans[i]);
+
+        m_index.setLastChange(last_change.change_time, last_change.change_sid,
+                              last_change.change_sname);
+        m_index.commit();
+      }
+
+      //! Open a transaction, if none is open. Modifying requests
+      //! handled in the same activation share this transaction and
+      //! their replies are sent once it is committed.
+      void
+      beginBatch(void)
+      {
+        if (m_batch)
+          return;
 
-        // Create Plan table and initialize associated statements
-        m_db->execute(c_plan_table_stmt);
-        m_insert_plan_stmt = new Database::Statement(c_insert_plan_stmt, *m_db);
-        m_delete_plan_stmt = new Database::Statement(c_delete_plan_stmt, *m_db);
-        m_plan_iterator_stmt = new Database::Statement(c_plan_iterator_stmt, *m_db);
-        m_query_plan_stmt = new Database::Statement(c_query_plan_stmt, *m_db);
-        m_get_plan_stmt = new Database::Statement(c_get_plan_stmt, *m_db);
-        m_delete_all_plans_stmt = new Database::Statement(c_delete_all_plans_stmt, *m_db);
+        m_storage->begin();
+        m_batch = true;
+      }
 
-        // Create Plan table and initialize associated statements
-        m_db->execute(c_lastchange_table_stmt);
-        m_lastchange_update_stmt = new Database::Statement(c_lastchange_update_stmt, *m_db);
-        m_lastchange_query_stmt = new Database::Statement(c_lastchange_query_stmt, *m_db);
+      //! Commit the open transaction and send the pending replies.
+      void
+      commitBatch(void)
+      {
+        if (!m_batch)
+          return;
 
-        if (!m_lastchange_query_stmt->execute())
+        try
         {
-          Database::Statement initial_insert("insert into LastChange values(?,?,?)", *m_db);
-          double now = Clock::getSinceEpoch();
-          initial_insert << now << getSystemId() << getSystemName();
-          initial_insert.execute();
+          m_storage->commit();
+          m_index.commit();
+          m_batch = false;
+        }
+        catch (std::runtime_error& e)
+        {
+          abortBatch(e.what());
+          return;
         }
 
-        m_lastchange_query_stmt->reset();
-
-        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+        for (size_t i = 0; i < m_pending.size(); ++i)
+          send(m_pending[i]);
 
-        onSuccess(DTR("initialization complete"));
+        m_pending.clear();
       }
 
+      //! Discard the open transaction and fail the pending replies.
+      //! @param[in] errmsg error message.
       void
-      onResourceRelease(void)
+      abortBatch(const char* errmsg)
       {
-        if (m_db == NULL)
+        if (!m_batch)
           return;
 
-        delete m_insert_plan_stmt;
-        delete m_delete_plan_stmt;
-        delete m_plan_iterator_stmt;
-        delete m_query_plan_stmt;
-        delete m_get_plan_stmt;
-        delete m_delete_all_plans_stmt;
-        delete m_lastchange_update_stmt;
-        delete m_lastchange_query_stmt;
-        delete m_db;
-
-        m_db = NULL;
+        m_batch = false;
+        m_index.rollback();
+
+        try
+        {
+          m_storage->rollback();
+        }
+        catch (std::runtime_error& e)
+        {
+          err("%s", e.what());
+        }
+
+        for (size_t i = 0; i < m_pending.size(); ++i)
+        {
+          m_pending[i].type = IMC::PlanDB::DBT_FAILURE;
+          m_pending[i].info = errmsg;
+          m_pending[i].arg.clear();
+          send(m_pending[i]);
+        }
+
+        m_pending.clear();
       }
 
       void
@@ -261,7 +291,7 @@ namespace Plan
         m_reply.request_id = req->request_id;
         m_reply.plan_id = req->plan_id;
 
-        if (!m_db)
+        if (m_storage == NULL)
         {
           onFailure(DTR("not active"));
           return;
@@ -315,14 +345,8 @@ namespace Plan
       void
       onChange(double time, uint16_t sid, const std::string& sname)
       {
-        // Update LastChange table information.
-        int count = 0;
-
-        *m_lastchange_update_stmt << time << sid << sname;
-        m_lastchange_update_stmt->execute(&count);
-
-        if (count != 1)
-          throw std::runtime_error(DTR("database is corrupt"));
+        m_storage->setLastChange(time, sid, sname);
+        m_index.setLastChange(time, sid, sname);
       }
 
       void
@@ -368,34 +392,23 @@ namespace Plan
         m_plan_info.md5.resize(16);
         MD5::compute((uint8_t*)&plan_data[0], m_plan_info.plan_size, (uint8_t*)&m_plan_info.md5[0]);
 
-        m_db->beginTransaction();
-
-        int count = 0;
+        bool updated = false;
         try
         {
-          *m_delete_plan_stmt << m_plan_info.plan_id;
-          m_delete_plan_stmt->execute(&count);
-          m_delete_plan_stmt->reset();
-
-          *m_insert_plan_stmt << m_plan_info.plan_id
-                              << m_plan_info.change_time
-                              << m_plan_info.change_sid
-                              << m_plan_info.change_sname
-                              << m_plan_info.md5
-                              << plan_data;
-          m_insert_plan_stmt->execute();
+          beginBatch();
+          m_storage->store(m_plan_info, plan_data);
           onChange(m_plan_info.change_time, m_plan_info.change_sid, m_plan_info.change_sname);
+          updated = m_index.set(m_plan_info);
         }
         catch (std::runtime_error& e)
         {
+          abortBatch(e.what());
           onFailure(e.what());
-          m_db->rollback();
+          return;
         }
 
-        m_db->commit();
-
         m_reply.arg.set(m_plan_info);
-        onSuccess(count ? DTR("OK (updated)") : DTR("OK (new entry)"));
+        onSuccess(updated ? DTR("OK (updated)") : DTR("OK (new entry)"));
       }
 
       void
@@ -407,30 +420,29 @@ namespace Plan
           return;
         }
 
+        if (m_index.find(req.plan_id) == NULL)
+        {
+          onFailure(DTR("undefined plan"));
+          return;
+        }
+
         inProgress();
-        m_db->beginTransaction();
 
-        int count = 0;
         try
         {
-          *m_delete_plan_stmt << req.plan_id;
-          m_delete_plan_stmt->execute(&count);
-          if (count)
-            onChange(req);
+          beginBatch();
+          m_storage->remove(req.plan_id);
+          onChange(req);
+          m_index.remove(req.plan_id);
         }
         catch (std::runtime_error& e)
         {
+          abortBatch(e.what());
           onFailure(e.what());
-          m_db->rollback();
           return;
         }
 
-        m_db->commit();
-
-        if (!count)
-          onFailure(DTR("undefined plan"));
-        else
-          onSuccess();
+        onSuccess();
       }
 
       void
@@ -442,26 +454,18 @@ namespace Plan
           return;
         }
 
-        *m_get_plan_stmt << req.plan_id;
-
-        bool found = m_get_plan_stmt->execute();
-
-        if (!found)
+        Database::Blob data;
+        if (m_index.find(req.plan_id) == NULL || !m_storage->get(req.plan_id, data))
         {
           onFailure(DTR("undefined plan"));
+          return;
         }
-        else
-        {
-          Database::Blob data;
-          *m_get_plan_stmt >> data;
 
-          IMC::PlanSpecification spec;
-          spec.deserializeFields((const uint8_t*)&data[0], data.size());
-          m_reply.arg.set(&spec);
+        IMC::PlanSpecification spec;
+        spec.deserializeFields((const uint8_t*)&data[0], data.size());
+        m_reply.arg.set(&spec);
 
-          onSuccess();
-        }
-        m_get_plan_stmt->reset();
+        onSuccess();
       }
 
       void
@@ -473,26 +477,14 @@ namespace Plan
           return;
         }
 
-        *m_query_plan_stmt << req.plan_id;
-
-        bool found = m_query_plan_stmt->execute();
-
-        if (!found)
+        const IMC::PlanDBInformation* info = m_index.find(req.plan_id);
+        if (info == NULL)
         {
           onFailure(DTR("undefined plan"));
           return;
         }
 
-        m_plan_info.plan_id = req.plan_id;
-        *m_query_plan_stmt >> m_plan_info.change_time
-                           >> m_plan_info.change_sid
-                           >> m_plan_info.change_sname
-                           >> m_plan_info.md5
-                           >> m_plan_info.plan_size;
-
-        m_reply.arg.set(m_plan_info);
-        m_query_plan_stmt->reset();
-
+        m_reply.arg.set(*info);
         onSuccess();
       }
 
@@ -500,21 +492,21 @@ namespace Plan
       clearDatabase(const IMC::PlanDB& req)
       {
         inProgress();
-        m_db->beginTransaction();
 
         try
         {
-          m_delete_all_plans_stmt->execute();
+          beginBatch();
+          m_storage->clear();
           onChange(req);
+          m_index.clear();
         }
         catch (std::runtime_error& e)
         {
+          abortBatch(e.what());
           onFailure(e.what());
-          m_db->rollback();
           return;
         }
 
-        m_db->commit();
         onSuccess();
       }
 
@@ -522,50 +514,14 @@ namespace Plan
       getDatabaseState(const IMC::PlanDB& req)
       {
         (void)req;
-        IMC::PlanDBState* state = new IMC::PlanDBState;
-
-        state->plan_size = 0;
-        state->plan_count = 0;
-
-        MD5 md5sum;
-
-        IMC::MessageList<PlanDBInformation>* plandbinfo = &state->plans_info;
-
-        while (m_plan_iterator_stmt->execute())
-        {
-          IMC::PlanDBInformation* pinfo = new IMC::PlanDBInformation;
-
-          *m_plan_iterator_stmt >> pinfo->plan_id
-                                >> pinfo->change_time
-                                >> pinfo->change_sid
-                                >> pinfo->change_sname
-                                >> pinfo->md5
-                                >> pinfo->plan_size;
-
-          md5sum.update((const uint8_t*)&pinfo->md5[0], 16); // the MD5 of all MD5s ordered by plan_id
-          state->plan_size += pinfo->plan_size;
-          state->plan_count++;
 
-          plandbinfo->push_back(*pinfo);
+        // Changes of the open transaction are not reported until
+        // they are committed.
+        IMC::PlanDBState state;
+        m_index.fill(state);
 
-          delete pinfo;
-        }
-        m_plan_iterator_stmt->reset();
-
-        // Finalized MD5 digest
-        state->md5.resize(16);
-        md5sum.finalize((uint8_t*)&state->md5[0]);
-
-        m_lastchange_query_stmt->execute();
-        *m_lastchange_query_stmt >> state->change_time
-                                 >> state->change_sid
-                                 >> state->change_sname;
-        m_lastchange_query_stmt->reset();
-
-        m_reply.arg.set(*state);
+        m_reply.arg.set(state);
         onSuccess();
-
-        delete state;
       }
 
       void
@@ -573,23 +529,34 @@ namespace Plan
       {
         m_reply.type = type;
         m_reply.info = desc;
-        dispatch(m_reply);
 
-        switch (m_reply.op)
+        // Changes are only reported once they are committed.
+        if (type == IMC::PlanDB::DBT_SUCCESS && m_batch)
+          m_pending.push_back(m_reply);
+        else
+          send(m_reply);
+      }
+
+      void
+      send(IMC::PlanDB& reply)
+      {
+        dispatch(reply);
+
+        switch (reply.op)
         {
           case IMC::PlanDB::DBOP_SET:
           case IMC::PlanDB::DBOP_DEL:
           case IMC::PlanDB::DBOP_CLEAR:
             {
-              if (type == IMC::PlanDB::DBT_FAILURE)
-                err("%s (%s) -- %s", DTR(c_op_desc[m_reply.op]),
-                    m_reply.plan_id.c_str(), desc);
-              else if (type == IMC::PlanDB::DBT_SUCCESS)
-                inf("%s (%s) -- %s", DTR(c_op_desc[m_reply.op]),
-                    m_reply.plan_id.c_str(), desc);
+              if (reply.type == IMC::PlanDB::DBT_FAILURE)
+                err("%s (%s) -- %s", DTR(c_op_desc[reply.op]),
+                    reply.plan_id.c_str(), reply.info.c_str());
+              else if (reply.type == IMC::PlanDB::DBT_SUCCESS)
+                inf("%s (%s) -- %s", DTR(c_op_desc[reply.op]),
+                    reply.plan_id.c_str(), reply.info.c_str());
               else
-                debug("%s (%s) -- %s", DTR(c_op_desc[m_reply.op]),
-                      m_reply.plan_id.c_str(), desc);
+                debug("%s (%s) -- %s", DTR(c_op_desc[reply.op]),
+                      reply.plan_id.c_str(), reply.info.c_str());
             }
         }
       }
@@ -618,7 +585,10 @@ namespace Plan
         while (!stopping())
         {
           waitForMessages(1.0);
+          commitBatch();
         }
+
+        commitBatch();
       }
     };
   }
@@ -0,0 +1,256 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <set>
+
+// DUNE headers.
+#include <DUNE/I18N.hpp>
+
+// Local headers.
+#include "Analysis.hpp"
+#include "Statistics.hpp"
+#include "Timeline.hpp"
+
+namespace Plan
+{
+  namespace Engine
+  {
+    Analysis::Analysis(Tasks::Task* task, Parsers::Config* cfg, unsigned capacity):
+      m_task(task),
+      m_speed_model(NULL),
+      m_capacity(capacity)
+    {
+      try
+      {
+        m_speed_model = new Plans::SpeedModel(cfg);
+        m_speed_model->validate();
+      }
+      catch (...)
+      {
+        Memory::clear(m_speed_model);
+        m_task->inf(DTR("analysis: speed model invalid"));
+      }
+    }
+
+    Analysis::~Analysis(void)
+    {
+      while (!m_queue.empty())
+        delete m_queue.pop();
+
+      Cache::iterator itr = m_cache.begin();
+      for (; itr != m_cache.end(); ++itr)
+        delete itr->second.profiles;
+
+      Memory::clear(m_speed_model);
+    }
+
+    std::string
+    Analysis::digest(const IMC::PlanSpecification& spec)
+    {
+      std::vector<uint8_t> data(spec.getPayloadSerializationSize());
+      if (!data.empty())
+        spec.serializeFields(&data[0]);
+
+      uint8_t md5[16];
+      MD5::compute(data.empty() ? NULL : &data[0], data.size(), md5);
+      return std::string((char*)md5, sizeof(md5));
+    }
+
+    void
+    Analysis::submit(const IMC::PlanSpecification& spec)
+    {
+      m_queue.push(new IMC::PlanSpecification(spec));
+    }
+
+    bool
+    Analysis::apply(const std::string& md5, const std::vector<IMC::PlanManeuver*>& nodes,
+                    const IMC::EstimatedState* state, Plans::TimeProfile& profiles)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+
+      Entry* entry = lookup(md5);
+      if (entry == NULL)
+        return false;
+
+      return profiles.parse(nodes, state, *entry->profiles);
+    }
+
+    void
+    Analysis::analyse(const IMC::PlanSpecification& spec)
+    {
+      std::string md5 = digest(spec);
+
+      {
+        Concurrency::ScopedMutex l(m_mutex);
+        if (lookup(md5) != NULL)
+          return;
+      }
+
+      std::vector<IMC::PlanManeuver*> nodes;
+      if (!sequence(spec, nodes))
+      {
+        m_task->debug("analysis: %s: not linear", spec.plan_id.c_str());
+        return;
+      }
+
+      // Parse from the first maneuver, the engine replaces the first
+      // leg with the one from the actual vehicle position.
+      IMC::EstimatedState state;
+      if (!Plans::TimeProfile::getAnchor(nodes.front()->data.get(), state.lat, state.lon))
+      {
+        m_task->debug("analysis: %s: first maneuver depends on start position",
+                      spec.plan_id.c_str());
+        return;
+      }
+
+      Plans::TimeProfile* profiles = new Plans::TimeProfile(m_speed_model);
+      profiles->parse(nodes, &state);
+
+      if (!profiles->size())
+      {
+        delete profiles;
+        return;
+      }
+
+      IMC::PlanStatistics ps;
+      ps.plan_id = spec.plan_id;
+      PreStatistics pre_stat(&ps);
+
+      Timeline tline;
+      tline.fill(nodes, *profiles);
+      tline.setPlanETA(tline.getExecutionDuration());
+
+      pre_stat.fill(nodes, tline);
+      pre_stat.fill(nodes, *profiles, m_speed_model);
+
+      if (!profiles->isDurationFinite())
+        pre_stat.setProperties(IMC::PlanStatistics::PRP_INFINITE);
+
+      {
+        Concurrency::ScopedMutex l(m_mutex);
+
+        m_usage.push_front(md5);
+        Entry& entry = m_cache[md5];
+        entry.profiles = profiles;
+        entry.usage = m_usage.begin();
+
+        while (m_usage.size() > m_capacity)
+        {
+          Cache::iterator itr = m_cache.find(m_usage.back());
+          delete itr->second.profiles;
+          m_cache.erase(itr);
+          m_usage.pop_back();
+        }
+      }
+
+      m_task->debug("analysis: %s: cached", spec.plan_id.c_str());
+      m_task->dispatch(ps);
+    }
+
+    bool
+    Analysis::sequence(const IMC::PlanSpecification& spec, std::vector<IMC::PlanManeuver*>& nodes)
+    {
+      std::map<std::string, IMC::PlanManeuver*> maneuvers;
+
+      IMC::MessageList<IMC::PlanManeuver>::const_iterator mitr = spec.maneuvers.begin();
+      for (; mitr != spec.maneuvers.end(); ++mitr)
+      {
+        if (*mitr == NULL)
+          continue;
+
+        if ((*mitr)->data.isNull())
+          return false;
+
+        maneuvers[(*mitr)->maneuver_id] = *mitr;
+      }
+
+      std::set<std::string> visited;
+      std::string maneuver_id = spec.start_man_id;
+
+      while (true)
+      {
+        std::map<std::string, IMC::PlanManeuver*>::iterator itr = maneuvers.find(maneuver_id);
+        if (itr == maneuvers.end())
+          return false;
+
+        // Cyclical plan.
+        if (!visited.insert(maneuver_id).second)
+          return false;
+
+        nodes.push_back(itr->second);
+
+        // Follow the first transition, as the engine does.
+        IMC::MessageList<IMC::PlanTransition>::const_iterator titr = spec.transitions.begin();
+        for (; titr != spec.transitions.end(); ++titr)
+        {
+          if (*titr != NULL && (*titr)->source_man == maneuver_id)
+            break;
+        }
+
+        if (titr == spec.transitions.end() || (*titr)->dest_man == "_done_")
+          return true;
+
+        maneuver_id = (*titr)->dest_man;
+      }
+    }
+
+    Analysis::Entry*
+    Analysis::lookup(const std::string& md5)
+    {
+      Cache::iterator itr = m_cache.find(md5);
+      if (itr == m_cache.end())
+        return NULL;
+
+      m_usage.splice(m_usage.begin(), m_usage, itr->second.usage);
+      return &itr->second;
+    }
+
+    void
+    Analysis::run(void)
+    {
+      while (!isStopping())
+      {
+        if (!m_queue.waitForItems(1.0))
+          continue;
+
+        IMC::PlanSpecification* spec = m_queue.pop();
+
+        try
+        {
+          analyse(*spec);
+        }
+        catch (std::exception& e)
+        {
+          m_task->debug("analysis: %s: %s", spec->plan_id.c_str(), e.what());
+        }
+
+        delete spec;
+      }
+    }
+  }
+}
@@ -0,0 +1,145 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef PLAN_ENGINE_ANALYSIS_HPP_INCLUDED_
+#define PLAN_ENGINE_ANALYSIS_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Plan
+{
+  namespace Engine
+  {
+    using DUNE_NAMESPACES;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Analysis;
+
+    //! Background analysis of stored plans. Time profiles of linear
+    //! plans are computed on a separate thread, cached by the MD5 of
+    //! the plan specification (as computed by Plan::DB) and reused
+    //! when the plan is started. Durations and distances are
+    //! dispatched in a PlanStatistics message for consoles.
+    class Analysis: public Concurrency::Thread
+    {
+    public:
+      //! Constructor.
+      //! @param[in] task parent task.
+      //! @param[in] cfg configuration for the speed model.
+      //! @param[in] capacity maximum number of cached plans.
+      Analysis(Tasks::Task* task, Parsers::Config* cfg, unsigned capacity);
+
+      //! Destructor.
+      ~Analysis(void);
+
+      //! Compute the digest of a plan specification.
+      //! @param[in] spec plan specification.
+      //! @return MD5 of the serialized plan.
+      static std::string
+      digest(const IMC::PlanSpecification& spec);
+
+      //! Queue a plan for analysis.
+      //! @param[in] spec plan specification.
+      void
+      submit(const IMC::PlanSpecification& spec);
+
+      //! Fill in the time profile of a plan from the cache.
+      //! @param[in] md5 digest of the plan specification.
+      //! @param[in] nodes vector of sequenced plan maneuver nodes.
+      //! @param[in] state current estimated state.
+      //! @param[out] profiles time profile to fill in.
+      //! @return true if the plan was found in the cache, false otherwise.
+      bool
+      apply(const std::string& md5, const std::vector<IMC::PlanManeuver*>& nodes,
+            const IMC::EstimatedState* state, Plans::TimeProfile& profiles);
+
+    private:
+      //! Cached plan.
+      struct Entry
+      {
+        //! Time profile parsed from the first maneuver.
+        Plans::TimeProfile* profiles;
+        //! Position in the usage list.
+        std::list<std::string>::iterator usage;
+      };
+
+      //! Map of digests to cached plans.
+      typedef std::map<std::string, Entry> Cache;
+
+      //! Parent task.
+      Tasks::Task* m_task;
+      //! Speed model used by the worker.
+      Plans::SpeedModel* m_speed_model;
+      //! Maximum number of cached plans.
+      unsigned m_capacity;
+      //! Plans waiting for analysis.
+      Concurrency::TSQueue<IMC::PlanSpecification*> m_queue;
+      //! Cached plans.
+      Cache m_cache;
+      //! Digests, most recently used first.
+      std::list<std::string> m_usage;
+      //! Protects the cache.
+      Concurrency::Mutex m_mutex;
+
+      //! Analyse a plan and add it to the cache.
+      //! @param[in] spec plan specification.
+      void
+      analyse(const IMC::PlanSpecification& spec);
+
+      //! Sequence the maneuvers of a linear plan.
+      //! @param[in] spec plan specification.
+      //! @param[out] nodes sequenced plan maneuver nodes.
+      //! @return true if the plan is linear, false otherwise.
+      static bool
+      sequence(const IMC::PlanSpecification& spec, std::vector<IMC::PlanManeuver*>& nodes);
+
+      //! Check if a plan is cached. Must be called with the lock held.
+      //! @param[in] md5 digest of the plan specification.
+      //! @return cached plan or NULL.
+      Entry*
+      lookup(const std::string& md5);
+
+      void
+      run(void);
+
+      // Non-copyable.
+      Analysis(const Analysis&);
+
+      Analysis&
+      operator=(const Analysis&);
+    };
+  }
+}
+
+#endif
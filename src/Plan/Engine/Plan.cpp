@@ -37,7 +37,8 @@ namespace Plan
   {
     Plan::Plan(const IMC::PlanSpecification* spec, bool compute_progress,
                bool fpredict, Tasks::Task* task,
-               uint16_t min_cal_time, Parsers::Config* cfg):
+               uint16_t min_cal_time, Parsers::Config* cfg,
+               Analysis* analysis):
       m_spec(spec),
       m_curr_node(NULL),
       m_compute_progress(compute_progress),
@@ -53,7 +54,8 @@ namespace Plan
       m_config(cfg),
       m_fpred(NULL),
       m_task(task),
-      m_properties(0)
+      m_properties(0),
+      m_analysis(analysis)
     {
       try
       {
@@ -458,10 +460,22 @@ namespace Plan
 
         if (isLinear() && state != NULL)
         {
-          m_profiles->parse(m_seq_nodes, state);
+          bool cached = false;
+
+          if (m_analysis != NULL)
+          {
+            cached = m_analysis->apply(Analysis::digest(*m_spec), m_seq_nodes,
+                                       state, *m_profiles);
+
+            if (!cached)
+              m_analysis->submit(*m_spec);
+          }
+
+          if (!cached)
+            m_profiles->parse(m_seq_nodes, state);
 
           Timeline tline;
-          fillTimeline(tline);
+          tline.fill(m_seq_nodes, *m_profiles);
 
           Memory::clear(m_sched);
           m_sched = new ActionSchedule(m_task, m_spec, m_seq_nodes,
@@ -476,6 +490,9 @@ namespace Plan
           // Update duration statistics
           pre_stat.fill(m_seq_nodes, tline);
 
+          // Update distance statistics
+          pre_stat.fill(m_seq_nodes, *m_profiles, m_speed_model);
+
           // Update action statistics
           pre_stat.fill(m_cat);
 
@@ -629,40 +646,5 @@ namespace Plan
 
       return m_progress;
     }
-
-    void
-    Plan::fillTimeline(Timeline& tl)
-    {
-      float execution_duration = getExecutionDuration();
-
-      std::vector<IMC::PlanManeuver*>::const_iterator itr;
-      itr = m_seq_nodes.begin();
-
-      // Maneuver's start and end ETA
-      float maneuver_start_eta = -1.0;
-      float maneuver_end_eta = -1.0;
-
-      // Iterate through plan maneuvers
-      for (; itr != m_seq_nodes.end(); ++itr)
-      {
-        if (itr == m_seq_nodes.begin())
-          maneuver_start_eta = execution_duration;
-        else
-          maneuver_start_eta = maneuver_end_eta;
-
-        TimeProfile::const_iterator dur;
-        dur = m_profiles->find((*itr)->maneuver_id);
-
-        if (dur == m_profiles->end())
-          maneuver_end_eta = -1.0;
-        else if (dur->second.durations.size())
-          maneuver_end_eta = execution_duration - dur->second.durations.back();
-        else
-          maneuver_end_eta = -1.0;
-
-        // Fill timeline
-        tl.setManeuverETA((*itr)->maneuver_id, maneuver_start_eta, maneuver_end_eta);
-      }
-    }
   }
 }
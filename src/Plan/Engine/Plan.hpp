@@ -35,6 +35,7 @@
 
 // DUNE headers.
 #include <DUNE/Plans.hpp>
+#include "Analysis.hpp"
 #include "Calibration.hpp"
 #include "ActionSchedule.hpp"
 #include "Timeline.hpp"
@@ -69,9 +70,11 @@ namespace Plan
       //! @param[in] task pointer to task
       //! @param[in] min_cal_time minimum calibration time in s.
       //! @param[in] cfg pointer to config object
+      //! @param[in] analysis pointer to background plan analysis, may be NULL
       Plan(const IMC::PlanSpecification* spec, bool compute_progress,
            bool fpredict, Tasks::Task* task,
-           uint16_t min_cal_time, Parsers::Config* cfg);
+           uint16_t min_cal_time, Parsers::Config* cfg,
+           Analysis* analysis = NULL);
 
       //! Destructor
       ~Plan(void);
@@ -265,11 +268,6 @@ namespace Plan
       float
       progress(const IMC::ManeuverControlState* mcs);
 
-      //! Fill in plan timeline
-      //! @param[out] tl plan timeline filled in
-      void
-      fillTimeline(Timeline& tl);
-
       //! Test if plan is linear
       inline bool
       isLinear(void) const
@@ -339,6 +337,8 @@ namespace Plan
       IMC::PlanStatistics m_post_stat;
       //! Pointer to Run Time Statistics
       RunTimeStatistics* m_rt_stat;
+      //! Pointer to background plan analysis
+      Analysis* m_analysis;
     };
   }
 }
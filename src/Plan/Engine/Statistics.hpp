@@ -29,12 +29,14 @@
 #define PLAN_ENGINE_STATISTICS_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <map>
 #include <cstring>
 #include <sstream>
 
 // DUNE headers
 #include <DUNE/IMC.hpp>
+#include <DUNE/Plans.hpp>
 #include <DUNE/Time.hpp>
 
 // Local headers
@@ -146,6 +148,55 @@ namespace Plan
         }
       }
 
+      //! Fill in distances travelled at each speed of the maneuvers
+      //! @param[in] nodes vector of sequenced PlanManeuver nodes
+      //! @param[in] profiles speed profiles of the maneuvers
+      //! @param[in] model speed model for speed conversions
+      void
+      fill(const std::vector<IMC::PlanManeuver*>& nodes,
+           const Plans::TimeProfile& profiles, const Plans::SpeedModel* model)
+      {
+        if (model == NULL || !profiles.size())
+        {
+          addTuple(m_ps->distances, DTR("Total"), c_invalid);
+          return;
+        }
+
+        float total = 0.0;
+        std::string maneuvers;
+
+        std::vector<IMC::PlanManeuver*>::const_iterator itr;
+        itr = nodes.begin();
+
+        for (; itr != nodes.end(); ++itr)
+        {
+          Plans::TimeProfile::const_iterator prof;
+          prof = profiles.find((*itr)->maneuver_id);
+
+          if (prof == profiles.end())
+          {
+            addTuple(maneuvers, DTR("Maneuver ") + (*itr)->maneuver_id, c_invalid);
+            continue;
+          }
+
+          float distance = 0.0;
+
+          std::vector<Plans::TimeProfile::SpeedProfile>::const_iterator sp;
+          sp = prof->second.speeds.begin();
+
+          for (; sp != prof->second.speeds.end(); ++sp)
+            distance += std::max(0.0f, model->toMPS(sp->speed, sp->speed_units)) * sp->time;
+
+          addTuple(maneuvers, DTR("Maneuver ") + (*itr)->maneuver_id, distance);
+          total += distance;
+        }
+
+        addTuple(m_ps->distances, DTR("Total"), total);
+
+        if (!maneuvers.empty())
+          m_ps->distances.append("," + maneuvers);
+      }
+
       //! Fill in actions
       //! @param[in] cat list of times that components are active
       void
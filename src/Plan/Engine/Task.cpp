@@ -85,12 +85,16 @@ namespace Plan
       std::string recovery_plan;
       //! Entity label of the plan generator.
       std::string label_gen;
+      //! Number of plans kept by the background analysis.
+      unsigned analysis_size;
     };
 
     struct Task: public DUNE::Tasks::Task
     {
       //! Pointer to Plan class
       Plan* m_plan;
+      //! Background plan analysis.
+      Analysis* m_analysis;
       //! Plan control interface
       IMC::PlanControlState m_pcs;
       IMC::PlanControl m_reply;
@@ -132,6 +136,7 @@ namespace Plan
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
         m_plan(NULL),
+        m_analysis(NULL),
         m_db(NULL),
         m_get_plan_stmt(NULL),
         m_imu_enabled(false)
@@ -184,6 +189,11 @@ namespace Plan
         .defaultValue("Plan Generator")
         .description("Entity label of the Plan Generator");
 
+        param("Analysis Cache Size", m_args.analysis_size)
+        .defaultValue("16")
+        .description("Number of stored plans whose analysis is computed in the"
+                     " background and kept for plan start. Zero to disable");
+
         m_ctx.config.get("General", "Recovery Plan", "dislodge", m_args.recovery_plan);
 
         bind<IMC::PlanControl>(this);
@@ -233,7 +243,8 @@ namespace Plan
           m_args.speriod = 1.0 / m_args.speriod;
 
         if ((m_plan != NULL) && (paramChanged(m_args.progress) ||
-                                 paramChanged(m_args.calibration_time)))
+                                 paramChanged(m_args.calibration_time) ||
+                                 paramChanged(m_args.analysis_size)))
           throw RestartNeeded(DTR("restarting to relaunch plan parser"), 0, false);
       }
 
@@ -241,13 +252,28 @@ namespace Plan
       onResourceRelease(void)
       {
         Memory::clear(m_plan);
+
+        if (m_analysis != NULL)
+        {
+          m_analysis->stopAndJoin();
+          delete m_analysis;
+          m_analysis = NULL;
+        }
       }
 
       void
       onResourceAcquisition(void)
       {
+        // Analysis is only useful when time profiles are computed.
+        if (m_args.progress && m_args.analysis_size > 0)
+        {
+          m_analysis = new Analysis(this, &m_ctx.config, m_args.analysis_size);
+          m_analysis->start();
+        }
+
         m_plan = new Plan(&m_spec, m_args.progress, m_args.fpredict,
-                          this, m_args.calibration_time, &m_ctx.config);
+                          this, m_args.calibration_time, &m_ctx.config,
+                          m_analysis);
       }
 
       void
@@ -309,6 +335,17 @@ namespace Plan
       void
       consume(const IMC::PlanDB* pdb)
       {
+        // Analyse plans as they are stored.
+        if (pdb->op == IMC::PlanDB::DBOP_SET && pdb->type == IMC::PlanDB::DBT_REQUEST)
+        {
+          const IMC::PlanSpecification* spec = 0;
+
+          if (m_analysis != NULL && pdb->arg.get(spec))
+            m_analysis->submit(*spec);
+
+          return;
+        }
+
         if (pdb->op != IMC::PlanDB::DBOP_BOOT || pdb->type != IMC::PlanDB::DBT_SUCCESS)
           return;
 
@@ -32,9 +32,12 @@
 #include <string>
 #include <map>
 #include <cmath>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/IMC.hpp>
+#include <DUNE/Plans/TimeProfile.hpp>
 
 namespace Plan
 {
@@ -107,6 +110,51 @@ namespace Plan
         m_list.insert(ETAPair(id, eta));
       }
 
+      //! Set the ETAs of a linear sequence of maneuvers
+      //! @param[in] nodes vector of sequenced PlanManeuver nodes
+      //! @param[in] profiles durations of the maneuvers
+      void
+      fill(const std::vector<IMC::PlanManeuver*>& nodes, const Plans::TimeProfile& profiles)
+      {
+        float execution_duration = -1.0;
+
+        if (!profiles.lastValid().empty())
+        {
+          Plans::TimeProfile::const_iterator last = profiles.find(profiles.lastValid());
+          if (last != profiles.end())
+            execution_duration = last->second.durations.back();
+        }
+
+        std::vector<IMC::PlanManeuver*>::const_iterator itr;
+        itr = nodes.begin();
+
+        // Maneuver's start and end ETA
+        float maneuver_start_eta = -1.0;
+        float maneuver_end_eta = -1.0;
+
+        // Iterate through plan maneuvers
+        for (; itr != nodes.end(); ++itr)
+        {
+          if (itr == nodes.begin())
+            maneuver_start_eta = execution_duration;
+          else
+            maneuver_start_eta = maneuver_end_eta;
+
+          Plans::TimeProfile::const_iterator dur;
+          dur = profiles.find((*itr)->maneuver_id);
+
+          if (dur == profiles.end())
+            maneuver_end_eta = -1.0;
+          else if (dur->second.durations.size())
+            maneuver_end_eta = execution_duration - dur->second.durations.back();
+          else
+            maneuver_end_eta = -1.0;
+
+          // Fill timeline
+          setManeuverETA((*itr)->maneuver_id, maneuver_start_eta, maneuver_end_eta);
+        }
+      }
+
       //! Get maneuver's start ETA
       //! @param[in] id maneuver id
       //! @return maneuver's ETA, returns -1.0 if cannot find maneuver
@@ -28,7 +28,6 @@
 #define SENSORS_DEEPVISION_OSM2_PARSER_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
-#include <fstream>
 #include <string>
 
 // Local headers.
@@ -43,6 +42,9 @@ namespace Sensors
   {
     using DUNE_NAMESPACES;
 
+    //! Period between log statistics reports (s).
+    static const double c_log_report_period = 10.0;
+
     //! Parser class to DeepVision's OEM Sonar Module OSM2.
     //!
     //! This class parses the data packets arriving from the sonar
@@ -93,7 +95,10 @@ namespace Sensors
         m_size(0),
         m_csum(0),
         m_imc(false),
-        m_has_hdr(false)
+        m_has_hdr(false),
+        m_log_timer(c_log_report_period),
+        m_log_dropped(0),
+        m_log_error(0)
       {
         m_frame = new Frame();
         m_ping.type = DUNE::IMC::SonarData::ST_SIDESCAN;
@@ -201,15 +206,12 @@ namespace Sensors
           case (ST_SONAR_CSUM):
             if (m_csum == byte)
             {
-              if (!m_imc && !m_log_file.is_open())
-                m_log_file.open(m_log_filename.c_str(), std::ofstream::app | std::ios::binary);
+              if (!m_imc && !m_log_file.isOpen() && !m_log_filename.empty())
+                m_log_file.open(m_log_filename);
 
               // header is missing from file.
               if (!m_imc && !m_has_hdr)
-              {
-                m_has_hdr = true;
-                m_log_file.write((const char*)m_frame->getHeader(), m_frame->getHeaderSize());
-              }
+                m_has_hdr = m_log_file.write(m_frame->getHeader(), m_frame->getHeaderSize());
 
               // write position and data.
               if (m_imc)
@@ -226,9 +228,16 @@ namespace Sensors
               }
               else
               {
-                m_log_file.write((const char*)m_frame->getPosition(), m_frame->getPositionSize());
-                m_log_file.write((const char*)m_frame->getPortData(), m_frame->getPortSize());
-                m_log_file.write((const char*)m_frame->getStarboardData(), m_frame->getStarboardSize());
+                const void* data[] = {m_frame->getPosition(),
+                                      m_frame->getPortData(),
+                                      m_frame->getStarboardData()};
+                size_t sizes[] = {m_frame->getPositionSize(),
+                                  m_frame->getPortSize(),
+                                  m_frame->getStarboardSize()};
+                m_log_file.write(data, sizes, 3);
+
+                if (m_log_timer.overflow())
+                  reportLog();
               }
             }
 
@@ -298,12 +307,10 @@ namespace Sensors
         if (m_imc)
           return;
 
-        if (m_log_file.is_open())
+        if (m_log_file.isOpen())
         {
-          m_log_file.close();
-
-          if (m_log_filename.size() == 0)
-            m_log_filename.remove();
+          m_log_file.close(true);
+          reportLog();
         }
 
         // reset path and frame.
@@ -341,6 +348,31 @@ namespace Sensors
       }
 
     private:
+      //! Report log data dropped or storage errors since the last
+      //! report.
+      void
+      reportLog(void)
+      {
+        m_log_timer.reset();
+
+        Hardware::Recorder::Statistics stats = m_log_file.getStatistics();
+        if (stats.dropped != m_log_dropped)
+        {
+          m_task->war(DTR("log: dropped %llu bytes (%llu pending)"),
+                      (unsigned long long)(stats.dropped - m_log_dropped),
+                      (unsigned long long)stats.backlog);
+          m_log_dropped = stats.dropped;
+        }
+
+        if (stats.error != m_log_error)
+        {
+          if (stats.error != 0)
+            m_task->err(DTR("failed to write log file: %s"),
+                        System::Error::getMessage(stats.error).c_str());
+          m_log_error = stats.error;
+        }
+      }
+
       // Change log file while in the same directory.
       void
       changeLog(void)
@@ -348,7 +380,7 @@ namespace Sensors
         if (m_imc)
           return;
 
-        if (!m_log_file.is_open())
+        if (!m_log_file.isOpen())
           return;
 
         FileSystem::Path dir = m_log_path;
@@ -375,13 +407,19 @@ namespace Sensors
       //! Sonar data file.
       IMC::SonarData m_ping;
       //! Log file.
-      std::ofstream m_log_file;
+      Hardware::Recorder m_log_file;
       //! Header inserted.
       bool m_has_hdr;
       //! Log path.
       FileSystem::Path m_log_path;
       //! Log filename
       FileSystem::Path m_log_filename;
+      //! Log statistics report timer.
+      Time::Counter<double> m_log_timer;
+      //! Log bytes dropped at last report.
+      uint64_t m_log_dropped;
+      //! Log storage error at last report.
+      int m_log_error;
     };
   }
 }
@@ -34,9 +34,6 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
-// Local headers.
-#include "EstimatedStateList.hpp"
-
 namespace Sensors
 {
   namespace Edgetech2205
@@ -82,8 +79,6 @@ namespace Sensors
       int32_t altitude;
       //! Depth.
       int32_t depth;
-      //! Estimated state list.
-      EstimatedStateList estates;
       //! True if subsystem is active.
       bool active;
 
@@ -95,7 +90,6 @@ namespace Sensors
       void
       clear(void)
       {
-        estates.clear();
         ping_number = 0;
         ping_count = 0;
         msec_cpu = 0;
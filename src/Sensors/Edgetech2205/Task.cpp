@@ -36,7 +36,6 @@
 #include "Parser.hpp"
 #include "CommandLink.hpp"
 #include "SubsystemData.hpp"
-#include "Log.hpp"
 
 namespace Sensors
 {
@@ -44,6 +43,9 @@ namespace Sensors
   {
     using DUNE_NAMESPACES;
 
+    //! Period between log statistics reports (s).
+    static const double c_log_report_period = 10.0;
+
     //! Finite state machine states.
     enum StateMachineStates
     {
@@ -118,6 +120,12 @@ namespace Sensors
     {
       //! Buffer size.
       static const unsigned c_buffer_size = 256 * 1024;
+      //! Number of navigation states kept for georeferencing.
+      static const unsigned c_estates_size = 512;
+      //! Number of log buffers.
+      static const unsigned c_log_buffer_count = 40;
+      //! Size of each log buffer.
+      static const unsigned c_log_buffer_size = 64 * 1024;
       //! Data socket.
       TCPSocket* m_sock_dat;
       //! Read buffer.
@@ -126,14 +134,20 @@ namespace Sensors
       Parser m_parser;
       //! Command link.
       CommandLink* m_cmd;
-      //! Log file.
-      Log* m_log;
+      //! Raw data recorder.
+      Hardware::Recorder m_log;
       //! Watchdog timer.
       Counter<double> m_wdog;
       //! Timer for time delta estimation.
       Counter<double> m_time_delta_timer;
+      //! Log statistics report timer.
+      Counter<double> m_log_timer;
+      //! Log bytes dropped at last report.
+      uint64_t m_log_dropped;
       //! Subsystem specific data.
       SubsystemData m_subsys_data[c_subsys_count];
+      //! Navigation history used to georeference pings.
+      Navigation::StateHistory m_estates;
       //! Current state machine state.
       StateMachineStates m_sm_state;
       //! State machine state queue.
@@ -141,7 +155,7 @@ namespace Sensors
       //! True if device is powered on.
       bool m_powered;
       //! Current packet being parsed.
-      Packet* m_packet;
+      Packet m_packet;
       //! Configuration parameters.
       Arguments m_args;
 
@@ -149,10 +163,12 @@ namespace Sensors
         Tasks::Task(name, ctx),
         m_sock_dat(NULL),
         m_cmd(NULL),
-        m_log(NULL),
+        m_log(c_log_buffer_count, c_log_buffer_size),
+        m_log_timer(c_log_report_period),
+        m_log_dropped(0),
+        m_estates(c_estates_size, Navigation::StateHistory::INTERP_SLERP),
         m_sm_state(SM_IDLE),
-        m_powered(false),
-        m_packet(NULL)
+        m_powered(false)
       {
         // Define configuration parameters.
         setParamSectionEditor("Edgetech2205");
@@ -416,6 +432,7 @@ namespace Sensors
 
         for (size_t i = 0; i < c_subsys_count; ++i)
           m_subsys_data[i].clear();
+        m_estates.clear();
 
         debug("creating data socket");
         m_sock_dat = new TCPSocket;
@@ -464,11 +481,7 @@ namespace Sensors
         if (!isActive())
           return;
 
-        for (size_t i = 0; i < c_subsys_count; ++i)
-        {
-          if (m_subsys_data[i].active)
-            m_subsys_data[i].estates.push_back(*msg);
-        }
+        m_estates.push(*msg);
       }
 
       void
@@ -601,17 +614,17 @@ namespace Sensors
       void
       handleSonarData(void)
       {
-        if (m_log == NULL || m_packet == NULL)
+        if (!m_log.isOpen())
           return;
 
-        int subsys_idx = getSubsysIndex(m_packet->getSubsystemNumber());
+        int subsys_idx = getSubsysIndex(m_packet.getSubsystemNumber());
         if (subsys_idx < 0)
           return;
 
         SubsystemData* data = m_subsys_data + subsys_idx;
 
         uint32_t ping_number = 0;
-        m_packet->get(ping_number, SDATA_IDX_PING_NUMBER);
+        m_packet.get(ping_number, SDATA_IDX_PING_NUMBER);
         if (ping_number != data->ping_number)
         {
           data->ping_number = ping_number;
@@ -627,7 +640,7 @@ namespace Sensors
         else
         {
           dispatchDebugData(String::str("discarded initial sample %u:%u",
-                                        m_packet->getSubsystemNumber(),
+                                        m_packet.getSubsystemNumber(),
                                         data->ping_count));
         }
       }
@@ -635,37 +648,37 @@ namespace Sensors
       void
       writeSubsystemData(SubsystemData* data)
       {
-        m_packet->set(data->time_epoch, SDATA_IDX_TIME);
-        m_packet->set(data->time_msec_today, SDATA_IDX_MILLISECOND_TODAY);
-        m_packet->set<int16_t>(3, SDATA_IDX_CPU_TIME_BASIS);
-        m_packet->set<int16_t>(data->time_bdt.year, SDATA_IDX_CPU_YEAR);
-        m_packet->set<int16_t>(data->time_bdt.day_year, SDATA_IDX_CPU_DAY);
-        m_packet->set<int16_t>(data->time_bdt.hour, SDATA_IDX_CPU_HOUR);
-        m_packet->set<int16_t>(data->time_bdt.hour, SDATA_IDX_NMEA_HOUR);
-        m_packet->set<int16_t>(data->time_bdt.minutes, SDATA_IDX_CPU_MINUTES);
-        m_packet->set<int16_t>(data->time_bdt.minutes, SDATA_IDX_NMEA_MINUTES);
-        m_packet->set<int16_t>(data->time_bdt.seconds, SDATA_IDX_CPU_SECONDS);
-        m_packet->set<int16_t>(data->time_bdt.seconds, SDATA_IDX_NMEA_SECONDS);
-        m_packet->set<uint16_t>(2, SDATA_IDX_COORDINATE_UNITS);
-        m_packet->set(data->longitude, SDATA_IDX_LONGITUDE);
-        m_packet->set(data->latitude, SDATA_IDX_LATITUDE);
-        m_packet->set(data->course, SDATA_IDX_COURSE);
-        m_packet->set(data->speed, SDATA_IDX_SPEED);
-        m_packet->set(data->heading, SDATA_IDX_HEADING);
-        m_packet->set(data->roll, SDATA_IDX_ROLL);
-        m_packet->set(data->pitch, SDATA_IDX_PITCH);
-        m_packet->set(data->altitude, SDATA_IDX_ALTITUDE);
-        m_packet->set(data->depth, SDATA_IDX_DEPTH);
-        m_packet->set(data->validity, SDATA_IDX_VALIDITY);
+        m_packet.set(data->time_epoch, SDATA_IDX_TIME);
+        m_packet.set(data->time_msec_today, SDATA_IDX_MILLISECOND_TODAY);
+        m_packet.set<int16_t>(3, SDATA_IDX_CPU_TIME_BASIS);
+        m_packet.set<int16_t>(data->time_bdt.year, SDATA_IDX_CPU_YEAR);
+        m_packet.set<int16_t>(data->time_bdt.day_year, SDATA_IDX_CPU_DAY);
+        m_packet.set<int16_t>(data->time_bdt.hour, SDATA_IDX_CPU_HOUR);
+        m_packet.set<int16_t>(data->time_bdt.hour, SDATA_IDX_NMEA_HOUR);
+        m_packet.set<int16_t>(data->time_bdt.minutes, SDATA_IDX_CPU_MINUTES);
+        m_packet.set<int16_t>(data->time_bdt.minutes, SDATA_IDX_NMEA_MINUTES);
+        m_packet.set<int16_t>(data->time_bdt.seconds, SDATA_IDX_CPU_SECONDS);
+        m_packet.set<int16_t>(data->time_bdt.seconds, SDATA_IDX_NMEA_SECONDS);
+        m_packet.set<uint16_t>(2, SDATA_IDX_COORDINATE_UNITS);
+        m_packet.set(data->longitude, SDATA_IDX_LONGITUDE);
+        m_packet.set(data->latitude, SDATA_IDX_LATITUDE);
+        m_packet.set(data->course, SDATA_IDX_COURSE);
+        m_packet.set(data->speed, SDATA_IDX_SPEED);
+        m_packet.set(data->heading, SDATA_IDX_HEADING);
+        m_packet.set(data->roll, SDATA_IDX_ROLL);
+        m_packet.set(data->pitch, SDATA_IDX_PITCH);
+        m_packet.set(data->altitude, SDATA_IDX_ALTITUDE);
+        m_packet.set(data->depth, SDATA_IDX_DEPTH);
+        m_packet.set(data->validity, SDATA_IDX_VALIDITY);
 
         // Use user annotation string to save position with increased
         // resolution.
-        std::memcpy(m_packet->getMessageData()
+        std::memcpy(m_packet.getMessageData()
                     + SDATA_IDX_ANNOTATION_STRING,
                     &data->latitude_rad,
                     sizeof(data->latitude_rad));
 
-        std::memcpy(m_packet->getMessageData()
+        std::memcpy(m_packet.getMessageData()
                     + SDATA_IDX_ANNOTATION_STRING
                     + sizeof(data->latitude_rad),
                     &data->longitude_rad,
@@ -679,10 +692,10 @@ namespace Sensors
 
         // Adjust sidescan time.
         uint32_t ss_sec = 0;
-        m_packet->get(ss_sec, SDATA_IDX_TIME);
+        m_packet.get(ss_sec, SDATA_IDX_TIME);
 
         uint32_t ss_msec = 0;
-        m_packet->get(ss_msec, SDATA_IDX_MILLISECOND_TODAY);
+        m_packet.get(ss_msec, SDATA_IDX_MILLISECOND_TODAY);
 
         int64_t ss_time = ss_sec;
         ss_time *= 1000;
@@ -701,9 +714,13 @@ namespace Sensors
                                  + data->time_bdt.seconds) * 1000;
         data->time_msec_today += ss_time % 1000;
 
-        // Find closest estimated state.
-        int64_t estate_delta = 0;
-        const IMC::EstimatedState* estate = data->estates.find(ss_time, estate_delta);
+        // Interpolate estimated state.
+        double delta = 0;
+        IMC::EstimatedState state;
+        const IMC::EstimatedState* estate = NULL;
+        if (m_estates.get(ss_time / 1000.0, state, &delta))
+          estate = &state;
+        int64_t estate_delta = delta * 1000;
 
         // Trace.
         int msec_delta = 0;
@@ -713,12 +730,12 @@ namespace Sensors
           msec_delta = -(int)(old_msec_today - data->time_msec_today);
 
         int64_t msec_cpu_old = data->msec_cpu;
-        data->msec_cpu = m_packet->getTimeStamp();
+        data->msec_cpu = m_packet.getTimeStamp();
 
         dispatchDebugData(String::str("%u, %u, %u, %lld, %lld, %d, %u, %llu",
                                       data->ping_count,
                                       data->ping_number,
-                                      m_packet->getSubsystemNumber(),
+                                      m_packet.getSubsystemNumber(),
                                       estate_delta,
                                       data->msec_cpu - msec_cpu_old,
                                       msec_delta,
@@ -768,7 +785,7 @@ namespace Sensors
       void
       handlePacket(void)
       {
-        if (m_packet->getMessageType() == MSG_ID_SONAR_DATA)
+        if (m_packet.getMessageType() == MSG_ID_SONAR_DATA)
           handleSonarData();
       }
 
@@ -779,13 +796,13 @@ namespace Sensors
           return false;
 
         consumeMessages();
-        if (m_sock_dat == NULL || m_packet == NULL)
+        if (m_sock_dat == NULL || !m_log.isOpen())
           return false;
 
         size_t rv = m_sock_dat->read(&m_bfr[0], m_bfr.size());
         for (size_t i = 0; i < rv; ++i)
         {
-          if (m_parser.parse(m_bfr[i], m_packet))
+          if (m_parser.parse(m_bfr[i], &m_packet))
             handlePacket();
         }
 
@@ -829,41 +846,50 @@ namespace Sensors
         if (!isActive() && !isActivating())
           return;
 
-        if (m_log != NULL)
-        {
-          if (m_log->getPath() == path)
-            return;
-        }
+        if (m_log.isOpen() && m_log.getPath() == path)
+          return;
 
         closeLog();
 
-        m_log = new Log(this, path);
-        m_log->start();
-        m_packet = m_log->get();
+        m_log.open(path);
         debug("opened: %s", path.c_str());
       }
 
       void
       logPacket(void)
       {
-        if (m_log != NULL)
-        {
-          m_log->put(m_packet);
-          m_packet = m_log->get();
-        }
+        if (!m_log.write(m_packet.getData(), m_packet.getSize()))
+          debug("dropped packet");
       }
 
       void
       closeLog(void)
       {
-        if (m_log == NULL)
+        if (!m_log.isOpen())
           return;
 
-        m_log->stopAndJoin();
-        debug("closed: %s", m_log->getPath().c_str());
+        debug("closed: %s", m_log.getPath().c_str());
+        m_log.close();
+        reportLog();
+      }
 
-        Memory::clear(m_packet);
-        Memory::clear(m_log);
+      //! Report log data dropped since the last report.
+      void
+      reportLog(void)
+      {
+        m_log_timer.reset();
+
+        Hardware::Recorder::Statistics stats = m_log.getStatistics();
+        if (stats.dropped != m_log_dropped)
+        {
+          war(DTR("log: dropped %llu bytes (%llu pending)"),
+              (unsigned long long)(stats.dropped - m_log_dropped),
+              (unsigned long long)stats.backlog);
+          m_log_dropped = stats.dropped;
+        }
+
+        debug("log: %llu bytes written, %.0f B/s",
+              (unsigned long long)stats.written, stats.rate);
       }
 
       void
@@ -964,7 +990,7 @@ namespace Sensors
 
             // Wait for log name.
           case SM_ACT_LOG_WAIT:
-            if (m_log != NULL)
+            if (m_log.isOpen())
               queueState(SM_ACT_DONE);
             break;
 
@@ -984,6 +1010,12 @@ namespace Sensors
             }
 
             readData();
+
+            if (m_log_timer.overflow())
+              reportLog();
+
+            if (m_log.hasFailed())
+              setEntityState(IMC::EntityState::ESTA_ERROR, DTR("failed to write log file"));
             break;
 
             // Start deactivation procedure.
@@ -50,7 +50,8 @@ namespace Sensors
       //! @param[in] handle I/O handle.
       Reader(Tasks::Task* task, IO::Handle* handle):
         m_task(task),
-        m_handle(handle)
+        m_handle(handle),
+        m_line_time(0)
       {
         m_buffer.resize(c_read_buffer_size);
       }
@@ -64,13 +65,15 @@ namespace Sensors
       std::vector<char> m_buffer;
       //! Current line.
       std::string m_line;
+      //! Arrival time of the first byte of the current line.
+      double m_line_time;
 
       void
-      dispatch(IMC::Message& msg)
+      dispatch(IMC::Message& msg, unsigned flags = 0)
       {
         msg.setDestination(m_task->getSystemId());
         msg.setDestinationEntity(m_task->getEntityId());
-        m_task->dispatch(msg, DF_LOOP_BACK);
+        m_task->dispatch(msg, DF_LOOP_BACK | flags);
       }
 
       void
@@ -79,18 +82,23 @@ namespace Sensors
         if (!Poll::poll(*m_handle, 1.0))
           return;
 
-        size_t rv = m_handle->read(&m_buffer[0], m_buffer.size());
+        double tstamp = 0;
+        size_t rv = m_handle->read(&m_buffer[0], m_buffer.size(), tstamp);
         if (rv == 0)
           throw std::runtime_error(DTR("invalid read size"));
 
         for (size_t i = 0; i < rv; ++i)
         {
+          if (m_line.empty())
+            m_line_time = tstamp;
+
           m_line.push_back(m_buffer[i]);
           if (m_buffer[i] == c_line_term)
           {
             IMC::DevDataText line;
             line.value = m_line;
-            dispatch(line);
+            line.setTimeStamp(m_line_time);
+            dispatch(line, DF_KEEP_TIME);
             m_line.clear();
           }
         }
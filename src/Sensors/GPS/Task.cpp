@@ -72,6 +72,8 @@ namespace Sensors
       std::string uart_dev;
       //! Serial port baud rate.
       unsigned uart_baud;
+      //! Serial port low latency mode.
+      bool uart_low_latency;
       //! Order of sentences.
       std::vector<std::string> stn_order;
       //! Input timeout in seconds.
@@ -104,6 +106,8 @@ namespace Sensors
       bool m_has_euler;
       //! Last initialization line read.
       std::string m_init_line;
+      //! Arrival time of the sentence being processed.
+      double m_tstamp;
       //! Reader thread.
       Reader* m_reader;
 
@@ -112,6 +116,7 @@ namespace Sensors
         m_handle(NULL),
         m_has_agvel(false),
         m_has_euler(false),
+        m_tstamp(0),
         m_reader(NULL)
       {
         // Define configuration parameters.
@@ -123,6 +128,10 @@ namespace Sensors
         .defaultValue("4800")
         .description("Serial port baud rate");
 
+        param("Serial Port - Low Latency", m_args.uart_low_latency)
+        .defaultValue("false")
+        .description("Ask the serial port driver to deliver bytes as soon as they arrive");
+
         param("Input Timeout", m_args.inp_tout)
         .units(Units::Second)
         .defaultValue("4.0")
@@ -176,7 +185,7 @@ namespace Sensors
         try
         {
           if (!openSocket())
-            m_handle = new SerialPort(m_args.uart_dev, m_args.uart_baud);
+            openSerialPort();
 
           m_reader = new Reader(this, m_handle);
           m_reader->start();
@@ -187,6 +196,16 @@ namespace Sensors
         }
       }
 
+      void
+      openSerialPort(void)
+      {
+        SerialPort* uart = new SerialPort(m_args.uart_dev, m_args.uart_baud);
+        m_handle = uart;
+
+        if (m_args.uart_low_latency && !uart->setLowLatency(true))
+          war(DTR("serial port driver does not support low latency mode"));
+      }
+
       bool
       openSocket(void)
       {
@@ -198,6 +217,7 @@ namespace Sensors
 
         TCPSocket* sock = new TCPSocket;
         sock->connect(addr, port);
+        sock->enableTimestamps(true);
         m_handle = sock;
         return true;
       }
@@ -255,7 +275,10 @@ namespace Sensors
         if (getEntityState() == IMC::EntityState::ESTA_BOOT)
           m_init_line = msg->value;
         else
+        {
+          m_tstamp = msg->getTimeStamp();
           processSentence(msg->value);
+        }
       }
 
       void
@@ -442,7 +465,7 @@ namespace Sensors
         if (parts[0] == m_args.stn_order.front())
         {
           clearMessages();
-          m_fix.setTimeStamp();
+          m_fix.setTimeStamp(m_tstamp);
           m_euler.setTimeStamp(m_fix.getTimeStamp());
           m_agvel.setTimeStamp(m_fix.getTimeStamp());
         }
@@ -485,17 +508,17 @@ namespace Sensors
         if (parts[0] == m_args.stn_order.back())
         {
           m_wdog.reset();
-          dispatch(m_fix);
+          dispatch(m_fix, DF_KEEP_TIME);
 
           if (m_has_euler)
           {
-            dispatch(m_euler);
+            dispatch(m_euler, DF_KEEP_TIME);
             m_has_euler = false;
           }
 
           if (m_has_agvel)
           {
-            dispatch(m_agvel);
+            dispatch(m_agvel, DF_KEEP_TIME);
             m_has_agvel = false;
           }
 
@@ -72,6 +72,8 @@ namespace Sensors
       unsigned frequency;
       // Default range.
       unsigned range;
+      // Number of frame buffers.
+      unsigned frames;
     };
 
     // List of available ranges.
@@ -96,6 +98,8 @@ namespace Sensors
     static const int c_rdata_dat_size = 1000;
     // Return data footer size.
     static const int c_rdata_ftr_size = 1;
+    // Frame pool report period.
+    static const double c_pool_report_period = 10.0;
 
     struct Task: public Tasks::Periodic
     {
@@ -109,12 +113,24 @@ namespace Sensors
       uint8_t m_rdata_ftr[c_rdata_ftr_size];
       // Single sidescan ping.
       IMC::SonarData m_ping;
+      // Destination of ping data.
+      char* m_data;
+      // Pool of ping buffers.
+      Media::FramePool* m_pool;
+      // Number of skipped pings already reported.
+      unsigned m_pool_drops;
+      // Frame pool report timer.
+      Time::Counter<double> m_pool_timer;
       // Configuration parameters.
       Arguments m_args;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Periodic(name, ctx),
-        m_sock(NULL)
+        m_sock(NULL),
+        m_data(NULL),
+        m_pool(NULL),
+        m_pool_drops(0),
+        m_pool_timer(c_pool_report_period)
       {
         // Define configuration parameters.
         paramActive(Tasks::Parameter::SCOPE_MANEUVER,
@@ -161,6 +177,15 @@ namespace Sensors
         .valuesIf("Frequency", "770", "10, 20, 30, 40, 50")
         .description(DTR("Operating range"));
 
+        param("Frame Buffers", m_args.frames)
+        .defaultValue("0")
+        .maximumValue("64")
+        .description("Number of ping buffers shared with consumers by reference."
+                     " Pings are dispatched as SonarData copies if zero, otherwise"
+                     " at least two are needed and pings only reach consumers that"
+                     " accept frames (Transports.Logging, Transports.UDP and"
+                     " Transports.HTTP)");
+
         // Initialize switch data.
         std::memset(m_sdata, 0, sizeof(m_sdata));
         m_sdata[0] = 0xfe;
@@ -168,7 +193,6 @@ namespace Sensors
         m_sdata[26] = 0xfd;
 
         // Initialize return data.
-        m_ping.data.resize(c_rdata_dat_size * 2);
         m_ping.type = IMC::SonarData::ST_SIDESCAN;
         m_ping.bits_per_point = 8;
         m_ping.scale_factor = 1.0f;
@@ -187,6 +211,16 @@ namespace Sensors
 
         if (paramChanged(m_args.port) && m_sock != NULL)
           throw RestartNeeded(DTR("restarting to change TCP port"), 1);
+
+        // One buffer is always held by the last consumer.
+        if (m_args.frames == 1)
+        {
+          war(DTR("one frame buffer is not enough, using two"));
+          m_args.frames = 2;
+        }
+
+        if (paramChanged(m_args.frames) && m_sock != NULL)
+          throw RestartNeeded(DTR("restarting to change frame buffers"), 1);
       }
 
       void
@@ -194,12 +228,32 @@ namespace Sensors
       {
         m_sock = new TCPSocket();
         m_sock->setNoDelay(true);
+
+        if (m_args.frames > 0)
+        {
+          // Ping data is carried by the frame.
+          m_pool = new Media::FramePool(m_args.frames, c_rdata_dat_size * 2);
+          m_pool_drops = 0;
+          m_pool_timer.reset();
+          m_ping.data.clear();
+        }
+        else
+        {
+          m_ping.data.resize(c_rdata_dat_size * 2);
+          m_data = &m_ping.data[0];
+        }
       }
 
       void
       onResourceRelease(void)
       {
         Memory::clear(m_sock);
+
+        if (m_pool != NULL)
+        {
+          m_pool->close();
+          m_pool = NULL;
+        }
       }
 
       void
@@ -208,7 +262,18 @@ namespace Sensors
         try
         {
           m_sock->connect(m_args.addr, m_args.port);
-          pingBoth();
+
+          if (m_pool != NULL)
+          {
+            Media::Frame* frame = pingFrame();
+            if (frame != NULL)
+              frame->release();
+          }
+          else
+          {
+            pingBoth();
+          }
+
           setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_IDLE);
         }
         catch (std::runtime_error& e)
@@ -288,7 +353,7 @@ namespace Sensors
           throw std::runtime_error(DTR("failed to read header"));
 
         unsigned dat_idx = ((side == SIDE_STARBOARD) ? 1 : 0) * c_rdata_dat_size;
-        rv = m_sock->read(&m_ping.data[dat_idx], c_rdata_dat_size);
+        rv = m_sock->read(m_data + dat_idx, c_rdata_dat_size);
         if (rv != c_rdata_dat_size)
           throw std::runtime_error(DTR("failed to read data"));
 
@@ -301,9 +366,9 @@ namespace Sensors
         {
           for (unsigned i = 0; i < c_rdata_dat_size / 2; ++i)
           {
-            char tmp = m_ping.data[i];
-            m_ping.data[i] = m_ping.data[c_rdata_dat_size - 1 - i];
-            m_ping.data[c_rdata_dat_size - 1 - i] = tmp;
+            char tmp = m_data[i];
+            m_data[i] = m_data[c_rdata_dat_size - 1 - i];
+            m_data[c_rdata_dat_size - 1 - i] = tmp;
           }
         }
       }
@@ -316,6 +381,50 @@ namespace Sensors
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
+      //! Ping into a frame buffer.
+      //! @return frame holding the ping, owned by the caller, or NULL
+      //! if all frame buffers are in use.
+      Media::Frame*
+      pingFrame(void)
+      {
+        Media::Frame* frame = m_pool->acquire();
+        if (frame == NULL)
+          return NULL;
+
+        try
+        {
+          frame->setSize(c_rdata_dat_size * 2);
+          m_data = (char*)frame->getData();
+          pingBoth();
+        }
+        catch (...)
+        {
+          frame->release();
+          throw;
+        }
+
+        return frame;
+      }
+
+      //! Report pings skipped because all frame buffers were in use.
+      void
+      reportFramePool(void)
+      {
+        if (!m_pool_timer.overflow())
+          return;
+
+        m_pool_timer.reset();
+
+        unsigned drops = m_pool->getDrops();
+        if (drops != m_pool_drops)
+        {
+          war(DTR("skipped %u pings, all frame buffers in use"), drops - m_pool_drops);
+          m_pool_drops = drops;
+        }
+
+        debug("frame buffers in use: %u of %u at peak", m_pool->getPeakUsed(), m_pool->getCount());
+      }
+
       void
       task(void)
       {
@@ -324,8 +433,23 @@ namespace Sensors
 
         try
         {
-          pingBoth();
-          dispatch(m_ping);
+          if (m_pool != NULL)
+          {
+            Media::Frame* frame = pingFrame();
+            if (frame != NULL)
+            {
+              Media::FrameDescriptor desc(m_ping, frame);
+              frame->release();
+              dispatch(desc);
+            }
+
+            reportFramePool();
+          }
+          else
+          {
+            pingBoth();
+            dispatch(m_ping);
+          }
         }
         catch (std::exception& e)
         {
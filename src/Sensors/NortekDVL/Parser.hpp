@@ -51,6 +51,8 @@ namespace Sensors
     static const float c_ang_scale = 0.01f;
     //! Current profile cell size and blanking scale.
     static const float c_m_to_mm = 1000.0f;
+    //! Period between log statistics reports (s).
+    static const double c_log_report_period = 10.0;
 
     //! Parser class to interpret Nortek DVL's incoming data.
     class Parser
@@ -75,7 +77,10 @@ namespace Sensors
         m_checksum(0),
         m_status(0),
         m_water(false),
-        m_type(RT_NONE)
+        m_type(RT_NONE),
+        m_log_timer(c_log_report_period),
+        m_log_dropped(0),
+        m_log_error(0)
       {
         m_filter = new BeamFilter(m_task, c_beam_count, c_beam_width, c_beam_offset,
                                   c_beam_angle, pos, ang, BeamFilter::STANDARD);
@@ -146,17 +151,40 @@ namespace Sensors
       void
       closeLog(void)
       {
-        if (m_log_file.is_open())
+        if (m_log_file.isOpen())
         {
-          m_log_file.close();
-
-          if (m_log_path.size() == 0)
-            m_log_path.remove();
+          m_log_file.close(true);
+          reportLog();
         }
 
         m_log_path.clear();
       }
 
+      //! Report log data dropped or storage errors since the last
+      //! report.
+      void
+      reportLog(void)
+      {
+        m_log_timer.reset();
+
+        Hardware::Recorder::Statistics stats = m_log_file.getStatistics();
+        if (stats.dropped != m_log_dropped)
+        {
+          m_task->war(DTR("log: dropped %llu bytes (%llu pending)"),
+                      (unsigned long long)(stats.dropped - m_log_dropped),
+                      (unsigned long long)stats.backlog);
+          m_log_dropped = stats.dropped;
+        }
+
+        if (stats.error != m_log_error)
+        {
+          if (stats.error != 0)
+            m_task->err(DTR("failed to write log file: %s"),
+                        System::Error::getMessage(stats.error).c_str());
+          m_log_error = stats.error;
+        }
+      }
+
     private:
       //! Parse one byte of data.
       //! @param[in] byte data byte.
@@ -325,10 +353,13 @@ namespace Sensors
       void
       decodeCurrentProfile(void)
       {
-        if (!m_log_file.is_open())
-          m_log_file.open(m_log_path.c_str(), std::ofstream::app | std::ios::binary);
+        if (!m_log_file.isOpen() && !m_log_path.empty())
+          m_log_file.open(m_log_path);
+
+        m_log_file.write(&m_bfr[c_hdr_size], m_data_size);
+        if (m_log_timer.overflow())
+          reportLog();
 
-        m_log_file.write((const char*)&m_bfr[c_hdr_size], m_data_size);
         m_task->spew("parsed current profile data");
       }
 
@@ -619,9 +650,15 @@ namespace Sensors
       //! Return data type.
       ReturnType m_type;
       //! Log file.
-      std::ofstream m_log_file;
+      Hardware::Recorder m_log_file;
       //! Log path.
       FileSystem::Path m_log_path;
+      //! Log statistics report timer.
+      Time::Counter<double> m_log_timer;
+      //! Log bytes dropped at last report.
+      uint64_t m_log_dropped;
+      //! Log storage error at last report.
+      int m_log_error;
     };
   }
 }
@@ -31,6 +31,7 @@
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
+#include <DUNE/Simulation/Bathymetry.hpp>
 
 // Local headers.
 #include "QuadTree.hpp"
@@ -133,6 +134,8 @@ namespace Simulators
       // Bottom distance arguments
       //! Location.
       std::string location;
+      //! Gridded bathymetry file.
+      std::string grid;
       //! Fixed value for the tide level
       float tide;
       //! Standard deviation of bottom distance estimates.
@@ -195,6 +198,8 @@ namespace Simulators
       Random::Generator* m_prng;
       //! The tree.
       QuadTree* m_qtree;
+      //! Gridded bathymetry.
+      Simulation::Bathymetry* m_grid;
       //! Reference latitude and longitude for data points.
       double m_ref_lat, m_ref_lon;
       //! NE offsets in regard to navigational reference.
@@ -208,6 +213,7 @@ namespace Simulators
         Tasks::Periodic(name, ctx),
         m_prng(NULL),
         m_qtree(NULL),
+        m_grid(NULL),
         m_pb(NULL)
       {
         param("Simulate - Bottom Distance", m_args.simulate_bd)
@@ -228,6 +234,11 @@ namespace Simulators
         param("Location", m_args.location)
         .defaultValue("APDL");
 
+        param("Bathymetry Grid", m_args.grid)
+        .defaultValue("")
+        .description("Gridded bathymetry file. If empty, 'bathymetry-<location>.grid'"
+                     " is used when present in the simulation configuration folder");
+
         param("Tide Level", m_args.tide)
         .defaultValue("0.0")
         .units(Units::Meter)
@@ -351,6 +362,7 @@ namespace Simulators
       {
         Memory::clear(m_prng);
         Memory::clear(m_qtree);
+        Memory::clear(m_grid);
         Memory::clear(m_pb);
       }
 
@@ -393,11 +405,29 @@ namespace Simulators
         debug("pier point B lat: %0.6f, lon: %0.6f", m_args.pier[2], m_args.pier[3]);
       }
 
+      //! Load gridded bathymetry.
+      //! @param[in] path grid file.
       void
-      onResourceInitialization(void)
+      loadGrid(const Path& path)
+      {
+        m_grid = new Simulation::Bathymetry(path);
+
+        const Simulation::Bathymetry::Layout& layout = m_grid->getLayout();
+        m_ref_lat = layout.lat;
+        m_ref_lon = layout.lon;
+
+        debug("%s | %0.6f, %0.6f", m_args.location.c_str(),
+              Angles::degrees(m_ref_lat), Angles::degrees(m_ref_lon));
+        debug("%s | %s", m_args.location.c_str(), path.c_str());
+        debug("%s | %u x %u cells of %0.2f m", m_args.location.c_str(),
+              layout.rows, layout.cols, layout.cell);
+      }
+
+      //! Load scattered bathymetry points.
+      //! @param[in] path configuration file.
+      void
+      loadPoints(const Path& path)
       {
-        Utils::String::toLowerCase(m_args.location);
-        Path path = m_ctx.dir_cfg / "simulation" / ("bathymetry-" + m_args.location + ".ini");
         DUNE::Parsers::Config cfg(path.c_str());
         std::vector<std::string> lines;
         cfg.get("Bathymetry", "Data", "", lines);
@@ -441,6 +471,19 @@ namespace Simulators
         ss.clear();
         ss << *m_qtree;
         trace("tree elements: %s", ss.str().c_str());
+      }
+
+      void
+      onResourceInitialization(void)
+      {
+        Utils::String::toLowerCase(m_args.location);
+        Path base = m_ctx.dir_cfg / "simulation" / ("bathymetry-" + m_args.location);
+        Path grid = m_args.grid.empty() ? Path(base.str() + ".grid") : Path(m_args.grid);
+
+        if (!m_args.grid.empty() || grid.exists())
+          loadGrid(grid);
+        else
+          loadPoints(base.str() + ".ini");
 
         m_bd.beam_config.clear();
         m_bd.location.clear();
@@ -557,6 +600,18 @@ namespace Simulators
       double
       depthAt(double x, double y)
       {
+        if (m_grid != NULL)
+        {
+          double depth;
+          if (!m_grid->getDepth(x, y, depth))
+          {
+            trace("out of bounds");
+            return m_args.oob_depth;
+          }
+
+          return depth + m_args.tide;
+        }
+
         Point p(x, y);
         Bounds search_area(p, m_args.interp_radius);
 
@@ -611,7 +666,7 @@ namespace Simulators
           psi_offset = m_pb->update();
         }
 
-        m_fd.value = forwardRange(0.0) + error;
+        m_fd.value = forwardRange(psi_offset) + error;
         m_fd.value = trimValue(m_fd.value, m_args.min_range, m_args.max_range);
         m_fd.validity = IMC::Distance::DV_VALID;
         const IMC::DeviceState* ds = *m_fd.location.begin();
@@ -644,7 +699,14 @@ namespace Simulators
             double value = std::abs(m_sstate.z / sin(m_sstate.theta));
             range = std::min(range, value);
           }
+        }
 
+        if (m_grid != NULL)
+        {
+          range = std::min(range, gridIntersection(psi_offset));
+        }
+        else if (!m_args.pencil_beam)
+        {
           if (m_args.intersect_method)
           {
             range = std::min(range, bottomIntersection());
@@ -695,6 +757,25 @@ namespace Simulators
         return range;
       }
 
+      //! Cast the forward beam against the gridded bathymetry.
+      //! @param[in] psi_offset beam heading offset.
+      //! @return range to the bottom or maximum range.
+      double
+      gridIntersection(double psi_offset)
+      {
+        double psi = m_sstate.psi + psi_offset;
+        double origin[3] = {m_sstate.x + m_off_n, m_sstate.y + m_off_e, m_sstate.z - m_args.tide};
+        double direction[3] = {cos(m_sstate.theta) * cos(psi),
+                               cos(m_sstate.theta) * sin(psi),
+                               -sin(m_sstate.theta)};
+
+        double range;
+        if (m_grid->castRay(origin, direction, m_args.max_range, range))
+          return range;
+
+        return m_args.max_range;
+      }
+
       //! Compute the depths of c_forward_points in front of the vehicle
       //! Use connections between these points as line segments
       //! and intersect them with lower beam part of the echo sounder.
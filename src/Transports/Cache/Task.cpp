@@ -30,10 +30,30 @@
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <map>
+#include <vector>
+#include <utility>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_SYS_TYPES_H)
+#  include <sys/types.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
 namespace Transports
 {
   namespace Cache
@@ -44,32 +64,57 @@ namespace Transports
     {
       // Loading order.
       std::vector<std::string> order;
+      // Number of superseded journal records that triggers compaction.
+      unsigned compaction_threshold;
     };
 
+    //! Cached messages are kept in an append-only journal, an LSF
+    //! file where every stored message is appended and synced to
+    //! storage. Superseded records are dropped when the journal is
+    //! compacted, which is done by writing a new journal and renaming
+    //! it over the old one. The latest serialized instance of each
+    //! cached message is kept in memory, indexed by message name and
+    //! sub-identifier. A journal that was hard linked into a log is
+    //! never appended to; it is compacted into a new file instead.
     struct Task: public DUNE::Tasks::Task
     {
+      //! Index key: message name and sub-identifier.
+      typedef std::pair<std::string, unsigned> Key;
+      //! Index of serialized messages.
+      typedef std::map<Key, std::vector<uint8_t> > Index;
+
       // Cache directory path.
       Path m_path;
-      // Path to snapshot file.
+      // Path to journal file.
       Path m_snapshot;
-      // Internal buffer.
-      uint8_t* m_buffer;
-      // Internal buffer size.
-      uint16_t m_buffer_size;
+      // Journal output stream.
+      std::ofstream m_journal;
+      // Latest instance of each cached message.
+      Index m_index;
+      // Number of superseded records in the journal.
+      unsigned m_stale;
+      // True if the journal file is hard linked by a copy.
+      bool m_linked;
+      // Serialization buffer.
+      Utils::ByteBuffer m_buffer;
       // Task arguments.
       Arguments m_args;
 
       Task(const std::string& name, Tasks::Context& ctx):
-        DUNE::Tasks::Task(name, ctx)
+        DUNE::Tasks::Task(name, ctx),
+        m_stale(0),
+        m_linked(false)
       {
         // Define configuration parameters.
         param("Loading Order", m_args.order)
         .defaultValue("")
         .description("List of messages ordered by loading order");
 
-        // Initialize internal buffer.
-        m_buffer_size = 128;
-        m_buffer = new uint8_t[m_buffer_size];
+        param("Compaction Threshold", m_args.compaction_threshold)
+        .defaultValue("128")
+        .minimumValue("1")
+        .description("Number of superseded journal records that triggers"
+                     " a compaction of the journal");
 
         // Create cache directory.
         m_path = m_ctx.dir_db / "Cache";
@@ -82,15 +127,16 @@ namespace Transports
         bind<IMC::CacheControl>(this);
       }
 
-      ~Task(void)
+      void
+      onResourceInitialization(void)
       {
-        delete [] m_buffer;
+        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
       void
-      onResourceInitialization(void)
+      onResourceRelease(void)
       {
-        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+        m_journal.close();
       }
 
       void
@@ -116,79 +162,176 @@ namespace Transports
         }
       }
 
+      //! Retrieve index entries sorted by loading order.
+      //! @param[out] entries index entries.
       void
-      getMessageFiles(std::vector<std::string>& files)
+      getEntries(std::vector<Index::const_iterator>& entries)
       {
-        std::vector<std::string> msgs = m_args.order;
-        const char* fname = 0;
+        for (unsigned i = 0; i < m_args.order.size(); ++i)
+        {
+          Index::const_iterator itr = m_index.lower_bound(Key(m_args.order[i], 0));
+          for (; itr != m_index.end() && itr->first.first == m_args.order[i]; ++itr)
+            entries.push_back(itr);
+        }
+
+        Index::const_iterator itr = m_index.begin();
+        for (; itr != m_index.end(); ++itr)
+        {
+          if (std::find(m_args.order.begin(), m_args.order.end(), itr->first.first) == m_args.order.end())
+            entries.push_back(itr);
+        }
+      }
+
+      //! Add a serialized message to the index.
+      //! @param[in] key message abbreviation and sub-identifier.
+      //! @param[in] data serialized message.
+      //! @param[in] size size of serialized message.
+      void
+      index(const Key& key, const uint8_t* data, unsigned size)
+      {
+        std::vector<uint8_t>& entry = m_index[key];
+
+        if (!entry.empty())
+          ++m_stale;
+
+        entry.assign(data, data + size);
+      }
+
+      //! Open journal for appending.
+      void
+      openJournal(void)
+      {
+        m_journal.close();
+        m_journal.clear();
+        m_journal.open(m_snapshot.c_str(), std::ios::binary | std::ios::app);
+        m_linked = isShared(m_snapshot);
+      }
+
+      //! Check if a file has more than one hard link, e.g. a journal
+      //! handed over to a log before a restart.
+      //! @param[in] path file path.
+      //! @return true if the file is shared, false otherwise.
+      static bool
+      isShared(const Path& path)
+      {
+#if defined(DUNE_SYS_HAS_STAT)
+        struct stat st;
+        if (::stat(path.c_str(), &st) != 0)
+          return false;
+
+        return st.st_nlink > 1;
+#else
+        (void)path;
+        return false;
+#endif
+      }
+
+      //! Flush the contents of a file or directory to storage.
+      //! @param[in] path file or directory path.
+      //! @return true on success, false otherwise.
+      static bool
+      syncFile(const Path& path)
+      {
+#if defined(DUNE_SYS_HAS_FSYNC)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+          return false;
+
+        bool rv = (::fsync(fd) == 0);
+        ::close(fd);
+        return rv;
+#else
+        (void)path;
+        return true;
+#endif
+      }
+
+      //! Write the latest instance of each cached message to a new
+      //! journal and replace the current one.
+      void
+      compact(void)
+      {
+        Path tmp = m_snapshot + ".tmp";
+
+        m_journal.close();
 
-        // Retrieve the name of all cached messages that are not in the
-        // loading order list.
-        try
         {
-          Directory dir(m_path);
+          std::ofstream ofs(tmp.c_str(), std::ios::binary);
+
+          std::vector<Index::const_iterator> entries;
+          getEntries(entries);
 
-          while ((fname = dir.readEntry(Directory::RD_FILE_NAME)))
+          for (unsigned i = 0; i < entries.size(); ++i)
           {
-            if (std::find(msgs.begin(), msgs.end(), fname) == msgs.end()
-                && ((m_path / fname).type() == Path::PT_DIRECTORY))
-            {
-              msgs.push_back(fname);
-            }
+            const std::vector<uint8_t>& data = entries[i]->second;
+            ofs.write((const char*)&data[0], data.size());
           }
-        }
-        catch (...)
-        { }
 
-        // Load cached messages.
-        for (unsigned int i = 0; i < msgs.size(); ++i)
-        {
-          try
+          ofs.flush();
+
+          if (!ofs.good())
           {
-            Directory md(m_path / msgs[i]);
-            while ((fname = md.readEntry(Directory::RD_FULL_NAME)))
-              files.push_back(fname);
+            err(DTR("failed to write compacted journal"));
+            openJournal();
+            return;
           }
-          catch (...)
-          { }
         }
-      }
 
-      void
-      growBuffer(int size)
-      {
-        if (size > m_buffer_size)
+        // The new journal must be on storage before it replaces the
+        // old one, or a power loss may leave an empty journal.
+        if (!syncFile(tmp))
+        {
+          err(DTR("failed to write compacted journal"));
+          openJournal();
+          return;
+        }
+
+        try
         {
-          delete [] m_buffer;
-          m_buffer_size = size;
-          m_buffer = new uint8_t[m_buffer_size];
+          tmp.rename(m_snapshot);
+          m_stale = 0;
+
+          // Make the rename itself durable.
+          if (!syncFile(m_path))
+            war(DTR("failed to sync cache directory"));
+        }
+        catch (System::Error& e)
+        {
+          err(DTR("failed to replace journal: %s"), e.what());
         }
+
+        openJournal();
       }
 
       void
       store(const IMC::Message* msg)
       {
-        std::string id = String::str(msg->getSubId());
-        uint16_t size = msg->getSerializationSize();
+        uint16_t size = IMC::Packet::serialize(msg, m_buffer);
 
-        // Create destination directory.
-        Path path = m_path / msg->getName();
-        path.create();
+        index(Key(msg->getName(), msg->getSubId()), m_buffer.getBuffer(), size);
 
-        // Open file for writing.
-        path = path / id;
-        std::ofstream ofs(path.c_str(), std::ios::binary);
+        // Never modify a journal that was handed over to a copy.
+        if (m_linked || m_stale >= m_args.compaction_threshold)
+        {
+          compact();
+          return;
+        }
 
-        growBuffer(size);
+        m_journal.write(m_buffer.getBufferSigned(), size);
+        m_journal.flush();
 
-        // Write message to file.
-        IMC::Packet::serialize(msg, m_buffer, size);
-        ofs.write((char*)m_buffer, size);
-        ofs.close();
+        if (m_journal.good() && !syncFile(m_snapshot))
+          m_journal.setstate(std::ios::badbit);
 
-        storeSnapshot();
+        if (!m_journal.good())
+        {
+          err(DTR("failed to append to journal"));
+          compact();
+        }
       }
 
+      //! Read the journal into the index and dispatch cached
+      //! messages.
       void
       loadSnapshot(void)
       {
@@ -198,45 +341,48 @@ namespace Transports
           return;
         }
 
+        bool torn = false;
         std::ifstream ifs(m_snapshot.c_str(), std::ios::binary);
 
-        if (!ifs.is_open())
-          return;
-
-        while (!ifs.eof())
+        while (ifs.is_open() && !ifs.eof())
         {
-          IMC::Message* msg = IMC::Packet::deserialize(ifs);
-          if (msg)
+          try
           {
-            dispatch(msg, DF_KEEP_TIME);
-            delete msg;
+            // Entries are only indexed here, so they are not decoded.
+            uint16_t size = IMC::Packet::read(ifs, m_buffer);
+            if (size == 0)
+            {
+              // End of file inside a header.
+              if (ifs.gcount() > 0)
+              {
+                war(DTR("discarding journal tail: %s"), DTR("truncated header"));
+                torn = true;
+              }
+              break;
+            }
+
+            IMC::MessageView view(m_buffer.getBuffer(), size);
+            index(Key(view.getName(), view.getSubId()), m_buffer.getBuffer(), size);
+          }
+          catch (std::exception& e)
+          {
+            // Truncated or corrupted tail: keep what was read.
+            war(DTR("discarding journal tail: %s"), e.what());
+            torn = true;
+            break;
           }
         }
-      }
-
-      void
-      storeSnapshot(void)
-      {
-        // Retrieve file list.
-        std::vector<std::string> files;
-        getMessageFiles(files);
-
-        std::ofstream ofs(m_snapshot.c_str(), std::ios::binary);
-
-        // Copy all cached messages to a single file.
-        for (unsigned int i = 0; i < files.size(); ++i)
-        {
-          int64_t size = Path(files[i]).size();
 
-          if (size < 0)
-            continue;
+        ifs.close();
 
-          growBuffer(size);
+        // A journal still linked by an earlier log must not be
+        // appended to.
+        if (torn || m_stale > 0 || isShared(m_snapshot))
+          compact();
+        else
+          openJournal();
 
-          std::ifstream ifs(files[i].c_str(), std::ios::binary);
-          ifs.read((char*)m_buffer, size);
-          ofs.write((char*)m_buffer, size);
-        }
+        load();
       }
 
       void
@@ -247,7 +393,21 @@ namespace Transports
 
         try
         {
-          Path(m_snapshot).copy(destination);
+          if (destination.exists())
+            destination.remove();
+
+          // Hand over the journal without copying it, if possible.
+          try
+          {
+            m_snapshot.link(destination);
+            m_linked = true;
+          }
+          catch (System::Error& e)
+          {
+            debug("unable to link journal, copying: %s", e.what());
+            m_snapshot.copy(destination);
+          }
+
           IMC::CacheControl cc;
           cc.op = IMC::CacheControl::COP_COPY_COMPLETE;
           cc.snapshot = destination.str();
@@ -262,13 +422,13 @@ namespace Transports
       void
       load(void)
       {
-        std::vector<std::string> files;
-        getMessageFiles(files);
+        std::vector<Index::const_iterator> entries;
+        getEntries(entries);
 
-        for (unsigned int i = 0; i < files.size(); ++i)
+        for (unsigned int i = 0; i < entries.size(); ++i)
         {
-          std::ifstream ifs(files[i].c_str(), std::ios::binary);
-          IMC::Message* msg = IMC::Packet::deserialize(ifs);
+          const std::vector<uint8_t>& data = entries[i]->second;
+          IMC::Message* msg = IMC::Packet::deserialize(&data[0], data.size());
           if (msg)
           {
             dispatch(msg, DF_KEEP_TIME);
@@ -280,9 +440,16 @@ namespace Transports
       void
       clear(void)
       {
+        m_journal.close();
+        m_index.clear();
+        m_stale = 0;
+        m_linked = false;
+
         // Remove cache directory and create a new one.
         m_path.remove(Path::MODE_RECURSIVE);
         m_path.create();
+
+        openJournal();
       }
 
       void
@@ -0,0 +1,159 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef TRANSPORTS_FTP_OFFLOAD_HPP_INCLUDED_
+#define TRANSPORTS_FTP_OFFLOAD_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <map>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace FTP
+  {
+    //! State shared by all sessions: the transfer rate limit and a
+    //! cache of file manifests, so that repeated synchronizations of
+    //! unchanged files do not read them again.
+    class Offload
+    {
+    public:
+      //! Unit of transfer accounted by the rate limiter.
+      static const unsigned c_chunk_size = 16 * 1024;
+
+      //! Constructor.
+      //! @param[in] block_size manifest block size in bytes.
+      //! @param[in] rate maximum transfer rate of all sessions in bytes
+      //! per second, zero for no limit.
+      Offload(uint32_t block_size, double rate):
+        m_block_size(block_size),
+        m_rate(rate)
+      {
+        if (m_rate > 0)
+          m_bucket.setRate(m_rate / c_chunk_size, std::max(4.0, m_rate / c_chunk_size / 4.0));
+      }
+
+      //! Check if transfers are rate limited.
+      //! @return true if transfers are limited, false otherwise.
+      bool
+      isLimited(void) const
+      {
+        return m_rate > 0;
+      }
+
+      //! Wait until a number of bytes may be sent.
+      //! @param[in] bytes number of bytes.
+      void
+      throttle(unsigned bytes)
+      {
+        if (m_rate <= 0)
+          return;
+
+        unsigned chunks = (bytes + c_chunk_size - 1) / c_chunk_size;
+        double period = std::min(0.1, c_chunk_size / m_rate);
+
+        for (unsigned i = 0; i < chunks; ++i)
+        {
+          while (true)
+          {
+            {
+              DUNE::Concurrency::ScopedMutex l(m_lock);
+              if (m_bucket.take())
+                break;
+            }
+
+            DUNE::Time::Delay::wait(period);
+          }
+        }
+      }
+
+      //! Get the manifest of a file.
+      //! @param[in] path file path.
+      //! @param[out] manifest file manifest.
+      void
+      getManifest(const DUNE::FileSystem::Path& path, DUNE::FileSystem::Manifest& manifest)
+      {
+        int64_t size = path.size();
+        time_t mtime = path.getLastModifiedTime();
+
+        {
+          DUNE::Concurrency::ScopedMutex l(m_lock);
+          std::map<std::string, Entry>::iterator itr = m_cache.find(path.str());
+          if (itr != m_cache.end() && itr->second.size == size && itr->second.mtime == mtime)
+          {
+            manifest = itr->second.manifest;
+            return;
+          }
+        }
+
+        // Hash without holding the lock, other sessions keep going.
+        manifest = DUNE::FileSystem::Manifest(m_block_size);
+        manifest.compute(path);
+
+        DUNE::Concurrency::ScopedMutex l(m_lock);
+        if (m_cache.size() >= c_cache_size)
+          m_cache.clear();
+
+        Entry& entry = m_cache[path.str()];
+        entry.size = size;
+        entry.mtime = mtime;
+        entry.manifest = manifest;
+      }
+
+    private:
+      //! Cached manifest.
+      struct Entry
+      {
+        //! File size.
+        int64_t size;
+        //! Modification time.
+        time_t mtime;
+        //! Manifest.
+        DUNE::FileSystem::Manifest manifest;
+      };
+
+      //! Maximum number of cached manifests.
+      static const unsigned c_cache_size = 1024;
+      //! Manifest block size.
+      uint32_t m_block_size;
+      //! Maximum transfer rate.
+      double m_rate;
+      //! Rate limiter, one token per chunk.
+      DUNE::Time::TokenBucket m_bucket;
+      //! Manifest cache.
+      std::map<std::string, Entry> m_cache;
+      //! Lock.
+      DUNE::Concurrency::Mutex m_lock;
+    };
+  }
+}
+
+#endif
@@ -26,7 +26,9 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <fstream>
 #include <sstream>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -78,12 +80,16 @@ namespace Transports
     };
 
     Session::Session(Tasks::Task* task, const FileSystem::Path& root,
-                     TCPSocket* sock, const Address& local_addr, double timeout):
+                     TCPSocket* sock, const Address& local_addr, double timeout,
+                     Offload& offload):
       m_task(task),
       m_sock(sock),
       m_local_addr(local_addr),
       m_data_pasv(false),
       m_rest_offset(-1),
+      m_range_end(-1),
+      m_compression(METHOD_UNKNOWN),
+      m_offload(offload),
       m_timer(timeout)
     {
       m_root = root;
@@ -252,6 +258,69 @@ namespace Transports
       delete sock;
     }
 
+    void
+    Session::sendData(TCPSocket* sock, const char* data, unsigned size)
+    {
+      m_offload.throttle(size);
+
+      while (size > 0)
+      {
+        unsigned rv = sock->write(data, size);
+        data += rv;
+        size -= rv;
+      }
+    }
+
+    bool
+    Session::sendFile(TCPSocket* sock, const Path& path, int64_t begin, int64_t end)
+    {
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      ifs.seekg(begin, std::ios::beg);
+      if (!ifs)
+        return false;
+
+      Compression::Compressor* com = NULL;
+      if (m_compression != METHOD_UNKNOWN)
+        com = Compression::Factory::compressor(m_compression);
+
+      std::vector<char> bfr(64 * 1024);
+      Utils::ByteBuffer packed;
+      int64_t remaining = end - begin + 1;
+      bool rv = true;
+
+      try
+      {
+        while (remaining > 0)
+        {
+          ifs.read(&bfr[0], std::min((int64_t)bfr.size(), remaining));
+          unsigned n = ifs.gcount();
+          if (n == 0)
+            break;
+
+          remaining -= n;
+          m_timer.reset();
+
+          if (com == NULL)
+          {
+            sendData(sock, &bfr[0], n);
+          }
+          else
+          {
+            com->compress(packed, &bfr[0], n);
+            sendData(sock, packed.getBufferSigned(), packed.getSize());
+          }
+        }
+      }
+      catch (std::exception& e)
+      {
+        m_task->debug("transfer of %s aborted: %s", path.c_str(), e.what());
+        rv = false;
+      }
+
+      delete com;
+      return rv;
+    }
+
     void
     Session::handleUSER(const std::string& arg)
     {
@@ -345,8 +414,10 @@ namespace Transports
     void
     Session::handleRETR(const std::string& arg)
     {
-      int64_t rest_offset = m_rest_offset;
+      int64_t begin = std::max(m_rest_offset, (int64_t)0);
+      int64_t end = m_range_end;
       m_rest_offset = -1;
+      m_range_end = -1;
 
       Path path = getAbsolutePath(arg);
       if (!path.isFile())
@@ -355,15 +426,29 @@ namespace Transports
         return;
       }
 
+      int64_t last = path.size() - 1;
+      if (end < 0 || end > last)
+        end = last;
+
       sendReply(150, "File status okay; about to open data connection.");
 
       TCPSocket* data = openDataConnection();
 
-      if (!data->writeFile(path.c_str(), path.size() - 1, rest_offset))
+      // Plain transfers of whole files use sendfile().
+      bool rv = false;
+      if (m_compression == METHOD_UNKNOWN && !m_offload.isLimited() && end == last)
+        rv = data->writeFile(path.c_str(), last, begin);
+      else
+        rv = sendFile(data, path, begin, end);
+
+      if (!rv)
+      {
+        delete data;
+        sendReply(426, "Connection closed; transfer aborted.");
         return;
+      }
 
       closeDataConnection(data);
-      m_rest_offset = 0;
     }
 
     void
@@ -375,6 +460,80 @@ namespace Transports
       sendReply(350, "Requested file action pending further information.");
     }
 
+    void
+    Session::handleRANG(const std::string& arg)
+    {
+      int64_t begin = -1;
+      int64_t end = -1;
+
+      std::istringstream is(arg);
+      if (!(is >> begin >> end) || begin < 0 || (end < begin && !(begin == 1 && end == 0)))
+      {
+        sendReply(501, "Syntax error in parameters or arguments.");
+        return;
+      }
+
+      // "RANG 1 0" resets the range.
+      if (begin == 1 && end == 0)
+      {
+        m_rest_offset = -1;
+        m_range_end = -1;
+        sendReply(350, "Restarting at 0. End byte range at EOF.");
+        return;
+      }
+
+      m_rest_offset = begin;
+      m_range_end = end;
+      sendReply(350, String::str("Restarting at %lld. End byte range at %lld.",
+                                 (long long)begin, (long long)end));
+    }
+
+    void
+    Session::handleXMAN(const std::string& arg)
+    {
+      Path path = getAbsolutePath(arg);
+      if (!path.isFile())
+      {
+        sendReply(450, "Requested file action not taken.");
+        return;
+      }
+
+      Manifest manifest;
+      m_offload.getManifest(path, manifest);
+      std::string text = manifest.str();
+
+      sendReply(150, "File status okay; about to open data connection.");
+
+      TCPSocket* data = openDataConnection();
+      try
+      {
+        sendData(data, text.c_str(), text.size());
+      }
+      catch (std::exception&)
+      {
+        delete data;
+        sendReply(426, "Connection closed; transfer aborted.");
+        return;
+      }
+
+      closeDataConnection(data);
+    }
+
+    void
+    Session::handleXCMP(const std::string& arg)
+    {
+      Methods method = Compression::Factory::method(arg);
+
+      if (method == METHOD_UNKNOWN && arg != "none")
+      {
+        sendReply(504, "Command not implemented for that parameter.");
+        return;
+      }
+
+      m_compression = method;
+      sendOK();
+    }
+
     void
     Session::handlePWD(const std::string& arg)
     {
@@ -589,6 +748,12 @@ namespace Transports
         handleMLSD(arg);
       else if (cmd == "USPC")
         handleUSPC(arg);
+      else if (cmd == "RANG")
+        handleRANG(arg);
+      else if (cmd == "XMAN")
+        handleXMAN(arg);
+      else if (cmd == "XCMP")
+        handleXCMP(arg);
       else
         handleNotImplemented(arg);
     }
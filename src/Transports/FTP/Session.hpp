@@ -37,6 +37,7 @@
 
 // Local headers.
 #include "CommandParser.hpp"
+#include "Offload.hpp"
 
 namespace Transports
 {
@@ -49,7 +50,8 @@ namespace Transports
               const DUNE::FileSystem::Path& root,
               DUNE::Network::TCPSocket* sock,
               const DUNE::Network::Address& local_addr,
-              double timeout);
+              double timeout,
+              Offload& offload);
 
       ~Session(void);
 
@@ -78,6 +80,12 @@ namespace Transports
       char m_bfr[1024];
       //! File offset (used by REST/RETR commands).
       int64_t m_rest_offset;
+      //! Last byte to send (used by RANG/RETR commands).
+      int64_t m_range_end;
+      //! Compression of transferred files (none if unknown).
+      DUNE::Compression::Methods m_compression;
+      //! Shared transfer state.
+      Offload& m_offload;
       //! Idle timer.
       DUNE::Time::Counter<double> m_timer;
 
@@ -105,6 +113,12 @@ namespace Transports
       void
       closeDataConnection(DUNE::Network::TCPSocket* sock);
 
+      void
+      sendData(DUNE::Network::TCPSocket* sock, const char* data, unsigned size);
+
+      bool
+      sendFile(DUNE::Network::TCPSocket* sock, const DUNE::FileSystem::Path& path, int64_t begin, int64_t end);
+
       void
       handleUSER(const std::string& arg);
 
@@ -132,6 +146,15 @@ namespace Transports
       void
       handleREST(const std::string& arg);
 
+      void
+      handleRANG(const std::string& arg);
+
+      void
+      handleXMAN(const std::string& arg);
+
+      void
+      handleXCMP(const std::string& arg);
+
       void
       handlePWD(const std::string& arg);
 
@@ -51,6 +51,10 @@ namespace Transports
       uint16_t control_port;
       //! Session timeout.
       double session_tout;
+      //! Manifest block size.
+      unsigned block_size;
+      //! Maximum transfer rate.
+      unsigned max_rate;
     };
 
     struct Task: public Tasks::Task
@@ -67,9 +71,12 @@ namespace Transports
       std::list<Session*> m_busy_list;
       //! Concurrency lock for list of busy sessions.
       Mutex m_busy_list_lock;
+      //! State shared by sessions.
+      Offload* m_offload;
 
       Task(const std::string& name, Tasks::Context& ctx):
-        Tasks::Task(name, ctx)
+        Tasks::Task(name, ctx),
+        m_offload(NULL)
       {
         param("Data Port", m_args.data_port)
         .defaultValue("30020")
@@ -83,6 +90,19 @@ namespace Transports
         .units(Units::Second)
         .defaultValue("120")
         .description("Timeout period of a session");
+
+        param("Manifest Block Size", m_args.block_size)
+        .units(Units::Kibibyte)
+        .defaultValue("1024")
+        .minimumValue("4")
+        .description("Size of the file blocks compared by offload clients (XMAN command)");
+
+        param("Maximum Transfer Rate", m_args.max_rate)
+        .units(Units::Kibibyte)
+        .defaultValue("0")
+        .description("Maximum number of KiB per second sent by all sessions, "
+                     "zero for no limit. Leaves bandwidth for telemetry on "
+                     "shared links");
       }
 
       ~Task(void)
@@ -115,6 +135,8 @@ namespace Transports
       void
       onResourceAcquisition(void)
       {
+        m_offload = new Offload(m_args.block_size * 1024, m_args.max_rate * 1024.0);
+
         // Initialize and dispatch AnnounceService.
         std::vector<Interface> itfs = Interface::get();
         std::set<Address> addrs;
@@ -166,6 +188,8 @@ namespace Transports
           m_sockets.pop_front();
           delete socket;
         }
+
+        Memory::clear(m_offload);
       }
 
       void
@@ -178,7 +202,7 @@ namespace Transports
 
           debug("accepted connection from '%s'", addr.c_str());
           Session* handler = new Session(this, m_ctx.dir_log, client, local_addr,
-                                         m_args.session_tout);
+                                         m_args.session_tout, *m_offload);
           handler->start();
           m_busy_list.push_back(handler);
         }
@@ -39,11 +39,27 @@ namespace Transports
     {
       // Reception timeout.
       float max_age_secs;
+      // Time to ignore fragments of reassembled messages.
+      float done_secs;
+    };
+
+    //! Recently reassembled message.
+    struct Reassembled
+    {
+      //! Reassembly time.
+      double time;
+      //! Number of data fragments.
+      int num_frags;
+      //! Data fragments received before reassembly.
+      std::vector<bool> received;
     };
 
     struct Task: public DUNE::Tasks::Task
     {
       std::map<uint32_t, FragmentedMessage> m_incoming;
+      //! Recently reassembled messages, whose remaining fragments
+      //! are ignored.
+      std::map<uint32_t, Reassembled> m_done;
       Time::Counter<float> m_gc_counter;
       Arguments m_args;
 
@@ -54,6 +70,13 @@ namespace Transports
         .defaultValue("1800")
         .description("Maximum amount of seconds to wait for missing fragments in incoming messages");
 
+        param("Reassembled Message Window", m_args.done_secs)
+        .defaultValue("120")
+        .units(Units::Second)
+        .description("Amount of seconds to ignore the remaining fragments of a"
+                     " reassembled message, such as unneeded parity fragments."
+                     " A repeated data fragment starts a new message");
+
         bind<IMC::MessagePart>(this);
         m_gc_counter.setTop(120);
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
@@ -63,6 +86,7 @@ namespace Transports
       onResourceRelease(void)
       {
         m_incoming.clear();
+        m_done.clear();
       }
 
       void
@@ -70,6 +94,19 @@ namespace Transports
       {
         int hash = (msg->uid << 16) | msg->getSource();
 
+        std::map<uint32_t, Reassembled>::iterator done = m_done.find(hash);
+        if (done != m_done.end())
+        {
+          if (isRedundant(done->second, msg))
+          {
+            debug("Ignoring fragment of reassembled message");
+            return;
+          }
+
+          // Message identifiers wrap around, this is a new message.
+          m_done.erase(done);
+        }
+
         if (m_incoming.find(hash) == m_incoming.end())
         {
           FragmentedMessage incMsg;
@@ -80,14 +117,50 @@ namespace Transports
         debug("Incoming message fragment (%d still missing)",
               m_incoming[hash].getFragmentsMissing());
 
-        IMC::Message * res = m_incoming[hash].setFragment(msg);
+        FragmentedMessage& incoming = m_incoming[hash];
+        IMC::Message * res = incoming.setFragment(msg);
         if (res != NULL)
         {
           dispatch(res);
+
+          Reassembled& entry = m_done[hash];
+          entry.time = Clock::get();
+          entry.num_frags = incoming.getFragmentCount();
+          entry.received.resize(entry.num_frags);
+          for (int i = 0; i < entry.num_frags; ++i)
+            entry.received[i] = incoming.hasFragment(i);
+
           m_incoming.erase(hash);
         }
       }
 
+      //! Test if a fragment belongs to a reassembled message. Parity
+      //! fragments and data fragments that were missing when the
+      //! message was recovered are redundant. A repeated data fragment
+      //! or a different number of fragments means a new message with
+      //! the same identifier.
+      //! @param[in] entry reassembled message.
+      //! @param[in] msg fragment.
+      //! @return true if the fragment should be ignored.
+      bool
+      isRedundant(Reassembled& entry, const IMC::MessagePart* msg)
+      {
+        if (Clock::get() - entry.time >= m_args.done_secs)
+          return false;
+
+        if (msg->num_frags != entry.num_frags)
+          return false;
+
+        if (msg->frag_number >= entry.num_frags)
+          return true;
+
+        if (entry.received[msg->frag_number])
+          return false;
+
+        entry.received[msg->frag_number] = true;
+        return true;
+      }
+
       void
       messageRipper(void)
       {
@@ -109,6 +182,15 @@ namespace Transports
 
         for (size_t i = 0; i < remove.size(); ++i)
           m_incoming.erase(remove[i]);
+
+        std::map<uint32_t, Reassembled>::iterator done = m_done.begin();
+        while (done != m_done.end())
+        {
+          if (Clock::get() - done->second.time >= m_args.done_secs)
+            m_done.erase(done++);
+          else
+            ++done;
+        }
       }
 
       void
@@ -0,0 +1,296 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "History.hpp"
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    using DUNE_NAMESPACES;
+
+    //! Find the first sample at or after a given time.
+    //! @param[in] samples samples, oldest first.
+    //! @param[in] time time.
+    //! @return index of the sample.
+    static unsigned
+    lowerBound(const CircularBuffer<History::Sample>& samples, double time)
+    {
+      unsigned lo = 0;
+      unsigned hi = samples.getSize();
+      while (lo < hi)
+      {
+        unsigned mid = (lo + hi) / 2;
+        if (samples(mid).time < time)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+      return lo;
+    }
+
+    //! Find the first sample after a given time.
+    //! @param[in] samples samples, oldest first.
+    //! @param[in] time time.
+    //! @return index of the sample.
+    static unsigned
+    upperBound(const CircularBuffer<History::Sample>& samples, double time)
+    {
+      unsigned lo = 0;
+      unsigned hi = samples.getSize();
+      while (lo < hi)
+      {
+        unsigned mid = (lo + hi) / 2;
+        if (samples(mid).time <= time)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+      return lo;
+    }
+
+    History::History(void):
+      m_raw_size(1),
+      m_tier_size(1)
+    { }
+
+    History::~History(void)
+    {
+      clear();
+    }
+
+    std::vector<uint32_t>
+    History::configure(const std::vector<std::string>& names, unsigned raw_size, unsigned tier_size)
+    {
+      ScopedMutex l(m_mutex);
+
+      clear();
+      m_subs.clear();
+      m_raw_size = std::max(raw_size, 1u);
+      m_tier_size = std::max(tier_size, 1u);
+
+      std::vector<uint32_t> ids;
+
+      for (unsigned i = 0; i < names.size(); ++i)
+      {
+        size_t dot = names[i].find('.');
+        if (dot == std::string::npos)
+          throw std::runtime_error(String::str(DTR("invalid history field: %s"), names[i].c_str()));
+
+        uint32_t id = IMC::Factory::getIdFromAbbrev(names[i].substr(0, dot));
+        std::string field = names[i].substr(dot + 1);
+
+        Subscription sub;
+        sub.name = names[i];
+        sub.field = IMC::MessageView::getFields(id);
+        while (sub.field != NULL && sub.field->name != NULL && field != sub.field->name)
+          ++sub.field;
+
+        if (sub.field == NULL || sub.field->name == NULL)
+          throw std::runtime_error(String::str(DTR("invalid history field: %s"), names[i].c_str()));
+
+        if (m_subs.find(id) == m_subs.end())
+          ids.push_back(id);
+
+        m_subs.insert(std::make_pair((uint16_t)id, sub));
+      }
+
+      return ids;
+    }
+
+    void
+    History::update(const IMC::Message* msg)
+    {
+      ScopedMutex l(m_mutex);
+
+      std::pair<SubscriptionMap::iterator, SubscriptionMap::iterator> range = m_subs.equal_range(msg->getId());
+      if (range.first == range.second)
+        return;
+
+      uint16_t size = IMC::Packet::serialize(msg, m_bfr);
+      IMC::MessageView view(m_bfr.getBuffer(), size);
+
+      for (SubscriptionMap::iterator itr = range.first; itr != range.second; ++itr)
+      {
+        Key key(itr->second.name, msg->getSourceEntity());
+        std::map<Key, Series*>::iterator sitr = m_series.find(key);
+        Series* series = (sitr == m_series.end()) ? (m_series[key] = createSeries()) : sitr->second;
+        add(series, msg->getTimeStamp(), (float)view.readFieldFP(*itr->second.field));
+      }
+    }
+
+    bool
+    History::query(const std::string& name, unsigned& entity, double start, double end,
+                   unsigned max_samples, double& period, std::vector<Sample>& samples)
+    {
+      ScopedMutex l(m_mutex);
+
+      std::map<Key, Series*>::iterator sitr;
+      if (entity == 0xff)
+      {
+        sitr = m_series.lower_bound(Key(name, 0));
+        if (sitr != m_series.end() && sitr->first.first != name)
+          sitr = m_series.end();
+      }
+      else
+      {
+        sitr = m_series.find(Key(name, entity));
+      }
+
+      if (sitr == m_series.end())
+        return false;
+
+      entity = sitr->first.second;
+      Tier* tiers = sitr->second->tiers;
+      unsigned index = c_history_tiers - 1;
+      unsigned first = 0;
+      unsigned last = 0;
+
+      for (unsigned i = 0; i < c_history_tiers; ++i)
+      {
+        const CircularBuffer<Sample>& buf = *tiers[i].samples;
+        first = lowerBound(buf, start);
+        last = std::max(first, upperBound(buf, end));
+
+        // A tier spans the interval if it never dropped samples or
+        // if it still holds samples older than the start.
+        bool spans = buf.getSize() < buf.getCapacity() || (buf.getSize() > 0 && buf(0).time <= start);
+        if (spans && (max_samples == 0 || last - first <= max_samples))
+        {
+          index = i;
+          break;
+        }
+      }
+
+      if (max_samples > 0 && last - first > max_samples)
+        first = last - max_samples;
+
+      period = tiers[index].period;
+      samples.clear();
+      samples.reserve(last - first);
+      for (unsigned i = first; i < last; ++i)
+        samples.push_back((*tiers[index].samples)(i));
+
+      return true;
+    }
+
+    void
+    History::list(std::vector<std::pair<std::string, unsigned> >& series)
+    {
+      ScopedMutex l(m_mutex);
+
+      series.clear();
+      std::map<Key, Series*>::iterator itr = m_series.begin();
+      for (; itr != m_series.end(); ++itr)
+        series.push_back(itr->first);
+    }
+
+    History::Series*
+    History::createSeries(void)
+    {
+      Series* series = new Series;
+      for (unsigned i = 0; i < c_history_tiers; ++i)
+      {
+        Tier& tier = series->tiers[i];
+        tier.period = c_history_periods[i];
+        tier.samples = new CircularBuffer<Sample>(i == 0 ? m_raw_size : m_tier_size);
+        tier.sum = 0;
+        tier.count = 0;
+      }
+
+      return series;
+    }
+
+    void
+    History::add(Series* series, double time, float value)
+    {
+      Tier* tiers = series->tiers;
+
+      // Samples out of order would break the time ordering of tiers.
+      if (tiers[0].samples->getSize() > 0
+          && time < (*tiers[0].samples)(tiers[0].samples->getSize() - 1).time)
+        return;
+
+      Sample sample;
+      sample.time = time;
+      sample.mean = value;
+      sample.min = value;
+      sample.max = value;
+      tiers[0].samples->add(sample);
+
+      for (unsigned i = 1; i < c_history_tiers; ++i)
+      {
+        Tier& tier = tiers[i];
+        double bucket = std::floor(time / tier.period) * tier.period;
+
+        if (tier.count > 0 && bucket != tier.current.time)
+        {
+          tier.current.mean = (float)(tier.sum / tier.count);
+          tier.samples->add(tier.current);
+          tier.count = 0;
+        }
+
+        if (tier.count == 0)
+        {
+          tier.current = sample;
+          tier.current.time = bucket;
+          tier.sum = 0;
+        }
+
+        tier.current.min = std::min(tier.current.min, value);
+        tier.current.max = std::max(tier.current.max, value);
+        tier.sum += value;
+        ++tier.count;
+      }
+    }
+
+    void
+    History::clear(void)
+    {
+      std::map<Key, Series*>::iterator itr = m_series.begin();
+      for (; itr != m_series.end(); ++itr)
+      {
+        for (unsigned i = 0; i < c_history_tiers; ++i)
+          delete itr->second->tiers[i].samples;
+        delete itr->second;
+      }
+
+      m_series.clear();
+    }
+  }
+}
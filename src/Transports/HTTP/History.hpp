@@ -0,0 +1,189 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef TRANSPORTS_HTTP_HISTORY_HPP_INCLUDED_
+#define TRANSPORTS_HTTP_HISTORY_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Transports
+{
+  namespace HTTP
+  {
+    //! Number of resolution tiers.
+    static const unsigned c_history_tiers = 4;
+    //! Sample period of each tier (raw samples first).
+    static const double c_history_periods[c_history_tiers] = {0, 1, 10, 60};
+
+    //! Bounded in-memory history of message fields. Each series
+    //! (message field and source entity) keeps the latest raw samples
+    //! and the latest samples of each downsampling tier, so recent
+    //! data is available at full rate and older data at decreasing
+    //! resolution. Methods may be called from different threads.
+    class History
+    {
+    public:
+      //! Sample of a series. Raw samples have the same mean, minimum
+      //! and maximum.
+      struct Sample
+      {
+        //! Start time of the sample.
+        double time;
+        //! Mean value.
+        float mean;
+        //! Minimum value.
+        float min;
+        //! Maximum value.
+        float max;
+      };
+
+      //! Constructor.
+      History(void);
+
+      //! Destructor.
+      ~History(void);
+
+      //! Select the fields to record and clear all series.
+      //! @param[in] names list of fields, as 'Message.field'.
+      //! @param[in] raw_size number of raw samples of each series.
+      //! @param[in] tier_size number of samples of each downsampling tier.
+      //! @return identifiers of the messages to consume.
+      std::vector<uint32_t>
+      configure(const std::vector<std::string>& names, unsigned raw_size, unsigned tier_size);
+
+      //! Record the subscribed fields of a message.
+      //! @param[in] msg message.
+      void
+      update(const DUNE::IMC::Message* msg);
+
+      //! Read the samples of a series in a time interval. The finest
+      //! tier that spans the interval with at most 'max_samples' is
+      //! used; if none does, the newest samples of the coarsest tier
+      //! are returned.
+      //! @param[in] name field, as 'Message.field'.
+      //! @param[in,out] entity source entity or 255 for the first
+      //! series of the field, replaced by the source entity of the
+      //! series.
+      //! @param[in] start start time.
+      //! @param[in] end end time.
+      //! @param[in] max_samples maximum number of samples (0 for no limit).
+      //! @param[out] period sample period of the tier used (0 for raw
+      //! samples).
+      //! @param[out] samples samples, oldest first.
+      //! @return false if the series does not exist, true otherwise.
+      bool
+      query(const std::string& name, unsigned& entity, double start, double end,
+            unsigned max_samples, double& period, std::vector<Sample>& samples);
+
+      //! Get the existing series.
+      //! @param[out] series field and source entity of each series.
+      void
+      list(std::vector<std::pair<std::string, unsigned> >& series);
+
+    private:
+      //! Downsampling tier.
+      struct Tier
+      {
+        //! Sample period.
+        double period;
+        //! Samples.
+        DUNE::Utils::CircularBuffer<Sample>* samples;
+        //! Sample being accumulated.
+        Sample current;
+        //! Sum of the values of the current sample.
+        double sum;
+        //! Number of values of the current sample.
+        unsigned count;
+      };
+
+      //! Series of a field and source entity.
+      struct Series
+      {
+        //! Raw samples and downsampling tiers.
+        Tier tiers[c_history_tiers];
+      };
+
+      //! Subscribed field.
+      struct Subscription
+      {
+        //! Field name, as 'Message.field'.
+        std::string name;
+        //! Field of the serialized message.
+        const DUNE::IMC::MessageView::Field* field;
+      };
+
+      //! Series key: field name and source entity.
+      typedef std::pair<std::string, unsigned> Key;
+      //! Subscriptions by message identifier.
+      typedef std::multimap<uint16_t, Subscription> SubscriptionMap;
+
+      //! Number of raw samples.
+      unsigned m_raw_size;
+      //! Number of samples of downsampling tiers.
+      unsigned m_tier_size;
+      //! Subscriptions.
+      SubscriptionMap m_subs;
+      //! Series.
+      std::map<Key, Series*> m_series;
+      //! Serialization buffer.
+      DUNE::Utils::ByteBuffer m_bfr;
+      //! Lock.
+      DUNE::Concurrency::Mutex m_mutex;
+
+      //! Create a series.
+      //! @return series.
+      Series*
+      createSeries(void);
+
+      //! Add a value to a series.
+      //! @param[in] series series.
+      //! @param[in] time time stamp.
+      //! @param[in] value value.
+      void
+      add(Series* series, double time, float value);
+
+      //! Delete all series.
+      void
+      clear(void);
+
+      // Non-copyable.
+      History(const History&);
+
+      History&
+      operator=(const History&);
+    };
+  }
+}
+
+#endif
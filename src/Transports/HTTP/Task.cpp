@@ -27,17 +27,21 @@
 
 // ISO C++ 98 headers.
 #include <vector>
+#include <map>
+#include <set>
 #include <stdexcept>
 #include <fstream>
 #include <sstream>
 #include <cstdlib>
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
 // Local headers.
+#include "History.hpp"
 #include "MessageMonitor.hpp"
 #include "RequestHandler.hpp"
 #include "Server.hpp"
@@ -59,12 +63,25 @@ namespace Transports
       unsigned threads;
       //! List of messages to transport.
       std::vector<std::string> messages;
+      //! List of message fields to keep in the history.
+      std::vector<std::string> history;
+      //! Number of raw samples of each history series.
+      unsigned history_raw;
+      //! Number of samples of each history tier.
+      unsigned history_tier;
     };
 
     //! Buffer length.
     static const unsigned c_buffer_len = 4096;
     //! Maximum number of ports to try before giving up.
     static const int c_max_port_tries = 10;
+    //! Topic of history queries carried by Event messages.
+    static const char* c_history_query = "HistoryQuery";
+    //! Topic of history replies carried by Event messages.
+    static const char* c_history_reply = "HistoryReply";
+    //! Maximum number of samples in a history reply, so that it fits
+    //! in a single IMC message.
+    static const unsigned c_history_event_samples = 800;
 
     struct Task: public Tasks::Task, public RequestHandler
     {
@@ -76,6 +93,17 @@ namespace Transports
       std::string m_agent;
       //! Message Monitor.
       MessageMonitor m_msg_mon;
+      //! Descriptor of the last frame of each source entity. Holding
+      //! it keeps one frame of the producer's pool referenced.
+      std::map<unsigned, Media::FrameDescriptor*> m_frames;
+      //! Lock to serialize access to m_frames.
+      Concurrency::Mutex m_frames_lock;
+      //! Messages to serve when carried by frame descriptors.
+      Tasks::FilterTable m_frame_carriers;
+      //! Messages shown by the message monitor.
+      std::set<uint32_t> m_monitored;
+      //! Telemetry history.
+      History m_history;
       //! Task arguments.
       Arguments m_args;
 
@@ -98,8 +126,25 @@ namespace Transports
         .defaultValue("")
         .description("List of messages to transport");
 
+        param("History", m_args.history)
+        .defaultValue("")
+        .description("List of message fields to keep in memory, as 'Message.field'");
+
+        param("History Raw Samples", m_args.history_raw)
+        .defaultValue("600")
+        .minimumValue("1")
+        .description("Number of samples kept at full rate for each field and source entity");
+
+        param("History Tier Samples", m_args.history_tier)
+        .defaultValue("1800")
+        .minimumValue("1")
+        .description("Number of 1 s, 10 s and 1 min averages kept for each field and source entity");
+
         m_cfg_dir = ctx.dir_cfg.str();
         m_agent = getSystemName();
+
+        bind<Media::FrameDescriptor>(this);
+        bind<IMC::Event>(this);
       }
 
       void
@@ -142,10 +187,30 @@ namespace Transports
         throw std::runtime_error(DTR("failed to find one available port"));
       }
 
+      ~Task(void)
+      {
+        clearFrames();
+      }
+
       void
       onResourceRelease(void)
       {
         Memory::clear(m_server);
+
+        clearFrames();
+      }
+
+      //! Release the descriptors of all frames.
+      void
+      clearFrames(void)
+      {
+        Concurrency::ScopedMutex l(m_frames_lock);
+
+        std::map<unsigned, Media::FrameDescriptor*>::iterator itr = m_frames.begin();
+        for (; itr != m_frames.end(); ++itr)
+          delete itr->second;
+
+        m_frames.clear();
       }
 
       void
@@ -157,14 +222,122 @@ namespace Transports
       void
       onUpdateParameters(void)
       {
-        bind(this, m_args.messages);
+        std::set<uint32_t> ids;
+        for (unsigned i = 0; i < m_args.messages.size(); ++i)
+          ids.insert(IMC::Factory::getIdFromAbbrev(m_args.messages[i]));
+
+        m_monitored = ids;
+
+        // Messages of the history are bound only once.
+        std::vector<uint32_t> history = m_history.configure(m_args.history, m_args.history_raw,
+                                                            m_args.history_tier);
+        std::set<uint32_t> all(ids);
+        all.insert(history.begin(), history.end());
+        bind(this, std::vector<uint32_t>(all.begin(), all.end()));
+
+        std::set<uint32_t> any;
+        any.insert(Tasks::FilterTable::c_any);
+
+        m_frame_carriers.clear();
+        m_frame_carriers.add(ids, any, any);
       }
 
       void
       consume(const IMC::Message* msg)
       {
-        if (msg->getSource() == getSystemId())
+        if (msg->getSource() != getSystemId())
+          return;
+
+        if (m_monitored.find(msg->getId()) != m_monitored.end())
           m_msg_mon.updateMessage(msg);
+
+        m_history.update(msg);
+      }
+
+      //! Convert a history query time, which is relative to the
+      //! current time if not positive.
+      //! @param[in] time query time.
+      //! @return time since the epoch.
+      static double
+      getHistoryTime(double time)
+      {
+        if (time <= 0)
+          return Clock::getSinceEpoch() + time;
+        return time;
+      }
+
+      //! Answer history queries sent to this system. The query is
+      //! an Event with topic 'HistoryQuery' whose data holds the
+      //! tuples 'req', 'series', 'entity' (255 for any), 'start',
+      //! 'end' and 'max', with the same meaning as in the HTTP
+      //! interface. The reply is an Event with topic 'HistoryReply'
+      //! holding 'req', 'series', 'entity', 'period' and 'samples', a
+      //! space separated list of 'time,mean,min,max' values, or
+      //! 'req' and 'error' if the query cannot be answered.
+      void
+      consume(const IMC::Event* msg)
+      {
+        if (msg->topic != c_history_query || msg->getDestination() != getSystemId())
+          return;
+
+        TupleList query(msg->data);
+        std::string req = query.get("req");
+        std::string series = query.get("series");
+        unsigned entity = query.get("entity", 255u);
+        double start = query.get("start", 0.0);
+        double end = query.get("end", 0.0);
+        unsigned max = query.get("max", c_history_event_samples);
+        if (max == 0 || max > c_history_event_samples)
+          max = c_history_event_samples;
+
+        IMC::Event reply;
+        reply.setDestination(msg->getSource());
+        reply.setDestinationEntity(msg->getSourceEntity());
+        reply.topic = c_history_reply;
+
+        double period = 0;
+        std::vector<History::Sample> samples;
+        if (!m_history.query(series, entity, getHistoryTime(start), getHistoryTime(end),
+                             max, period, samples))
+        {
+          reply.data = String::str("req=%s;error=unknown series", req.c_str());
+          dispatch(reply);
+          return;
+        }
+
+        std::ostringstream os;
+        os << "req=" << req << ";series=" << series << ";entity=" << entity
+           << ";period=" << period << ";samples=";
+        for (unsigned i = 0; i < samples.size(); ++i)
+        {
+          os << (i == 0 ? "" : " ")
+             << String::str("%0.3f,%g,%g,%g", samples[i].time, samples[i].mean,
+                            samples[i].min, samples[i].max);
+        }
+
+        reply.data = os.str();
+        dispatch(reply);
+      }
+
+      void
+      consume(const Media::FrameDescriptor* msg)
+      {
+        if (msg->getSource() != getSystemId() || msg->getCarrier() == NULL)
+          return;
+
+        if (!m_frame_carriers.applies(msg->getCarrier()->getId()))
+          return;
+
+        if (msg->getFrame() == NULL)
+          return;
+
+        // Keep a reference; the contents are only read on request.
+        Media::FrameDescriptor* desc = static_cast<Media::FrameDescriptor*>(msg->clone());
+
+        Concurrency::ScopedMutex l(m_frames_lock);
+        Media::FrameDescriptor*& entry = m_frames[msg->getSourceEntity()];
+        delete entry;
+        entry = desc;
       }
 
       static bool
@@ -202,6 +375,12 @@ namespace Transports
             showMessages(sock, headers, uri);
           else if (matchURL(uri, "/dune/power/channel/", true))
             handlePowerChannel(sock, headers, uri);
+          else if (matchURL(uri, "/dune/frames/", true))
+            sendFrame(sock, headers, uri);
+          else if (matchURL(uri, "/dune/history/series.js"))
+            sendHistorySeries(sock, headers, uri);
+          else if (matchURL(uri, "/dune/history/", true))
+            sendHistory(sock, headers, uri);
           else
             sendResponse404(sock);
         }
@@ -332,6 +511,138 @@ namespace Transports
         sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
       }
 
+      //! Send the contents of the last frame of an entity.
+      void
+      sendFrame(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+
+        unsigned eid = 0;
+        if (!castLexical(String::getRemaining("/dune/frames/", uri), eid))
+        {
+          sendResponse404(sock);
+          return;
+        }
+
+        // Take a new reference, so that the lock is not held while
+        // sending and the frame outlives a newer one replacing it.
+        Media::FrameDescriptor* desc = NULL;
+        {
+          Concurrency::ScopedMutex l(m_frames_lock);
+          std::map<unsigned, Media::FrameDescriptor*>::iterator itr = m_frames.find(eid);
+          if (itr != m_frames.end())
+            desc = static_cast<Media::FrameDescriptor*>(itr->second->clone());
+        }
+
+        if (desc == NULL)
+        {
+          sendResponse404(sock);
+          return;
+        }
+
+        const Media::Frame* frame = desc->getFrame();
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "application/octet-stream";
+        hdr["X-IMC-Message"] = desc->getCarrier()->getName();
+        hdr["X-IMC-Timestamp"] = String::str("%0.6f", desc->getTimeStamp());
+
+        try
+        {
+          sendData(sock, (const char*)frame->getData(), frame->getSize(), &hdr);
+        }
+        catch (...)
+        {
+          delete desc;
+          throw;
+        }
+
+        delete desc;
+      }
+
+      //! Send the list of history series.
+      void
+      sendHistorySeries(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+        (void)uri;
+
+        std::vector<std::pair<std::string, unsigned> > series;
+        m_history.list(series);
+
+        std::ostringstream os;
+        os << "[";
+        for (unsigned i = 0; i < series.size(); ++i)
+        {
+          std::string label;
+          try
+          {
+            label = resolveEntity(series[i].second);
+          }
+          catch (...)
+          { }
+
+          os << (i == 0 ? "" : ",")
+             << "\n{\"series\": \"" << series[i].first << "\", \"entity\": " << series[i].second
+             << ", \"label\": \"" << label << "\"}";
+        }
+        os << "\n]";
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "application/json";
+        sendData(sock, os.str(), &hdr);
+      }
+
+      //! Send the samples of a history series. The URI is
+      //! /dune/history/SERIES/ENTITY/START/END[/MAX], where times that
+      //! are not positive are relative to the current time.
+      void
+      sendHistory(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+
+        std::vector<std::string> parts;
+        String::split(String::getRemaining("/dune/history/", uri), "/", parts);
+
+        unsigned entity = 0;
+        double start = 0;
+        double end = 0;
+        unsigned max = 0;
+        if ((parts.size() != 4 && parts.size() != 5)
+            || !castLexical(parts[1], entity)
+            || !castLexical(parts[2], start)
+            || !castLexical(parts[3], end)
+            || (parts.size() == 5 && !castLexical(parts[4], max)))
+        {
+          sendResponse500(sock);
+          return;
+        }
+
+        double period = 0;
+        std::vector<History::Sample> samples;
+        if (!m_history.query(parts[0], entity, getHistoryTime(start), getHistoryTime(end),
+                             max, period, samples))
+        {
+          sendResponse404(sock);
+          return;
+        }
+
+        std::ostringstream os;
+        os << "{\"series\": \"" << parts[0] << "\", \"entity\": " << entity
+           << ", \"period\": " << period << ", \"samples\": [";
+        for (unsigned i = 0; i < samples.size(); ++i)
+        {
+          os << (i == 0 ? "" : ",")
+             << String::str("\n[%0.3f, %g, %g, %g]", samples[i].time, samples[i].mean,
+                            samples[i].min, samples[i].max);
+        }
+        os << "\n]}";
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "application/json";
+        sendData(sock, os.str(), &hdr);
+      }
+
       void
       sendVersionJSON(TCPSocket* sock, TupleList& headers, const char* uri)
       {
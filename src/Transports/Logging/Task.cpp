@@ -28,6 +28,7 @@
 // ISO C++ 98 headers.
 #include <string>
 #include <vector>
+#include <set>
 #include <fstream>
 #include <algorithm>
 #include <cstddef>
@@ -56,6 +57,10 @@ namespace Transports
       unsigned lsf_volume_size;
       // Compression method.
       std::string lsf_compression;
+      // Number of compression threads.
+      unsigned lsf_compression_threads;
+      // Copy terminal output to the log directory.
+      bool terminal_output;
     };
 
     struct Task: public Tasks::Task
@@ -76,6 +81,8 @@ namespace Transports
       Path m_lsf_file;
       // Serialization buffer.
       ByteBuffer m_buffer;
+      // Messages to log when carried by frame descriptors.
+      Tasks::FilterTable m_frame_carriers;
       // Logging control message.
       IMC::LoggingControl m_log_ctl;
       // True if logging is enabled.
@@ -97,7 +104,15 @@ namespace Transports
 
         param("LSF Compression Method", m_args.lsf_compression)
         .defaultValue("none")
-        .description("Compression method");
+        .values("none, zlib, gzip, bzip2, lz4")
+        .description("Compression method. LZ4 is much faster than gzip or bzip2 at a lower compression ratio");
+
+        param("LSF Compression Threads", m_args.lsf_compression_threads)
+        .defaultValue("0")
+        .minimumValue("0")
+        .maximumValue("16")
+        .description("Number of threads compressing log data in parallel. Zero compresses "
+                     "on the logging thread");
 
         param("LSF Volume Size", m_args.lsf_volume_size)
         .units(Units::Mebibyte)
@@ -109,12 +124,19 @@ namespace Transports
         param("Transports", m_args.messages)
         .defaultValue("");
 
+        param("Terminal Output", m_args.terminal_output)
+        .defaultValue("true")
+        .description("Copy the terminal output of the process to Output.txt in the log directory."
+                     " The terminal is shared by the whole process, so this must be disabled when"
+                     " several vehicles are hosted in the same process");
+
         m_log_ctl.setSource(getSystemId());
 
         bind<IMC::CacheControl>(this);
         bind<IMC::LoggingControl>(this);
         bind<IMC::PowerOperation>(this);
         bind<IMC::EntityInfo>(this);
+        bind<Media::FrameDescriptor>(this);
       }
 
       ~Task(void)
@@ -143,6 +165,16 @@ namespace Transports
           m_args.lsf_volumes.push_back("");
 
         bind(this, m_args.messages);
+
+        std::set<uint32_t> ids;
+        for (unsigned i = 0; i < m_args.messages.size(); ++i)
+          ids.insert(IMC::Factory::getIdFromAbbrev(m_args.messages[i]));
+
+        std::set<uint32_t> any;
+        any.insert(Tasks::FilterTable::c_any);
+
+        m_frame_carriers.clear();
+        m_frame_carriers.add(ids, any, any);
       }
 
       void
@@ -197,7 +229,8 @@ namespace Transports
         if (msg->op == IMC::PowerOperation::POP_PWR_DOWN_IP)
         {
           stopLog(false);
-          dune_term.close();
+          if (m_args.terminal_output)
+            dune_term.close();
         }
         else if (msg->op == IMC::PowerOperation::POP_PWR_DOWN_ABORTED)
         {
@@ -220,6 +253,27 @@ namespace Transports
           logMessage(msg);
       }
 
+      void
+      consume(const Media::FrameDescriptor* msg)
+      {
+        if (!m_active || m_lsf == NULL || msg->getCarrier() == NULL)
+          return;
+
+        if (!m_frame_carriers.applies(msg->getCarrier()->getId()))
+          return;
+
+        // Frames are logged as the message they replace.
+        try
+        {
+          msg->serializeCarrier(m_buffer);
+          m_lsf->write(m_buffer.getBufferSigned(), m_buffer.getSize());
+        }
+        catch (std::exception& e)
+        {
+          err(DTR("failed to log frame: %s"), e.what());
+        }
+      }
+
       bool
       changeVolumeDirectory(void)
       {
@@ -248,9 +302,9 @@ namespace Transports
 
         // Copy current configuration file to log directory.
         Path cfg_path = m_dir / "Config.ini";
-        Path out_path = m_dir / "Output.txt";
         m_ctx.config.writeToFile(cfg_path.c_str());
-        dune_term.open(out_path.c_str());
+        if (m_args.terminal_output)
+          dune_term.open((m_dir / "Output.txt").c_str());
 
         // Log entities.
         std::vector<Entities::EntityDataBase::Entity*> devs;
@@ -351,7 +405,8 @@ namespace Transports
         if (m_compression == METHOD_UNKNOWN)
           m_lsf = new std::ofstream(m_lsf_file.c_str(), std::ios::binary);
         else
-          m_lsf = new Compression::FileOutput(m_lsf_file.c_str(), m_compression);
+          m_lsf = new Compression::FileOutput(m_lsf_file.c_str(), m_compression,
+                                              m_args.lsf_compression_threads);
 
         // Log LoggingControl to facilitate posterior conversion to LLF.
         m_log_ctl.op = IMC::LoggingControl::COP_STARTED;
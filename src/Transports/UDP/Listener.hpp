@@ -108,40 +108,63 @@ namespace Transports
               continue;
 
             uint16_t rv = m_sock.read(bfr, c_bfr_size, &addr);
-            IMC::Message* msg = IMC::Packet::deserialize(bfr, rv);
 
-            if (m_lcomms->isActive())
-            {
-              if (msg->getId() == DUNE_IMC_ANNOUNCE)
-              {
-                m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
-              }
+            // A datagram may carry several coalesced packets.
+            uint16_t offset = 0;
+            while (offset < rv)
+              offset += handlePacket(bfr + offset, rv - offset, addr);
+          }
+          catch (std::exception & e)
+          {
+            m_task.debug("error while unpacking message: %s",e.what());
+          }
+        }
 
-              if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
-              {
-                delete msg;
-                continue;
-              }
-            }
+        delete [] bfr;
+      }
 
-            m_contacts_lock.lockWrite();
-            m_contacts.update(msg->getSource(), addr);
-            m_contacts_lock.unlock();
+      //! Unpack and dispatch the first packet of a buffer.
+      //! @param[in] bfr buffer.
+      //! @param[in] bfr_len buffer length.
+      //! @param[in] addr address of the sender.
+      //! @return size of the packet.
+      uint16_t
+      handlePacket(const uint8_t* bfr, uint16_t bfr_len, const Address& addr)
+      {
+        IMC::Header hdr;
+        IMC::Packet::deserializeHeader(hdr, bfr, bfr_len);
 
-            m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+        unsigned size = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+        if (size > bfr_len)
+          throw IMC::BufferTooShort();
 
-            if (m_trace)
-              msg->toText(std::cerr);
+        IMC::Message* msg = IMC::Packet::deserializePayload(hdr, bfr, size, NULL);
 
-            delete msg;
+        if (m_lcomms->isActive())
+        {
+          if (msg->getId() == DUNE_IMC_ANNOUNCE)
+          {
+            m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
           }
-          catch (std::exception & e)
+
+          if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
           {
-            m_task.debug("error while unpacking message: %s",e.what());
+            delete msg;
+            return size;
           }
         }
 
-        delete [] bfr;
+        m_contacts_lock.lockWrite();
+        m_contacts.update(msg->getSource(), addr);
+        m_contacts_lock.unlock();
+
+        m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+
+        if (m_trace)
+          msg->toText(std::cerr);
+
+        delete msg;
+        return size;
       }
     };
   }
@@ -37,18 +37,30 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "SharedRing.hpp"
+
 namespace Transports
 {
   namespace UDP
   {
     using DUNE_NAMESPACES;
 
+    //! Maximum age of the heartbeat of a shared memory inbox.
+    static const double c_shm_timeout = 5.0;
+
     class Node
     {
     public:
       Node(const std::string& name, const std::string& services):
         m_name(name),
-        m_active(m_addrs.end())
+        m_active(m_addrs.end()),
+        m_coalesce(false),
+        m_mtu(0),
+        m_latency(0),
+        m_deadline(-1),
+        m_outbox(NULL),
+        m_shm_lost(0)
       {
         // Search for IMC + UDP services.
         std::vector<std::string> list;
@@ -56,6 +68,22 @@ namespace Transports
 
         for (unsigned i = 0; i < list.size(); ++i)
         {
+          // Node is able to unpack coalesced datagrams.
+          if (list[i].compare(0, 19, "imc+udp+coalesce://", 19) == 0)
+          {
+            m_coalesce = true;
+            continue;
+          }
+
+          // Node has a shared memory inbox.
+          if (list[i].compare(0, 10, "imc+shm://", 10) == 0)
+          {
+            char inbox[128] = {0};
+            if (std::sscanf(list[i].c_str(), "imc+shm://%127[^/]", inbox) == 1)
+              m_shm_name = inbox;
+            continue;
+          }
+
           if (list[i].compare(0, 10, "imc+udp://", 10) != 0)
             continue;
 
@@ -71,6 +99,15 @@ namespace Transports
       {
         m_name = node.m_name;
         m_addrs = node.m_addrs;
+        m_coalesce = node.m_coalesce;
+        m_mtu = node.m_mtu;
+        m_latency = node.m_latency;
+        m_deadline = node.m_deadline;
+        m_batch = node.m_batch;
+        m_shm_name = node.m_shm_name;
+        // Shared memory outboxes are not copied.
+        m_outbox = NULL;
+        m_shm_lost = node.m_shm_lost;
 
         if (node.m_active == node.m_addrs.end())
           m_active = m_addrs.end();
@@ -78,6 +115,11 @@ namespace Transports
           m_active = m_addrs.find(node.m_active->first);
       }
 
+      ~Node(void)
+      {
+        detach();
+      }
+
       //! Get node name.
       //! @return node name.
       const std::string&
@@ -132,9 +174,118 @@ namespace Transports
           return false;
 
         m_active = m_addrs.end();
+        m_batch.clear();
+        m_deadline = -1;
         return true;
       }
 
+      //! Open the shared memory inbox of this node, if it has one
+      //! and it is reachable from this host.
+      //! @param[in] id IMC address of this node.
+      //! @param[in] system local IMC address.
+      //! @return true if the inbox was opened, false otherwise.
+      bool
+      attach(unsigned id, unsigned system)
+      {
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        if (m_shm_name.empty() || isLocal())
+          return false;
+
+        detach();
+
+        try
+        {
+          m_outbox = new SharedOutbox(m_shm_name, id, system);
+          return true;
+        }
+        catch (std::exception&)
+        {
+          // Inbox is on another host or is not compatible.
+          detach();
+        }
+#else
+        (void)id;
+        (void)system;
+#endif
+
+        return false;
+      }
+
+      //! Close shared memory inbox.
+      void
+      detach(void)
+      {
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        Memory::clear(m_outbox);
+#endif
+      }
+
+      //! Check if a shared memory inbox of this node is open.
+      //! @return true if inbox is open, false otherwise.
+      bool
+      isAttached(void) const
+      {
+        return m_outbox != NULL;
+      }
+
+      //! Check if this node is reachable through a live shared memory
+      //! inbox.
+      //! @return true if node is reachable, false otherwise.
+      bool
+      isLocal(void) const
+      {
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        return m_outbox != NULL && m_outbox->isAlive(c_shm_timeout);
+#else
+        return false;
+#endif
+      }
+
+      //! Get the number of packets that did not fit the shared
+      //! memory inbox of this node.
+      //! @return number of packets.
+      unsigned
+      getSharedDrops(void) const
+      {
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        if (m_outbox != NULL)
+          return m_outbox->getDrops();
+#endif
+        return 0;
+      }
+
+      //! Get the number of packets that did not fit the shared
+      //! memory inbox of this node and could not be sent over UDP
+      //! either.
+      //! @return number of packets.
+      unsigned
+      getSharedLosses(void) const
+      {
+        return m_shm_lost;
+      }
+
+      //! Check if this node advertised support for coalesced
+      //! datagrams.
+      //! @return true if node accepts coalesced datagrams, false
+      //! otherwise.
+      bool
+      canCoalesce(void) const
+      {
+        return m_coalesce;
+      }
+
+      //! Enable coalescing of outgoing packets. Coalescing is only
+      //! used if this node advertised support for it.
+      //! @param[in] mtu maximum datagram size (0 to disable).
+      //! @param[in] latency maximum time a packet may wait in the
+      //! batch before being sent (s).
+      void
+      setCoalescing(unsigned mtu, double latency)
+      {
+        m_mtu = mtu;
+        m_latency = latency;
+      }
+
       //! Send data to node.
       //! @param[in] sock UDP destination socket.
       //! @param[in] data data to be transmitted.
@@ -142,15 +293,82 @@ namespace Transports
       void
       send(UDPSocket& sock, const uint8_t* data, unsigned data_len)
       {
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        // Fall back to UDP if the inbox is full.
+        if (isLocal())
+        {
+          if (m_outbox->write(data, data_len))
+            return;
+
+          if (m_active == m_addrs.end())
+          {
+            ++m_shm_lost;
+            return;
+          }
+        }
+#endif
+
         if (m_active == m_addrs.end())
           return;
 
-        try
+        if (!m_coalesce || m_mtu == 0)
         {
-          sock.write(data, data_len, m_active->first, m_active->second);
+          write(sock, data, data_len);
+          return;
         }
-        catch (...)
-        { }
+
+        if (m_batch.size() + data_len > m_mtu)
+          flush(sock);
+
+        // Packet doesn't fit a datagram on its own.
+        if (data_len >= m_mtu)
+        {
+          write(sock, data, data_len);
+          return;
+        }
+
+        if (m_batch.empty())
+          m_deadline = Clock::get() + m_latency;
+
+        m_batch.insert(m_batch.end(), data, data + data_len);
+      }
+
+      //! Get the time at which pending coalesced packets must be
+      //! sent.
+      //! @return deadline or -1 if no packets are pending.
+      double
+      getDeadline(void) const
+      {
+        if (m_batch.empty())
+          return -1;
+
+        return m_deadline;
+      }
+
+      //! Send pending coalesced packets if their latency budget
+      //! has expired.
+      //! @param[in] sock UDP destination socket.
+      //! @param[in] now current time.
+      void
+      flush(UDPSocket& sock, double now)
+      {
+        if (m_batch.empty() || now < m_deadline)
+          return;
+
+        flush(sock);
+      }
+
+      //! Send pending coalesced packets.
+      //! @param[in] sock UDP destination socket.
+      void
+      flush(UDPSocket& sock)
+      {
+        if (m_batch.empty())
+          return;
+
+        write(sock, &m_batch[0], m_batch.size());
+        m_batch.clear();
+        m_deadline = -1;
       }
 
     private:
@@ -160,6 +378,44 @@ namespace Transports
       std::map<Address, unsigned> m_addrs;
       // Active address.
       std::map<Address, unsigned>::iterator m_active;
+      // True if node accepts coalesced datagrams.
+      bool m_coalesce;
+      // Maximum coalesced datagram size.
+      unsigned m_mtu;
+      // Maximum time a packet may wait in the batch.
+      double m_latency;
+      // Time at which the current batch must be sent.
+      double m_deadline;
+      // Packets waiting to be sent.
+      std::vector<uint8_t> m_batch;
+      // Name of the shared memory inbox.
+      std::string m_shm_name;
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+      // Shared memory inbox.
+      SharedOutbox* m_outbox;
+#else
+      void* m_outbox;
+#endif
+      // Packets lost because the inbox was full and UDP inactive.
+      unsigned m_shm_lost;
+
+      // Non-assignable.
+      Node&
+      operator=(const Node&);
+
+      void
+      write(UDPSocket& sock, const uint8_t* data, unsigned data_len)
+      {
+        if (m_active == m_addrs.end())
+          return;
+
+        try
+        {
+          sock.write(data, data_len, m_active->first, m_active->second);
+        }
+        catch (...)
+        { }
+      }
     };
   }
 }
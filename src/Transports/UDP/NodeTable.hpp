@@ -51,13 +51,129 @@ namespace Transports
     public:
       NodeTable(void):
         m_active_count(0),
-        m_lcomms(NULL)
+        m_local_count(0),
+        m_lcomms(NULL),
+        m_mtu(0),
+        m_latency(0)
       { }
 
       void
       addNode(unsigned id, const std::string& name, const std::string& services)
       {
-        m_table.insert(std::pair<unsigned, Node>(id, Node(name, services)));
+        Node node(name, services);
+        node.setCoalescing(m_mtu, m_latency);
+        m_table.insert(std::pair<unsigned, Node>(id, node));
+      }
+
+      //! Open the shared memory inbox of a node, if it is reachable
+      //! and not open yet.
+      //! @param[in] id node IMC address.
+      //! @param[in] system local IMC address.
+      //! @return true if the inbox was opened, false otherwise.
+      bool
+      attach(unsigned id, unsigned system)
+      {
+        Table::iterator itr = m_table.find(id);
+        if (itr == m_table.end())
+          return false;
+
+        bool attached = itr->second.isAttached();
+        bool rv = itr->second.attach(id, system);
+
+        if (attached && !itr->second.isAttached())
+          --m_local_count;
+        else if (!attached && itr->second.isAttached())
+          ++m_local_count;
+
+        return rv;
+      }
+
+      //! Get the number of nodes with an open shared memory inbox.
+      //! @return number of nodes.
+      unsigned
+      getLocalCount(void)
+      {
+        return m_local_count;
+      }
+
+      //! Configure coalescing of outgoing packets for nodes that
+      //! support it.
+      //! @param[in] mtu maximum datagram size (0 to disable).
+      //! @param[in] latency maximum batching delay (s).
+      void
+      setCoalescing(unsigned mtu, double latency)
+      {
+        m_mtu = mtu;
+        m_latency = latency;
+
+        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+          itr->second.setCoalescing(mtu, latency);
+      }
+
+      //! Send coalesced packets whose latency budget has expired.
+      //! @param[in] sock UDP destination socket.
+      void
+      flush(UDPSocket& sock)
+      {
+        double now = Clock::get();
+
+        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+          itr->second.flush(sock, now);
+      }
+
+      //! Get the earliest time at which pending coalesced packets
+      //! must be sent.
+      //! @return deadline or -1 if no packets are pending.
+      double
+      getDeadline(void) const
+      {
+        double deadline = -1;
+
+        for (Table::const_iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+        {
+          double node_deadline = itr->second.getDeadline();
+          if (node_deadline < 0)
+            continue;
+
+          if (deadline < 0 || node_deadline < deadline)
+            deadline = node_deadline;
+        }
+
+        return deadline;
+      }
+
+      //! Get the number of packets that did not fit the shared
+      //! memory inboxes of local nodes.
+      //! @return number of packets.
+      unsigned
+      getSharedDrops(void) const
+      {
+        unsigned drops = 0;
+        for (Table::const_iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+          drops += itr->second.getSharedDrops();
+        return drops;
+      }
+
+      //! Get the number of packets that did not fit the shared
+      //! memory inboxes of local nodes and could not be sent over
+      //! UDP either.
+      //! @return number of packets.
+      unsigned
+      getSharedLosses(void) const
+      {
+        unsigned lost = 0;
+        for (Table::const_iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+          lost += itr->second.getSharedLosses();
+        return lost;
+      }
+
+      //! Send all pending coalesced packets.
+      //! @param[in] sock UDP destination socket.
+      void
+      flushAll(UDPSocket& sock)
+      {
+        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+          itr->second.flush(sock);
       }
 
       bool
@@ -125,10 +241,16 @@ namespace Transports
       typedef std::map<unsigned, Node> Table;
       // Number of active nodes.
       unsigned m_active_count;
+      // Number of nodes with a shared memory inbox.
+      unsigned m_local_count;
       // Node table.
       Table m_table;
       // Limited Comms object
       LimitedComms* m_lcomms;
+      // Maximum coalesced datagram size.
+      unsigned m_mtu;
+      // Maximum batching delay.
+      double m_latency;
     };
   }
 }
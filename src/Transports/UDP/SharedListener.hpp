@@ -0,0 +1,137 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef TRANSPORTS_UDP_SHARED_LISTENER_HPP_INCLUDED_
+#define TRANSPORTS_UDP_SHARED_LISTENER_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "LimitedComms.hpp"
+#include "SharedRing.hpp"
+
+namespace Transports
+{
+  namespace UDP
+  {
+    using DUNE_NAMESPACES;
+
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+    //! Thread that dispatches packets written to the shared memory
+    //! inbox by other instances running on the same host.
+    class SharedListener: public Concurrency::Thread
+    {
+    public:
+      SharedListener(Tasks::Task& task, SharedInbox& inbox, LimitedComms* lcomms,
+                     bool trace = false):
+        m_task(task),
+        m_inbox(inbox),
+        m_trace(trace),
+        m_lcomms(lcomms),
+        m_errors(0)
+      {  }
+
+    private:
+      // Wait timeout in milliseconds.
+      static const int c_wait_tout = 1000;
+      // Parent task.
+      Tasks::Task& m_task;
+      // Shared memory inbox.
+      SharedInbox& m_inbox;
+      // True to print incoming messages.
+      bool m_trace;
+      // LimitedComms object
+      LimitedComms* m_lcomms;
+      // Last reported number of corrupted rings.
+      unsigned m_errors;
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          m_inbox.touch();
+          m_inbox.wait(c_wait_tout / 1000.0);
+
+          uint32_t size = 0;
+          const uint8_t* bfr = NULL;
+          while ((bfr = m_inbox.next(size)) != NULL)
+          {
+            try
+            {
+              handlePacket(bfr, size);
+            }
+            catch (std::exception& e)
+            {
+              m_task.debug("error while unpacking message: %s", e.what());
+            }
+
+            m_inbox.release();
+          }
+
+          if (m_inbox.getErrors() != m_errors)
+          {
+            m_errors = m_inbox.getErrors();
+            m_task.war(DTR("discarded %u corrupted shared memory rings"), m_errors);
+          }
+        }
+      }
+
+      //! Unpack and dispatch a packet.
+      //! @param[in] bfr buffer.
+      //! @param[in] bfr_len buffer length.
+      void
+      handlePacket(const uint8_t* bfr, uint32_t bfr_len)
+      {
+        IMC::Message* msg = IMC::Packet::deserialize(bfr, (uint16_t)bfr_len);
+
+        if (m_lcomms->isActive())
+        {
+          if (msg->getId() == DUNE_IMC_ANNOUNCE)
+            m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
+
+          if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
+          {
+            delete msg;
+            return;
+          }
+        }
+
+        m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+
+        if (m_trace)
+          msg->toText(std::cerr);
+
+        delete msg;
+      }
+    };
+#endif
+  }
+}
+
+#endif
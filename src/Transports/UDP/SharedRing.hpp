@@ -0,0 +1,442 @@
+//***************************************************************************
+// Copyright 2007-2016 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Universidade do Porto. For licensing   *
+// terms, conditions, and further information contact lsts@fe.up.pt.        *
+//                                                                          *
+// European Union Public Licence - EUPL v.1.1 Usage                         *
+// Alternatively, this file may be used under the terms of the EUPL,        *
+// Version 1.1 only (the "Licence"), appearing in the file LICENCE.md       *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: agent                                                            *
+//***************************************************************************
+
+#ifndef TRANSPORTS_UDP_SHARED_RING_HPP_INCLUDED_
+#define TRANSPORTS_UDP_SHARED_RING_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Linux headers.
+#if defined(DUNE_SYS_HAS_LINUX_FUTEX_H) && defined(DUNE_SYS_HAS_SYS_SYSCALL_H)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <ctime>
+#  define TRANSPORTS_UDP_SHARED_RING_FUTEX
+#endif
+
+// Shared memory inboxes require POSIX shared memory and GCC atomics.
+#if defined(DUNE_SYS_HAS_SHM_OPEN) && defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH)
+#  define TRANSPORTS_UDP_SHARED_RING
+#endif
+
+namespace Transports
+{
+  namespace UDP
+  {
+    using DUNE_NAMESPACES;
+
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+    //! Shared memory inboxes allow DUNE instances running on the same
+    //! host to exchange serialized IMC packets without sockets. Each
+    //! instance owns one inbox divided in slots, each slot holding a
+    //! single-producer/single-consumer ring claimed by one peer.
+    //! Packets are stored contiguously in the rings, so writers copy
+    //! each packet once and the reader deserializes it in place.
+
+    //! Inbox magic number.
+    static const uint32_t c_shm_magic = 0x53434d49;
+    //! Number of slots (peers) per inbox.
+    static const unsigned c_shm_slots = 16;
+    //! Size of each ring in bytes (power of two).
+    static const uint32_t c_shm_ring_size = 256 * 1024;
+    //! Marker for unused space at the end of a ring.
+    static const uint32_t c_shm_wrap = 0xffffffff;
+
+    //! Inbox header.
+    struct ShmHeader
+    {
+      //! Magic number.
+      uint32_t magic;
+      //! IMC address of the owner.
+      uint32_t system;
+      //! Ring size.
+      uint32_t ring_size;
+      //! Number of slots.
+      uint32_t slots;
+      //! Monotonic time of the last owner heartbeat (s).
+      volatile uint32_t alive;
+      //! Incremented by writers for every packet.
+      volatile uint32_t seq;
+      //! True if the owner is waiting for packets.
+      volatile uint32_t waiting;
+      //! Padding to a cache line.
+      uint8_t padding[36];
+    };
+
+    //! Slot header.
+    struct ShmSlot
+    {
+      //! IMC address of the writer plus one, zero if unclaimed.
+      volatile uint32_t owner;
+      //! Write position, only modified by the writer.
+      volatile uint32_t head;
+      //! Padding to a cache line.
+      uint8_t padding0[56];
+      //! Read position, only modified by the reader.
+      volatile uint32_t tail;
+      //! Padding to a cache line.
+      uint8_t padding1[60];
+    };
+
+    //! Total size of an inbox.
+    static const unsigned c_shm_size = sizeof(ShmHeader) + c_shm_slots * (sizeof(ShmSlot) + c_shm_ring_size);
+
+    //! Get the name of the inbox of a given UDP port.
+    //! @param[in] port UDP port of the inbox owner.
+    //! @return inbox name.
+    inline std::string
+    getInboxName(unsigned port)
+    {
+      return String::str("imc-udp-%u", port);
+    }
+
+    //! Get a pointer to a slot header.
+    inline ShmSlot*
+    getSlot(ShmHeader* hdr, unsigned index)
+    {
+      uint8_t* base = (uint8_t*)hdr + sizeof(ShmHeader);
+      return (ShmSlot*)(base + index * sizeof(ShmSlot));
+    }
+
+    //! Get a pointer to the ring of a slot.
+    inline uint8_t*
+    getRing(ShmHeader* hdr, unsigned index)
+    {
+      uint8_t* base = (uint8_t*)hdr + sizeof(ShmHeader) + c_shm_slots * sizeof(ShmSlot);
+      return base + index * c_shm_ring_size;
+    }
+
+    //! Inbox of the local instance.
+    class SharedInbox
+    {
+    public:
+      //! Create inbox.
+      //! @param[in] name inbox name.
+      //! @param[in] system local IMC address.
+      SharedInbox(const std::string& name, unsigned system):
+        m_shm(name.c_str(), c_shm_size),
+        m_next(0),
+        m_slot(NULL),
+        m_length(0),
+        m_errors(0)
+      {
+        m_shm.create();
+        m_hdr = (ShmHeader*)*m_shm;
+        std::memset(m_hdr, 0, c_shm_size);
+        m_hdr->system = system;
+        m_hdr->ring_size = c_shm_ring_size;
+        m_hdr->slots = c_shm_slots;
+        touch();
+        __sync_synchronize();
+        m_hdr->magic = c_shm_magic;
+      }
+
+      //! Refresh the heartbeat of the inbox.
+      void
+      touch(void)
+      {
+        m_hdr->alive = (uint32_t)Clock::get();
+      }
+
+      //! Get the next pending packet. The packet must be released
+      //! before retrieving the next one.
+      //! @param[out] size packet size.
+      //! @return pointer to packet or NULL if there are no pending
+      //! packets.
+      const uint8_t*
+      next(uint32_t& size)
+      {
+        for (unsigned i = 0; i < c_shm_slots; ++i)
+        {
+          unsigned index = (m_next + i) % c_shm_slots;
+          ShmSlot* slot = getSlot(m_hdr, index);
+          uint8_t* ring = getRing(m_hdr, index);
+
+          while (slot->tail != slot->head)
+          {
+            __sync_synchronize();
+
+            uint32_t offset = slot->tail & (c_shm_ring_size - 1);
+            uint32_t available = slot->head - slot->tail;
+            uint32_t len;
+            std::memcpy(&len, ring + offset, sizeof(len));
+
+            if (len == c_shm_wrap)
+            {
+              if (available < c_shm_ring_size - offset)
+              {
+                discard(slot);
+                break;
+              }
+
+              release(slot, c_shm_ring_size - offset);
+              continue;
+            }
+
+            // Records must lie within the written part of the ring
+            // and never wrap around its end.
+            if (len > c_shm_ring_size || getRecordSize(len) > available
+                || offset + getRecordSize(len) > c_shm_ring_size)
+            {
+              discard(slot);
+              break;
+            }
+
+            m_slot = slot;
+            m_length = getRecordSize(len);
+            m_next = (index + 1) % c_shm_slots;
+            size = len;
+            return ring + offset + sizeof(len);
+          }
+        }
+
+        return NULL;
+      }
+
+      //! Release the last packet returned by next().
+      void
+      release(void)
+      {
+        release(m_slot, m_length);
+      }
+
+      //! Wait for packets.
+      //! @param[in] timeout maximum amount of time to wait (s).
+      void
+      wait(double timeout)
+      {
+        uint32_t seq = m_hdr->seq;
+        __sync_synchronize();
+
+        uint32_t size = 0;
+        if (next(size) != NULL)
+          return;
+
+        m_hdr->waiting = 1;
+        __sync_synchronize();
+
+#if defined(TRANSPORTS_UDP_SHARED_RING_FUTEX)
+        struct timespec ts;
+        ts.tv_sec = (time_t)timeout;
+        ts.tv_nsec = (long)((timeout - ts.tv_sec) * 1e9);
+        syscall(SYS_futex, &m_hdr->seq, FUTEX_WAIT, seq, &ts, NULL, 0);
+#else
+        // Without futexes we poll for a bounded latency.
+        double deadline = Clock::get() + timeout;
+        while (m_hdr->seq == seq && Clock::get() < deadline)
+          Delay::wait(0.001);
+#endif
+
+        m_hdr->waiting = 0;
+      }
+
+      //! Get the number of times a ring was discarded because it
+      //! held an invalid record.
+      //! @return number of discarded rings.
+      unsigned
+      getErrors(void) const
+      {
+        return m_errors;
+      }
+
+      //! Get the size of a record in the ring.
+      //! @param[in] len packet size.
+      //! @return record size.
+      static uint32_t
+      getRecordSize(uint32_t len)
+      {
+        return (sizeof(uint32_t) + len + 3) & ~3u;
+      }
+
+    private:
+      //! Shared memory area.
+      SharedMemory m_shm;
+      //! Inbox header.
+      ShmHeader* m_hdr;
+      //! Next slot to be read.
+      unsigned m_next;
+      //! Slot of the last packet.
+      ShmSlot* m_slot;
+      //! Record size of the last packet.
+      uint32_t m_length;
+      //! Number of corrupted rings.
+      unsigned m_errors;
+
+      void
+      release(ShmSlot* slot, uint32_t length)
+      {
+        __sync_synchronize();
+        slot->tail = slot->tail + length;
+      }
+
+      //! Drop the contents of a corrupted ring.
+      void
+      discard(ShmSlot* slot)
+      {
+        ++m_errors;
+        __sync_synchronize();
+        slot->tail = slot->head;
+      }
+    };
+
+    //! Writer to the inbox of a peer.
+    class SharedOutbox
+    {
+    public:
+      //! Open the inbox of a peer and claim a slot.
+      //! @param[in] name inbox name.
+      //! @param[in] peer IMC address of the inbox owner.
+      //! @param[in] system local IMC address.
+      //! @throw std::runtime_error if the inbox cannot be used.
+      SharedOutbox(const std::string& name, unsigned peer, unsigned system):
+        m_shm(name.c_str(), c_shm_size),
+        m_slot(NULL),
+        m_drops(0)
+      {
+        m_shm.open();
+        m_hdr = (ShmHeader*)*m_shm;
+
+        if (m_hdr->magic != c_shm_magic || m_hdr->system != peer
+            || m_hdr->ring_size != c_shm_ring_size || m_hdr->slots != c_shm_slots)
+          throw std::runtime_error("incompatible shared memory inbox");
+
+        uint32_t owner = system + 1;
+        for (unsigned i = 0; i < c_shm_slots; ++i)
+        {
+          ShmSlot* slot = getSlot(m_hdr, i);
+          if (slot->owner == owner || __sync_bool_compare_and_swap(&slot->owner, 0, owner))
+          {
+            m_slot = slot;
+            m_ring = getRing(m_hdr, i);
+            break;
+          }
+        }
+
+        if (m_slot == NULL)
+          throw std::runtime_error("no free shared memory slots");
+      }
+
+      //! Release slot.
+      ~SharedOutbox(void)
+      {
+        m_slot->owner = 0;
+      }
+
+      //! Check if the inbox owner is alive.
+      //! @param[in] timeout maximum heartbeat age (s).
+      //! @return true if owner is alive, false otherwise.
+      bool
+      isAlive(double timeout) const
+      {
+        return (uint32_t)Clock::get() - m_hdr->alive <= (uint32_t)timeout;
+      }
+
+      //! Get number of packets dropped because the ring was full.
+      //! @return number of dropped packets.
+      unsigned
+      getDrops(void) const
+      {
+        return m_drops;
+      }
+
+      //! Write a packet.
+      //! @param[in] data packet.
+      //! @param[in] size packet size.
+      //! @return true if packet was written, false if the ring is
+      //! full.
+      bool
+      write(const uint8_t* data, uint32_t size)
+      {
+        uint32_t length = SharedInbox::getRecordSize(size);
+        uint32_t head = m_slot->head;
+        uint32_t offset = head & (c_shm_ring_size - 1);
+        uint32_t contiguous = c_shm_ring_size - offset;
+        uint32_t required = length;
+
+        // Records never wrap around the end of the ring.
+        if (contiguous < length)
+          required += contiguous;
+
+        if (c_shm_ring_size - (head - m_slot->tail) < required)
+        {
+          ++m_drops;
+          return false;
+        }
+
+        if (contiguous < length)
+        {
+          std::memcpy(m_ring + offset, &c_shm_wrap, sizeof(c_shm_wrap));
+          head += contiguous;
+          offset = 0;
+        }
+
+        std::memcpy(m_ring + offset, &size, sizeof(size));
+        std::memcpy(m_ring + offset + sizeof(size), data, size);
+
+        __sync_synchronize();
+        m_slot->head = head + length;
+
+        // Wake up reader.
+        __sync_add_and_fetch(&m_hdr->seq, 1);
+
+#if defined(TRANSPORTS_UDP_SHARED_RING_FUTEX)
+        if (m_hdr->waiting)
+          syscall(SYS_futex, &m_hdr->seq, FUTEX_WAKE, 1, NULL, NULL, 0);
+#endif
+
+        return true;
+      }
+
+    private:
+      //! Shared memory area.
+      SharedMemory m_shm;
+      //! Inbox header.
+      ShmHeader* m_hdr;
+      //! Claimed slot.
+      ShmSlot* m_slot;
+      //! Ring of the claimed slot.
+      uint8_t* m_ring;
+      //! Number of dropped packets.
+      unsigned m_drops;
+
+      // Non-copyable.
+      SharedOutbox(const SharedOutbox&);
+
+      SharedOutbox&
+      operator=(const SharedOutbox&);
+    };
+#endif
+  }
+}
+
+#endif
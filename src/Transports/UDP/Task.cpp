@@ -40,6 +40,8 @@
 #include "NodeTable.hpp"
 #include "Listener.hpp"
 #include "LimitedComms.hpp"
+#include "SharedRing.hpp"
+#include "SharedListener.hpp"
 
 namespace Transports
 {
@@ -80,6 +82,14 @@ namespace Transports
       bool dynamic_nodes;
       // Only transmit messages from local system
       bool only_local;
+      // Coalesce outgoing packets.
+      bool coalescing;
+      // Maximum size of coalesced datagrams.
+      unsigned coalescing_mtu;
+      // Maximum time a packet may wait to be coalesced.
+      unsigned coalescing_latency;
+      // Exchange packets with local nodes using shared memory.
+      bool shared_memory;
     };
 
     // Internal buffer size.
@@ -111,6 +121,18 @@ namespace Transports
       LimitedComms* m_lcomms;
       //! Message Filter
       MessageFilter m_filter;
+      //! Messages to transport when carried by frame descriptors.
+      Tasks::FilterTable m_frame_carriers;
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+      //! Shared memory inbox.
+      SharedInbox* m_inbox;
+      //! Shared memory listener thread.
+      SharedListener* m_shm_listener;
+      //! Last reported number of packets that did not fit inboxes.
+      unsigned m_shm_drops;
+      //! Last reported number of packets lost with full inboxes.
+      unsigned m_shm_lost;
+#endif
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
@@ -118,6 +140,13 @@ namespace Transports
         m_listener(NULL),
         m_lcomms(NULL)
       {
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        m_inbox = NULL;
+        m_shm_listener = NULL;
+        m_shm_drops = 0;
+        m_shm_lost = 0;
+#endif
+
         param("Local Port", m_args.port)
         .defaultValue("6002")
         .description("Local UDP port to listen on");
@@ -142,7 +171,7 @@ namespace Transports
         .description("List of <IPv4>:<Port> destinations that will always receive outgoing messages");
 
         param("Rate Limiters", m_args.rate_lims)
-        .description("List of <Message>:<Frequency>");
+        .description("List of <Message>:<Frequency>[:<Burst>]");
 
         param("Filtered Entities", m_args.entities_flt)
         .description("List of <Message>:<Entity>+<Entity> that define the source entities allowed to pass message of a specific message type.");
@@ -176,11 +205,36 @@ namespace Transports
         .defaultValue("false")
         .description("Only transmit messsages from local system.");
 
+        param("Coalescing", m_args.coalescing)
+        .defaultValue("false")
+        .description("Pack multiple packets in a single datagram when sending"
+                     " to nodes that advertise support for it");
+
+        param("Coalescing MTU", m_args.coalescing_mtu)
+        .units(Units::Byte)
+        .defaultValue("1400")
+        .minimumValue("64")
+        .maximumValue("65000")
+        .description("Maximum size of a coalesced datagram");
+
+        param("Coalescing Latency", m_args.coalescing_latency)
+        .units(Units::Millisecond)
+        .defaultValue("5")
+        .minimumValue("1")
+        .maximumValue("1000")
+        .description("Maximum time a packet may wait to be coalesced");
+
+        param("Shared Memory", m_args.shared_memory)
+        .defaultValue("false")
+        .description("Exchange packets with nodes running on the same host"
+                     " through shared memory instead of sockets");
+
         // Allocate space for internal buffer.
         m_bfr = new uint8_t[c_bfr_size];
 
         // Register listeners.
         bind<IMC::Announce>(this);
+        bind<Media::FrameDescriptor>(this);
       }
 
       ~Task(void)
@@ -222,8 +276,23 @@ namespace Transports
           m_comm_limitations = false;
         }
 
+        if (m_args.coalescing)
+          m_node_table.setCoalescing(m_args.coalescing_mtu, m_args.coalescing_latency / 1000.0);
+        else
+          m_node_table.setCoalescing(0, 0);
+
         // Register normal messages.
         bind(this, m_args.messages);
+
+        std::set<uint32_t> ids;
+        for (unsigned i = 0; i < m_args.messages.size(); ++i)
+          ids.insert(IMC::Factory::getIdFromAbbrev(m_args.messages[i]));
+
+        std::set<uint32_t> any;
+        any.insert(Tasks::FilterTable::c_any);
+
+        m_frame_carriers.clear();
+        m_frame_carriers.add(ids, any, any);
       }
 
       void
@@ -271,6 +340,13 @@ namespace Transports
               announce.service_type = IMC::AnnounceService::SRV_TYPE_EXTERNAL;
 
             dispatch(announce);
+
+            // Tell peers we are able to unpack coalesced datagrams.
+            if (m_args.coalescing)
+            {
+              announce.service = "imc+udp+coalesce" + os.str().substr(7);
+              dispatch(announce);
+            }
           }
         }
 
@@ -284,12 +360,48 @@ namespace Transports
                                   m_args.contact_timeout, m_args.trace_in);
         m_listener->start();
 
+        if (m_args.shared_memory)
+          createInbox();
+
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
+      //! Create the shared memory inbox and announce it.
+      void
+      createInbox(void)
+      {
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        std::string name = getInboxName(m_args.port);
+
+        try
+        {
+          m_inbox = new SharedInbox(name, getSystemId());
+        }
+        catch (std::runtime_error& e)
+        {
+          war(DTR("failed to create shared memory inbox: %s"), e.what());
+          return;
+        }
+
+        m_shm_listener = new SharedListener(*this, *m_inbox, m_lcomms, m_args.trace_in);
+        m_shm_listener->start();
+
+        IMC::AnnounceService announce;
+        announce.service = "imc+shm://" + name + "/";
+        announce.service_type = IMC::AnnounceService::SRV_TYPE_LOCAL;
+        dispatch(announce);
+
+        inf(DTR("shared memory inbox '%s'"), name.c_str());
+#else
+        war(DTR("shared memory is not supported on this system"));
+#endif
+      }
+
       void
       onResourceRelease(void)
       {
+        m_node_table.flushAll(m_sock);
+
         if (m_listener != NULL)
         {
           m_listener->stopAndJoin();
@@ -297,6 +409,17 @@ namespace Transports
           m_listener = NULL;
         }
 
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        if (m_shm_listener != NULL)
+        {
+          m_shm_listener->stopAndJoin();
+          delete m_shm_listener;
+          m_shm_listener = NULL;
+        }
+
+        Memory::clear(m_inbox);
+#endif
+
         Memory::clear(m_lcomms);
       }
 
@@ -312,7 +435,8 @@ namespace Transports
         if (m_args.only_local && msg->getSource() != this->getSystemId())
           return;
 
-        if (m_node_table.getActiveCount() == 0 && m_static_dsts.size() == 0)
+        if (m_node_table.getActiveCount() == 0 && m_node_table.getLocalCount() == 0
+            && m_static_dsts.size() == 0)
           return;
 
         if (m_filter.filter(msg))
@@ -342,6 +466,34 @@ namespace Transports
         }
       }
 
+      void
+      consume(const Media::FrameDescriptor* msg)
+      {
+        if (msg->getCarrier() == NULL || msg->getFrame() == NULL)
+          return;
+
+        if (!m_frame_carriers.applies(msg->getCarrier()->getId()))
+          return;
+
+        // Frames are transported as the message they replace.
+        IMC::Message* carrier = NULL;
+        try
+        {
+          carrier = msg->expand();
+        }
+        catch (std::exception& e)
+        {
+          err(DTR("failed to expand frame: %s"), e.what());
+          return;
+        }
+
+        if (carrier != NULL)
+        {
+          consume(carrier);
+          delete carrier;
+        }
+      }
+
       void
       consume(const IMC::Announce* msg)
       {
@@ -356,6 +508,13 @@ namespace Transports
 
         m_node_table.addNode(msg->getSource(), msg->sys_name, msg->services);
         m_lcomms->setAnnounce(msg);
+
+        // Use the shared memory inbox of nodes on the same host.
+        if (m_args.shared_memory && msg->getSource() != getSystemId())
+        {
+          if (m_node_table.attach(msg->getSource(), getSystemId()))
+            inf(DTR("using shared memory to reach node '%s'"), msg->sys_name.c_str());
+        }
       }
 
       void
@@ -386,17 +545,52 @@ namespace Transports
         m_listener->unlockContacts();
       }
 
+      void
+      reportSharedDrops(void)
+      {
+#if defined(TRANSPORTS_UDP_SHARED_RING)
+        unsigned drops = m_node_table.getSharedDrops();
+        if (drops != m_shm_drops)
+        {
+          debug("%u packets did not fit shared memory inboxes", drops);
+          m_shm_drops = drops;
+        }
+
+        unsigned lost = m_node_table.getSharedLosses();
+        if (lost != m_shm_lost)
+        {
+          war(DTR("%u packets did not fit shared memory inboxes and were dropped"), lost);
+          m_shm_lost = lost;
+        }
+#endif
+      }
+
       void
       onMain(void)
       {
         while (!stopping())
         {
-          waitForMessages(1.0);
+          // Sleep until a message arrives or the oldest coalesced
+          // packet runs out of latency budget. Expired batches are
+          // flushed without waiting, since a zero timeout blocks.
+          double timeout = 1.0;
+          double deadline = m_node_table.getDeadline();
+          if (deadline >= 0)
+            timeout = deadline - Clock::get();
+
+          if (timeout > 0)
+            waitForMessages(timeout);
+          else
+            consumeMessages();
+
+          if (m_args.coalescing)
+            m_node_table.flush(m_sock);
 
           // Check if it's time to update the contact list.
           if (m_contacts_refresh_counter.overflow())
           {
             refreshContacts();
+            reportSharedDrops();
             m_contacts_refresh_counter.reset();
           }
         }